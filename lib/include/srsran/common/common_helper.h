@@ -27,6 +27,7 @@
 #ifndef SRSRAN_COMMON_HELPER_H
 #define SRSRAN_COMMON_HELPER_H
 
+#include "srsran/phy/utils/vector_simd.h"
 #include "srsran/srslog/srslog.h"
 #include <fstream>
 #include <sstream>
@@ -44,11 +45,13 @@ inline void log_args(int argc, char* argv[], const std::string& service)
 
   srslog::fetch_basic_logger(service, false).set_level(srslog::basic_levels::info);
   srslog::fetch_basic_logger(service).info("%s", s1.str().c_str());
+  srslog::fetch_basic_logger(service).info("Using %s SIMD vector kernels",
+                                           srsran_simd_isa_to_str(srsran_vec_simd_isa()));
 }
 
 inline void check_scaling_governor(const std::string& device_name)
 {
-  if (device_name == "zmq") {
+  if (device_name == "zmq" || device_name == "shm") {
     return;
   }
   int nof_cpus = std::thread::hardware_concurrency();
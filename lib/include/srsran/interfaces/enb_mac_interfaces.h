@@ -35,6 +35,8 @@ struct mac_args_t {
   uint32_t                      nof_prealloc_ues; ///< Number of UE resources to pre-allocate at eNB startup
   uint32_t                      max_nof_kos;
   int                           rlf_min_ul_snr_estim;
+  uint32_t                      ul_softbuffer_pool_cbs; ///< UL code block softbuffers shared by all UEs, 0 for per UE
+  bool                          ul_softbuffer_8bit;     ///< UL softbuffers store 8-bit LLR for the 8-bit decoder
 };
 
 /* Interface PHY -> MAC */
@@ -46,6 +46,12 @@
 #include "srsran/phy/phch/pusch_cfg.h"
 #include "srsran/phy/resampling/interp.h"
 
+/* Maximum number of PUCCH DMRS resource elements in a subframe */
+#define SRSRAN_CHEST_UL_PUCCH_MAX_REFS (SRSRAN_NOF_SLOTS_PER_SF * 3 * SRSRAN_NRE)
+
+/* Maximum number of PUCCH PRB pairs whose base sequence estimates are shared within a batch */
+#define SRSRAN_CHEST_UL_PUCCH_MAX_BASE SRSRAN_MAX_PRB
+
 typedef struct SRSRAN_API {
   cf_t*    ce;
   uint32_t nof_re;
@@ -77,6 +83,11 @@ typedef struct {
   cf_t* pilot_known_signal;
   cf_t* tmp_noise;
 
+  // Received PUCCH DMRS times the conjugated base sequence, one entry per PRB pair in the current batch
+  cf_t*    pucch_base_ls;
+  uint32_t pucch_base_ls_key[SRSRAN_CHEST_UL_PUCCH_MAX_BASE];
+  uint32_t pucch_base_ls_count;
+
 #ifdef FREQ_SEL_SNR
   float snr_vector[12000];
   float pilot_power[12000];
@@ -117,6 +128,29 @@ SRSRAN_API int srsran_chest_ul_estimate_pucch(srsran_chest_ul_t*     q,
                                               cf_t*                  input,
                                               srsran_chest_ul_res_t* res);
 
+/**
+ * Estimates the channel of all the PUSCH transmissions of a subframe, the result of each transmission is written in the
+ * result with the same index. The Least-squares estimates are computed straight from the resource grid.
+ */
+SRSRAN_API int srsran_chest_ul_estimate_pusch_batch(srsran_chest_ul_t*      q,
+                                                    srsran_ul_sf_cfg_t*     sf,
+                                                    srsran_pusch_cfg_t**    cfg,
+                                                    cf_t*                   input,
+                                                    srsran_chest_ul_res_t** res,
+                                                    uint32_t                nof_pusch);
+
+/**
+ * Estimates the channel of all the PUCCH resources of a subframe, the result of each resource is written in the result
+ * with the same index. The received DMRS are de-rotated by the cell base sequence once for all the resources in the
+ * same PRB pair, each resource only removes its own cyclic shift and orthogonal sequence.
+ */
+SRSRAN_API int srsran_chest_ul_estimate_pucch_batch(srsran_chest_ul_t*      q,
+                                                    srsran_ul_sf_cfg_t*     sf,
+                                                    srsran_pucch_cfg_t**    cfg,
+                                                    cf_t*                   input,
+                                                    srsran_chest_ul_res_t** res,
+                                                    uint32_t                nof_pucch);
+
 SRSRAN_API int srsran_chest_ul_estimate_srs(srsran_chest_ul_t*                 q,
                                             srsran_ul_sf_cfg_t*                sf,
                                             srsran_refsignal_srs_cfg_t*        cfg,
@@ -79,6 +79,8 @@ typedef struct SRSRAN_API {
   uint32_t f_gh[SRSRAN_NSLOTS_X_FRAME];
   uint32_t u_pucch[SRSRAN_NSLOTS_X_FRAME];
   uint32_t v_pusch[SRSRAN_NSLOTS_X_FRAME][SRSRAN_NOF_DELTA_SS];
+  cf_t     r_uv_pucch[2][SRSRAN_NSLOTS_X_FRAME][SRSRAN_NRE]; // PUCCH DMRS base sequences, [1] with group hopping
+  cf_t     cs_pucch[SRSRAN_NRE][SRSRAN_NRE];                 // Cyclic shift phasors exp(j*2*pi*n_cs*n/12)
 } srsran_refsignal_ul_t;
 
 typedef struct {
@@ -133,6 +135,15 @@ SRSRAN_API int srsran_refsignal_dmrs_pucch_gen(srsran_refsignal_ul_t* q,
                                                srsran_pucch_cfg_t*    cfg,
                                                cf_t*                  r_pucch);
 
+/* Computes the cyclic shift n_cs and the weight z of the m-th PUCCH DMRS in slot ns. The DMRS is the product of the
+ * slot base sequence r_uv_pucch, the cyclic shift phasor cs_pucch[n_cs] and z */
+SRSRAN_API int srsran_refsignal_dmrs_pucch_cs(srsran_refsignal_ul_t* q,
+                                              srsran_pucch_cfg_t*    cfg,
+                                              uint32_t               ns,
+                                              uint32_t               m,
+                                              uint32_t*              n_cs,
+                                              cf_t*                  z);
+
 SRSRAN_API int
 srsran_refsignal_dmrs_pucch_put(srsran_refsignal_ul_t* q, srsran_pucch_cfg_t* cfg, cf_t* r_pucch, cf_t* output);
 
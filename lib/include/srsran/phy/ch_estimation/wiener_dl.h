@@ -48,6 +48,10 @@ typedef struct {
   float    invtpilotoff; // step for time domain linear interpolation
   cf_t*    timefifo;     // fifo for storing single frequency channel time domain evolution
   cf_t*    cxfifo[SRSRAN_WIENER_DL_CXFIFO_SIZE]; // fifo for averaging time domain channel correlation vector
+  cf_t     cxsum[SRSRAN_WIENER_DL_TIMEFIFO_SIZE];  // running sum of the time domain correlation fifo
+  cf_t     xsum[SRSRAN_WIENER_DL_MIN_RE];          // running sum of the frequency correlation fifo
+  uint32_t cxcnt;  // vectors added to cxsum since it was last recomputed
+  uint32_t xcnt;   // vectors added to xsum since it was last recomputed
   uint32_t sumlen; // length of dynamic average window for time domain channel correlation vector
   uint32_t skip;   // pilot OFDM symbols to skip when training Wiener matrices (skip = 1,..,4)
   uint32_t cnt;    // counter for skipping pilot OFDM symbols
@@ -71,9 +75,8 @@ typedef struct {
   // One state per possible channel (allocated in init)
   srsran_wiener_dl_state_t* state[SRSRAN_MAX_PORTS][SRSRAN_MAX_PORTS];
 
-  // Wiener matrices
-  cf_t wm1[SRSRAN_WIENER_DL_MIN_RE][SRSRAN_WIENER_DL_MIN_REF];
-  cf_t wm2[SRSRAN_WIENER_DL_MIN_RE][SRSRAN_WIENER_DL_MIN_REF];
+  // Wiener matrices for the two pilot subcarrier offsets (0-2 and 3-5), transposed so the filter runs along the REs
+  cf_t wm[2][SRSRAN_WIENER_DL_MIN_REF][SRSRAN_WIENER_DL_MIN_RE];
   bool wm_computed;
   bool ready;
 
@@ -29,8 +29,12 @@
 #include "rlf.h"
 #include "srsran/phy/common/phy_common.h"
 #include "srsran/srslog/srslog.h"
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace srsran {
 
@@ -41,6 +45,10 @@ public:
     // General
     bool enable = false;
 
+    // Number of threads processing the channels in parallel, including the caller thread. Values lower than 2 process
+    // all the channels in the caller thread
+    uint32_t nof_threads = 1;
+
     // AWGN options
     bool  awgn_enable            = false;
     float awgn_signal_power_dBfs = 0.0f;
@@ -77,17 +85,34 @@ public:
 
 private:
   srslog::basic_logger&    logger;
-  float                    hst_init_phase              = 0.0f;
-  srsran_channel_fading_t* fading[SRSRAN_MAX_CHANNELS] = {};
-  srsran_channel_delay_t*  delay[SRSRAN_MAX_CHANNELS]  = {};
-  srsran_channel_awgn_t*   awgn                        = nullptr;
-  srsran_channel_hst_t*    hst                         = nullptr;
-  srsran_channel_rlf_t*    rlf                         = nullptr;
-  cf_t*                    buffer_in                   = nullptr;
-  cf_t*                    buffer_out                  = nullptr;
-  uint32_t                 nof_channels                = 0;
-  uint32_t                 current_srate               = 0;
-  args_t                   args                        = {};
+  float                    hst_init_phase                  = 0.0f;
+  srsran_channel_fading_t* fading[SRSRAN_MAX_CHANNELS]     = {};
+  srsran_channel_delay_t*  delay[SRSRAN_MAX_CHANNELS]      = {};
+  srsran_channel_awgn_t*   awgn[SRSRAN_MAX_CHANNELS]       = {};
+  srsran_channel_hst_t*    hst[SRSRAN_MAX_CHANNELS]        = {};
+  srsran_channel_rlf_t*    rlf                             = nullptr;
+  cf_t*                    buffer_in[SRSRAN_MAX_CHANNELS]  = {};
+  cf_t*                    buffer_out[SRSRAN_MAX_CHANNELS] = {};
+  uint32_t                 nof_channels                    = 0;
+  uint32_t                 current_srate                   = 0;
+  args_t                   args                            = {};
+
+  // Worker pool, with W threads the worker w processes the channels w, w + W, w + 2W... The caller thread takes w = 0
+  std::vector<std::thread>  workers;
+  std::mutex                mutex;
+  std::condition_variable   cvar_start;
+  std::condition_variable   cvar_done;
+  uint64_t                  job_count   = 0;
+  uint32_t                  job_pending = 0;
+  bool                      quit        = false;
+  cf_t**                    job_in      = nullptr;
+  cf_t**                    job_out     = nullptr;
+  uint32_t                  job_len     = 0;
+  const srsran_timestamp_t* job_ts      = nullptr;
+
+  void run_channel(uint32_t i, cf_t* in, cf_t* out, uint32_t len, const srsran_timestamp_t& t);
+  void run_worker(uint32_t w);
+  void worker_loop(uint32_t w);
 };
 
 typedef std::unique_ptr<channel> channel_ptr;
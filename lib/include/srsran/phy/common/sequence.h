@@ -41,6 +41,10 @@ typedef struct SRSRAN_API {
   uint32_t x2;
 } srsran_sequence_state_t;
 
+/*
+ * The sequence state functions generate the sequence on the fly, 64 chips per step, and apply it in the same pass
+ * without any sequence buffer. They are preferred over srsran_sequence_t for per-user sequences.
+ */
 SRSRAN_API void srsran_sequence_state_init(srsran_sequence_state_t* s, uint32_t seed);
 
 SRSRAN_API void srsran_sequence_state_gen_f(srsran_sequence_state_t* s, float value, float* out, uint32_t length);
@@ -126,6 +130,12 @@ SRSRAN_API void srsran_sequence_pdsch_apply_c(const int8_t* in,
                                               uint32_t      cell_id,
                                               uint32_t      len);
 
+SRSRAN_API void srsran_sequence_pdsch_state_init(srsran_sequence_state_t* s,
+                                                 uint16_t                 rnti,
+                                                 int                      q,
+                                                 uint32_t                 nslot,
+                                                 uint32_t                 cell_id);
+
 SRSRAN_API int
 srsran_sequence_pusch(srsran_sequence_t* seq, uint16_t rnti, uint32_t nslot, uint32_t cell_id, uint32_t len);
 
@@ -150,6 +160,9 @@ SRSRAN_API void srsran_sequence_pusch_apply_s(const int16_t* in,
                                               uint32_t       cell_id,
                                               uint32_t       len);
 
+SRSRAN_API void
+srsran_sequence_pusch_state_init(srsran_sequence_state_t* s, uint16_t rnti, uint32_t nslot, uint32_t cell_id);
+
 SRSRAN_API void
 srsran_sequence_pusch_gen_unpack(uint8_t* out, uint16_t rnti, uint32_t nslot, uint32_t cell_id, uint32_t len);
 
@@ -157,6 +170,18 @@ SRSRAN_API int srsran_sequence_pucch(srsran_sequence_t* seq, uint16_t rnti, uint
 
 SRSRAN_API int srsran_sequence_pmch(srsran_sequence_t* seq, uint32_t nslot, uint32_t mbsfn_id, uint32_t len);
 
+SRSRAN_API void srsran_sequence_pmch_apply_pack(const uint8_t* in,
+                                                uint8_t*       out,
+                                                uint32_t       nslot,
+                                                uint32_t       mbsfn_id,
+                                                uint32_t       len);
+
+SRSRAN_API void srsran_sequence_pmch_apply_s(const int16_t* in,
+                                             int16_t*       out,
+                                             uint32_t       nslot,
+                                             uint32_t       mbsfn_id,
+                                             uint32_t       len);
+
 SRSRAN_API int srsran_sequence_npbch(srsran_sequence_t* seq, srsran_cp_t cp, uint32_t cell_id);
 
 SRSRAN_API int srsran_sequence_npbch_r14(srsran_sequence_t* seq, uint32_t n_id_ncell, uint32_t nf);
@@ -24,6 +24,7 @@
 
 #include "srsran/config.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 /**********************************************************************************************
  *  File:         dft.h
@@ -40,6 +41,16 @@
  *                norm   - Normalizes output (by sqrt(len) for complex, len for real).
  *                dc     - Handles insertion and removal of null DC carrier internally.
  *
+ *                Backends:
+ *
+ *                fftw   - FFTW plans, shared between objects through a plan cache.
+ *                native - Built-in radix 2/3/4/5 SIMD FFT. Complex transforms whose size
+ *                         is not a product of 2, 3 and 5 and real transforms use FFTW.
+ *
+ *                The default backend is FFTW unless the library is built with
+ *                USE_NATIVE_DFT. The SRSRAN_DFT_BACKEND environment variable
+ *                ("fftw" or "native") overrides it at run time.
+ *
  *  Reference:
  *********************************************************************************************/
 
@@ -51,22 +62,34 @@ typedef enum { SRSRAN_DFT_COMPLEX, SRSRAN_REAL } srsran_dft_mode_t;
 
 typedef enum { SRSRAN_DFT_FORWARD, SRSRAN_DFT_BACKWARD } srsran_dft_dir_t;
 
+typedef enum { SRSRAN_DFT_BACKEND_FFTW, SRSRAN_DFT_BACKEND_NATIVE } srsran_dft_backend_t;
+
 typedef struct SRSRAN_API {
-  int               init_size; // DFT length used in the first initialization
-  int               size;      // DFT length
-  void*             in;        // Input buffer
-  void*             out;       // Output buffer
-  void*             p;         // DFT plan
-  bool              is_guru;
-  bool              forward; // Forward transform?
-  bool              mirror;  // Shift negative and positive frequencies?
-  bool              db;      // Provide output in dB?
-  bool              norm;    // Normalize output?
-  bool              dc;      // Handle insertion/removal of null DC carrier internally?
-  srsran_dft_dir_t  dir;     // Forward/Backward
-  srsran_dft_mode_t mode;    // Complex/Real
+  int                  init_size; // DFT length used in the first initialization
+  int                  size;      // DFT length
+  void*                in;        // Input buffer
+  void*                out;       // Output buffer
+  void*                p;         // DFT plan
+  bool                 is_guru;
+  bool                 forward; // Forward transform?
+  bool                 mirror;  // Shift negative and positive frequencies?
+  bool                 db;      // Provide output in dB?
+  bool                 norm;    // Normalize output?
+  bool                 dc;      // Handle insertion/removal of null DC carrier internally?
+  srsran_dft_dir_t     dir;     // Forward/Backward
+  srsran_dft_mode_t    mode;    // Complex/Real
+  srsran_dft_backend_t backend; // Backend that owns the plan
 } srsran_dft_plan_t;
 
+/**
+ * @brief Selects the backend of the plans created afterwards. Existing plans keep their backend
+ */
+SRSRAN_API void srsran_dft_set_backend(srsran_dft_backend_t backend);
+
+SRSRAN_API srsran_dft_backend_t srsran_dft_get_backend();
+
+SRSRAN_API const char* srsran_dft_backend_string(srsran_dft_backend_t backend);
+
 SRSRAN_API int srsran_dft_plan(srsran_dft_plan_t* plan, int dft_points, srsran_dft_dir_t dir, srsran_dft_mode_t type);
 
 SRSRAN_API int srsran_dft_plan_c(srsran_dft_plan_t* plan, int dft_points, srsran_dft_dir_t dir);
@@ -82,6 +105,24 @@ SRSRAN_API int srsran_dft_plan_guru_c(srsran_dft_plan_t* plan,
                                       int                idist,
                                       int                odist);
 
+/**
+ * @brief Creates a guru plan that transforms a two level batch of contiguous DFTs in a single call
+ *
+ * The inner batch has how_many transforms spaced by idist/odist samples. The outer batch repeats the inner one
+ * nof_batches times spaced by batch_idist/batch_odist samples. The plan runs with srsran_dft_run_guru_c().
+ */
+SRSRAN_API int srsran_dft_plan_guru_batch_c(srsran_dft_plan_t* plan,
+                                            int                dft_points,
+                                            srsran_dft_dir_t   dir,
+                                            cf_t*              in_buffer,
+                                            cf_t*              out_buffer,
+                                            int                how_many,
+                                            int                idist,
+                                            int                odist,
+                                            int                nof_batches,
+                                            int                batch_idist,
+                                            int                batch_odist);
+
 SRSRAN_API int srsran_dft_plan_r(srsran_dft_plan_t* plan, int dft_points, srsran_dft_dir_t dir);
 
 SRSRAN_API int srsran_dft_replan(srsran_dft_plan_t* plan, const int new_dft_points);
@@ -102,6 +143,22 @@ SRSRAN_API int srsran_dft_replan_r(srsran_dft_plan_t* plan, int new_dft_points);
 
 SRSRAN_API void srsran_dft_plan_free(srsran_dft_plan_t* plan);
 
+/* Plan cache. Non-guru plans with the same size, direction, mode and buffer alignment share a single FFTW plan */
+
+/**
+ * @brief Creates the forward and backward complex plans of the given sizes in advance, so that the objects initialized
+ * later get them from the cache. The pre-warmed plans are kept until the process exits.
+ * @param sizes List of DFT sizes
+ * @param nof_sizes Number of sizes in the list
+ * @return SRSRAN_SUCCESS if the plans were created, SRSRAN_ERROR code otherwise
+ */
+SRSRAN_API int srsran_dft_plan_prewarm(const int* sizes, uint32_t nof_sizes);
+
+/**
+ * @brief Counts the distinct plans currently held by the cache
+ */
+SRSRAN_API uint32_t srsran_dft_plan_cache_nof_plans();
+
 /* Set options */
 
 SRSRAN_API void srsran_dft_plan_set_mirror(srsran_dft_plan_t* plan, bool val);
@@ -122,6 +179,17 @@ SRSRAN_API void srsran_dft_run_c(srsran_dft_plan_t* plan, const cf_t* in, cf_t*
 
 SRSRAN_API void srsran_dft_run_guru_c(srsran_dft_plan_t* plan);
 
+/**
+ * @brief Runs nof_batches transforms of plan->size samples stored one after the other, without staging every transform
+ * through the plan buffers. Plans with mirror, dB or DC options, and in-place or misaligned FFTW calls, fall back to
+ * srsran_dft_run_c() for every batch.
+ * @param plan Complex plan
+ * @param in Input buffer, nof_batches * plan->size samples
+ * @param out Output buffer, nof_batches * plan->size samples
+ * @param nof_batches Number of consecutive transforms
+ */
+SRSRAN_API void srsran_dft_run_batch_c(srsran_dft_plan_t* plan, const cf_t* in, cf_t* out, uint32_t nof_batches);
+
 SRSRAN_API void srsran_dft_run_r(srsran_dft_plan_t* plan, const float* in, float* out);
 
 #ifdef __cplusplus
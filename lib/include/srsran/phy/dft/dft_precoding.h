@@ -35,10 +35,17 @@
 #include "srsran/phy/common/phy_common.h"
 #include "srsran/phy/dft/dft.h"
 
-/* DFT-based Transform Precoding object */
+/* DFT-based Transform Precoding object. The plans are created on first use of every PRB count, the underlying FFTW
+ * plans are shared with the other objects through the DFT plan cache.
+ *
+ * The first use of a PRB count runs in the caller thread, which is usually a real-time worker. It allocates the plan
+ * buffers and takes the DFT plan cache mutex. If the size was not pre-warmed with srsran_dft_precoding_prewarm(), it
+ * also makes FFTW plan the DFT there. Pre-warm every PRB count the object can be used with during the initialisation.
+ */
 typedef struct SRSRAN_API {
 
   uint32_t          max_prb;
+  bool              is_tx;
   srsran_dft_plan_t dft_plan[SRSRAN_MAX_PRB + 1];
 
 } srsran_dft_precoding_t;
@@ -51,6 +58,10 @@ SRSRAN_API int srsran_dft_precoding_init_rx(srsran_dft_precoding_t* q, uint32_t
 
 SRSRAN_API void srsran_dft_precoding_free(srsran_dft_precoding_t* q);
 
+/* Creates in advance the shared plans of every valid PRB count up to max_prb, for both directions. Call it before the
+ * real-time threads start, the plans are kept until the process exits */
+SRSRAN_API int srsran_dft_precoding_prewarm(uint32_t max_prb);
+
 SRSRAN_API bool srsran_dft_precoding_valid_prb(uint32_t nof_prb);
 
 SRSRAN_API uint32_t srsran_dft_precoding_get_valid_prb(uint32_t nof_prb);
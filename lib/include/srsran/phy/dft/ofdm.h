@@ -71,7 +71,8 @@ typedef struct SRSRAN_API {
 typedef struct SRSRAN_API {
   srsran_ofdm_cfg_t cfg;
   srsran_dft_plan_t fft_plan;
-  srsran_dft_plan_t fft_plan_sf[2];
+  srsran_dft_plan_t fft_plan_sf[2]; ///< Tx plans, one per slot
+  srsran_dft_plan_t fft_plan_rx_sf; ///< Rx plan, transforms all the symbols of the subframe in one call
   uint32_t          max_prb;
   uint32_t          nof_symbols;
   uint32_t          nof_guards;
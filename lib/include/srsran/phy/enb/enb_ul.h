@@ -61,6 +61,19 @@ typedef struct SRSRAN_API {
   srsran_pusch_t    pusch;
   srsran_pucch_t    pucch;
 
+  // PUCCH format 1 candidates of srsran_enb_ul_get_pucch_batch()
+  srsran_pucch_cfg_t*  pucch_cand_cfg;
+  srsran_pucch_res_t*  pucch_cand_res;
+  srsran_pucch_cfg_t** pucch_cand_cfg_ptr;
+  srsran_pucch_res_t** pucch_cand_res_ptr;
+  uint32_t             pucch_cand_size;
+
+  // Channel estimates of the detected UEs of srsran_enb_ul_get_pucch_batch() that measure the time alignment
+  srsran_chest_ul_res_t*  pucch_chest_res;
+  srsran_chest_ul_res_t** pucch_chest_res_ptr;
+  uint32_t                pucch_chest_size;
+  uint32_t                max_prb;
+
 } srsran_enb_ul_t;
 
 /* This function shall be called just after the initial synchronization */
@@ -80,9 +93,38 @@ SRSRAN_API int srsran_enb_ul_get_pucch(srsran_enb_ul_t*    q,
                                        srsran_pucch_cfg_t* cfg,
                                        srsran_pucch_res_t* res);
 
+/* Same as srsran_enb_ul_get_pucch() for several UEs. The format 1, 1a and 1b hypotheses of all the UEs are detected
+ * jointly with srsran_pucch_decode_format1_joint(), the channel of the detected UEs that measure the time alignment is
+ * then estimated in a single batch. UEs using format 2 or 3 are decoded one by one.
+ */
+SRSRAN_API int srsran_enb_ul_get_pucch_batch(srsran_enb_ul_t*     q,
+                                             srsran_ul_sf_cfg_t*  ul_sf,
+                                             srsran_pucch_cfg_t** cfg,
+                                             srsran_pucch_res_t** res,
+                                             uint32_t             nof_ue);
+
 SRSRAN_API int srsran_enb_ul_get_pusch(srsran_enb_ul_t*    q,
                                        srsran_ul_sf_cfg_t* ul_sf,
                                        srsran_pusch_cfg_t* cfg,
                                        srsran_pusch_res_t* res);
 
+/* Estimates the PUSCH channel of all the UEs of the subframe in a single batch. The estimate of each UE is written in
+ * the caller storage with the same index, the PUSCH are decoded afterwards with srsran_enb_ul_decode_pusch() */
+SRSRAN_API int srsran_enb_ul_estimate_pusch_batch(srsran_enb_ul_t*        q,
+                                                  srsran_ul_sf_cfg_t*     ul_sf,
+                                                  srsran_pusch_cfg_t**    cfg,
+                                                  srsran_chest_ul_res_t** chest_res,
+                                                  uint32_t                nof_pusch);
+
+/* Decodes a PUSCH with the channel estimate given by srsran_enb_ul_estimate_pusch_batch() */
+SRSRAN_API int srsran_enb_ul_decode_pusch(srsran_enb_ul_t*       q,
+                                          srsran_ul_sf_cfg_t*    ul_sf,
+                                          srsran_pusch_cfg_t*    cfg,
+                                          srsran_chest_ul_res_t* chest_res,
+                                          srsran_pusch_res_t*    res);
+
+SRSRAN_API int srsran_enb_ul_set_pusch_batch_decoding(srsran_enb_ul_t* q, bool enable);
+
+SRSRAN_API int srsran_enb_ul_decode_pusch_pending(srsran_enb_ul_t* q);
+
 #endif // SRSRAN_ENB_UL_H
@@ -52,6 +52,8 @@ typedef struct SRSRAN_API {
   uint16_t* tmp_s;
   uint8_t*  symbols_uc;
   uint16_t* symbols_us;
+  int       poly[3];
+  void*     batch;
 } srsran_viterbi_t;
 
 SRSRAN_API int srsran_viterbi_init(srsran_viterbi_t*     q,
@@ -74,6 +76,25 @@ SRSRAN_API int srsran_viterbi_decode_us(srsran_viterbi_t* q, uint16_t* symbols,
 
 SRSRAN_API int srsran_viterbi_decode_uc(srsran_viterbi_t* q, uint8_t* symbols, uint8_t* data, uint32_t frame_length);
 
+/**
+ * @brief Decodes several frames of the same length at once, each frame is processed in a different SIMD lane.
+ *
+ * The symbols are real-valued as in srsran_viterbi_decode_f(). The frames are decoded one by one if the multi-stream
+ * decoder is not available for the current platform.
+ *
+ * @param q Viterbi decoder object
+ * @param symbols Pointers to the received symbols of each frame
+ * @param data Pointers to the decoded bits of each frame
+ * @param nof_frames Number of frames
+ * @param frame_length Number of bits of every frame
+ * @return SRSRAN_SUCCESS if all the frames are decoded, SRSRAN_ERROR code otherwise
+ */
+SRSRAN_API int srsran_viterbi_decode_batch(srsran_viterbi_t* q,
+                                           float*            symbols[],
+                                           uint8_t*          data[],
+                                           uint32_t          nof_frames,
+                                           uint32_t          frame_length);
+
 SRSRAN_API int srsran_viterbi_init_sse(srsran_viterbi_t*     q,
                                        srsran_viterbi_type_t type,
                                        int                   poly[3],
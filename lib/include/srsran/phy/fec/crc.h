@@ -44,6 +44,8 @@ typedef struct SRSRAN_API {
   uint64_t crcmask;
   uint64_t crchighbit;
   uint32_t srsran_crc_out;
+  bool     clmul;      // srsran_crc_checksum_byte() uses the carry-less multiplication engine
+  uint64_t clmul_k[9]; // x^(64*(i+1)) mod polynom, folding constants for the carry-less multiplication engine
 } srsran_crc_t;
 
 SRSRAN_API int srsran_crc_init(srsran_crc_t* h, uint32_t srsran_crc_poly, int srsran_crc_order);
@@ -78,6 +80,10 @@ static inline uint64_t srsran_crc_checksum_get(srsran_crc_t* h)
   return (h->crcinit & h->crcmask);
 }
 
+/**
+ * Computes the CRC of len bits (multiple of 8) of packed data. Long messages are folded with carry-less
+ * multiplications (PCLMULQDQ) when the CPU supports them, otherwise the byte table is used. Both give the same result.
+ */
 SRSRAN_API uint32_t srsran_crc_checksum_byte(srsran_crc_t* h, const uint8_t* data, int len);
 
 SRSRAN_API uint32_t srsran_crc_checksum(srsran_crc_t* h, uint8_t* data, int len);
@@ -99,6 +99,22 @@ typedef struct SRSRAN_API {
                   uint8_t*,
                   uint32_t,
                   srsran_crc_t*); /*!< \brief Pointer to the decoding function (16-bit version). */
+  int8_t* (*init_inplace_c)(void*, uint32_t*); /*!< \brief Pointer to the in-place initialization function (8-bit
+                                                  version), NULL if not supported. */
+  int (*decode_inplace_c)(void*,
+                          uint8_t*,
+                          uint32_t,
+                          srsran_crc_t*); /*!< \brief Pointer to the in-place decoding function (8-bit version). */
+  int8_t* inplace_llrs; /*!< \brief LLR buffer for the 8-bit decoders that cannot be loaded in place. */
+  uint32_t batch_size;  /*!< \brief Number of codewords decoded at once by decode_batch_c. */
+  int (*decode_batch_c)(void*,
+                        const int8_t* const*,
+                        uint8_t**,
+                        int*,
+                        uint32_t,
+                        uint32_t,
+                        srsran_crc_t*); /*!< \brief Pointer to the multi-codeword decoding function (8-bit version),
+                                           NULL if not supported. */
 } srsran_ldpc_decoder_t;
 
 /*!
@@ -179,4 +195,59 @@ SRSRAN_API int srsran_ldpc_decoder_decode_crc_c(srsran_ldpc_decoder_t* q,
                                                 uint32_t               cdwd_rm_length,
                                                 srsran_crc_t*          crc);
 
+/*!
+ * Prepares the decoder for receiving the LLRs directly in its soft-bit memory, skipping the copy carried out by
+ * srsran_ldpc_decoder_decode_c(). The LLR of the i-th bit of the rate-matched codeword (i.e., after the two punctured
+ * lifted nodes) must be written in `ptr[(i / ls) * node_size + i % ls]`, where `ptr` is the returned pointer. All
+ * other soft bits are set to zero. The flooded decoders, which keep a copy of the channel LLRs, are loaded through an
+ * intermediate buffer instead.
+ * \param[in]  q         A pointer to the LDPC decoder.
+ * \param[out] node_size The distance, in bytes, between two consecutive lifted nodes.
+ * \return A pointer to the decoder soft bits, NULL if the decoder does not work with 8-bit LLRs.
+ */
+SRSRAN_API int8_t* srsran_ldpc_decoder_init_inplace_c(srsran_ldpc_decoder_t* q, uint32_t* node_size);
+
+/*!
+ * Carries out the decoding of the LLRs written in the decoder memory after srsran_ldpc_decoder_init_inplace_c().
+ * \param[in] q A pointer to the LDPC decoder.
+ * \param[out] message The message (uncoded bits) resulting from the decoding operation.
+ * \param[in] cdwd_rm_length The number of bits forming the codeword (after rate matching).
+ * \param[in,out] crc Code-block CRC object for early stop. Set for NULL to disable check
+ * \return -1 if an error occurred, the number of used iterations, and 0 if CRC is provided and did not match
+ */
+SRSRAN_API int srsran_ldpc_decoder_decode_inplace_c(srsran_ldpc_decoder_t* q,
+                                                    uint8_t*               message,
+                                                    uint32_t               cdwd_rm_length,
+                                                    srsran_crc_t*          crc);
+
+/*!
+ * Returns the number of codewords that the decoder processes at once in srsran_ldpc_decoder_decode_batch_c(). With
+ * short lifting sizes, the AVX512 decoder packs several codewords side by side in its registers. All other decoders
+ * process one codeword at a time.
+ * \param[in] q A pointer to the LDPC decoder.
+ * \return The number of codewords decoded at once.
+ */
+SRSRAN_API uint32_t srsran_ldpc_decoder_batch_size(const srsran_ldpc_decoder_t* q);
+
+/*!
+ * Decodes several codewords with the same base graph and lifting size, using 8-bit integer-valued LLRs. The
+ * codewords are decoded in groups of srsran_ldpc_decoder_batch_size(). Each codeword gives the same message it would
+ * give with srsran_ldpc_decoder_decode_crc_c(), the iterations stop when all the codewords of the group match the CRC.
+ * \param[in] q A pointer to the LDPC decoder.
+ * \param[in] llrs The LLRs of each codeword.
+ * \param[out] messages The decoded message of each codeword.
+ * \param[out] results For each codeword, the number of used iterations, 0 if CRC is provided and did not match.
+ * \param[in] nof_cw The number of codewords.
+ * \param[in] cdwd_rm_length The number of bits forming each codeword (after rate matching).
+ * \param[in,out] crc Code-block CRC object for early stop. Set for NULL to disable check
+ * \return -1 if an error occurred, 0 otherwise.
+ */
+SRSRAN_API int srsran_ldpc_decoder_decode_batch_c(srsran_ldpc_decoder_t* q,
+                                                  const int8_t* const*   llrs,
+                                                  uint8_t**              messages,
+                                                  int*                   results,
+                                                  uint32_t               nof_cw,
+                                                  uint32_t               cdwd_rm_length,
+                                                  srsran_crc_t*          crc);
+
 #endif // SRSRAN_LDPCDECODER_H
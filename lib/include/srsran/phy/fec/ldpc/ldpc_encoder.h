@@ -38,13 +38,9 @@
  * \brief Types of LDPC encoder.
  */
 typedef enum SRSRAN_API {
-  SRSRAN_LDPC_ENCODER_C = 0, /*!< \brief Non-optimized encoder. */
-#if LV_HAVE_AVX2
-  SRSRAN_LDPC_ENCODER_AVX2, /*!< \brief SIMD-optimized encoder. */
-#endif                      // LV_HAVE_AVX2
-#if LV_HAVE_AVX512
-  SRSRAN_LDPC_ENCODER_AVX512, /*!< \brief SIMD-optimized encoder. */
-#endif                        // LV_HAVE_AVX512
+  SRSRAN_LDPC_ENCODER_C = 0,  /*!< \brief Non-optimized encoder. */
+  SRSRAN_LDPC_ENCODER_AVX2,   /*!< \brief SIMD-optimized encoder (AVX2 version). */
+  SRSRAN_LDPC_ENCODER_AVX512, /*!< \brief SIMD-optimized encoder (AVX512 version). */
 } srsran_ldpc_encoder_type_t;
 
 /*!
@@ -34,6 +34,7 @@
 
 #include "srsran/phy/common/phy_common.h"
 #include "srsran/phy/fec/ldpc/base_graph.h"
+#include "srsran/phy/fec/ldpc/ldpc_decoder.h"
 
 /*!
  * \brief Describes a rate matcher or rate dematcher (K, F are ignored at rate matcher)
@@ -191,6 +192,40 @@ SRSRAN_API int srsran_ldpc_rm_rx_c(srsran_ldpc_rm_t*        q,
                                    const srsran_mod_t       mod_type,
                                    const uint32_t           Nref);
 
+/*!
+ * Carries out the rate-dematching (int8_t symbols) and loads the resulting codeword in the decoder. The bit
+ * deinterleaving, the bit selection and the soft combining with the previous redundancy versions are done in a single
+ * pass, which also writes the combined LLRs straight in the soft-bit memory of the decoder (see
+ * srsran_ldpc_decoder_init_inplace_c()). The codeword must then be decoded with srsran_ldpc_decoder_decode_inplace_c().
+ * \param[in] q           A pointer to the Rate-DeMatcher (a srsran_ldpc_rm_t structure
+ *                        instance) that carries out the rate matching.
+ * \param[in,out] decoder The LDPC decoder in which the codeword is loaded, initialized for the same base graph and
+ *                        lifting size.
+ * \param[in] input       The LLRs obtained from the channel samples that correspond to
+ *                        the codeword to be first, rate-dematched and then decoded.
+ * \param[in,out] output  The rate-dematched codeword (HARQ soft buffer). Shall be either initialized to all zeros or
+ *                        to the result of previous redundancy versions is available.
+ * \param[in] E           Rate-matched codeword length.
+ * \param[in] F           Number of filler bits.
+ * \param[in] bg;         Current base graph.
+ * \param[in] ls          Current lifting size.
+ * \param[in] rv          Redundancy version 0,1,2,3.
+ * \param[in] mod_type    Modulation type.
+ * \param[in] Nref        Size of limited buffer.
+ * \return An integer: The number of useful LLR if the function executes correctly, -1 otherwise.
+ */
+SRSRAN_API int srsran_ldpc_rm_rx_inplace_c(srsran_ldpc_rm_t*        q,
+                                           srsran_ldpc_decoder_t*   decoder,
+                                           const int8_t*            input,
+                                           int8_t*                  output,
+                                           const uint32_t           E,
+                                           const uint32_t           F,
+                                           const srsran_basegraph_t bg,
+                                           const uint32_t           ls,
+                                           const uint8_t            rv,
+                                           const srsran_mod_t       mod_type,
+                                           const uint32_t           Nref);
+
 /*!
  * The Rate Matcher "destructor": it frees all the resources allocated to the rate-matcher.
  * \param[in] q A pointer to the dismantled rate-matcher.
@@ -319,6 +319,21 @@ static const uint16_t blk_interleaver_10[1024] = {
     988,  989,  990,  991,  992,  993,  994,  995,  996,  997,  998,  999,  1000, 1001, 1002, 1003, 1004, 1005, 1006,
     1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023};
 
+/*!
+ * \brief Types of node in the decoding tree of a polar code.
+ *
+ * Besides the ::SRSRAN_POLAR_NODE_RATE_0, ::SRSRAN_POLAR_NODE_RATE_1 and ::SRSRAN_POLAR_NODE_RATE_R nodes of
+ * the simplified successive cancellation (SSC) decoder, the Fast-SSC decoder recognizes repetition and single
+ * parity-check subcodes and decodes them without visiting their children.
+ */
+typedef enum {
+  SRSRAN_POLAR_NODE_RATE_0 = 0, /*!< \brief All the bits below the node are frozen. */
+  SRSRAN_POLAR_NODE_RATE_R = 1, /*!< \brief Generic node, decoded through its children. */
+  SRSRAN_POLAR_NODE_RATE_1 = 2, /*!< \brief None of the bits below the node is frozen. */
+  SRSRAN_POLAR_NODE_REP    = 3, /*!< \brief Repetition node: all the bits below the node but the last are frozen. */
+  SRSRAN_POLAR_NODE_SPC    = 4, /*!< \brief Single parity-check node: only the first bit below the node is frozen. */
+} srsran_polar_node_type_t;
+
 /*!
  * \brief Describes a polar set.
  */
@@ -333,6 +348,8 @@ typedef struct {
   uint16_t* tmp_K_set;  /*!< \brief Temporal Pointer. */
   uint16_t  PC_set[4];  /*!< \brief Pointer to the indices of the encoder input vector containing the parity bits.*/
   uint16_t* F_set;      /*!< \brief Pointer to the indices of the encoder input vector containing frozen bits.*/
+  uint8_t*  node_type;  /*!< \brief Type (::srsran_polar_node_type_t) of all the nodes of the decoding tree, see
+                             srsran_polar_code_node_type(). */
 } srsran_polar_code_t;
 
 /*!
@@ -413,6 +430,21 @@ int srsran_polar_code_init(srsran_polar_code_t* c);
  */
 int srsran_polar_code_get(srsran_polar_code_t* c, const uint16_t K, const uint16_t E, const uint8_t nMax);
 
+/*!
+ * Computes the type of all the nodes of the decoding tree associated to the given frozen set. The \f$2^{n-s}\f$ nodes
+ * at stage \f$s\f$ (stage 0 being the leaves) are stored starting at position \f$2^{n+1} - 2^{n-s+1}\f$, so that
+ * \a node_type must have room for \f$2^{n+1} - 1\f$ values.
+ * \param[in] frozen_set The position of the frozen bits in the codeword.
+ * \param[in] frozen_set_size The size of the frozen set.
+ * \param[in] n \f$log_2(N)\f$, where \f$N\f$ is the codeword size.
+ * \param[out] node_type The node types, see ::srsran_polar_node_type_t.
+ * \return An integer: 0 if the function executes correctly, -1 otherwise.
+ */
+int srsran_polar_code_node_type(const uint16_t* frozen_set,
+                                const uint16_t  frozen_set_size,
+                                const uint8_t   n,
+                                uint8_t*        node_type);
+
 /*!
  * The polar code "destructor": it frees all the resources.
  * \param[in] c A pointer to the dismantled polar code.
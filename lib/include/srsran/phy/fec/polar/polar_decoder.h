@@ -34,6 +34,7 @@
 #ifndef SRSRAN_POLARDECODER_H
 #define SRSRAN_POLARDECODER_H
 #include "srsran/config.h"
+#include "srsran/phy/fec/polar/polar_code.h"
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -45,7 +46,8 @@ typedef enum SRSRAN_API {
   SRSRAN_POLAR_DECODER_SSC_S = 1, /*!< \brief Fixed-point (16 bit) Simplified Successive Cancellation (SSC) decoder. */
   SRSRAN_POLAR_DECODER_SSC_C = 2, /*!< \brief Fixed-point (8 bit) Simplified Successive Cancellation (SSC) decoder. */
   SRSRAN_POLAR_DECODER_SSC_C_AVX2 =
-      3 /*!< \brief Fixed-point (8 bit, avx2) Simplified Successive Cancellation (SSC) decoder. */
+      3, /*!< \brief Fixed-point (8 bit, avx2) Simplified Successive Cancellation (SSC) decoder. */
+  SRSRAN_POLAR_DECODER_FSSC_C = 4 /*!< \brief Fixed-point (8 bit) Fast Simplified Successive Cancellation decoder. */
 } srsran_polar_decoder_type_t;
 
 /*!
@@ -72,7 +74,12 @@ typedef struct SRSRAN_API {
                   const uint8_t   n,
                   const uint16_t* frozen_set,
                   const uint16_t  frozen_set_size); /*!< \brief Pointer to the decoder function (8-bit version). */
-  void (*free)(void*);                             /*!< \brief Pointer to a "destructor". */
+  int (*decode_code_c)(void*                      ptr,
+                       const int8_t*              symbols,
+                       uint8_t*                   data_decoded,
+                       const srsran_polar_code_t* code); /*!< \brief Pointer to the decoder function using the
+                                                            precomputed decoding tree (8-bit version), may be NULL. */
+  void (*free)(void*);                                   /*!< \brief Pointer to a "destructor". */
 } srsran_polar_decoder_t;
 
 /*!
@@ -145,4 +152,19 @@ SRSRAN_API int srsran_polar_decoder_decode_c(srsran_polar_decoder_t* q,
                                              const uint16_t*         frozen_set,
                                              const uint16_t          frozen_set_size);
 
+/*!
+ * Decodes the input (int8_t) codeword of the given polar code with the specified polar decoder. Decoders that
+ * support it (e.g., ::SRSRAN_POLAR_DECODER_FSSC_C) use the node types computed by srsran_polar_code_get(), the
+ * others fall back to srsran_polar_decoder_decode_c() with the frozen set of the code.
+ * \param[in] q A pointer to the desired polar decoder.
+ * \param[in] input_llr The decoder LLR input vector.
+ * \param[out] data_decoded The decoder output vector.
+ * \param[in] code The polar code, as given by srsran_polar_code_get().
+ * \return An integer: 0 if the function executes correctly, -1 otherwise.
+ */
+SRSRAN_API int srsran_polar_decoder_decode_code_c(srsran_polar_decoder_t*    q,
+                                                  const int8_t*              input_llr,
+                                                  uint8_t*                   data_decoded,
+                                                  const srsran_polar_code_t* code);
+
 #endif // SRSRAN_POLARDECODER_H
@@ -32,19 +32,39 @@
 #define SRSRAN_SOFTBUFFER_H
 
 #include "srsran/config.h"
+#include <pthread.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Pool of code block LLR buffers shared by many Rx soft-buffers. A pooled Rx soft-buffer only holds chunks from the
+ * time a transport block is received until it is decoded correctly or the soft-buffer is reset. The decoded bits are
+ * not pooled, they are kept with the soft-buffer.
+ */
 typedef struct SRSRAN_API {
-  uint32_t  max_cb;
-  uint32_t  max_cb_size;
-  int16_t** buffer_f;
-  uint8_t** data;
-  bool*     cb_crc;
-  bool      tb_crc;
+  uint32_t        max_cb_size; // Number of LLR per code block
+  bool            llr_is_8bit;
+  uint32_t        nof_chunks;
+  uint32_t        chunk_size; // Bytes per chunk
+  uint8_t*        memory;
+  uint8_t**       free_chunks;
+  uint32_t        nof_free;
+  pthread_mutex_t mutex;
+} srsran_softbuffer_pool_t;
+
+typedef struct SRSRAN_API {
+  uint32_t                  max_cb;
+  uint32_t                  max_cb_size;
+  int16_t**                 buffer_f; // Holds int8_t LLR if llr_is_8bit is set
+  uint8_t**                 data;
+  bool*                     cb_crc;
+  bool                      tb_crc;
+  bool                      llr_is_8bit;
+  srsran_softbuffer_pool_t* pool; // Chunks are taken from this pool if not NULL
 } srsran_softbuffer_rx_t;
 
 typedef struct SRSRAN_API {
@@ -67,6 +87,47 @@ SRSRAN_API int srsran_softbuffer_rx_init(srsran_softbuffer_rx_t* q, uint32_t nof
  */
 SRSRAN_API int srsran_softbuffer_rx_init_guru(srsran_softbuffer_rx_t* q, uint32_t max_cb, uint32_t max_cb_size);
 
+SRSRAN_API int srsran_softbuffer_rx_init_8bit(srsran_softbuffer_rx_t* q, uint32_t nof_prb);
+
+/**
+ * @brief Initialises Rx soft-buffer which stores 8-bit LLR, for decoders working with 8-bit LLR
+ * @param q The Rx soft-buffer pointer
+ * @param max_cb The maximum number of code blocks to allocate
+ * @param max_cb_size The code block size to allocate
+ * @return It returns SRSRAN_SUCCESS if it allocates the soft-buffer successfully, otherwise it returns SRSRAN_ERROR
+ * code
+ */
+SRSRAN_API int srsran_softbuffer_rx_init_guru_8bit(srsran_softbuffer_rx_t* q, uint32_t max_cb, uint32_t max_cb_size);
+
+/**
+ * @brief Initialises Rx soft-buffer which takes the code block buffers from a shared pool. No code block buffer is
+ * held until srsran_softbuffer_rx_reserve_cb() is called. The LLR width and code block size are given by the pool.
+ * @param q The Rx soft-buffer pointer
+ * @param nof_prb Number of PRB used to compute the maximum number of code blocks
+ * @param pool Initialised pool shared by all the soft-buffers, it must outlive them
+ * @return It returns SRSRAN_SUCCESS if it allocates the soft-buffer successfully, otherwise it returns SRSRAN_ERROR
+ * code
+ */
+SRSRAN_API int
+srsran_softbuffer_rx_init_pool(srsran_softbuffer_rx_t* q, uint32_t nof_prb, srsran_softbuffer_pool_t* pool);
+
+/**
+ * @brief Makes sure the first code blocks have a buffer. Pooled soft-buffers take the missing buffers from the pool,
+ * cleared; the buffers already held keep their soft bits.
+ * @param q Rx soft-buffer object
+ * @param nof_cb Number of code blocks about to be decoded
+ * @return SRSRAN_SUCCESS if all the code blocks have a buffer, SRSRAN_ERROR if there are not enough buffers
+ */
+SRSRAN_API int srsran_softbuffer_rx_reserve_cb(srsran_softbuffer_rx_t* q, uint32_t nof_cb);
+
+/**
+ * @brief Returns the code block LLR buffers of a pooled soft-buffer to the pool, keeping the code block CRCs and the
+ * decoded bits so that retransmissions of a correctly decoded transport block are still skipped and reassembled. It
+ * does nothing for other soft-buffers.
+ * @param q Rx soft-buffer object
+ */
+SRSRAN_API void srsran_softbuffer_rx_release(srsran_softbuffer_rx_t* q);
+
 SRSRAN_API void srsran_softbuffer_rx_reset(srsran_softbuffer_rx_t* p);
 
 SRSRAN_API void srsran_softbuffer_rx_reset_tbs(srsran_softbuffer_rx_t* q, uint32_t tbs);
@@ -84,6 +145,21 @@ SRSRAN_API void srsran_softbuffer_rx_free(srsran_softbuffer_rx_t* p);
  */
 SRSRAN_API void srsran_softbuffer_rx_reset_cb_crc(srsran_softbuffer_rx_t* q, uint32_t nof_cb);
 
+/**
+ * @brief Initialises a pool of code block soft buffers
+ * @param q The pool pointer
+ * @param nof_chunks Number of code block buffers in the pool
+ * @param max_cb_size The code block size to allocate
+ * @param llr_is_8bit Set to store 8-bit LLR instead of 16-bit LLR
+ * @return It returns SRSRAN_SUCCESS if it allocates the pool successfully, otherwise it returns SRSRAN_ERROR code
+ */
+SRSRAN_API int
+srsran_softbuffer_pool_init(srsran_softbuffer_pool_t* q, uint32_t nof_chunks, uint32_t max_cb_size, bool llr_is_8bit);
+
+SRSRAN_API uint32_t srsran_softbuffer_pool_nof_free(srsran_softbuffer_pool_t* q);
+
+SRSRAN_API void srsran_softbuffer_pool_free(srsran_softbuffer_pool_t* q);
+
 SRSRAN_API int srsran_softbuffer_tx_init(srsran_softbuffer_tx_t* q, uint32_t nof_prb);
 
 /**
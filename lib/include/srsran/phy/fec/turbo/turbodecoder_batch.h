@@ -0,0 +1,91 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/**********************************************************************************************
+ *  File:         turbodecoder_batch.h
+ *
+ *  Description:  Batched Turbo Decoder.
+ *                Decodes several code blocks at once, one code block per SIMD lane. Code blocks
+ *                shorter than the longest one of their batch are padded with zero LLR after
+ *                their own trellis termination. Each lane runs the same MAX-LOG-MAP computation
+ *                as the generic decoder, so the output is bit-exact with srsran_tdec_t for code
+ *                blocks which are too short for the windowed decoders. Every code block stops
+ *                iterating as soon as its CRC is correct.
+ *
+ *  Reference:    3GPP TS 36.212 version 10.0.0 Release 10 Sec. 5.1.3.2
+ *********************************************************************************************/
+
+#ifndef SRSRAN_TURBODECODER_BATCH_H
+#define SRSRAN_TURBODECODER_BATCH_H
+
+#include "srsran/config.h"
+#include "srsran/phy/fec/cbsegm.h"
+#include "srsran/phy/fec/crc.h"
+#include "srsran/phy/fec/turbo/tc_interl.h"
+#include <stdbool.h>
+
+/* Maximum code block length decoded by the batched decoder. Longer code blocks use the windowed decoders. */
+#define SRSRAN_TDEC_BATCH_MAX_LONG_CB 512
+
+typedef struct SRSRAN_API {
+  uint32_t      long_cb;        // Code block length
+  int16_t*      input;          // Input LLR in natural order (3 * long_cb + 12 values)
+  uint8_t*      output;         // Decoded bits, packed in bytes
+  srsran_crc_t* crc;            // CRC used for early stopping, set to NULL to always run all iterations
+  uint32_t      crc_len;        // Number of bits covered by the CRC, including the checksum
+  bool          crc_ok;         // Output: the CRC was correct
+  uint32_t      nof_iterations; // Output: number of iterations run for this code block
+} srsran_tdec_batch_cb_t;
+
+typedef struct SRSRAN_API {
+  uint32_t max_long_cb;
+
+  int16_t* syst;
+  int16_t* parity0;
+  int16_t* parity1;
+  int16_t* app1;
+  int16_t* app2;
+  int16_t* ext1;
+  int16_t* ext2;
+  int16_t* beta;
+
+  srsran_tc_interl_t interleaver[SRSRAN_NOF_TC_CB_SIZES]; // Interleaver of every length up to max_long_cb
+} srsran_tdec_batch_t;
+
+SRSRAN_API int srsran_tdec_batch_init(srsran_tdec_batch_t* q, uint32_t max_long_cb);
+
+SRSRAN_API void srsran_tdec_batch_free(srsran_tdec_batch_t* q);
+
+SRSRAN_API uint32_t srsran_tdec_batch_nof_lanes();
+
+SRSRAN_API bool srsran_tdec_batch_is_supported(srsran_tdec_batch_t* q, uint32_t long_cb);
+
+/**
+ * Decodes nof_cb code blocks, NOF_LANES at a time. The code blocks may have different lengths, each group of lanes runs
+ * the trellis over the longest code block of the group, so sorting the code blocks by length keeps the padding short.
+ */
+SRSRAN_API int srsran_tdec_batch_run(srsran_tdec_batch_t*    q,
+                                     srsran_tdec_batch_cb_t* cb,
+                                     uint32_t                nof_cb,
+                                     uint32_t                min_iterations,
+                                     uint32_t                max_iterations);
+
+#endif // SRSRAN_TURBODECODER_BATCH_H
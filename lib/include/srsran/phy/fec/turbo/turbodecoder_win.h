@@ -299,6 +299,110 @@ inline static simd_type_t simd_rb_shift_256(simd_type_t v, const int l)
   return _mm256_blendv_epi8(hi, low, _mm256_set1_epi32(0x00FF00FF));
 }
 
+#else
+#ifdef WINIMP_IS_AVX512_16
+
+#ifndef LV_HAVE_AVX512
+#error "Selected AVX512 window decoder but instruction set not supported"
+#endif
+
+#include <immintrin.h>
+
+#define WINIMP avx512_16
+#define nof_blocks 32
+
+#define llr_t int16_t
+
+#define simd_type_t __m512i
+#define simd_load _mm512_load_si512
+#define simd_store _mm512_store_si512
+#define simd_add _mm512_adds_epi16
+#define simd_sub _mm512_subs_epi16
+#define simd_max _mm512_max_epi16
+#define simd_set1 _mm512_set1_epi16
+#define simd_insert simd_insert_512_16
+#define simd_shuffle simd_shuffle_512_16
+#define move_right 1
+#define move_left -1
+#define simd_rb_shift _mm512_srai_epi16
+
+#define normalize_period 2
+#define win_overlap_len 40
+
+#define INF 10000
+
+inline static simd_type_t simd_insert_512_16(simd_type_t v, llr_t x, const int idx)
+{
+  return _mm512_mask_set1_epi16(v, (__mmask32)1 << idx, x);
+}
+
+/* Moves every element one position down (move_right) or up (move_left) across the whole register. The 128-bit
+ * lanes are rotated first so that the byte alignment brings in the neighbour lane, avoiding the extract/insert
+ * fix-up of the AVX2 version. The vacated element is overwritten by the caller. */
+inline static simd_type_t simd_shuffle_512_16(simd_type_t v, const int dir)
+{
+  if (dir > 0) {
+    return _mm512_alignr_epi8(_mm512_alignr_epi32(v, v, 4), v, 2);
+  }
+  return _mm512_alignr_epi8(v, _mm512_alignr_epi32(v, v, 12), 14);
+}
+
+#else
+#ifdef WINIMP_IS_AVX512_8
+
+#ifndef LV_HAVE_AVX512
+#error "Selected AVX512 window decoder but instruction set not supported"
+#endif
+
+#include <immintrin.h>
+
+#define WINIMP avx512_8
+#define nof_blocks 64
+
+#define llr_t int8_t
+
+// Parity sub-blocks start at long_cb + 32 bytes from the input, which is not 64-byte aligned for 8-bit LLR
+#define simd_type_t __m512i
+#define simd_load _mm512_loadu_si512
+#define simd_store _mm512_store_si512
+#define simd_add _mm512_adds_epi8
+#define simd_sub _mm512_subs_epi8
+#define simd_max _mm512_max_epi8
+#define simd_set1 _mm512_set1_epi8
+#define simd_insert simd_insert_512_8
+#define simd_shuffle simd_shuffle_512_8
+#define move_right 1
+#define move_left -1
+#define simd_rb_shift simd_rb_shift_512
+
+#define INF 0
+
+#define normalize_max
+#define normalize_period 1
+#define win_overlap_len 40
+#define use_saturated_add
+#define divide_output 1
+
+inline static simd_type_t simd_insert_512_8(simd_type_t v, llr_t x, const int idx)
+{
+  return _mm512_mask_set1_epi8(v, (__mmask64)1 << idx, x);
+}
+
+inline static simd_type_t simd_shuffle_512_8(simd_type_t v, const int dir)
+{
+  if (dir > 0) {
+    return _mm512_alignr_epi8(_mm512_alignr_epi32(v, v, 4), v, 1);
+  }
+  return _mm512_alignr_epi8(v, _mm512_alignr_epi32(v, v, 12), 15);
+}
+
+inline static simd_type_t simd_rb_shift_512(simd_type_t v, const int l)
+{
+  __m512i low = _mm512_srai_epi16(_mm512_slli_epi16(v, 8), l + 8);
+  __m512i hi  = _mm512_srai_epi16(v, l);
+  return _mm512_mask_blend_epi8(0x5555555555555555, hi, low);
+}
+
 #else
 #ifdef WINIMP_IS_NEON16
 #include <arm_neon.h>
@@ -407,6 +511,8 @@ inline static uint8x16_t v_load_s8(int i15,
 #endif
 #endif
 #endif
+#endif
+#endif
 
 typedef struct SRSRAN_API {
   uint32_t max_long_cb;
@@ -908,6 +1014,21 @@ void MAKE_FUNC(
     INSERT8_INPUT(parity1, 24, 2);
 #endif
 
+#if nof_blocks >= 64
+    INSERT8_INPUT(syst, 32, 0);
+    INSERT8_INPUT(parity0, 32, 1);
+    INSERT8_INPUT(parity1, 32, 2);
+    INSERT8_INPUT(syst, 40, 0);
+    INSERT8_INPUT(parity0, 40, 1);
+    INSERT8_INPUT(parity1, 40, 2);
+    INSERT8_INPUT(syst, 48, 0);
+    INSERT8_INPUT(parity0, 48, 1);
+    INSERT8_INPUT(parity1, 48, 2);
+    INSERT8_INPUT(syst, 56, 0);
+    INSERT8_INPUT(parity0, 56, 1);
+    INSERT8_INPUT(parity1, 56, 2);
+#endif
+
     simd_store(systPtr++, syst);
     simd_store(parity0Ptr++, parity0);
     simd_store(parity1Ptr++, parity1);
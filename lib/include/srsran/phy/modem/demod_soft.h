@@ -31,10 +31,12 @@
 #ifndef SRSRAN_DEMOD_SOFT_H
 #define SRSRAN_DEMOD_SOFT_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "modem_table.h"
 #include "srsran/config.h"
+#include "srsran/phy/common/sequence.h"
 
 SRSRAN_API int srsran_demod_soft_demodulate(srsran_mod_t modulation, const cf_t* symbols, float* llr, int nsymbols);
 
@@ -42,4 +44,34 @@ SRSRAN_API int srsran_demod_soft_demodulate_s(srsran_mod_t modulation, const cf_
 
 SRSRAN_API int srsran_demod_soft_demodulate_b(srsran_mod_t modulation, const cf_t* symbols, int8_t* llr, int nsymbols);
 
+/**
+ * @brief Equalizes, soft-demodulates and descrambles a single layer into 8-bit LLR in one pass
+ *
+ * The resource elements are processed in blocks that stay in the L1 cache, so neither the equalized symbols nor the
+ * scrambled LLR are written to an intermediate buffer. The equalizer is the same MMSE combiner as
+ * srsran_predecoding_single_multi() (ZF if the noise estimate is zero).
+ *
+ * @param modulation Modulation of the layer
+ * @param y Received resource elements for each receive antenna
+ * @param h Channel estimates for each receive antenna, NULL if y[0] is already equalized
+ * @param nof_rxant Number of receive antennas
+ * @param scaling Amplitude scaling of the transmitted symbols
+ * @param noise_estimate Noise power for the MMSE equalizer
+ * @param scrambling Scrambling sequence state, advanced by the number of LLR. NULL skips descrambling
+ * @param negate Changes the sign of the LLR before descrambling
+ * @param llr Output LLR, nof_re times the modulation order
+ * @param nof_re Number of resource elements
+ * @return SRSRAN_SUCCESS if the inputs are valid, otherwise an error code
+ */
+SRSRAN_API int srsran_demod_soft_equalize_b(srsran_mod_t             modulation,
+                                            cf_t*                    y[SRSRAN_MAX_PORTS],
+                                            cf_t*                    h[SRSRAN_MAX_PORTS],
+                                            uint32_t                 nof_rxant,
+                                            float                    scaling,
+                                            float                    noise_estimate,
+                                            srsran_sequence_state_t* scrambling,
+                                            bool                     negate,
+                                            int8_t*                  llr,
+                                            uint32_t                 nof_re);
+
 #endif // SRSRAN_DEMOD_SOFT_H
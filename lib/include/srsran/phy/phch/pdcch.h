@@ -45,6 +45,8 @@
 #include "srsran/phy/phch/regs.h"
 #include "srsran/phy/scrambling/scrambling.h"
 
+#define SRSRAN_PDCCH_MAX_BATCH 32
+
 typedef enum SRSRAN_API { SEARCH_UE, SEARCH_COMMON } srsran_pdcch_search_mode_t;
 
 /* PDCCH object */
@@ -65,6 +67,7 @@ typedef struct SRSRAN_API {
   cf_t*    d;
   uint8_t* e;
   float    rm_f[3 * (SRSRAN_DCI_MAX_BITS + 16)];
+  float*   rm_batch[SRSRAN_PDCCH_MAX_BATCH];
   float*   llr;
 
   /* tx & rx objects */
@@ -104,6 +107,22 @@ SRSRAN_API int srsran_pdcch_extract_llr(srsran_pdcch_t*        q,
 SRSRAN_API int
 srsran_pdcch_decode_msg(srsran_pdcch_t* q, srsran_dl_sf_cfg_t* sf, srsran_dci_cfg_t* dci_cfg, srsran_dci_msg_t* msg);
 
+/**
+ * @brief Tries to decode several DCI messages after calling srsran_pdcch_extract_llr. The candidates with the same
+ * payload size are Viterbi-decoded together, the result of each candidate is the same as srsran_pdcch_decode_msg()
+ * @param q PDCCH object
+ * @param sf Subframe configuration
+ * @param dci_cfg DCI configuration
+ * @param msg Candidates to decode, each one with its location and format set
+ * @param nof_msg Number of candidates
+ * @return SRSRAN_SUCCESS if all the candidates are valid, SRSRAN_ERROR code otherwise
+ */
+SRSRAN_API int srsran_pdcch_decode_msg_batch(srsran_pdcch_t*     q,
+                                             srsran_dl_sf_cfg_t* sf,
+                                             srsran_dci_cfg_t*   dci_cfg,
+                                             srsran_dci_msg_t*   msg,
+                                             uint32_t            nof_msg);
+
 /**
  * @brief Computes decoded DCI correlation. It encodes the given DCI message and compares it with the received LLRs
  * @param q PDCCH object
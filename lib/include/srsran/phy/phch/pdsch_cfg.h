@@ -68,6 +68,7 @@ typedef struct SRSRAN_API {
   bool     meas_evm_en;
   bool     meas_time_en;
   uint32_t meas_time_value;
+  bool     store_symbols; // Keep the equalized symbols in the PDSCH object, for instance for plotting them
 } srsran_pdsch_cfg_t;
 
 #endif // SRSRAN_PDSCH_CFG_H
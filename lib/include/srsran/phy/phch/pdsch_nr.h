@@ -64,6 +64,7 @@ typedef struct SRSRAN_API {
   cf_t*                x[SRSRAN_MAX_LAYERS_NR];         ///< PDSCH modulated bits
   srsran_modem_table_t modem_tables[SRSRAN_MOD_NITEMS]; ///< Modulator tables
   srsran_evm_buffer_t* evm_buffer;
+  bool                 store_symbols; ///< Keep the equalized symbols in d, for instance for plotting them
   bool                 meas_time_en;
   uint32_t             meas_time_us;
   srsran_re_pattern_t  dmrs_re_pattern;
@@ -43,9 +43,6 @@
 #include "srsran/phy/phch/regs.h"
 #include "srsran/phy/phch/sch.h"
 #include "srsran/phy/scrambling/scrambling.h"
-typedef struct {
-  srsran_sequence_t seq[SRSRAN_NOF_SF_X_FRAME];
-} srsran_pmch_seq_t;
 
 typedef struct SRSRAN_API {
   srsran_pdsch_cfg_t pdsch_cfg;
@@ -71,9 +68,6 @@ typedef struct SRSRAN_API {
   /* tx & rx objects */
   srsran_modem_table_t mod[4];
 
-  // This is to generate the scrambling seq for multiple MBSFN Area IDs
-  srsran_pmch_seq_t** seqs;
-
   srsran_sch_t dl_sch;
 
 } srsran_pmch_t;
@@ -86,7 +80,10 @@ SRSRAN_API int srsran_pmch_set_cell(srsran_pmch_t* q, srsran_cell_t cell);
 
 SRSRAN_API int srsran_pmch_set_area_id(srsran_pmch_t* q, uint16_t area_id);
 
-SRSRAN_API void srsran_pmch_free_area_id(srsran_pmch_t* q, uint16_t area_id);
+/**
+ * @deprecated The scrambling sequences are no longer stored per MBSFN area, there is nothing to free. It will be removed.
+ */
+SRSRAN_API void srsran_pmch_free_area_id(srsran_pmch_t* q, uint16_t area_id) __attribute__((deprecated));
 
 SRSRAN_API void srsran_configure_pmch(srsran_pmch_cfg_t* pmch_cfg, srsran_cell_t* cell, srsran_mbsfn_cfg_t* mbsfn_cfg);
 
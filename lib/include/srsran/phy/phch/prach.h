@@ -49,7 +49,7 @@
 
 /** Generation and detection of RACH signals for uplink.
  *  Currently only supports preamble formats 0-3.
- *  Does not currently support high speed flag.
+ *  With the high speed flag, the detector combines the Doppler aliases of the restricted set.
  *  Based on 3GPP TS 36.211 version 10.7.0 Release 10.
  */
 
@@ -86,6 +86,8 @@ typedef struct SRSRAN_API {
   uint64_t dft_gen_bitmap;    // Bitmap where each bit Indicates if the dft has been generated for sequence i.
   uint32_t root_seqs_idx[64]; // Indices of root seqs in seqs table
   uint32_t N_roots;           // Number of root sequences used in this configuration
+  uint32_t seq_shift[64];     // Cyclic shift C_v of each preamble sequence
+  uint32_t root_d_u[64];      // Cyclic shift of the Doppler aliases of each root, restricted set only
   cf_t*    td_signals[64];
   // Containers
   cf_t*  ifft_in;
@@ -93,6 +95,7 @@ typedef struct SRSRAN_API {
   cf_t*  prach_bins;
   cf_t*  corr_spec;
   float* corr;
+  float* corr_hs; // Correlation repeated twice, the Doppler aliases of a window are searched without wrapping
 
   // PRACH IFFT
   srsran_dft_plan_t fft;
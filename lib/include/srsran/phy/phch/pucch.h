@@ -34,6 +34,7 @@
 #include "srsran/phy/ch_estimation/chest_ul.h"
 #include "srsran/phy/common/phy_common.h"
 #include "srsran/phy/common/sequence.h"
+#include "srsran/phy/dft/dft.h"
 #include "srsran/phy/modem/mod.h"
 #include "srsran/phy/phch/cqi.h"
 #include "srsran/phy/phch/pucch_cfg.h"
@@ -78,6 +79,13 @@ typedef struct SRSRAN_API {
   cf_t* z_tmp;
   cf_t* ce;
 
+  // Joint format 1 detection, eNb only
+  srsran_dft_plan_t cs_dft;         // 12 point DFT across the cyclic shifts
+  cf_t*             cs_in;          // PRB pair de-rotated by the base sequence, one row per SC-FDMA symbol
+  cf_t*             cs_out;         // Cyclic shift domain of the PRB pair
+  uint32_t*         joint_key;      // PRB pair key of every resource
+  uint32_t          joint_key_size; // Number of allocated keys
+
 } srsran_pucch_t;
 
 typedef struct SRSRAN_API {
@@ -119,6 +127,30 @@ SRSRAN_API int srsran_pucch_decode(srsran_pucch_t*        q,
                                    cf_t*                  sf_symbols,
                                    srsran_pucch_res_t*    data);
 
+/**
+ * Detects jointly all the PUCCH format 1, 1a and 1b resources of a subframe. The resources sharing a PRB pair are
+ * separated with one DFT across the cyclic shift dimension of every SC-FDMA symbol and the orthogonal covers, the
+ * channel of each resource is estimated from its own DMRS cyclic shift. It does not use the UL channel estimator.
+ *
+ * The time alignment is not measured, ta_valid is set to false.
+ *
+ * @param q PUCCH object initialised with srsran_pucch_init_enb()
+ * @param dmrs UL reference signal object of the same cell
+ * @param sf Subframe configuration
+ * @param cfg Configuration of every resource, n_pucch and format 1, 1a or 1b shall be set
+ * @param sf_symbols Received resource grid
+ * @param res Result of every resource
+ * @param nof_resources Number of resources
+ * @return SRSRAN_SUCCESS if no error occurs, SRSRAN_ERROR code otherwise
+ */
+SRSRAN_API int srsran_pucch_decode_format1_joint(srsran_pucch_t*        q,
+                                                 srsran_refsignal_ul_t* dmrs,
+                                                 srsran_ul_sf_cfg_t*    sf,
+                                                 srsran_pucch_cfg_t**   cfg,
+                                                 cf_t*                  sf_symbols,
+                                                 srsran_pucch_res_t**   res,
+                                                 uint32_t               nof_resources);
+
 /* Other utilities. These functions do not modify the state and run in real-time */
 SRSRAN_API float srsran_pucch_alpha_format1(const uint32_t n_cs_cell[SRSRAN_NSLOTS_X_FRAME][SRSRAN_CP_NORM_NSYMB],
                                             const srsran_pucch_cfg_t* cfg,
@@ -119,6 +119,8 @@ SRSRAN_API int srsran_pusch_decode(srsran_pusch_t*        q,
                                    cf_t*                  sf_symbols,
                                    srsran_pusch_res_t*    data);
 
+SRSRAN_API int srsran_pusch_decode_pending(srsran_pusch_t* q);
+
 SRSRAN_API uint32_t srsran_pusch_grant_tx_info(srsran_pusch_grant_t* grant,
                                                srsran_uci_cfg_t*     uci_cfg,
                                                srsran_uci_value_t*   uci_data,
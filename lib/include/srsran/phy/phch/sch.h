@@ -36,6 +36,7 @@
 #include "srsran/phy/fec/turbo/rm_turbo.h"
 #include "srsran/phy/fec/turbo/turbocoder.h"
 #include "srsran/phy/fec/turbo/turbodecoder.h"
+#include "srsran/phy/fec/turbo/turbodecoder_batch.h"
 #include "srsran/phy/phch/pdsch_cfg.h"
 #include "srsran/phy/phch/pusch_cfg.h"
 #include "srsran/phy/phch/uci.h"
@@ -48,6 +49,18 @@
 #define SRSRAN_TX_NULL 100
 #endif
 
+#define SRSRAN_SCH_MAX_PENDING_TB 128
+
+/* Transport block waiting for srsran_sch_decode_pending() */
+typedef struct SRSRAN_API {
+  srsran_softbuffer_rx_t* softbuffer;
+  uint8_t*                data;
+  uint32_t                tbs;
+  uint32_t                cb_len;
+  bool*                   crc;            // Written with the TB CRC result after decoding
+  float*                  avg_iterations; // Written with the number of iterations after decoding
+} srsran_sch_pending_tb_t;
+
 /* DL-SCH AND UL-SCH common functions */
 typedef struct SRSRAN_API {
 
@@ -71,6 +84,15 @@ typedef struct SRSRAN_API {
 
   srsran_uci_cqi_pusch_t uci_cqi;
 
+  /* Single code block transport blocks short enough for the batched decoder are only rate-matched by
+   * srsran_ulsch_decode() and decoded together by srsran_sch_decode_pending() */
+  bool                    batch_enabled;
+  bool                    last_tb_pending;
+  srsran_tdec_batch_t     batch_decoder;
+  srsran_tdec_batch_cb_t  batch_cb[SRSRAN_SCH_MAX_PENDING_TB];
+  srsran_sch_pending_tb_t pending_tb[SRSRAN_SCH_MAX_PENDING_TB];
+  uint32_t                nof_pending_tb;
+
 } srsran_sch_t;
 
 SRSRAN_API int srsran_sch_init(srsran_sch_t* q);
@@ -81,6 +103,12 @@ SRSRAN_API void srsran_sch_set_max_noi(srsran_sch_t* q, uint32_t max_iterations)
 
 SRSRAN_API float srsran_sch_last_noi(srsran_sch_t* q);
 
+SRSRAN_API int srsran_sch_set_batch_decoding(srsran_sch_t* q, bool enable);
+
+SRSRAN_API void srsran_sch_set_pending_result(srsran_sch_t* q, bool* crc, float* avg_iterations);
+
+SRSRAN_API int srsran_sch_decode_pending(srsran_sch_t* q);
+
 SRSRAN_API int srsran_dlsch_encode(srsran_sch_t* q, srsran_pdsch_cfg_t* cfg, uint8_t* data, uint8_t* e_bits);
 
 SRSRAN_API int srsran_dlsch_encode2(srsran_sch_t*       q,
@@ -106,6 +106,116 @@ SRSRAN_API void srsran_resampler_fft_run(srsran_resampler_fft_t* q, const cf_t*
  */
 SRSRAN_API void srsran_resampler_fft_free(srsran_resampler_fft_t* q);
 
+/**
+ * Maximum number of phases of a polyphase resampler with a rational ratio. Ratios that can not be expressed as a
+ * fraction with a numerator equal or smaller than this value are resampled as arbitrary ratios.
+ */
+#define SRSRAN_RESAMPLER_POLY_MAX_PHASES 1024
+
+/**
+ * Default number of filter taps of each phase of the polyphase resampler
+ */
+#define SRSRAN_RESAMPLER_POLY_DEFAULT_NOF_TAPS 32
+
+/**
+ * @brief Polyphase resampler internal buffers and state
+ */
+typedef struct {
+  double   ratio;       ///< Output to input sampling rate ratio, set to 0 if it is not initialised
+  uint32_t nof_taps;    ///< Number of filter taps of each phase
+  uint32_t nof_phases;  ///< Number of filter phases
+  bool     rational;    ///< Set to true if the ratio is exactly the number of phases divided by the step
+  uint32_t stride;      ///< Number of floats between the coefficients of consecutive phases
+  uint64_t den;         ///< Denominator of the fractional input sample position
+  uint32_t step_int;    ///< Integer number of input samples advanced by each output sample
+  uint64_t step_frac;   ///< Fractional input samples advanced by each output sample, in units of 1/den
+  uint32_t phase_shift; ///< Fractional position bit shift that gives the phase of arbitrary ratios
+  int32_t  idx;         ///< Input sample index of the next output sample, relative to the next input block
+  uint64_t frac;        ///< Fractional input sample position of the next output sample, in units of 1/den
+  float*   filter;      ///< Coefficients of each phase, time reversed and repeated for real and imaginary parts
+  float*   filter_diff; ///< Coefficient difference between consecutive phases, used for arbitrary ratios only
+  cf_t*    head;        ///< Last input samples of the previous block followed by the first samples of the current
+} srsran_resampler_poly_t;
+
+/**
+ * @brief Initialises a polyphase resampler for a rational or arbitrary ratio.
+ *
+ * Ratios that can be expressed as a fraction with a numerator up to SRSRAN_RESAMPLER_POLY_MAX_PHASES use one filter
+ * phase for each numerator value. Any other ratio interpolates linearly between the coefficients of adjacent phases.
+ *
+ * @param q Object pointer
+ * @param ratio Output to input sampling rate ratio, greater than 1 interpolates and smaller than 1 decimates
+ * @param nof_taps Number of filter taps of each phase, set to 0 for SRSRAN_RESAMPLER_POLY_DEFAULT_NOF_TAPS
+ * @return SRSRAN_SUCCES if no error, otherwise an SRSRAN error code
+ */
+SRSRAN_API int srsran_resampler_poly_init(srsran_resampler_poly_t* q, double ratio, uint32_t nof_taps);
+
+/**
+ * @brief resets internal polyphase re-sampler state
+ * @param q Object pointer
+ */
+SRSRAN_API void srsran_resampler_poly_reset_state(srsran_resampler_poly_t* q);
+
+/**
+ * @brief Get delay from the polyphase resampler
+ * @param q Object pointer
+ * @return the delay in number of input samples
+ */
+SRSRAN_API double srsran_resampler_poly_get_delay(const srsran_resampler_poly_t* q);
+
+/**
+ * @brief Get the number of input samples required for producing a given number of output samples from the current
+ * state
+ * @param q Object pointer
+ * @param nof_output Number of output samples
+ * @return the number of input samples
+ */
+SRSRAN_API uint32_t srsran_resampler_poly_get_nof_input(const srsran_resampler_poly_t* q, uint32_t nof_output);
+
+/**
+ * @brief Get the number of output samples produced from a given number of input samples from the current state
+ * @param q Object pointer
+ * @param nof_input Number of input samples
+ * @return the number of output samples
+ */
+SRSRAN_API uint32_t srsran_resampler_poly_get_nof_output(const srsran_resampler_poly_t* q, uint32_t nof_input);
+
+/**
+ * @brief Run the polyphase resampler.
+ *
+ * @note Setting the output to NULL is equivalent of dropping output samples
+ *
+ * @param q Object pointer, make sure it has been initialised
+ * @param input Points at the input complex buffer
+ * @param output Points at the output complex buffer, it shall fit srsran_resampler_poly_get_nof_output() samples
+ * @param nsamples Number of input samples
+ * @return The number of output samples
+ */
+SRSRAN_API uint32_t srsran_resampler_poly_run(srsran_resampler_poly_t* q,
+                                              const cf_t*              input,
+                                              cf_t*                    output,
+                                              uint32_t                 nsamples);
+
+/**
+ * @brief Run the polyphase resampler for producing an exact number of output samples.
+ *
+ * @param q Object pointer, make sure it has been initialised
+ * @param input Points at the input complex buffer, it shall hold srsran_resampler_poly_get_nof_input() samples
+ * @param output Points at the output complex buffer
+ * @param nof_output Number of output samples
+ * @return The number of input samples taken
+ */
+SRSRAN_API uint32_t srsran_resampler_poly_run_nof_output(srsran_resampler_poly_t* q,
+                                                         const cf_t*              input,
+                                                         cf_t*                    output,
+                                                         uint32_t                 nof_output);
+
+/**
+ * Free polyphase resampler buffers
+ * @param q  Object pointer
+ */
+SRSRAN_API void srsran_resampler_poly_free(srsran_resampler_poly_t* q);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,11 @@
  */
 #define SRSRAN_SSB_NOF_CANDIDATES 64
 
+/**
+ * @brief Maximum number of SSB center frequencies searched at once by srsran_ssb_search_wideband()
+ */
+#define SRSRAN_SSB_MAX_NOF_SEARCH_FREQ 128
+
 /**
  * @brief Describes SSB object initialization arguments
  */
@@ -97,6 +102,8 @@ typedef struct SRSRAN_API {
   uint32_t symbol_sz;     ///< Current SSB symbol size (for the given base-band sampling rate)
   uint32_t corr_sz;       ///< Correlation size
   uint32_t corr_window;   ///< Correlation window length
+  uint32_t corr_nb_sz;    ///< Narrow band correlation size, number of correlation bins that hold the PSS
+  int32_t  pss_f_offset;  ///< Integer frequency offset of the PSS correlation sequences
   uint32_t ssb_sz;        ///< SSB size in samples at the configured sampling rate
   int32_t  f_offset;      ///< SSB integer frequency offset (multiple of SCS) between DC and the SSB center
   uint32_t cp_sz;         ///< CP length for the given symbol size
@@ -106,11 +113,12 @@ typedef struct SRSRAN_API {
   uint32_t Lmax;                               ///< Number of SSB candidates
 
   /// Internal Objects
-  srsran_dft_plan_t ifft;      ///< IFFT object for modulating the SSB
-  srsran_dft_plan_t fft;       ///< FFT object for demodulate the SSB.
-  srsran_dft_plan_t fft_corr;  ///< FFT for correlation
-  srsran_dft_plan_t ifft_corr; ///< IFFT for correlation
-  srsran_pbch_nr_t  pbch;      ///< PBCH encoder and decoder
+  srsran_dft_plan_t ifft;         ///< IFFT object for modulating the SSB
+  srsran_dft_plan_t fft;          ///< FFT object for demodulate the SSB.
+  srsran_dft_plan_t fft_corr;     ///< FFT for correlation
+  srsran_dft_plan_t ifft_corr;    ///< IFFT for correlation
+  srsran_dft_plan_t ifft_corr_nb; ///< IFFT for narrow band correlation
+  srsran_pbch_nr_t  pbch;         ///< PBCH encoder and decoder
 
   /// Frequency/Time domain temporal data
   cf_t* tmp_freq;                     ///< Temporal frequency domain buffer
@@ -163,6 +171,27 @@ SRSRAN_API int srsran_ssb_set_cfg(srsran_ssb_t* q, const srsran_ssb_cfg_t* cfg);
  */
 SRSRAN_API int srsran_ssb_search(srsran_ssb_t* q, const cf_t* in, uint32_t nof_samples, srsran_ssb_search_res_t* res);
 
+/**
+ * @brief Searches for SSB transmissions at several SSB center frequencies (e.g. GSCN) of a single wideband capture
+ * @note Every correlation window is transformed once, the PSS of each candidate is correlated in its own band with the
+ * PSS sequences shifted in frequency domain
+ * @note All candidates shall be inside the sampled bandwidth and aligned to the SSB subcarrier spacing from the
+ * configured center frequency
+ * @param q SSB object, configured with the capture sampling rate and center frequency
+ * @param in Input baseband buffer
+ * @param nof_samples Number of samples available in the buffer
+ * @param ssb_freq_hz SSB center frequency of each candidate
+ * @param nof_freq Number of candidates, up to SRSRAN_SSB_MAX_NOF_SEARCH_FREQ
+ * @param res One SSB search result for each candidate
+ * @return SRSRAN_SUCCESS if the parameters are valid, SRSRAN_ERROR code otherwise
+ */
+SRSRAN_API int srsran_ssb_search_wideband(srsran_ssb_t*            q,
+                                          const cf_t*              in,
+                                          uint32_t                 nof_samples,
+                                          const double*            ssb_freq_hz,
+                                          uint32_t                 nof_freq,
+                                          srsran_ssb_search_res_t* res);
+
 /**
  * @brief Decides if the SSB object is configured and a given subframe is configured for SSB transmission
  * @param q SSB object
@@ -107,6 +107,8 @@ typedef struct SRSRAN_API {
 
   srsran_dci_location_t allocated_locations[SRSRAN_MAX_DCI_MSG];
   uint32_t              nof_allocated_locations;
+
+  srsran_dci_msg_t dci_candidates[SRSRAN_MAX_CANDIDATES * SRSRAN_MAX_FORMATS];
 } srsran_ue_dl_t;
 
 // Downlink config (includes common and dedicated variables)
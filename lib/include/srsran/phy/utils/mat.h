@@ -67,6 +67,12 @@ SRSRAN_API void srsran_mat_2x2_mmse_csi_gen(cf_t   y0,
 
 SRSRAN_API int srsran_mat_2x2_cn(cf_t h00, cf_t h01, cf_t h10, cf_t h11, float* cn);
 
+/* Maximum order of the Hermitian matrices inverted in place */
+#define SRSRAN_MAT_HERM_MAX_N 4
+
+/* Generic in-place inversion of the leading n x n block of a Hermitian positive definite matrix */
+SRSRAN_API void srsran_mat_herm_inv_gen(cf_t a[SRSRAN_MAT_HERM_MAX_N][SRSRAN_MAT_HERM_MAX_N], uint32_t n);
+
 #ifdef LV_HAVE_SSE
 
 /* SSE implementation for complex reciprocal */
@@ -203,6 +209,35 @@ static inline void srsran_mat_2x2_mmse_simd(simd_cf_t  y0,
   srsran_mat_2x2_mmse_csi_simd(y0, y1, h00, h01, h10, h11, x0, x1, &csi0, &csi1, noise_estimate, norm);
 }
 
+/* Generic SIMD in-place inversion of the leading n x n block of Hermitian positive definite matrices, one matrix per
+ * SIMD lane. Gauss-Jordan elimination does not need pivoting as the pivots of these matrices are real and positive */
+static inline void srsran_mat_herm_inv_simd(simd_cf_t a[SRSRAN_MAT_HERM_MAX_N][SRSRAN_MAT_HERM_MAX_N], uint32_t n)
+{
+  for (uint32_t k = 0; k < n; k++) {
+    /* 1. Reciprocal of the pivot, refined with one Newton-Raphson iteration */
+    simd_f_t d = srsran_simd_cf_re(a[k][k]);
+    simd_f_t p = srsran_simd_f_rcp(d);
+    p          = srsran_simd_f_mul(p, srsran_simd_f_sub(srsran_simd_f_set1(2.0f), srsran_simd_f_mul(d, p)));
+
+    /* 2. Normalise the pivot row */
+    a[k][k] = srsran_simd_cf_set1(1.0f);
+    for (uint32_t j = 0; j < n; j++) {
+      a[k][j] = srsran_simd_cf_mul(a[k][j], p);
+    }
+
+    /* 3. Eliminate the pivot column from the rest of rows */
+    for (uint32_t i = 0; i < n; i++) {
+      if (i != k) {
+        simd_cf_t f = a[i][k];
+        a[i][k]     = srsran_simd_cf_zero();
+        for (uint32_t j = 0; j < n; j++) {
+          a[i][j] = srsran_simd_cf_sub(a[i][j], srsran_simd_cf_prod(f, a[k][j]));
+        }
+      }
+    }
+  }
+}
+
 #endif /* SRSRAN_SIMD_CF_SIZE != 0 */
 
 typedef struct {
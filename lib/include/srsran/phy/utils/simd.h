@@ -1487,6 +1487,25 @@ static inline simd_s_t srsran_simd_s_zero(void)
 #endif /* LV_HAVE_AVX512 */
 }
 
+static inline simd_s_t srsran_simd_s_set1(int16_t x)
+{
+#ifdef LV_HAVE_AVX512
+  return _mm512_set1_epi16(x);
+#else /* LV_HAVE_AVX512 */
+#ifdef LV_HAVE_AVX2
+  return _mm256_set1_epi16(x);
+#else /* LV_HAVE_AVX2 */
+#ifdef LV_HAVE_SSE
+  return _mm_set1_epi16(x);
+#else /* LV_HAVE_SSE */
+#ifdef HAVE_NEON
+  return vdupq_n_s16(x);
+#endif /* HAVE_NEON */
+#endif /* LV_HAVE_SSE */
+#endif /* LV_HAVE_AVX2 */
+#endif /* LV_HAVE_AVX512 */
+}
+
 static inline simd_s_t srsran_simd_s_mul(simd_s_t a, simd_s_t b)
 {
 #ifdef LV_HAVE_AVX512
@@ -1584,6 +1603,25 @@ static inline simd_s_t srsran_simd_s_sub(simd_s_t a, simd_s_t b)
 #endif /* LV_HAVE_AVX512 */
 }
 
+static inline simd_s_t srsran_simd_s_max(simd_s_t a, simd_s_t b)
+{
+#ifdef LV_HAVE_AVX512
+  return _mm512_max_epi16(a, b);
+#else /* LV_HAVE_AVX512 */
+#ifdef LV_HAVE_AVX2
+  return _mm256_max_epi16(a, b);
+#else /* LV_HAVE_AVX2 */
+#ifdef LV_HAVE_SSE
+  return _mm_max_epi16(a, b);
+#else /* LV_HAVE_SSE */
+#ifdef HAVE_NEON
+  return vmaxq_s16(a, b);
+#endif /* HAVE_NEON */
+#endif /* LV_HAVE_SSE */
+#endif /* LV_HAVE_AVX2 */
+#endif /* LV_HAVE_AVX512 */
+}
+
 #endif /* SRSRAN_SIMD_S_SIZE */
 
 #if SRSRAN_SIMD_C16_SIZE
@@ -0,0 +1,78 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         simd_dispatch.h
+ *
+ *  Description:  Helpers for the SIMD code selected at runtime. When the
+ *                library is built with ENABLE_SIMD_DISPATCH the code is built
+ *                for the SSE4.1 baseline, and the SIMD code is also built
+ *                for every ISA of SRSRAN_SIMD_DISPATCH_HAVE_<ISA>:
+ *                - Files built once per ISA get SRSRAN_SIMD_DISPATCH_ISA set
+ *                  to the variant name and suffix their functions with
+ *                  SRSRAN_SIMD_DISPATCH_NAME().
+ *                - Files written for a single ISA are built for that ISA.
+ *                The callers test SRSRAN_SIMD_HAVE_<ISA> to know if a variant
+ *                is built and srsran_simd_isa_enabled() to know if it runs.
+ *
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef SRSRAN_SIMD_DISPATCH_H
+#define SRSRAN_SIMD_DISPATCH_H
+
+#include "srsran/phy/utils/vector_simd.h"
+
+/* Instruction sets with code built in the library, either for the whole build or as a dispatch variant */
+#if defined(LV_HAVE_AVX2) || defined(SRSRAN_SIMD_DISPATCH_HAVE_AVX2)
+#define SRSRAN_SIMD_HAVE_AVX2
+#endif /* defined(LV_HAVE_AVX2) || defined(SRSRAN_SIMD_DISPATCH_HAVE_AVX2) */
+
+#if defined(LV_HAVE_AVX512) || defined(SRSRAN_SIMD_DISPATCH_HAVE_AVX512)
+#define SRSRAN_SIMD_HAVE_AVX512
+#endif /* defined(LV_HAVE_AVX512) || defined(SRSRAN_SIMD_DISPATCH_HAVE_AVX512) */
+
+#ifdef SRSRAN_SIMD_DISPATCH_ISA
+#define SRSRAN_SIMD_DISPATCH_CONCAT_(F, ISA) F##_##ISA
+#define SRSRAN_SIMD_DISPATCH_CONCAT(F, ISA) SRSRAN_SIMD_DISPATCH_CONCAT_(F, ISA)
+#define SRSRAN_SIMD_DISPATCH_NAME(F) SRSRAN_SIMD_DISPATCH_CONCAT(F, SRSRAN_SIMD_DISPATCH_ISA)
+#endif /* SRSRAN_SIMD_DISPATCH_ISA */
+
+/* Declares the variants T_sse41, T_avx2 and T_avx512 of a kernel table of type TYPE */
+#define SRSRAN_SIMD_DISPATCH_DECLARE(TYPE, T)                                                                          \
+  extern const TYPE T##_sse41;                                                                                         \
+  extern const TYPE T##_avx2;                                                                                          \
+  extern const TYPE T##_avx512;
+
+/* Pointer to the fastest variant of the kernel table T which is built and enabled, the baseline is always built */
+#ifdef SRSRAN_SIMD_DISPATCH_HAVE_AVX512
+#define SRSRAN_SIMD_DISPATCH_SELECT_AVX512(T) srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX512) ? &T##_avx512:
+#else /* SRSRAN_SIMD_DISPATCH_HAVE_AVX512 */
+#define SRSRAN_SIMD_DISPATCH_SELECT_AVX512(T)
+#endif /* SRSRAN_SIMD_DISPATCH_HAVE_AVX512 */
+#ifdef SRSRAN_SIMD_DISPATCH_HAVE_AVX2
+#define SRSRAN_SIMD_DISPATCH_SELECT_AVX2(T) srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2) ? &T##_avx2:
+#else /* SRSRAN_SIMD_DISPATCH_HAVE_AVX2 */
+#define SRSRAN_SIMD_DISPATCH_SELECT_AVX2(T)
+#endif /* SRSRAN_SIMD_DISPATCH_HAVE_AVX2 */
+#define SRSRAN_SIMD_DISPATCH_SELECT(T) (SRSRAN_SIMD_DISPATCH_SELECT_AVX512(T) SRSRAN_SIMD_DISPATCH_SELECT_AVX2(T) &T##_sse41)
+
+#endif // SRSRAN_SIMD_DISPATCH_H
@@ -27,9 +27,35 @@ extern "C" {
 #endif
 
 #include "srsran/config.h"
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 
+/* SIMD instruction sets */
+typedef enum {
+  SRSRAN_SIMD_ISA_GENERIC = 0,
+  SRSRAN_SIMD_ISA_SSE41,
+  SRSRAN_SIMD_ISA_AVX,
+  SRSRAN_SIMD_ISA_AVX2,
+  SRSRAN_SIMD_ISA_AVX512,
+  SRSRAN_SIMD_ISA_NEON,
+  SRSRAN_SIMD_ISA_COUNT
+} srsran_simd_isa_t;
+
+SRSRAN_API const char* srsran_simd_isa_to_str(srsran_simd_isa_t isa);
+
+/* Returns true if the host CPU and OS support the given instruction set */
+SRSRAN_API bool srsran_simd_isa_host_supports(srsran_simd_isa_t isa);
+
+/* Returns the instruction set of the SIMD code. If the library is built with ENABLE_SIMD_DISPATCH it is selected at
+ * startup, the fastest variant supported by the host is used unless the environment variable SRSRAN_SIMD_ISA names
+ * another supported one */
+SRSRAN_API srsran_simd_isa_t srsran_vec_simd_isa();
+
+/* Returns true if the code built for the given instruction set can run, that is, the selected instruction set
+ * includes it. The FEC and the demodulators use it to choose among the variants built with ENABLE_SIMD_DISPATCH */
+SRSRAN_API bool srsran_simd_isa_enabled(srsran_simd_isa_t isa);
+
 /*SIMD Logical operations*/
 SRSRAN_API void srsran_vec_xor_bbb_simd(const uint8_t* x, const uint8_t* y, uint8_t* z, int len);
 
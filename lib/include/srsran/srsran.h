@@ -75,6 +75,7 @@ extern "C" {
 #include "srsran/phy/fec/turbo/tc_interl.h"
 #include "srsran/phy/fec/turbo/turbocoder.h"
 #include "srsran/phy/fec/turbo/turbodecoder.h"
+#include "srsran/phy/fec/turbo/turbodecoder_batch.h"
 
 #include "srsran/phy/io/binsource.h"
 #include "srsran/phy/io/filesink.h"
@@ -79,6 +79,11 @@ int srsran_chest_ul_init(srsran_chest_ul_t* q, uint32_t max_prb)
       goto clean_exit;
     }
 
+    q->pucch_base_ls = srsran_vec_cf_malloc((SRSRAN_CHEST_UL_PUCCH_MAX_BASE + 1) * SRSRAN_CHEST_UL_PUCCH_MAX_REFS);
+    if (!q->pucch_base_ls) {
+      perror("malloc");
+      goto clean_exit;
+    }
     q->pilot_known_signal = srsran_vec_cf_malloc(MAX_REFS_SF + 1);
     if (!q->pilot_known_signal) {
       perror("malloc");
@@ -136,6 +141,9 @@ void srsran_chest_ul_free(srsran_chest_ul_t* q)
   if (q->pilot_recv_signal) {
     free(q->pilot_recv_signal);
   }
+  if (q->pucch_base_ls) {
+    free(q->pucch_base_ls);
+  }
   if (q->pilot_known_signal) {
     free(q->pilot_known_signal);
   }
@@ -293,6 +301,7 @@ average_pilots(srsran_chest_ul_t* q, cf_t* input, cf_t* ce, uint32_t nslots, uin
  * @param meas_ta_en enables or disables the Time Alignment error measurement
  * @param write_estimates Write channel estimation in res, (true for DMRS and false for SRS)
  * @param n_prb Resource block start for the grant, set to zero for Sounding Reference Signals
+ * @param pilot_recv Received reference signal of each slot, used for measuring RSRP and EPRE
  * @param res UL channel estimation result
  */
 static void chest_ul_estimate(srsran_chest_ul_t*     q,
@@ -303,6 +312,7 @@ static void chest_ul_estimate(srsran_chest_ul_t*     q,
                               bool                   use_cedron_alg,
                               bool                   write_estimates,
                               uint32_t               n_prb[SRSRAN_NOF_SLOTS_PER_SF],
+                              const cf_t*            pilot_recv[SRSRAN_NOF_SLOTS_PER_SF],
                               srsran_chest_ul_res_t* res)
 {
   // Calculate CFO
@@ -369,13 +379,17 @@ static void chest_ul_estimate(srsran_chest_ul_t*     q,
     }
   }
 
-  // Measure reference signal RE average power
-  cf_t  corr     = srsran_vec_acc_cc(q->pilot_recv_signal, nslots * nrefs_sym) / (nslots * nrefs_sym);
+  // Measure reference signal RE average power and EPRE
+  cf_t  corr = 0.0f;
+  float epre = 0.0f;
+  for (uint32_t i = 0; i < nslots; i++) {
+    corr += srsran_vec_acc_cc(pilot_recv[i], nrefs_sym);
+    epre += srsran_vec_avg_power_cf(pilot_recv[i], nrefs_sym);
+  }
+  corr /= (float)(nslots * nrefs_sym);
+  epre /= (float)nslots;
   float rsrp_avg = __real__ corr * __real__ corr + __imag__ corr * __imag__ corr;
 
-  // Measure EPRE
-  float epre = srsran_vec_avg_power_cf(q->pilot_recv_signal, nslots * nrefs_sym);
-
   // RSRP shall not be greater than EPRE
   rsrp_avg = SRSRAN_MIN(rsrp_avg, epre);
 
@@ -401,35 +415,59 @@ int srsran_chest_ul_estimate_pusch(srsran_chest_ul_t*     q,
                                    cf_t*                  input,
                                    srsran_chest_ul_res_t* res)
 {
+  return srsran_chest_ul_estimate_pusch_batch(q, sf, &cfg, input, &res, 1);
+}
+
+int srsran_chest_ul_estimate_pusch_batch(srsran_chest_ul_t*      q,
+                                         srsran_ul_sf_cfg_t*     sf,
+                                         srsran_pusch_cfg_t**    cfg,
+                                         cf_t*                   input,
+                                         srsran_chest_ul_res_t** res,
+                                         uint32_t                nof_pusch)
+{
+  if (q == NULL || sf == NULL || cfg == NULL || input == NULL || res == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
   if (!q->dmrs_signal_configured) {
     ERROR("Error must call srsran_chest_ul_set_cfg() before using the UL estimator");
     return SRSRAN_ERROR;
   }
 
-  uint32_t nof_prb = cfg->grant.L_prb;
+  for (uint32_t i = 0; i < nof_pusch; i++) {
+    uint32_t nof_prb = cfg[i]->grant.L_prb;
 
-  if (!srsran_dft_precoding_valid_prb(nof_prb)) {
-    ERROR("Error invalid nof_prb=%d", nof_prb);
-    return SRSRAN_ERROR_INVALID_INPUTS;
-  }
-
-  int nrefs_sym = nof_prb * SRSRAN_NRE;
-  int nrefs_sf  = nrefs_sym * SRSRAN_NOF_SLOTS_PER_SF;
+    if (!srsran_dft_precoding_valid_prb(nof_prb)) {
+      ERROR("Error invalid nof_prb=%d", nof_prb);
+      return SRSRAN_ERROR_INVALID_INPUTS;
+    }
 
-  /* Get references from the input signal */
-  srsran_refsignal_dmrs_pusch_get(&q->dmrs_signal, cfg, input, q->pilot_recv_signal);
+    uint32_t    nrefs_sym = nof_prb * SRSRAN_NRE;
+    const cf_t* r         = q->dmrs_pregen.r[cfg[i]->grant.n_dmrs][sf->tti % SRSRAN_NOF_SF_X_FRAME][nof_prb];
 
-  // Use the known DMRS signal to compute Least-squares estimates
-  srsran_vec_prod_conj_ccc(q->pilot_recv_signal,
-                           q->dmrs_pregen.r[cfg->grant.n_dmrs][sf->tti % SRSRAN_NOF_SF_X_FRAME][nof_prb],
-                           q->pilot_estimates,
-                           nrefs_sf);
+    // Compute the Least-squares estimates straight from the resource grid, the DMRS are not copied out
+    const cf_t* pilot_recv[SRSRAN_NOF_SLOTS_PER_SF] = {};
+    for (uint32_t ns = 0; ns < SRSRAN_NOF_SLOTS_PER_SF; ns++) {
+      uint32_t L     = SRSRAN_REFSIGNAL_UL_L(ns, q->cell.cp);
+      pilot_recv[ns] = &input[SRSRAN_RE_IDX(q->cell.nof_prb, L, cfg[i]->grant.n_prb_tilde[ns] * SRSRAN_NRE)];
+      srsran_vec_prod_conj_ccc(
+          pilot_recv[ns], &r[ns * nrefs_sym], &q->pilot_estimates[ns * nrefs_sym], nrefs_sym);
+    }
 
-  // Estimate
-  chest_ul_estimate(
-      q, SRSRAN_NOF_SLOTS_PER_SF, nrefs_sym, 1, cfg->meas_ta_en, cfg->use_cedron_alg, true, cfg->grant.n_prb, res);
+    // Estimate
+    chest_ul_estimate(q,
+                      SRSRAN_NOF_SLOTS_PER_SF,
+                      nrefs_sym,
+                      1,
+                      cfg[i]->meas_ta_en,
+                      cfg[i]->use_cedron_alg,
+                      true,
+                      cfg[i]->grant.n_prb,
+                      pilot_recv,
+                      res[i]);
+  }
 
-  return 0;
+  return SRSRAN_SUCCESS;
 }
 
 static float
@@ -459,55 +497,74 @@ estimate_noise_pilots_pucch(srsran_chest_ul_t* q, cf_t* ce, uint32_t n_rs, uint3
   }
 }
 
-int srsran_chest_ul_estimate_pucch(srsran_chest_ul_t*     q,
-                                   srsran_ul_sf_cfg_t*    sf,
-                                   srsran_pucch_cfg_t*    cfg,
-                                   cf_t*                  input,
-                                   srsran_chest_ul_res_t* res)
+/* Returns the received DMRS of a PUCCH resource multiplied by the conjugated slot base sequences. All the PUCCH DMRS in
+ * the cell share the base sequence, so the resources in the same PRB pair share the product within a batch */
+static cf_t* chest_ul_pucch_base_ls(srsran_chest_ul_t*  q,
+                                    srsran_ul_sf_cfg_t* sf,
+                                    srsran_pucch_cfg_t* cfg,
+                                    cf_t*               input,
+                                    uint32_t            n_rs)
 {
-  int n_rs = srsran_refsignal_dmrs_N_rs(cfg->format, q->cell.cp);
-  if (!n_rs) {
-    ERROR("Error computing N_rs");
-    return SRSRAN_ERROR;
+  // The PRB pair, the first DMRS symbol and the number of DMRS per slot identify the resource elements
+  uint32_t gh  = cfg->group_hopping_en ? 1 : 0;
+  uint32_t l0  = srsran_refsignal_dmrs_pucch_symbol(0, cfg->format, q->cell.cp);
+  uint32_t key = srsran_pucch_n_prb(&q->cell, cfg, 0) | (srsran_pucch_n_prb(&q->cell, cfg, 1) << 8U) | (l0 << 16U) |
+                 (n_rs << 20U) | (gh << 24U);
+
+  for (uint32_t i = 0; i < q->pucch_base_ls_count; i++) {
+    if (q->pucch_base_ls_key[i] == key) {
+      return &q->pucch_base_ls[i * SRSRAN_CHEST_UL_PUCCH_MAX_REFS];
+    }
   }
-  int nrefs_sf = SRSRAN_NRE * n_rs * SRSRAN_NOF_SLOTS_PER_SF;
-
-  /* Get references from the input signal */
-  srsran_refsignal_dmrs_pucch_get(&q->dmrs_signal, cfg, input, q->pilot_recv_signal);
 
-  /* Generate known pilots */
-  if (cfg->format == SRSRAN_PUCCH_FORMAT_2A || cfg->format == SRSRAN_PUCCH_FORMAT_2B) {
-    float max   = -1e9;
-    int   i_max = 0;
+  // When the table is full, the last entry is used as scratch
+  uint32_t idx = q->pucch_base_ls_count;
+  if (idx < SRSRAN_CHEST_UL_PUCCH_MAX_BASE) {
+    q->pucch_base_ls_key[idx] = key;
+    q->pucch_base_ls_count++;
+  }
+  cf_t* base_ls = &q->pucch_base_ls[idx * SRSRAN_CHEST_UL_PUCCH_MAX_REFS];
 
-    int m = 0;
-    if (cfg->format == SRSRAN_PUCCH_FORMAT_2A) {
-      m = 2;
-    } else {
-      m = 4;
+  srsran_refsignal_dmrs_pucch_get(&q->dmrs_signal, cfg, input, base_ls);
+  for (uint32_t ns = 0; ns < SRSRAN_NOF_SLOTS_PER_SF; ns++) {
+    const cf_t* r_uv = q->dmrs_signal.r_uv_pucch[gh][SRSRAN_NOF_SLOTS_PER_SF * (sf->tti % SRSRAN_NOF_SF_X_FRAME) + ns];
+    for (uint32_t m = 0; m < n_rs; m++) {
+      cf_t* y = &base_ls[(ns * n_rs + m) * SRSRAN_NRE];
+      srsran_vec_prod_conj_ccc(y, r_uv, y, SRSRAN_NRE);
     }
+  }
 
-    for (int i = 0; i < m; i++) {
-      cfg->pucch2_drs_bits[0] = i % 2;
-      cfg->pucch2_drs_bits[1] = i / 2;
-      srsran_refsignal_dmrs_pucch_gen(&q->dmrs_signal, sf, cfg, q->pilot_known_signal);
-      srsran_vec_prod_conj_ccc(q->pilot_recv_signal, q->pilot_known_signal, q->pilot_estimates_tmp[i], nrefs_sf);
-      float x = cabsf(srsran_vec_acc_cc(q->pilot_estimates_tmp[i], nrefs_sf));
-      if (x >= max) {
-        max   = x;
-        i_max = i;
+  return base_ls;
+}
+
+/* Removes the cyclic shift and the orthogonal sequence of the resource from the base sequence LS estimates */
+static int chest_ul_pucch_ls(srsran_chest_ul_t*  q,
+                             srsran_ul_sf_cfg_t* sf,
+                             srsran_pucch_cfg_t* cfg,
+                             const cf_t*         base_ls,
+                             uint32_t            n_rs,
+                             cf_t*               ls)
+{
+  for (uint32_t ns = 0; ns < SRSRAN_NOF_SLOTS_PER_SF; ns++) {
+    for (uint32_t m = 0; m < n_rs; m++) {
+      uint32_t n_cs = 0;
+      cf_t     z    = 1.0f;
+      if (srsran_refsignal_dmrs_pucch_cs(
+              &q->dmrs_signal, cfg, SRSRAN_NOF_SLOTS_PER_SF * (sf->tti % SRSRAN_NOF_SF_X_FRAME) + ns, m, &n_cs, &z) <
+          SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
       }
+      uint32_t offset = (ns * n_rs + m) * SRSRAN_NRE;
+      srsran_vec_prod_conj_ccc(&base_ls[offset], q->dmrs_signal.cs_pucch[n_cs], &ls[offset], SRSRAN_NRE);
+      srsran_vec_sc_prod_ccc(&ls[offset], conjf(z), &ls[offset], SRSRAN_NRE);
     }
-    memcpy(q->pilot_estimates, q->pilot_estimates_tmp[i_max], nrefs_sf * sizeof(cf_t));
-    cfg->pucch2_drs_bits[0] = i_max % 2;
-    cfg->pucch2_drs_bits[1] = i_max / 2;
-
-  } else {
-    srsran_refsignal_dmrs_pucch_gen(&q->dmrs_signal, sf, cfg, q->pilot_known_signal);
-    /* Use the known DMRS signal to compute Least-squares estimates */
-    srsran_vec_prod_conj_ccc(q->pilot_recv_signal, q->pilot_known_signal, q->pilot_estimates, nrefs_sf);
   }
+  return SRSRAN_SUCCESS;
+}
 
+static void
+chest_ul_pucch_measure(srsran_chest_ul_t* q, srsran_pucch_cfg_t* cfg, uint32_t n_rs, srsran_chest_ul_res_t* res)
+{
   // Measure reference signal RE average power
   cf_t corr = srsran_vec_acc_cc(q->pilot_estimates, SRSRAN_NOF_SLOTS_PER_SF * SRSRAN_NRE * n_rs) /
               (SRSRAN_NOF_SLOTS_PER_SF * SRSRAN_NRE * n_rs);
@@ -606,7 +663,79 @@ int srsran_chest_ul_estimate_pucch(srsran_chest_ul_t*     q,
     }
   }
 
-  return 0;
+}
+
+int srsran_chest_ul_estimate_pucch(srsran_chest_ul_t*     q,
+                                   srsran_ul_sf_cfg_t*    sf,
+                                   srsran_pucch_cfg_t*    cfg,
+                                   cf_t*                  input,
+                                   srsran_chest_ul_res_t* res)
+{
+  return srsran_chest_ul_estimate_pucch_batch(q, sf, &cfg, input, &res, 1);
+}
+
+int srsran_chest_ul_estimate_pucch_batch(srsran_chest_ul_t*      q,
+                                         srsran_ul_sf_cfg_t*     sf,
+                                         srsran_pucch_cfg_t**    cfg,
+                                         cf_t*                   input,
+                                         srsran_chest_ul_res_t** res,
+                                         uint32_t                nof_pucch)
+{
+  if (q == NULL || sf == NULL || cfg == NULL || input == NULL || res == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  // The shared base sequence estimates are only valid for this subframe
+  q->pucch_base_ls_count = 0;
+
+  for (uint32_t i = 0; i < nof_pucch; i++) {
+    uint32_t n_rs = srsran_refsignal_dmrs_N_rs(cfg[i]->format, q->cell.cp);
+    if (!n_rs) {
+      ERROR("Error computing N_rs");
+      return SRSRAN_ERROR;
+    }
+    uint32_t nrefs_sf = SRSRAN_NRE * n_rs * SRSRAN_NOF_SLOTS_PER_SF;
+
+    /* Get references from the input signal, without the base sequence */
+    const cf_t* base_ls = chest_ul_pucch_base_ls(q, sf, cfg[i], input, n_rs);
+
+    /* Use the known cyclic shift and orthogonal sequence to compute Least-squares estimates */
+    if (cfg[i]->format == SRSRAN_PUCCH_FORMAT_2A || cfg[i]->format == SRSRAN_PUCCH_FORMAT_2B) {
+      float max   = -1e9;
+      int   i_max = 0;
+
+      int m = 0;
+      if (cfg[i]->format == SRSRAN_PUCCH_FORMAT_2A) {
+        m = 2;
+      } else {
+        m = 4;
+      }
+
+      for (int j = 0; j < m; j++) {
+        cfg[i]->pucch2_drs_bits[0] = j % 2;
+        cfg[i]->pucch2_drs_bits[1] = j / 2;
+        if (chest_ul_pucch_ls(q, sf, cfg[i], base_ls, n_rs, q->pilot_estimates_tmp[j]) < SRSRAN_SUCCESS) {
+          return SRSRAN_ERROR;
+        }
+        float x = cabsf(srsran_vec_acc_cc(q->pilot_estimates_tmp[j], nrefs_sf));
+        if (x >= max) {
+          max   = x;
+          i_max = j;
+        }
+      }
+      srsran_vec_cf_copy(q->pilot_estimates, q->pilot_estimates_tmp[i_max], nrefs_sf);
+      cfg[i]->pucch2_drs_bits[0] = i_max % 2;
+      cfg[i]->pucch2_drs_bits[1] = i_max / 2;
+    } else {
+      if (chest_ul_pucch_ls(q, sf, cfg[i], base_ls, n_rs, q->pilot_estimates) < SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
+      }
+    }
+
+    chest_ul_pucch_measure(q, cfg[i], n_rs, res[i]);
+  }
+
+  return SRSRAN_SUCCESS;
 }
 
 int srsran_chest_ul_estimate_srs(srsran_chest_ul_t*                 q,
@@ -640,8 +769,9 @@ int srsran_chest_ul_estimate_srs(srsran_chest_ul_t*                 q,
   srsran_vec_prod_conj_ccc(q->pilot_recv_signal, known_pilots, q->pilot_estimates, n_srs_re);
 
   // Estimate
-  uint32_t n_prb[2] = {};
-  chest_ul_estimate(q, 1, n_srs_re, 1, true, false, false, n_prb, res);
+  uint32_t    n_prb[2]      = {};
+  const cf_t* pilot_recv[2] = {q->pilot_recv_signal, NULL};
+  chest_ul_estimate(q, 1, n_srs_re, 1, true, false, false, n_prb, pilot_recv, res);
 
   return SRSRAN_SUCCESS;
 }
@@ -118,6 +118,28 @@ static int generate_n_prs(srsran_refsignal_ul_t* q)
   return SRSRAN_SUCCESS;
 }
 
+/* PUCCH DMRS share one base sequence per slot in the cell, only the cyclic shift and the orthogonal sequence change */
+static int generate_pucch_base_sequences(srsran_refsignal_ul_t* q)
+{
+  for (uint32_t ns = 0; ns < SRSRAN_NSLOTS_X_FRAME; ns++) {
+    for (uint32_t gh = 0; gh < 2; gh++) {
+      uint32_t f_gh = gh ? q->f_gh[ns] : 0;
+      uint32_t u    = (f_gh + (q->cell.id % 30)) % 30;
+      if (srsran_zc_sequence_generate_lte(u, 0, 0.0f, 1, q->r_uv_pucch[gh][ns]) < SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
+      }
+    }
+  }
+
+  for (uint32_t n_cs = 0; n_cs < SRSRAN_NRE; n_cs++) {
+    for (uint32_t n = 0; n < SRSRAN_NRE; n++) {
+      q->cs_pucch[n_cs][n] = cexpf(I * 2.0f * (float)M_PI * (float)((n_cs * n) % SRSRAN_NRE) / (float)SRSRAN_NRE);
+    }
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
 static int generate_srsran_sequence_hopping_v(srsran_refsignal_ul_t* q)
 {
   srsran_sequence_t seq;
@@ -164,6 +186,11 @@ int srsran_refsignal_ul_set_cell(srsran_refsignal_ul_t* q, srsran_cell_t cell)
       if (srsran_pucch_n_cs_cell(q->cell, q->n_cs_cell)) {
         return SRSRAN_ERROR;
       }
+
+      // Precompute PUCCH DMRS base sequences and cyclic shifts
+      if (generate_pucch_base_sequences(q)) {
+        return SRSRAN_ERROR;
+      }
     }
     ret = SRSRAN_SUCCESS;
   }
@@ -428,6 +455,71 @@ uint32_t srsran_refsignal_dmrs_pucch_symbol(uint32_t m, srsran_pucch_format_t fo
   return 0;
 }
 
+/* Cyclic shift and orthogonal sequence of the PUCCH DMRS according to 5.5.2.2.1 in 36.211 */
+int srsran_refsignal_dmrs_pucch_cs(srsran_refsignal_ul_t* q,
+                                   srsran_pucch_cfg_t*    cfg,
+                                   uint32_t               ns,
+                                   uint32_t               m,
+                                   uint32_t*              n_cs,
+                                   cf_t*                  z)
+{
+  if (q == NULL || cfg == NULL || n_cs == NULL || z == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  uint32_t n_oc = 0;
+
+  uint32_t l = srsran_refsignal_dmrs_pucch_symbol(m, cfg->format, q->cell.cp);
+  // Add cyclic prefix alpha
+  float alpha = 0.0;
+  if (cfg->format < SRSRAN_PUCCH_FORMAT_2) {
+    alpha = srsran_pucch_alpha_format1(q->n_cs_cell, cfg, q->cell.cp, true, ns, l, &n_oc, NULL);
+  } else {
+    alpha = srsran_pucch_alpha_format2(q->n_cs_cell, cfg, ns, l);
+  }
+
+  // Choose number of symbols and orthogonal sequence from Tables 5.5.2.2.1-1 to -3
+  const float* w = NULL;
+  switch (cfg->format) {
+    case SRSRAN_PUCCH_FORMAT_1:
+    case SRSRAN_PUCCH_FORMAT_1A:
+    case SRSRAN_PUCCH_FORMAT_1B:
+      if (SRSRAN_CP_ISNORM(q->cell.cp)) {
+        w = w_arg_pucch_format1_cpnorm[n_oc];
+      } else {
+        w = w_arg_pucch_format1_cpext[n_oc];
+      }
+      break;
+    case SRSRAN_PUCCH_FORMAT_2:
+    case SRSRAN_PUCCH_FORMAT_3:
+      if (SRSRAN_CP_ISNORM(q->cell.cp)) {
+        w = w_arg_pucch_format2_cpnorm;
+      } else {
+        w = w_arg_pucch_format2_cpext;
+      }
+      break;
+    case SRSRAN_PUCCH_FORMAT_2A:
+    case SRSRAN_PUCCH_FORMAT_2B:
+      w = w_arg_pucch_format2_cpnorm;
+      break;
+    default:
+      ERROR("DMRS Generator: Unsupported format %d", cfg->format);
+      return SRSRAN_ERROR;
+  }
+
+  // alpha is always a multiple of 2*pi/12
+  *n_cs = (uint32_t)roundf(alpha * SRSRAN_NRE / (2.0f * (float)M_PI)) % SRSRAN_NRE;
+
+  *z = cexpf(I * w[m]);
+  if (m == 1 && (cfg->format == SRSRAN_PUCCH_FORMAT_2A || cfg->format == SRSRAN_PUCCH_FORMAT_2B)) {
+    cf_t z_m_1 = 1.0;
+    srsran_pucch_format2ab_mod_bits(cfg->format, cfg->pucch2_drs_bits, &z_m_1);
+    *z *= z_m_1;
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
 /* Generates DMRS for PUCCH according to 5.5.2.2 in 36.211 */
 int srsran_refsignal_dmrs_pucch_gen(srsran_refsignal_ul_t* q,
                                     srsran_ul_sf_cfg_t*    sf,
@@ -442,67 +534,19 @@ int srsran_refsignal_dmrs_pucch_gen(srsran_refsignal_ul_t* q,
 
     uint32_t sf_idx = sf->tti % 10;
 
-    cf_t z_m_1 = 1.0;
-    if (cfg->format == SRSRAN_PUCCH_FORMAT_2A || cfg->format == SRSRAN_PUCCH_FORMAT_2B) {
-      srsran_pucch_format2ab_mod_bits(cfg->format, cfg->pucch2_drs_bits, &z_m_1);
-    }
-
     for (uint32_t ns = 2 * sf_idx; ns < 2 * (sf_idx + 1); ns++) {
-      // Get group hopping number u
-      uint32_t f_gh = 0;
-      if (cfg->group_hopping_en) {
-        f_gh = q->f_gh[ns];
-      }
-      uint32_t u = (f_gh + (q->cell.id % 30)) % 30;
+      // Base sequence with group hopping number u
+      const cf_t* r_uv = q->r_uv_pucch[cfg->group_hopping_en ? 1 : 0][ns];
 
       for (uint32_t m = 0; m < N_rs; m++) {
-        uint32_t n_oc = 0;
-
-        uint32_t l = srsran_refsignal_dmrs_pucch_symbol(m, cfg->format, q->cell.cp);
-        // Add cyclic prefix alpha
-        float alpha = 0.0;
-        if (cfg->format < SRSRAN_PUCCH_FORMAT_2) {
-          alpha = srsran_pucch_alpha_format1(q->n_cs_cell, cfg, q->cell.cp, true, ns, l, &n_oc, NULL);
-        } else {
-          alpha = srsran_pucch_alpha_format2(q->n_cs_cell, cfg, ns, l);
-        }
-
-        // Choose number of symbols and orthogonal sequence from Tables 5.5.2.2.1-1 to -3
-        const float* w = NULL;
-        switch (cfg->format) {
-          case SRSRAN_PUCCH_FORMAT_1:
-          case SRSRAN_PUCCH_FORMAT_1A:
-          case SRSRAN_PUCCH_FORMAT_1B:
-            if (SRSRAN_CP_ISNORM(q->cell.cp)) {
-              w = w_arg_pucch_format1_cpnorm[n_oc];
-            } else {
-              w = w_arg_pucch_format1_cpext[n_oc];
-            }
-            break;
-          case SRSRAN_PUCCH_FORMAT_2:
-          case SRSRAN_PUCCH_FORMAT_3:
-            if (SRSRAN_CP_ISNORM(q->cell.cp)) {
-              w = w_arg_pucch_format2_cpnorm;
-            } else {
-              w = w_arg_pucch_format2_cpext;
-            }
-            break;
-          case SRSRAN_PUCCH_FORMAT_2A:
-          case SRSRAN_PUCCH_FORMAT_2B:
-            w = w_arg_pucch_format2_cpnorm;
-            break;
-          default:
-            ERROR("DMRS Generator: Unsupported format %d", cfg->format);
-            return SRSRAN_ERROR;
+        uint32_t n_cs = 0;
+        cf_t     z_m  = 1.0;
+        if (srsran_refsignal_dmrs_pucch_cs(q, cfg, ns, m, &n_cs, &z_m) < SRSRAN_SUCCESS) {
+          return SRSRAN_ERROR;
         }
 
         cf_t* r_sequence = &r_pucch[(ns % 2) * SRSRAN_NRE * N_rs + m * SRSRAN_NRE];
-        srsran_zc_sequence_generate_lte(u, 0, alpha, 1, r_sequence);
-
-        cf_t z_m = cexpf(I * w[m]);
-        if (m == 1) {
-          z_m *= z_m_1;
-        }
+        srsran_vec_prod_ccc(r_uv, q->cs_pucch[n_cs], r_sequence, SRSRAN_NRE);
         srsran_vec_sc_prod_ccc(r_sequence, z_m, r_sequence, SRSRAN_NRE);
       }
     }
@@ -36,6 +36,7 @@ srsran_cell_t cell = {6,              // nof_prb
                       SRSRAN_FDD};
 
 char* output_matlab = NULL;
+bool  wiener        = false;
 
 void usage(char* prog)
 {
@@ -45,6 +46,7 @@ void usage(char* prog)
   printf("\t-e extended cyclic prefix [Default normal]\n");
 
   printf("\t-c cell_id (1000 tests all). [Default %d]\n", cell.id);
+  printf("\t-w use the Wiener estimator [Default %s]\n", wiener ? "yes" : "no");
 
   printf("\t-o output matlab file [Default %s]\n", output_matlab ? output_matlab : "None");
   printf("\t-v increase verbosity\n");
@@ -53,7 +55,7 @@ void usage(char* prog)
 void parse_args(int argc, char** argv)
 {
   int opt;
-  while ((opt = getopt(argc, argv, "recov")) != -1) {
+  while ((opt = getopt(argc, argv, "recowv")) != -1) {
     switch (opt) {
       case 'r':
         cell.nof_prb = (uint32_t)strtol(argv[optind], NULL, 10);
@@ -67,6 +69,9 @@ void parse_args(int argc, char** argv)
       case 'o':
         output_matlab = argv[optind];
         break;
+      case 'w':
+        wiener = true;
+        break;
       case 'v':
         increase_srsran_verbose_level();
         break;
@@ -164,6 +169,11 @@ int main(int argc, char** argv)
       }
 
       srsran_chest_dl_res_t res;
+      srsran_chest_dl_cfg_t chest_cfg;
+      ZERO_OBJECT(chest_cfg);
+      if (wiener) {
+        chest_cfg.estimator_alg = SRSRAN_ESTIMATOR_ALG_WIENER;
+      }
 
       res.ce[0][0] = ce;
 
@@ -173,7 +183,7 @@ int main(int argc, char** argv)
       struct timeval t[3];
       gettimeofday(&t[1], NULL);
       for (int k = 0; k < 100; k++) {
-        srsran_chest_dl_estimate(&est, &sf_cfg, input_m, &res);
+        srsran_chest_dl_estimate_cfg(&est, &sf_cfg, &chest_cfg, input_m, &res);
       }
       gettimeofday(&t[2], NULL);
       get_time_interval(t);
@@ -40,6 +40,9 @@ srsran_cell_t cell = {
 
 char* output_matlab = NULL;
 
+#define TEST_BATCH_MAX 12
+#define TEST_BATCH_PUSCH_MAX 8
+
 void usage(char* prog)
 {
   printf("Usage: %s [recov]\n", prog);
@@ -80,6 +83,138 @@ void parse_args(int argc, char** argv)
   }
 }
 
+static bool res_equal(srsran_chest_ul_res_t* a, srsran_chest_ul_res_t* b, uint32_t num_re)
+{
+  for (uint32_t i = 0; i < num_re; i++) {
+    if (cabsf(a->ce[i] - b->ce[i]) > 1e-5f) {
+      return false;
+    }
+  }
+  return fabsf(a->epre - b->epre) <= 1e-5f * a->epre && fabsf(a->rsrp - b->rsrp) <= 1e-5f * a->epre &&
+         fabsf(a->noise_estimate - b->noise_estimate) <= 1e-5f * a->epre;
+}
+
+/* Checks that the batched estimators give the same results as estimating each transmission on its own, and that the
+ * PUCCH DMRS built from the shared base sequences match the sequence generated with the cyclic shift. It must run
+ * after srsran_chest_ul_pregen() */
+static int test_batch(srsran_chest_ul_t* est, cf_t* input, uint32_t num_re)
+{
+  int                    ret = SRSRAN_ERROR;
+  srsran_chest_ul_res_t  res_single                = {};
+  srsran_chest_ul_res_t  res_batch[TEST_BATCH_MAX] = {};
+  srsran_chest_ul_res_t* res_ptr[TEST_BATCH_MAX]   = {};
+  cf_t                   r_pucch[SRSRAN_CHEST_UL_PUCCH_MAX_REFS];
+  cf_t                   r_ref[SRSRAN_NRE];
+
+  if (srsran_chest_ul_res_init(&res_single, cell.nof_prb)) {
+    return SRSRAN_ERROR;
+  }
+  for (uint32_t i = 0; i < TEST_BATCH_MAX; i++) {
+    if (srsran_chest_ul_res_init(&res_batch[i], cell.nof_prb)) {
+      goto clean_exit;
+    }
+    res_ptr[i] = &res_batch[i];
+  }
+
+  for (uint32_t i = 0; i < num_re; i++) {
+    input[i] = 0.5 - rand() / (float)RAND_MAX + I * (0.5 - rand() / (float)RAND_MAX);
+  }
+
+  srsran_ul_sf_cfg_t ul_sf = {};
+  ul_sf.tti                = 7;
+
+  // PUCCH resources, several of them in the same PRB pair
+  srsran_pucch_format_t formats[4] = {
+      SRSRAN_PUCCH_FORMAT_1, SRSRAN_PUCCH_FORMAT_1A, SRSRAN_PUCCH_FORMAT_2, SRSRAN_PUCCH_FORMAT_2B};
+  srsran_pucch_cfg_t  pucch_cfg[TEST_BATCH_MAX] = {};
+  srsran_pucch_cfg_t* pucch_ptr[TEST_BATCH_MAX] = {};
+  for (uint32_t i = 0; i < TEST_BATCH_MAX; i++) {
+    pucch_cfg[i].format            = formats[i % 4];
+    pucch_cfg[i].n_pucch           = (i * 7) % 24;
+    pucch_cfg[i].delta_pucch_shift = 2;
+    pucch_cfg[i].N_cs              = 0;
+    pucch_cfg[i].n_rb_2            = 1;
+    pucch_cfg[i].group_hopping_en  = (i % 3) == 0;
+    pucch_ptr[i]                   = &pucch_cfg[i];
+
+    if (pucch_cfg[i].format == SRSRAN_PUCCH_FORMAT_2 && SRSRAN_CP_ISNORM(cell.cp)) {
+      if (srsran_refsignal_dmrs_pucch_gen(&est->dmrs_signal, &ul_sf, &pucch_cfg[i], r_pucch)) {
+        goto clean_exit;
+      }
+      for (uint32_t ns = 0; ns < SRSRAN_NOF_SLOTS_PER_SF; ns++) {
+        uint32_t ns_idx = 2 * ul_sf.tti + ns;
+        uint32_t u      = (pucch_cfg[i].group_hopping_en ? est->dmrs_signal.f_gh[ns_idx] : 0) + cell.id % 30;
+        for (uint32_t m = 0; m < 2; m++) {
+          uint32_t l     = srsran_refsignal_dmrs_pucch_symbol(m, pucch_cfg[i].format, cell.cp);
+          float    alpha = srsran_pucch_alpha_format2(est->dmrs_signal.n_cs_cell, &pucch_cfg[i], ns_idx, l);
+          srsran_zc_sequence_generate_lte(u % 30, 0, alpha, 1, r_ref);
+          for (uint32_t k = 0; k < SRSRAN_NRE; k++) {
+            if (cabsf(r_ref[k] - r_pucch[(ns * 2 + m) * SRSRAN_NRE + k]) > 1e-4f) {
+              ERROR("PUCCH DMRS mismatch n_pucch=%d ns=%d m=%d k=%d", pucch_cfg[i].n_pucch, ns, m, k);
+              goto clean_exit;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for (uint32_t i = 0; i < TEST_BATCH_MAX; i++) {
+    srsran_vec_cf_zero(res_batch[i].ce, num_re);
+  }
+  if (srsran_chest_ul_estimate_pucch_batch(est, &ul_sf, pucch_ptr, input, res_ptr, TEST_BATCH_MAX)) {
+    goto clean_exit;
+  }
+  for (uint32_t i = 0; i < TEST_BATCH_MAX; i++) {
+    srsran_vec_cf_zero(res_single.ce, num_re);
+    if (srsran_chest_ul_estimate_pucch(est, &ul_sf, &pucch_cfg[i], input, &res_single)) {
+      goto clean_exit;
+    }
+    if (!res_equal(&res_single, &res_batch[i], num_re)) {
+      ERROR("PUCCH batch mismatch format=%d n_pucch=%d", pucch_cfg[i].format, pucch_cfg[i].n_pucch);
+      goto clean_exit;
+    }
+  }
+
+  // One PUSCH transmission of 6 PRB for each UE, as many UEs as fit in the bandwidth
+  uint32_t            nof_pusch                 = SRSRAN_MIN(cell.nof_prb / 6, TEST_BATCH_PUSCH_MAX);
+  srsran_pusch_cfg_t  pusch_cfg[TEST_BATCH_MAX] = {};
+  srsran_pusch_cfg_t* pusch_ptr[TEST_BATCH_MAX] = {};
+  for (uint32_t i = 0; i < nof_pusch; i++) {
+    pusch_ptr[i]                      = &pusch_cfg[i];
+    pusch_cfg[i].grant.L_prb          = 6;
+    pusch_cfg[i].grant.n_prb[0]       = i * 6;
+    pusch_cfg[i].grant.n_prb[1]       = pusch_cfg[i].grant.n_prb[0];
+    pusch_cfg[i].grant.n_prb_tilde[0] = pusch_cfg[i].grant.n_prb[0];
+    pusch_cfg[i].grant.n_prb_tilde[1] = pusch_cfg[i].grant.n_prb[0];
+    pusch_cfg[i].grant.n_dmrs         = (3 * i) % 8;
+    pusch_cfg[i].meas_ta_en           = true;
+    srsran_vec_cf_zero(res_batch[i].ce, num_re);
+  }
+  if (srsran_chest_ul_estimate_pusch_batch(est, &ul_sf, pusch_ptr, input, res_ptr, nof_pusch)) {
+    goto clean_exit;
+  }
+  for (uint32_t i = 0; i < nof_pusch; i++) {
+    srsran_vec_cf_zero(res_single.ce, num_re);
+    if (srsran_chest_ul_estimate_pusch(est, &ul_sf, &pusch_cfg[i], input, &res_single)) {
+      goto clean_exit;
+    }
+    if (!res_equal(&res_single, &res_batch[i], num_re) || res_single.ta_us != res_batch[i].ta_us) {
+      ERROR("PUSCH batch mismatch n_prb=%d", pusch_cfg[i].grant.n_prb[0]);
+      goto clean_exit;
+    }
+  }
+
+  ret = SRSRAN_SUCCESS;
+
+clean_exit:
+  srsran_chest_ul_res_free(&res_single);
+  for (uint32_t i = 0; i < TEST_BATCH_MAX; i++) {
+    srsran_chest_ul_res_free(&res_batch[i]);
+  }
+  return ret;
+}
+
 int main(int argc, char** argv)
 {
   srsran_chest_ul_t est;
@@ -228,6 +363,11 @@ int main(int argc, char** argv)
         }
       }
     }
+    if (test_batch(&est, input, num_re)) {
+      ERROR("Batch estimation test failed");
+      goto do_exit;
+    }
+
     cid += 10;
     printf("cid=%d\n", cid);
   }
@@ -0,0 +1,192 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+
+#include <complex.h>
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "srsran/phy/ch_estimation/refsignal_dl.h"
+#include "srsran/phy/ch_estimation/wiener_dl.h"
+#include "srsran/phy/utils/random.h"
+#include "srsran/phy/utils/vector.h"
+#include "srsran/support/srsran_test.h"
+
+#define NOF_PATHS 6
+#define NOF_SF 200
+#define NOF_SF_CHECK 2
+#define MAX_RMS_ERROR 1e-5
+#define MAX_ABS_ERROR 1e-4
+
+static srsran_cell_t cell = {10,             // nof_prb
+                             1,              // nof_ports
+                             1,              // cell_id
+                             SRSRAN_CP_NORM, // cyclic prefix
+                             SRSRAN_PHICH_NORM,
+                             SRSRAN_PHICH_R_1_6,
+                             SRSRAN_FDD};
+
+static float snr_db      = 20.0f;
+static float doppler_hz  = 5.0f;
+static char* input_file  = NULL;
+static char* output_file = NULL;
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [rcsdio]\n", prog);
+  printf("\t-r nof_prb [Default %d]\n", cell.nof_prb);
+  printf("\t-c cell_id [Default %d]\n", cell.id);
+  printf("\t-s SNR in dB [Default %.1f]\n", snr_db);
+  printf("\t-d Doppler frequency in Hz [Default %.1f]\n", doppler_hz);
+  printf("\t-i reference estimates file to compare with [Default %s]\n", input_file ? input_file : "None");
+  printf("\t-o file to write the estimates to [Default %s]\n", output_file ? output_file : "None");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "rcsdio")) != -1) {
+    switch (opt) {
+      case 'r':
+        cell.nof_prb = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'c':
+        cell.id = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 's':
+        snr_db = strtof(argv[optind], NULL);
+        break;
+      case 'd':
+        doppler_hz = strtof(argv[optind], NULL);
+        break;
+      case 'i':
+        input_file = argv[optind];
+        break;
+      case 'o':
+        output_file = argv[optind];
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+/*
+ * Feeds the Wiener estimator with the pilots of a deterministic multipath fading channel and compares the estimates of
+ * the last subframes with the ones produced by the reference (scalar) Wiener estimator, stored in the -i file.
+ */
+int main(int argc, char** argv)
+{
+  srsran_wiener_dl_t wiener = {};
+  srsran_random_t    random = srsran_random_init(1234);
+  float              delay[NOF_PATHS];
+  float              angle[NOF_PATHS];
+  cf_t               gain[NOF_PATHS];
+
+  parse_args(argc, argv);
+
+  uint32_t nof_re   = cell.nof_prb * SRSRAN_NRE;
+  uint32_t nof_ref  = cell.nof_prb * 2;
+  uint32_t nof_ce   = nof_re * SRSRAN_CP_NORM_NSYMB * 2;
+  uint32_t shift    = srsran_refsignal_cs_fidx(cell, 0, 0, 0);
+  float    noise_sd = sqrtf(srsran_convert_dB_to_power(-snr_db) / 2.0f);
+  float    snr_lin  = srsran_convert_dB_to_power(snr_db) / 2.0f;
+
+  cf_t* pilots    = srsran_vec_cf_malloc(nof_ref * SRSRAN_NOF_SLOTS_PER_SF * 2);
+  cf_t* ce        = srsran_vec_cf_malloc(nof_ce * NOF_SF_CHECK);
+  cf_t* reference = srsran_vec_cf_malloc(nof_ce * NOF_SF_CHECK);
+  TESTASSERT(pilots && ce && reference);
+
+  TESTASSERT(srsran_wiener_dl_init(&wiener, cell.nof_prb, cell.nof_ports, 1) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_wiener_dl_set_cell(&wiener, cell) == SRSRAN_SUCCESS);
+
+  for (uint32_t p = 0; p < NOF_PATHS; p++) {
+    delay[p] = srsran_random_uniform_real_dist(random, 0.0f, 1e-6f);
+    angle[p] = srsran_random_uniform_real_dist(random, 0.0f, 2.0f * M_PI);
+    gain[p]  = cexpf(I * srsran_random_uniform_real_dist(random, 0.0f, 2.0f * M_PI)) / sqrtf(NOF_PATHS);
+  }
+
+  for (uint32_t sf = 0; sf < NOF_SF; sf++) {
+    // Pilots of port 0, in OFDM symbols 0 and 4 of every slot
+    for (uint32_t l = 0; l < SRSRAN_NOF_SLOTS_PER_SF * 2; l++) {
+      uint32_t nsymb = srsran_refsignal_cs_nsymbol(l, cell.cp, 0);
+      float    t     = (sf * SRSRAN_CP_NORM_NSYMB * 2 + nsymb) * 1e-3f / (SRSRAN_CP_NORM_NSYMB * 2);
+      uint32_t v     = (l % 2) ? 3 : 0;
+      for (uint32_t i = 0; i < nof_ref; i++) {
+        uint32_t k = 6 * i + (shift + v) % 6;
+        cf_t     h = 0;
+        for (uint32_t p = 0; p < NOF_PATHS; p++) {
+          h += gain[p] * cexpf(-I * 2.0f * M_PI * (15e3f * k * delay[p] -
+                                                   doppler_hz * t * cosf(angle[p])));
+        }
+        pilots[nof_ref * l + i] = h + noise_sd * (srsran_random_gauss_dist(random, 1.0f) +
+                                                 I * srsran_random_gauss_dist(random, 1.0f));
+      }
+    }
+
+    // Same sequence of calls as the DL channel estimator
+    cf_t* sf_ce = &ce[nof_ce * (sf % NOF_SF_CHECK)];
+    for (uint32_t m = 0, l = 0; m < 2 * SRSRAN_CP_NORM_NSYMB + 4; m++) {
+      uint32_t ce_idx = (m >= 4) ? (m - 4) * nof_re : 0;
+      uint32_t k      = srsran_refsignal_cs_nsymbol(l, cell.cp, 0);
+      srsran_wiener_dl_run(&wiener, 0, 0, m, shift, &pilots[nof_ref * l], &sf_ce[ce_idx], snr_lin);
+      if (m == k) {
+        l = (l + 1) % 4;
+      }
+    }
+  }
+
+  if (output_file) {
+    srsran_vec_save_file(output_file, ce, sizeof(cf_t) * nof_ce * NOF_SF_CHECK);
+  }
+
+  if (input_file) {
+    FILE* f = fopen(input_file, "r");
+    if (f == NULL) {
+      perror("fopen");
+      return SRSRAN_ERROR;
+    }
+    size_t nread = fread(reference, sizeof(cf_t), nof_ce * NOF_SF_CHECK, f);
+    fclose(f);
+    TESTASSERT(nread == nof_ce * NOF_SF_CHECK);
+
+    float power = srsran_vec_avg_power_cf(reference, nof_ce * NOF_SF_CHECK);
+    srsran_vec_sub_ccc(ce, reference, ce, nof_ce * NOF_SF_CHECK);
+    float rms_error = sqrtf(srsran_vec_avg_power_cf(ce, nof_ce * NOF_SF_CHECK) / power);
+    float abs_error = cabsf(ce[srsran_vec_max_abs_ci(ce, nof_ce * NOF_SF_CHECK)]) / sqrtf(power);
+
+    printf("Normalised error: rms=%.2e; max=%.2e;\n", rms_error, abs_error);
+    TESTASSERT(rms_error < MAX_RMS_ERROR);
+    TESTASSERT(abs_error < MAX_ABS_ERROR);
+  }
+
+  srsran_wiener_dl_free(&wiener);
+  srsran_random_free(random);
+  free(pilots);
+  free(ce);
+  free(reference);
+
+  printf("Ok\n");
+  return SRSRAN_SUCCESS;
+}
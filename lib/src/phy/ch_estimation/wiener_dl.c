@@ -92,7 +92,7 @@ static void                      srsran_wiener_dl_state_reset(srsran_wiener_dl_t
 // Local run function prototypes
 static void
             srsran_wiener_dl_run_symbol_1_8(srsran_wiener_dl_t* q, srsran_wiener_dl_state_t* state, cf_t* pilots, float snr_lin);
-static void srsran_wiener_dl_run_symbol_2_9(srsran_wiener_dl_t* q, srsran_wiener_dl_state_t* state);
+static void srsran_wiener_dl_run_symbol_2_9(srsran_wiener_dl_t* q, srsran_wiener_dl_state_t* state, uint32_t shift);
 static void srsran_wiener_dl_run_symbol_5_12(srsran_wiener_dl_t*       q,
                                              srsran_wiener_dl_state_t* state,
                                              cf_t*                     pilots,
@@ -197,7 +197,9 @@ static void srsran_wiener_dl_state_reset(srsran_wiener_dl_t* q, srsran_wiener_dl
       bzero(state->xfifo[i], NSAMPLES2NBYTES(SRSRAN_WIENER_DL_MIN_RE));
     }
     bzero(state->cV, NSAMPLES2NBYTES(SRSRAN_WIENER_DL_MIN_RE));
+    bzero(state->xsum, NSAMPLES2NBYTES(SRSRAN_WIENER_DL_MIN_RE));
     bzero(state->timefifo, NSAMPLES2NBYTES(SRSRAN_WIENER_DL_TIMEFIFO_SIZE));
+    bzero(state->cxsum, NSAMPLES2NBYTES(SRSRAN_WIENER_DL_TIMEFIFO_SIZE));
 
     for (uint32_t i = 0; i < SRSRAN_WIENER_DL_CXFIFO_SIZE; i++) {
       bzero(state->cxfifo[i], NSAMPLES2NBYTES(SRSRAN_WIENER_DL_TIMEFIFO_SIZE));
@@ -210,6 +212,8 @@ static void srsran_wiener_dl_state_reset(srsran_wiener_dl_t* q, srsran_wiener_dl
     state->sumlen       = 0;
     state->skip         = 0;
     state->cnt          = 0;
+    state->cxcnt        = 0;
+    state->xcnt         = 0;
   }
 }
 
@@ -366,8 +370,7 @@ void srsran_wiener_dl_reset(srsran_wiener_dl_t* q)
     }
 
     // Reset wiener
-    bzero(q->wm1, NSAMPLES2NBYTES(SRSRAN_WIENER_DL_MIN_REF * SRSRAN_WIENER_DL_MIN_RE));
-    bzero(q->wm2, NSAMPLES2NBYTES(SRSRAN_WIENER_DL_MIN_REF * SRSRAN_WIENER_DL_MIN_RE));
+    bzero(q->wm, sizeof(q->wm));
   }
 }
 
@@ -464,82 +467,93 @@ static inline uint32_t vec_find_first_smaller_than_cf(cf_t* x, float y, uint32_t
   return ret;
 }
 
-static inline cf_t _srsran_vec_dot_prod_ccc_simd(const cf_t* x, const cf_t* y, const int len)
+inline static cf_t _cmul(cf_t a, cf_t b)
 {
-  int  i      = 0;
-  cf_t result = 0;
+  cf_t ret = 0;
 
-#if SRSRAN_SIMD_CF_SIZE
-  if (len >= SRSRAN_SIMD_CF_SIZE) {
-    simd_cf_t avx_result = srsran_simd_cf_zero();
-    for (; i < len - SRSRAN_SIMD_CF_SIZE + 1; i += SRSRAN_SIMD_CF_SIZE) {
-      simd_cf_t xVal = srsran_simd_cfi_loadu(&x[i]);
-      simd_cf_t yVal = srsran_simd_cfi_loadu(&y[i]);
+  __real__ ret = __real__ a * __real__ b - __imag__ a * __imag__ b;
+  __imag__ ret = __real__ a * __imag__ b + __imag__ a * __real__ b;
 
-      avx_result = srsran_simd_cf_add(srsran_simd_cf_prod(xVal, yVal), avx_result);
-    }
+  return ret;
+}
 
-    __attribute__((aligned(64))) float simd_dotProdVector[SRSRAN_SIMD_CF_SIZE];
-    simd_f_t                           acc_re = srsran_simd_cf_re(avx_result);
-    simd_f_t                           acc_im = srsran_simd_cf_im(avx_result);
+// Applies a transposed Wiener matrix to SRSRAN_WIENER_DL_MIN_REF pilots: h[i] = sum_k ref[k] * wm[k][offset + i]
+static void wiener_dl_apply(const cf_t wm[SRSRAN_WIENER_DL_MIN_REF][SRSRAN_WIENER_DL_MIN_RE],
+                            const cf_t* ref,
+                            uint32_t    offset,
+                            cf_t*       h,
+                            uint32_t    len)
+{
+  uint32_t i = 0;
+
+#if SRSRAN_SIMD_CF_SIZE
+  simd_cf_t r[SRSRAN_WIENER_DL_MIN_REF];
+  for (uint32_t k = 0; k < SRSRAN_WIENER_DL_MIN_REF; k++) {
+    r[k] = srsran_simd_cf_set1(ref[k]);
+  }
 
-    simd_f_t acc = srsran_simd_f_hadd(acc_re, acc_im);
-    for (int j = 2; j < SRSRAN_SIMD_F_SIZE; j *= 2) {
-      acc = srsran_simd_f_hadd(acc, acc);
+  for (; i + SRSRAN_SIMD_CF_SIZE <= len; i += SRSRAN_SIMD_CF_SIZE) {
+    simd_cf_t acc = srsran_simd_cf_prod(r[0], srsran_simd_cfi_loadu(&wm[0][offset + i]));
+    for (uint32_t k = 1; k < SRSRAN_WIENER_DL_MIN_REF; k++) {
+      acc = srsran_simd_cf_add(acc, srsran_simd_cf_prod(r[k], srsran_simd_cfi_loadu(&wm[k][offset + i])));
     }
-    srsran_simd_f_store(simd_dotProdVector, acc);
-    __real__ result = simd_dotProdVector[0];
-    __imag__ result = simd_dotProdVector[1];
+    srsran_simd_cfi_storeu(&h[i], acc);
   }
 #endif
 
   for (; i < len; i++) {
-    result += (x[i] * y[i]);
+    cf_t acc = 0;
+    for (uint32_t k = 0; k < SRSRAN_WIENER_DL_MIN_REF; k++) {
+      acc += _cmul(ref[k], wm[k][offset + i]);
+    }
+    h[i] = acc;
   }
-
-  return result;
 }
 
 static void estimate_wiener(srsran_wiener_dl_t* q,
-                            const cf_t          wm[SRSRAN_WIENER_DL_MIN_RE][SRSRAN_WIENER_DL_MIN_REF],
+                            const cf_t          wm[SRSRAN_WIENER_DL_MIN_REF][SRSRAN_WIENER_DL_MIN_RE],
                             cf_t*               ref,
                             cf_t*               h)
 {
-  uint32_t r_offset = 0; // Resource Element indexing offset
-  uint32_t p_offset = 0; // Pilot indexing offset
-
   // Estimate lower band
-  for (uint32_t i = 0; i < SRSRAN_WIENER_DL_MIN_RE; i++) {
-    h[r_offset + i] = _srsran_vec_dot_prod_ccc_simd(&ref[p_offset], wm[i], SRSRAN_WIENER_DL_MIN_REF);
-  }
+  wiener_dl_apply(wm, ref, 0, h, SRSRAN_WIENER_DL_MIN_RE);
 
   // Estimate Upper band (it might overlap in 6PRB cells with the lower band)
-  r_offset = q->nof_re - SRSRAN_WIENER_DL_MIN_RE;
-  p_offset = q->nof_ref - SRSRAN_WIENER_DL_MIN_REF;
-  for (uint32_t i = 0; i < SRSRAN_WIENER_DL_MIN_RE; i++) {
-    h[r_offset + i] = _srsran_vec_dot_prod_ccc_simd(&ref[p_offset], wm[i], SRSRAN_WIENER_DL_MIN_REF);
-  }
+  wiener_dl_apply(wm,
+                  &ref[q->nof_ref - SRSRAN_WIENER_DL_MIN_REF],
+                  0,
+                  &h[q->nof_re - SRSRAN_WIENER_DL_MIN_RE],
+                  SRSRAN_WIENER_DL_MIN_RE);
 
   // Estimate center Resource elements
   if (q->nof_re > 2 * SRSRAN_WIENER_DL_MIN_RE) {
     for (uint32_t prb = 2; prb < q->nof_prb - 2; prb += 2) {
-      p_offset = (prb - 1) * 2;
-      r_offset = prb * SRSRAN_NRE;
-      for (uint32_t i = 0; i < SRSRAN_NRE * 2; i++) {
-        h[r_offset + i] = _srsran_vec_dot_prod_ccc_simd(&ref[p_offset], wm[i + SRSRAN_NRE], SRSRAN_WIENER_DL_MIN_REF);
-      }
+      wiener_dl_apply(wm, &ref[(prb - 1) * 2], SRSRAN_NRE, &h[prb * SRSRAN_NRE], SRSRAN_NRE * 2);
     }
   }
 }
 
-inline static cf_t _cmul(cf_t a, cf_t b)
+// Linear interpolation in time between the last two estimates: out = t1 + (t0 - t1) * alpha
+static void wiener_dl_interpolate(const cf_t* t0, const cf_t* t1, float alpha, cf_t* out, uint32_t nof_re)
 {
-  cf_t ret = 0;
-
-  __real__ ret = __real__ a * __real__ b - __imag__ a * __imag__ b;
-  __imag__ ret = __real__ a * __imag__ b + __imag__ a * __real__ b;
+  const float* x0  = (const float*)t0;
+  const float* x1  = (const float*)t1;
+  float*       y   = (float*)out;
+  uint32_t     len = 2 * nof_re;
+  uint32_t     i   = 0;
+
+#if SRSRAN_SIMD_F_SIZE
+  simd_f_t a = srsran_simd_f_set1(alpha);
+  for (; i + SRSRAN_SIMD_F_SIZE <= len; i += SRSRAN_SIMD_F_SIZE) {
+    simd_f_t v0 = srsran_simd_f_loadu(&x0[i]);
+    simd_f_t v1 = srsran_simd_f_loadu(&x1[i]);
+    srsran_simd_f_storeu(&y[i], srsran_simd_f_add(v1, srsran_simd_f_mul(srsran_simd_f_sub(v0, v1), a)));
+  }
+#endif
 
-  return ret;
+  for (; i < len; i++) {
+    y[i] = x1[i] + (x0[i] - x1[i]) * alpha;
+  }
 }
 
 static void
@@ -555,12 +569,20 @@ srsran_wiener_dl_run_symbol_1_8(srsran_wiener_dl_t* q, srsran_wiener_dl_state_t*
   state->timefifo[0] = conjf(pilots[SRSRAN_WIENER_HALFREF_IDX]);          // train with center of subband frequency
 
   circshift_dim1(state->cxfifo, SRSRAN_WIENER_DL_CXFIFO_SIZE, 1); // shift rows down one position
+  srsran_vec_sub_ccc(state->cxsum, state->cxfifo[0], state->cxsum, SRSRAN_WIENER_DL_TIMEFIFO_SIZE); // drop oldest
   srsran_vec_sc_prod_ccc(
       state->timefifo, pilots[SRSRAN_WIENER_HALFREF_IDX], state->cxfifo[0], SRSRAN_WIENER_DL_TIMEFIFO_SIZE);
 
-  // Calculate auto-correlation and normalize
-  matrix_acc_dim1_cc(state->cxfifo, q->tmp, SRSRAN_WIENER_DL_CXFIFO_SIZE, SRSRAN_WIENER_DL_TIMEFIFO_SIZE);
-  srsran_vec_sc_prod_cfc(q->tmp, 1.0f / SRSRAN_WIENER_DL_CXFIFO_SIZE, q->tmp, SRSRAN_WIENER_DL_TIMEFIFO_SIZE);
+  // Update the auto-correlation sum, recompute it once per fifo length to bound the rounding error
+  if (++state->cxcnt == SRSRAN_WIENER_DL_CXFIFO_SIZE) {
+    state->cxcnt = 0;
+    matrix_acc_dim1_cc(state->cxfifo, state->cxsum, SRSRAN_WIENER_DL_CXFIFO_SIZE, SRSRAN_WIENER_DL_TIMEFIFO_SIZE);
+  } else {
+    srsran_vec_sum_ccc(state->cxsum, state->cxfifo[0], state->cxsum, SRSRAN_WIENER_DL_TIMEFIFO_SIZE);
+  }
+
+  // Normalize auto-correlation
+  srsran_vec_sc_prod_cfc(state->cxsum, 1.0f / SRSRAN_WIENER_DL_CXFIFO_SIZE, q->tmp, SRSRAN_WIENER_DL_TIMEFIFO_SIZE);
 
   // Find index of half amplitude
   uint32_t halfcx = vec_find_first_smaller_than_cf(q->tmp, cabsf(q->tmp[1]) * 0.5f, SRSRAN_WIENER_DL_TIMEFIFO_SIZE, 2);
@@ -570,7 +592,7 @@ srsran_wiener_dl_run_symbol_1_8(srsran_wiener_dl_t* q, srsran_wiener_dl_state_t*
   state->skip         = SRSRAN_MAX(1, floorf(halfcx / 4.0f * SRSRAN_MIN(1, snr_lin / 16.0f)));
 }
 
-static void srsran_wiener_dl_run_symbol_2_9(srsran_wiener_dl_t* q, srsran_wiener_dl_state_t* state)
+static void srsran_wiener_dl_run_symbol_2_9(srsran_wiener_dl_t* q, srsran_wiener_dl_state_t* state, uint32_t shift)
 {
 
   // here we only shift and feed TD interpolation fifo
@@ -580,8 +602,8 @@ static void srsran_wiener_dl_run_symbol_2_9(srsran_wiener_dl_t* q, srsran_wiener
   matrix_acc_dim1_cc(state->hls_fifo_2, q->tmp, state->sumlen, q->nof_ref); // Sum values
   srsran_vec_sc_prod_cfc(q->tmp, 1.0f / state->sumlen, q->tmp, q->nof_ref); // Scale sum
 
-  // Estimate channel based on the wiener matrix 2
-  estimate_wiener(q, q->wm2, q->tmp, state->tfifo[0]);
+  // Estimate channel based on the wiener matrix for the first pilot symbol of the slot
+  estimate_wiener(q, q->wm[shift / 3], q->tmp, state->tfifo[0]);
 
   // Update internal states
   state->deltan       = 0.0f;
@@ -606,8 +628,8 @@ static void srsran_wiener_dl_run_symbol_5_12(srsran_wiener_dl_t*       q,
   matrix_acc_dim1_cc(state->hls_fifo_1, q->tmp, state->sumlen, q->nof_ref); // Sum values
   srsran_vec_sc_prod_cfc(q->tmp, 1.0f / state->sumlen, q->tmp, q->nof_ref); // Scale sum
 
-  // Estimate channel based on the wiener matrix 1
-  estimate_wiener(q, q->wm1, q->tmp, state->tfifo[0]);
+  // Estimate channel based on the wiener matrix for the second pilot symbol of the slot
+  estimate_wiener(q, q->wm[((shift + 3) % 6) / 3], q->tmp, state->tfifo[0]);
 
   // Update internal states
   state->deltan       = 0.0f;
@@ -653,13 +675,17 @@ static void srsran_wiener_dl_run_symbol_5_12(srsran_wiener_dl_t*       q,
     // Put correlation in FIFO
     state->nfifosamps = SRSRAN_MIN(state->nfifosamps + 1, SRSRAN_WIENER_DL_XFIFO_SIZE);
     circshift_dim1(state->xfifo, state->nfifosamps, 1);
+    srsran_vec_sub_ccc(state->xsum, state->xfifo[0], state->xsum, SRSRAN_WIENER_DL_MIN_RE); // drop oldest
     memcpy(state->xfifo[0], q->hlsv_sum, NSAMPLES2NBYTES(SRSRAN_WIENER_DL_MIN_RE));
 
-    // Average samples in FIFO
-    matrix_acc_dim1_cc(state->xfifo, state->cV, SRSRAN_WIENER_DL_XFIFO_SIZE, SRSRAN_WIENER_DL_MIN_RE);
-    if (state->nfifosamps) {
-      srsran_vec_sc_prod_cfc(state->cV, 1.0f / state->nfifosamps, state->cV, SRSRAN_WIENER_DL_MIN_RE);
+    // Average samples in FIFO, recompute the sum once per fifo length to bound the rounding error
+    if (++state->xcnt == SRSRAN_WIENER_DL_XFIFO_SIZE) {
+      state->xcnt = 0;
+      matrix_acc_dim1_cc(state->xfifo, state->xsum, SRSRAN_WIENER_DL_XFIFO_SIZE, SRSRAN_WIENER_DL_MIN_RE);
+    } else {
+      srsran_vec_sum_ccc(state->xsum, state->xfifo[0], state->xsum, SRSRAN_WIENER_DL_MIN_RE);
     }
+    srsran_vec_sc_prod_cfc(state->xsum, 1.0f / state->nfifosamps, state->cV, SRSRAN_WIENER_DL_MIN_RE);
 
     // Interpolate
     srsran_dft_run_c(&q->fft, state->cV, q->tmp);
@@ -714,7 +740,7 @@ static void srsran_wiener_dl_run_symbol_5_12(srsran_wiener_dl_t*       q,
       // Compute wiener correlation inverse matrix
       srsran_matrix_NxN_inv_run(q->matrix_inverter, q->RH.v, q->invRH.v);
 
-      // Generate Rectangular Wiener
+      // Generate Rectangular Wiener for both pilot offsets
       for (uint32_t i = 0; i < SRSRAN_WIENER_DL_MIN_RE; i++) {
         for (uint32_t k = 0; k < SRSRAN_WIENER_DL_MIN_REF; k++) {
           int m1 = ((shift + 3) % 6) + 6 * k - i;
@@ -734,15 +760,19 @@ static void srsran_wiener_dl_run_symbol_5_12(srsran_wiener_dl_t*       q,
         }
       }
 
-      // Compute Wiener matrices
+      // Compute transposed Wiener matrices
+      cf_t(*wm1)[SRSRAN_WIENER_DL_MIN_RE] = q->wm[((shift + 3) % 6) / 3];
+      cf_t(*wm2)[SRSRAN_WIENER_DL_MIN_RE] = q->wm[shift / 3];
       for (uint32_t dim1 = 0; dim1 < SRSRAN_WIENER_DL_MIN_RE; dim1++) {
         for (uint32_t dim2 = 0; dim2 < SRSRAN_WIENER_DL_MIN_REF; dim2++) {
-          q->wm1[dim1][dim2] = 0;
-          q->wm2[dim1][dim2] = 0;
+          cf_t acc1 = 0;
+          cf_t acc2 = 0;
           for (int i = 0; i < SRSRAN_WIENER_DL_MIN_REF; i++) {
-            q->wm1[dim1][dim2] += _cmul(q->hH1[dim1][i], q->invRH.m[i][dim2]);
-            q->wm2[dim1][dim2] += _cmul(q->hH2[dim1][i], q->invRH.m[i][dim2]);
+            acc1 += _cmul(q->hH1[dim1][i], q->invRH.m[i][dim2]);
+            acc2 += _cmul(q->hH2[dim1][i], q->invRH.m[i][dim2]);
           }
+          wm1[dim2][dim1] = acc1;
+          wm2[dim2][dim1] = acc2;
         }
       }
       q->wm_computed = true;
@@ -777,7 +807,7 @@ int srsran_wiener_dl_run(srsran_wiener_dl_t* q,
         break;
       case 2:
       case 9:
-        srsran_wiener_dl_run_symbol_2_9(q, state);
+        srsran_wiener_dl_run_symbol_2_9(q, state, shift);
         break;
       case 5:
       case 12:
@@ -788,9 +818,7 @@ int srsran_wiener_dl_run(srsran_wiener_dl_t* q,
     }
 
     // Estimate
-    srsran_vec_sub_ccc(state->tfifo[0], state->tfifo[1], q->tmp, q->nof_re);
-    srsran_vec_sc_prod_cfc(q->tmp, state->deltan * state->invtpilotoff, q->tmp, q->nof_re);
-    srsran_vec_sum_ccc(state->tfifo[1], q->tmp, estimated, q->nof_re);
+    wiener_dl_interpolate(state->tfifo[0], state->tfifo[1], state->deltan * state->invtpilotoff, estimated, q->nof_re);
     state->deltan += 1.0f;
 
     ret = SRSRAN_SUCCESS;
@@ -43,15 +43,15 @@ channel::channel(const channel::args_t& channel_args, uint32_t _nof_channels, sr
   // Copy args
   args = channel_args;
 
-  // Allocate internal buffers
-  buffer_in  = srsran_vec_cf_malloc(buffer_size);
-  buffer_out = srsran_vec_cf_malloc(buffer_size);
-  if (!buffer_out || !buffer_in) {
-    ret = SRSRAN_ERROR;
-  }
-
   nof_channels = _nof_channels;
   for (uint32_t i = 0; i < nof_channels; i++) {
+    // Allocate internal buffers, every channel has its own so they can be processed in parallel
+    buffer_in[i]  = srsran_vec_cf_malloc(buffer_size);
+    buffer_out[i] = srsran_vec_cf_malloc(buffer_size);
+    if (!buffer_out[i] || !buffer_in[i]) {
+      ret = SRSRAN_ERROR;
+    }
+
     // Create fading channel
     if (channel_args.fading_enable && !channel_args.fading_model.empty() && channel_args.fading_model != "none" &&
         ret == SRSRAN_SUCCESS) {
@@ -73,19 +73,19 @@ channel::channel(const channel::args_t& channel_args, uint32_t _nof_channels, sr
     } else {
       delay[i] = nullptr;
     }
-  }
 
-  // Create AWGN channnel
-  if (channel_args.awgn_enable && ret == SRSRAN_SUCCESS) {
-    awgn = (srsran_channel_awgn_t*)calloc(sizeof(srsran_channel_awgn_t), 1);
-    ret  = srsran_channel_awgn_init(awgn, 1234);
-    srsran_channel_awgn_set_n0(awgn, args.awgn_signal_power_dBfs - args.awgn_snr_dB);
-  }
+    // Create AWGN channnel
+    if (channel_args.awgn_enable && ret == SRSRAN_SUCCESS) {
+      awgn[i] = (srsran_channel_awgn_t*)calloc(sizeof(srsran_channel_awgn_t), 1);
+      ret     = srsran_channel_awgn_init(awgn[i], 1234 + i);
+      srsran_channel_awgn_set_n0(awgn[i], args.awgn_signal_power_dBfs - args.awgn_snr_dB);
+    }
 
-  // Create high speed train
-  if (channel_args.hst_enable && ret == SRSRAN_SUCCESS) {
-    hst = (srsran_channel_hst_t*)calloc(sizeof(srsran_channel_hst_t), 1);
-    srsran_channel_hst_init(hst, channel_args.hst_fd_hz, channel_args.hst_period_s, channel_args.hst_init_time_s);
+    // Create high speed train, the doppler shift is the same for all channels
+    if (channel_args.hst_enable && ret == SRSRAN_SUCCESS) {
+      hst[i] = (srsran_channel_hst_t*)calloc(sizeof(srsran_channel_hst_t), 1);
+      srsran_channel_hst_init(hst[i], channel_args.hst_fd_hz, channel_args.hst_period_s, channel_args.hst_init_time_s);
+    }
   }
 
   // Create Radio Link Failure simulator
@@ -94,6 +94,12 @@ channel::channel(const channel::args_t& channel_args, uint32_t _nof_channels, sr
     srsran_channel_rlf_init(rlf, channel_args.rlf_t_on_ms, channel_args.rlf_t_off_ms);
   }
 
+  // Launch workers, the caller thread processes its share of channels too
+  uint32_t nof_workers = SRSRAN_MIN(channel_args.nof_threads, nof_channels);
+  for (uint32_t w = 1; w < nof_workers && ret == SRSRAN_SUCCESS; w++) {
+    workers.emplace_back(&channel::worker_loop, this, w);
+  }
+
   if (ret != SRSRAN_SUCCESS) {
     fprintf(stderr, "Error: Creating channel\n\n");
   }
@@ -101,22 +107,14 @@ channel::channel(const channel::args_t& channel_args, uint32_t _nof_channels, sr
 
 channel::~channel()
 {
-  if (buffer_in) {
-    free(buffer_in);
+  // Stop workers
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    quit = true;
   }
-
-  if (buffer_out) {
-    free(buffer_out);
-  }
-
-  if (awgn) {
-    srsran_channel_awgn_free(awgn);
-    free(awgn);
-  }
-
-  if (hst) {
-    srsran_channel_hst_free(hst);
-    free(hst);
+  cvar_start.notify_all();
+  for (std::thread& worker : workers) {
+    worker.join();
   }
 
   if (rlf) {
@@ -125,6 +123,24 @@ channel::~channel()
   }
 
   for (uint32_t i = 0; i < nof_channels; i++) {
+    if (buffer_in[i]) {
+      free(buffer_in[i]);
+    }
+
+    if (buffer_out[i]) {
+      free(buffer_out[i]);
+    }
+
+    if (awgn[i]) {
+      srsran_channel_awgn_free(awgn[i]);
+      free(awgn[i]);
+    }
+
+    if (hst[i]) {
+      srsran_channel_hst_free(hst[i]);
+      free(hst[i]);
+    }
+
     if (fading[i]) {
       srsran_channel_fading_free(fading[i]);
       free(fading[i]);
@@ -147,66 +163,120 @@ static inline cf_t local_cexpf(float phase)
 }
 }
 
-void channel::run(cf_t*                     in[SRSRAN_MAX_CHANNELS],
-                  cf_t*                     out[SRSRAN_MAX_CHANNELS],
-                  uint32_t                  len,
-                  const srsran_timestamp_t& t)
+void channel::run_channel(uint32_t i, cf_t* in, cf_t* out, uint32_t len, const srsran_timestamp_t& t)
 {
-  // Early return if pointers are not enabled
+  // Skip if any buffer is null
   if (in == nullptr || out == nullptr) {
     return;
   }
 
-  // For each channel
-  for (uint32_t i = 0; i < nof_channels; i++) {
-    // Skip iteration if any buffer is null
-    if (in[i] == nullptr || out[i] == nullptr) {
-      continue;
+  // If sampling rate is not set, copy input and skip rest of channel
+  if (current_srate == 0) {
+    if (in != out) {
+      srsran_vec_cf_copy(out, in, len);
     }
+    return;
+  }
 
-    // If sampling rate is not set, copy input and skip rest of channel
-    if (current_srate == 0) {
-      if (in[i] != out[i]) {
-        srsran_vec_cf_copy(out[i], in[i], len);
-      }
-      continue;
-    }
+  // Every stage reads x and writes y, then the buffers are swapped
+  cf_t* x = buffer_in[i];
+  cf_t* y = buffer_out[i];
 
-    // Copy input buffer
-    srsran_vec_cf_copy(buffer_in, in[i], len);
+  // Copy input buffer
+  srsran_vec_cf_copy(x, in, len);
 
-    if (hst) {
-      srsran_channel_hst_execute(hst, buffer_in, buffer_out, len, &t);
-      srsran_vec_sc_prod_ccc(buffer_out, local_cexpf(hst_init_phase), buffer_in, len);
-    }
+  if (hst[i]) {
+    srsran_channel_hst_execute(hst[i], x, y, len, &t);
+    srsran_vec_sc_prod_ccc(y, local_cexpf(hst_init_phase), x, len);
+  }
 
-    if (awgn) {
-      srsran_channel_awgn_run_c(awgn, buffer_in, buffer_out, len);
-      srsran_vec_cf_copy(buffer_in, buffer_out, len);
-    }
+  if (awgn[i]) {
+    srsran_channel_awgn_run_c(awgn[i], x, y, len);
+    std::swap(x, y);
+  }
 
-    if (fading[i]) {
-      srsran_channel_fading_execute(fading[i], buffer_in, buffer_out, len, t.full_secs + t.frac_secs);
-      srsran_vec_cf_copy(buffer_in, buffer_out, len);
-    }
+  if (fading[i]) {
+    srsran_channel_fading_execute(fading[i], x, y, len, t.full_secs + t.frac_secs);
+    std::swap(x, y);
+  }
 
-    if (delay[i]) {
-      srsran_channel_delay_execute(delay[i], buffer_in, buffer_out, len, &t);
-      srsran_vec_cf_copy(buffer_in, buffer_out, len);
+  if (delay[i]) {
+    srsran_channel_delay_execute(delay[i], x, y, len, &t);
+    std::swap(x, y);
+  }
+
+  if (rlf) {
+    srsran_channel_rlf_execute(rlf, x, y, len, &t);
+    std::swap(x, y);
+  }
+
+  // Copy output buffer
+  srsran_vec_cf_copy(out, x, len);
+}
+
+void channel::run_worker(uint32_t w)
+{
+  for (uint32_t i = w; i < nof_channels; i += (uint32_t)workers.size() + 1) {
+    run_channel(i, job_in[i], job_out[i], job_len, *job_ts);
+  }
+}
+
+void channel::worker_loop(uint32_t w)
+{
+  uint64_t last_job = 0;
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    cvar_start.wait(lock, [this, last_job]() { return quit || job_count != last_job; });
+    if (quit) {
+      return;
     }
+    last_job = job_count;
+
+    lock.unlock();
+    run_worker(w);
+    lock.lock();
 
-    if (rlf) {
-      srsran_channel_rlf_execute(rlf, buffer_in, buffer_out, len, &t);
-      srsran_vec_cf_copy(buffer_in, buffer_out, len);
+    // Notify the caller when the last worker finishes
+    job_pending--;
+    if (job_pending == 0) {
+      cvar_done.notify_one();
     }
+  }
+}
+
+void channel::run(cf_t*                     in[SRSRAN_MAX_CHANNELS],
+                  cf_t*                     out[SRSRAN_MAX_CHANNELS],
+                  uint32_t                  len,
+                  const srsran_timestamp_t& t)
+{
+  // Early return if pointers are not enabled
+  if (in == nullptr || out == nullptr) {
+    return;
+  }
+
+  // Publish the job for the workers
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    job_in      = in;
+    job_out     = out;
+    job_len     = len;
+    job_ts      = &t;
+    job_pending = (uint32_t)workers.size();
+    job_count++;
+  }
+  cvar_start.notify_all();
 
-    // Copy output buffer
-    srsran_vec_cf_copy(out[i], buffer_in, len);
+  // Process the caller share and wait for the rest
+  run_worker(0);
+  if (!workers.empty()) {
+    std::unique_lock<std::mutex> lock(mutex);
+    cvar_done.wait(lock, [this]() { return job_pending == 0; });
   }
 
-  if (hst) {
+  if (hst[0]) {
     // Increment phase to keep it coherent between frames
-    hst_init_phase += (2 * M_PI * len * hst->fs_hz / hst->srate_hz);
+    hst_init_phase += (2 * M_PI * len * hst[0]->fs_hz / hst[0]->srate_hz);
 
     // Positive Remainder
     while (hst_init_phase > 2 * M_PI) {
@@ -225,8 +295,8 @@ void channel::run(cf_t*                     in[SRSRAN_MAX_CHANNELS],
   if (delay[0]) {
     str << "delay=" << delay[0]->delay_us << "us; ";
   }
-  if (hst) {
-    str << "hst=" << hst->fs_hz << "Hz; ";
+  if (hst[0]) {
+    str << "hst=" << hst[0]->fs_hz << "Hz; ";
   }
   logger.debug("%s", str.str().c_str());
 }
@@ -244,10 +314,10 @@ void channel::set_srate(uint32_t srate)
       if (delay[i]) {
         srsran_channel_delay_update_srate(delay[i], srate);
       }
-    }
 
-    if (hst) {
-      srsran_channel_hst_update_srate(hst, srate);
+      if (hst[i]) {
+        srsran_channel_hst_update_srate(hst[i], srate);
+      }
     }
 
     // Update sampling rate
@@ -257,7 +327,9 @@ void channel::set_srate(uint32_t srate)
 
 void channel::set_signal_power_dBfs(float power_dBfs)
 {
-  if (awgn != nullptr) {
-    srsran_channel_awgn_set_n0(awgn, power_dBfs - args.awgn_snr_dB);
+  for (uint32_t i = 0; i < nof_channels; i++) {
+    if (awgn[i] != nullptr) {
+      srsran_channel_awgn_set_n0(awgn[i], power_dBfs - args.awgn_snr_dB);
+    }
   }
 }
@@ -21,7 +21,9 @@
 
 #include "srsran/phy/channel/fading.h"
 #include "srsran/phy/utils/random.h"
+#include "srsran/phy/utils/simd.h"
 #include "srsran/phy/utils/vector.h"
+#include <complex.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -92,8 +94,9 @@ static inline __m128 _sine(const float* table, __m128 arg)
   __m128i indexi32 = _mm_abs_epi32(_mm_cvtps_epi32(indexps));
   _mm_store_si128((__m128i*)idx, indexi32);
 
+  // The rounding can yield a full turn (index 1024), wrap it around the table
   for (int i = 0; i < 4; i++) {
-    sine[i] = table[idx[i]];
+    sine[i] = table[idx[i] & 1023];
   }
 
   ret = _mm_load_ps(sine);
@@ -153,35 +156,58 @@ get_doppler_dispersion(srsran_channel_fading_t* q, float t, float F_d, float* al
 #endif /*LV_HAVE_SSE*/
 }
 
+// Generates the tap frequency response already shifted, so the taps can be combined without shifting
 static inline void generate_tap(float delay_ns, float power_db, float srate, cf_t* buf, uint32_t N, uint32_t path_delay)
 {
   float amplitude = srsran_convert_dB_to_power(power_db);
   float O         = (delay_ns * 1e-9f * srate + path_delay) / (float)N;
   cf_t  a0        = amplitude / N;
 
-  srsran_vec_gen_sine(a0, -O, buf, N);
+  // The first half takes the response from N/2 onwards
+  srsran_vec_gen_sine(a0 * (cf_t)cexp(-_Complex_I * M_PI * (double)O * (double)N), -O, buf, N / 2);
+  srsran_vec_gen_sine(a0, -O, &buf[N / 2], N - N / 2);
 }
 
-static inline void generate_taps(srsran_channel_fading_t* q, float time)
+static inline void combine_taps(srsran_channel_fading_t* q, const cf_t* a)
 {
-  // Generate taps
-  for (int i = 0; i < nof_taps[q->model]; i++) {
-    // Compute phase for the doppler dispersion
-    cf_t a = get_doppler_dispersion(q, time, q->doppler, q->coeff_alpha[i], q->coeff_a[i], q->coeff_b[i]);
+  uint32_t k = 0;
 
-    if (i) {
-      // Copy tap frequency response
-      srsran_vec_sc_prod_ccc(q->h_tap[i], a, q->temp, q->N);
+#if SRSRAN_SIMD_CF_SIZE
+  simd_cf_t _a[SRSRAN_CHANNEL_FADING_MAXTAPS];
+  for (uint32_t i = 0; i < nof_taps[q->model]; i++) {
+    _a[i] = srsran_simd_cf_set1(a[i]);
+  }
 
-      // Add to frequency response, shifts FFT at same time
-      srsran_vec_sum_ccc(q->h_freq, &q->temp[q->N / 2], q->h_freq, q->N / 2);
-      srsran_vec_sum_ccc(&q->h_freq[q->N / 2], q->temp, &q->h_freq[q->N / 2], q->N / 2);
-    } else {
-      // Copy tap frequency response
-      srsran_vec_sc_prod_ccc(&q->h_tap[i][q->N / 2], a, q->h_freq, q->N / 2);
-      srsran_vec_sc_prod_ccc(&q->h_tap[i][0], a, &q->h_freq[q->N / 2], q->N / 2);
+  // Accumulate all the taps in registers and store the frequency response once
+  for (; k + SRSRAN_SIMD_CF_SIZE <= q->N; k += SRSRAN_SIMD_CF_SIZE) {
+    simd_cf_t acc = srsran_simd_cf_prod(_a[0], srsran_simd_cfi_load(&q->h_tap[0][k]));
+    for (uint32_t i = 1; i < nof_taps[q->model]; i++) {
+      acc = srsran_simd_cf_add(acc, srsran_simd_cf_prod(_a[i], srsran_simd_cfi_load(&q->h_tap[i][k])));
     }
+    srsran_simd_cfi_store(&q->h_freq[k], acc);
+  }
+#endif /* SRSRAN_SIMD_CF_SIZE */
+
+  for (; k < q->N; k++) {
+    cf_t acc = a[0] * q->h_tap[0][k];
+    for (uint32_t i = 1; i < nof_taps[q->model]; i++) {
+      acc += a[i] * q->h_tap[i][k];
+    }
+    q->h_freq[k] = acc;
+  }
+}
+
+static inline void generate_taps(srsran_channel_fading_t* q, float time)
+{
+  cf_t a[SRSRAN_CHANNEL_FADING_MAXTAPS];
+
+  // Compute phase for the doppler dispersion of each tap
+  for (int i = 0; i < nof_taps[q->model]; i++) {
+    a[i] = get_doppler_dispersion(q, time, q->doppler, q->coeff_alpha[i], q->coeff_a[i], q->coeff_b[i]);
   }
+
+  // Add the tap frequency responses
+  combine_taps(q, a);
   // at this stage, q->h_freq should contain the frequency response
 }
 
@@ -200,15 +226,16 @@ static inline void filter_segment(srsran_channel_fading_t* q, const cf_t* input,
   // Do iFFT
   srsran_dft_run_c_zerocopy(&q->ifft, q->y_freq, q->temp);
 
-  // Add state
-  srsran_vec_sum_ccc(q->temp, q->state, q->temp, q->state_len);
-
-  // Copy the first nsamples into the output
-  srsran_vec_cf_copy(output, q->temp, nsamples);
+  // Add state and write the first nsamples into the output
+  uint32_t n = SRSRAN_MIN(nsamples, q->state_len);
+  srsran_vec_sum_ccc(q->temp, q->state, output, n);
+  srsran_vec_cf_copy(&output[n], &q->temp[n], nsamples - n);
 
-  // Copy the rest of the samples into the state
+  // Add the rest of the state and save the rest of the samples as the new state, the state moves forward in place
+  uint32_t m = (q->state_len > nsamples) ? (q->state_len - nsamples) : 0;
+  srsran_vec_sum_ccc(&q->temp[nsamples], &q->state[nsamples], q->state, m);
+  srsran_vec_cf_copy(&q->state[m], &q->temp[nsamples + m], q->N - nsamples - m);
   q->state_len = q->N - nsamples;
-  srsran_vec_cf_copy(q->state, &q->temp[nsamples], q->state_len);
 }
 
 int srsran_channel_fading_init(srsran_channel_fading_t* q, double srate, const char* model, uint32_t seed)
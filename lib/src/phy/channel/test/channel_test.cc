@@ -0,0 +1,181 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/common/test_common.h"
+#include "srsran/phy/channel/channel.h"
+#include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/random.h"
+#include "srsran/phy/utils/vector.h"
+#include <getopt.h>
+#include <sys/time.h>
+
+static uint32_t    nof_channels = 4;
+static uint32_t    nof_threads  = 4;
+static uint32_t    srate        = (uint32_t)23.04e6;
+static uint32_t    duration_ms  = 100;
+static std::string model        = "all";
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [mnpst]\n", prog);
+  printf("\t-m Fading model: epa5, eva70, etu300, all [Default %s]\n", model.c_str());
+  printf("\t-n Number of channels (antennas): [Default %d]\n", nof_channels);
+  printf("\t-p Number of threads: [Default %d]\n", nof_threads);
+  printf("\t-s Sampling rate in Hz: [Default %d]\n", srate);
+  printf("\t-t Simulation time in ms: [Default %d]\n", duration_ms);
+}
+
+static int parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "mnpst")) != -1) {
+    switch (opt) {
+      case 'm':
+        model = argv[optind];
+        break;
+      case 'n':
+        nof_channels = SRSRAN_MIN((uint32_t)strtol(argv[optind], NULL, 10), SRSRAN_MAX_CHANNELS);
+        break;
+      case 'p':
+        nof_threads = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 's':
+        srate = (uint32_t)strtof(argv[optind], NULL);
+        break;
+      case 't':
+        duration_ms = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        return SRSRAN_ERROR;
+    }
+  }
+  return SRSRAN_SUCCESS;
+}
+
+// Runs the whole channel emulator over the given buffers and returns the elapsed time in microseconds
+static uint64_t run_channel(srsran::channel& ch, cf_t* in[SRSRAN_MAX_CHANNELS], cf_t* out[SRSRAN_MAX_CHANNELS])
+{
+  uint32_t sf_len    = srate / 1000;
+  uint64_t time_usec = 0;
+
+  for (uint32_t i = 0; i < duration_ms; i++) {
+    cf_t* in_sf[SRSRAN_MAX_CHANNELS]  = {};
+    cf_t* out_sf[SRSRAN_MAX_CHANNELS] = {};
+    for (uint32_t j = 0; j < nof_channels; j++) {
+      in_sf[j]  = &in[j][sf_len * i];
+      out_sf[j] = &out[j][sf_len * i];
+    }
+
+    srsran_timestamp_t ts = {};
+    srsran_timestamp_init_uint64(&ts, (uint64_t)sf_len * i, srate);
+
+    struct timeval t[3] = {};
+    gettimeofday(&t[1], NULL);
+    ch.run(in_sf, out_sf, sf_len, ts);
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+    time_usec += t[0].tv_sec * 1000000UL + t[0].tv_usec;
+  }
+
+  return time_usec;
+}
+
+static int test_model(const std::string& fading_model, cf_t* in[SRSRAN_MAX_CHANNELS])
+{
+  srslog::basic_logger& logger      = srslog::fetch_basic_logger("CHANNEL", false);
+  uint32_t              nof_samples = srate / 1000 * duration_ms;
+  logger.set_level(srslog::basic_levels::error);
+
+  srsran::channel::args_t args = {};
+  args.enable                  = true;
+  args.fading_enable           = true;
+  args.fading_model            = fading_model;
+  args.delay_enable            = true;
+  args.delay_period_s          = 1.0f;
+
+  // Run the channels in the caller thread and in parallel, the output shall be identical
+  uint64_t time_usec[2]                = {};
+  cf_t*    out[2][SRSRAN_MAX_CHANNELS] = {};
+  for (uint32_t k = 0; k < 2; k++) {
+    for (uint32_t j = 0; j < nof_channels; j++) {
+      out[k][j] = srsran_vec_cf_malloc(nof_samples);
+      TESTASSERT(out[k][j] != nullptr);
+    }
+
+    args.nof_threads = (k == 0) ? 1 : nof_threads;
+    srsran::channel ch(args, nof_channels, logger);
+    ch.set_srate(srate);
+    time_usec[k] = run_channel(ch, in, out[k]);
+  }
+
+  int ret = SRSRAN_SUCCESS;
+  for (uint32_t j = 0; j < nof_channels; j++) {
+    if (memcmp(out[0][j], out[1][j], sizeof(cf_t) * nof_samples) != 0) {
+      ERROR("Channel %d output mismatch between 1 and %d threads", j, nof_threads);
+      ret = SRSRAN_ERROR;
+    }
+    free(out[0][j]);
+    free(out[1][j]);
+  }
+
+  printf("model=%s; channels=%d; 1 thread %.1f MSps; %d threads %.1f MSps;\n",
+         fading_model.c_str(),
+         nof_channels,
+         (double)nof_samples * nof_channels / (double)time_usec[0],
+         nof_threads,
+         (double)nof_samples * nof_channels / (double)time_usec[1]);
+
+  return ret;
+}
+
+int main(int argc, char** argv)
+{
+  if (parse_args(argc, argv) < SRSRAN_SUCCESS) {
+    return SRSRAN_ERROR;
+  }
+
+  srslog::init();
+
+  // Random input signal for every channel
+  uint32_t        nof_samples             = srate / 1000 * duration_ms;
+  srsran_random_t random_gen              = srsran_random_init(0x1234);
+  cf_t*           in[SRSRAN_MAX_CHANNELS] = {};
+  for (uint32_t j = 0; j < nof_channels; j++) {
+    in[j] = srsran_vec_cf_malloc(nof_samples);
+    TESTASSERT(in[j] != nullptr);
+    srsran_random_uniform_complex_dist_vector(random_gen, in[j], nof_samples, -1.0f, +1.0f);
+  }
+
+  int ret = SRSRAN_SUCCESS;
+  for (const char* m : {"epa5", "eva70", "etu300"}) {
+    if ((model == "all" || model == m) && test_model(m, in) != SRSRAN_SUCCESS) {
+      ret = SRSRAN_ERROR;
+    }
+  }
+
+  for (uint32_t j = 0; j < nof_channels; j++) {
+    free(in[j]);
+  }
+  srsran_random_free(random_gen);
+
+  return ret;
+}
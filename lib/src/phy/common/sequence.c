@@ -127,6 +127,210 @@ static inline uint32_t sequence_gen_LTE_pr_memless_step_x2(uint32_t state)
   return state;
 }
 
+/**
+ * Word-wide generation
+ * --------------------
+ *
+ * A 64-bit window holds the next 64 chips of x1 or x2, the first chip in the LSB. Squaring the generator polynomials
+ * gives x1(n+62) = x1(n+6) + x1(n) and x2(n+62) = x2(n+6) + x2(n+4) + x2(n+2) + x2(n), so the next window only depends
+ * on the current one and on its own first 8 chips. This advances the sequences 64 chips per step with a few shifts.
+ */
+#define SEQUENCE_WORD_BITS (64U)
+#define SEQUENCE_STATE_MASK ((1U << SEQUENCE_SEED_LEN) - 1U)
+
+/**
+ * Extends a 31 bit x1 state to a 64 chip window
+ * @param state 32 bit current state
+ * @return 64 bit window
+ */
+static inline uint64_t sequence_window_x1(uint32_t state)
+{
+  uint64_t w = state;
+  w |= ((w ^ (w >> 3U)) & 0xffffffUL) << SEQUENCE_SEED_LEN;
+  w |= (((w ^ (w >> 3U)) >> 24U) & 0x1ffUL) << (SEQUENCE_SEED_LEN + 24U);
+  return w;
+}
+
+/**
+ * Extends a 31 bit x2 state to a 64 chip window
+ * @param state 32 bit current state
+ * @return 64 bit window
+ */
+static inline uint64_t sequence_window_x2(uint32_t state)
+{
+  uint64_t w = state;
+  w |= ((w ^ (w >> 1U) ^ (w >> 2U) ^ (w >> 3U)) & 0xffffffUL) << SEQUENCE_SEED_LEN;
+  w |= (((w ^ (w >> 1U) ^ (w >> 2U) ^ (w >> 3U)) >> 24U) & 0x1ffUL) << (SEQUENCE_SEED_LEN + 24U);
+  return w;
+}
+
+/**
+ * Computes the next 64 chips of the X1 sequence
+ * @param w 64 bit current window
+ * @return new 64 bit window
+ */
+static inline uint64_t sequence_word_step_x1(uint64_t w)
+{
+  uint64_t a = (w >> 2U) ^ (w >> 8U);
+  return a ^ (a << 56U) ^ (a << 62U);
+}
+
+/**
+ * Computes the next 64 chips of the X2 sequence
+ * @param w 64 bit current window
+ * @return new 64 bit window
+ */
+static inline uint64_t sequence_word_step_x2(uint64_t w)
+{
+  uint64_t a = (w >> 2U) ^ (w >> 4U) ^ (w >> 6U) ^ (w >> 8U);
+  return a ^ (a << 56U) ^ (a << 58U) ^ (a << 60U) ^ (a << 62U);
+}
+
+#ifdef LV_HAVE_AVX2
+/*
+ * Fused sequence application for 64 chips. AVX512 takes the chips straight as lane masks, AVX2 expands them into
+ * lane masks of all ones where the chip is set.
+ */
+#ifndef LV_HAVE_AVX512
+static inline __m256i sequence_mask_epi8_avx2(uint32_t c)
+{
+  const __m256i bits = _mm256_set1_epi64x(0x8040201008040201);
+  const __m256i idx =
+      _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+  __m256i m = _mm256_shuffle_epi8(_mm256_set1_epi32((int)c), idx);
+  return _mm256_cmpeq_epi8(_mm256_and_si256(m, bits), bits);
+}
+
+static inline __m256i sequence_mask_epi16_avx2(uint32_t c)
+{
+  const __m256i bits = _mm256_setr_epi16(0x0001,
+                                         0x0002,
+                                         0x0004,
+                                         0x0008,
+                                         0x0010,
+                                         0x0020,
+                                         0x0040,
+                                         0x0080,
+                                         0x0100,
+                                         0x0200,
+                                         0x0400,
+                                         0x0800,
+                                         0x1000,
+                                         0x2000,
+                                         0x4000,
+                                         (short)0x8000);
+  __m256i       m    = _mm256_set1_epi16((short)(c & 0xffffU));
+  return _mm256_cmpeq_epi16(_mm256_and_si256(m, bits), bits);
+}
+
+static inline __m256 sequence_mask_ps_avx2(uint32_t c)
+{
+  const __m256i bits = _mm256_setr_epi32(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+  __m256i       m    = _mm256_set1_epi32((int)(c & 0xffU));
+  m                  = _mm256_cmpeq_epi32(_mm256_and_si256(m, bits), bits);
+  return _mm256_castsi256_ps(_mm256_slli_epi32(m, 31));
+}
+#endif // LV_HAVE_AVX512
+
+static inline void sequence_word_gen_f(uint64_t c, float value, float* out)
+{
+#ifdef LV_HAVE_AVX512
+  __m512i v = _mm512_castps_si512(_mm512_set1_ps(value));
+  for (uint32_t j = 0; j < SEQUENCE_WORD_BITS; j += 16) {
+    _mm512_storeu_si512(out + j, _mm512_mask_xor_epi32(v, (__mmask16)(c >> j), v, _mm512_set1_epi32(INT32_MIN)));
+  }
+#else  // LV_HAVE_AVX512
+  __m256 v = _mm256_set1_ps(value);
+  for (uint32_t j = 0; j < SEQUENCE_WORD_BITS; j += 8) {
+    _mm256_storeu_ps(out + j, _mm256_xor_ps(v, sequence_mask_ps_avx2((uint32_t)(c >> j))));
+  }
+#endif // LV_HAVE_AVX512
+}
+
+static inline void sequence_word_apply_f(uint64_t c, const float* in, float* out)
+{
+#ifdef LV_HAVE_AVX512
+  for (uint32_t j = 0; j < SEQUENCE_WORD_BITS; j += 16) {
+    __m512i v = _mm512_loadu_si512(in + j);
+    _mm512_storeu_si512(out + j, _mm512_mask_xor_epi32(v, (__mmask16)(c >> j), v, _mm512_set1_epi32(INT32_MIN)));
+  }
+#else  // LV_HAVE_AVX512
+  for (uint32_t j = 0; j < SEQUENCE_WORD_BITS; j += 8) {
+    _mm256_storeu_ps(out + j, _mm256_xor_ps(_mm256_loadu_ps(in + j), sequence_mask_ps_avx2((uint32_t)(c >> j))));
+  }
+#endif // LV_HAVE_AVX512
+}
+
+static inline void sequence_word_apply_s(uint64_t c, const int16_t* in, int16_t* out)
+{
+#ifdef LV_HAVE_AVX512
+  for (uint32_t j = 0; j < SEQUENCE_WORD_BITS; j += 32) {
+    __m512i v = _mm512_loadu_si512(in + j);
+    _mm512_storeu_si512(out + j, _mm512_mask_sub_epi16(v, (__mmask32)(c >> j), _mm512_setzero_si512(), v));
+  }
+#else  // LV_HAVE_AVX512
+  for (uint32_t j = 0; j < SEQUENCE_WORD_BITS; j += 16) {
+    __m256i m = sequence_mask_epi16_avx2((uint32_t)(c >> j));
+    __m256i v = _mm256_loadu_si256((__m256i*)(in + j));
+    _mm256_storeu_si256((__m256i*)(out + j), _mm256_sub_epi16(_mm256_xor_si256(v, m), m));
+  }
+#endif // LV_HAVE_AVX512
+}
+
+static inline void sequence_word_apply_c(uint64_t c, const int8_t* in, int8_t* out)
+{
+#ifdef LV_HAVE_AVX512
+  __m512i v = _mm512_loadu_si512(in);
+  _mm512_storeu_si512(out, _mm512_mask_sub_epi8(v, (__mmask64)c, _mm512_setzero_si512(), v));
+#else  // LV_HAVE_AVX512
+  for (uint32_t j = 0; j < SEQUENCE_WORD_BITS; j += 32) {
+    __m256i m = sequence_mask_epi8_avx2((uint32_t)(c >> j));
+    __m256i v = _mm256_loadu_si256((__m256i*)(in + j));
+    _mm256_storeu_si256((__m256i*)(out + j), _mm256_sub_epi8(_mm256_xor_si256(v, m), m));
+  }
+#endif // LV_HAVE_AVX512
+}
+
+static inline void sequence_word_apply_bit(uint64_t c, const uint8_t* in, uint8_t* out)
+{
+#ifdef LV_HAVE_AVX512
+  __m512i v = _mm512_loadu_si512(in);
+  _mm512_storeu_si512(out, _mm512_xor_si512(v, _mm512_maskz_mov_epi8((__mmask64)c, _mm512_set1_epi8(1))));
+#else  // LV_HAVE_AVX512
+  for (uint32_t j = 0; j < SEQUENCE_WORD_BITS; j += 32) {
+    __m256i m = _mm256_and_si256(sequence_mask_epi8_avx2((uint32_t)(c >> j)), _mm256_set1_epi8(1));
+    __m256i v = _mm256_loadu_si256((__m256i*)(in + j));
+    _mm256_storeu_si256((__m256i*)(out + j), _mm256_xor_si256(v, m));
+  }
+#endif // LV_HAVE_AVX512
+}
+
+static inline void sequence_word_gen_bit(uint64_t c, uint8_t* out)
+{
+#ifdef LV_HAVE_AVX512
+  _mm512_storeu_si512(out, _mm512_maskz_mov_epi8((__mmask64)c, _mm512_set1_epi8(1)));
+#else  // LV_HAVE_AVX512
+  for (uint32_t j = 0; j < SEQUENCE_WORD_BITS; j += 32) {
+    __m256i m = _mm256_and_si256(sequence_mask_epi8_avx2((uint32_t)(c >> j)), _mm256_set1_epi8(1));
+    _mm256_storeu_si256((__m256i*)(out + j), m);
+  }
+#endif // LV_HAVE_AVX512
+}
+#endif // LV_HAVE_AVX2
+
+/**
+ * Reverses the bit order within each byte, so that 64 chips become 8 bytes packed MSB first
+ * @param c 64 chips, first chip in the LSB
+ * @return packed chips in memory order (little endian)
+ */
+static inline uint64_t sequence_word_pack(uint64_t c)
+{
+  c = ((c >> 1U) & 0x5555555555555555UL) | ((c & 0x5555555555555555UL) << 1U);
+  c = ((c >> 2U) & 0x3333333333333333UL) | ((c & 0x3333333333333333UL) << 2U);
+  c = ((c >> 4U) & 0x0f0f0f0f0f0f0f0fUL) | ((c & 0x0f0f0f0f0f0f0f0fUL) << 4U);
+  return c;
+}
+
 /**
  * Static precomputed x1 and x2 states after Nc shifts
  * -------------------------------------------------------
@@ -186,6 +390,21 @@ static void sequence_gen_LTE_pr(uint8_t* pr, uint32_t len, uint32_t seed)
   uint32_t x1 = sequence_x1_init;           // X1 initial state is fix
   uint32_t x2 = sequence_get_x2_init(seed); // loads x2 initial state
 
+#ifdef LV_HAVE_AVX2
+  // Word stage
+  if (len >= SEQUENCE_WORD_BITS) {
+    uint64_t w1 = sequence_window_x1(x1);
+    uint64_t w2 = sequence_window_x2(x2);
+    for (; n + SEQUENCE_WORD_BITS <= len; n += SEQUENCE_WORD_BITS) {
+      sequence_word_gen_bit(w1 ^ w2, pr + n);
+      w1 = sequence_word_step_x1(w1);
+      w2 = sequence_word_step_x2(w2);
+    }
+    x1 = (uint32_t)w1 & SEQUENCE_STATE_MASK;
+    x2 = (uint32_t)w2 & SEQUENCE_STATE_MASK;
+  }
+#endif // LV_HAVE_AVX2
+
   // Parallel stage
   if (len >= SEQUENCE_PAR_BITS) {
     for (; n < len - (SEQUENCE_PAR_BITS - 1); n += SEQUENCE_PAR_BITS) {
@@ -232,6 +451,21 @@ void srsran_sequence_state_gen_f(srsran_sequence_state_t* s, float value, float*
 {
   uint32_t i = 0;
 
+#ifdef LV_HAVE_AVX2
+  // Word stage
+  if (length >= SEQUENCE_WORD_BITS) {
+    uint64_t w1 = sequence_window_x1(s->x1);
+    uint64_t w2 = sequence_window_x2(s->x2);
+    for (; i + SEQUENCE_WORD_BITS <= length; i += SEQUENCE_WORD_BITS) {
+      sequence_word_gen_f(w1 ^ w2, value, out + i);
+      w1 = sequence_word_step_x1(w1);
+      w2 = sequence_word_step_x2(w2);
+    }
+    s->x1 = (uint32_t)w1 & SEQUENCE_STATE_MASK;
+    s->x2 = (uint32_t)w2 & SEQUENCE_STATE_MASK;
+  }
+#endif // LV_HAVE_AVX2
+
   if (length >= SEQUENCE_PAR_BITS) {
     for (; i < length - (SEQUENCE_PAR_BITS - 1); i += SEQUENCE_PAR_BITS) {
       uint32_t c = (uint32_t)(s->x1 ^ s->x2);
@@ -284,6 +518,21 @@ void srsran_sequence_state_apply_f(srsran_sequence_state_t* s, const float* in,
 {
   uint32_t i = 0;
 
+#ifdef LV_HAVE_AVX2
+  // Word stage
+  if (length >= SEQUENCE_WORD_BITS) {
+    uint64_t w1 = sequence_window_x1(s->x1);
+    uint64_t w2 = sequence_window_x2(s->x2);
+    for (; i + SEQUENCE_WORD_BITS <= length; i += SEQUENCE_WORD_BITS) {
+      sequence_word_apply_f(w1 ^ w2, in + i, out + i);
+      w1 = sequence_word_step_x1(w1);
+      w2 = sequence_word_step_x2(w2);
+    }
+    s->x1 = (uint32_t)w1 & SEQUENCE_STATE_MASK;
+    s->x2 = (uint32_t)w2 & SEQUENCE_STATE_MASK;
+  }
+#endif // LV_HAVE_AVX2
+
   if (length >= SEQUENCE_PAR_BITS) {
     for (; i < length - (SEQUENCE_PAR_BITS - 1); i += SEQUENCE_PAR_BITS) {
       uint32_t c = (uint32_t)(s->x1 ^ s->x2);
@@ -335,6 +584,19 @@ void srsran_sequence_state_apply_f(srsran_sequence_state_t* s, const float* in,
 void srsran_sequence_state_advance(srsran_sequence_state_t* s, uint32_t length)
 {
   uint32_t i = 0;
+
+  // Word stage
+  if (length >= SEQUENCE_WORD_BITS) {
+    uint64_t w1 = sequence_window_x1(s->x1);
+    uint64_t w2 = sequence_window_x2(s->x2);
+    for (; i + SEQUENCE_WORD_BITS <= length; i += SEQUENCE_WORD_BITS) {
+      w1 = sequence_word_step_x1(w1);
+      w2 = sequence_word_step_x2(w2);
+    }
+    s->x1 = (uint32_t)w1 & SEQUENCE_STATE_MASK;
+    s->x2 = (uint32_t)w2 & SEQUENCE_STATE_MASK;
+  }
+
   if (length >= SEQUENCE_PAR_BITS) {
     for (; i < length - (SEQUENCE_PAR_BITS - 1); i += SEQUENCE_PAR_BITS) {
       // Step sequences
@@ -512,6 +774,21 @@ void srsran_sequence_apply_s(const int16_t* in, int16_t* out, uint32_t length, u
 
   uint32_t i = 0;
 
+#ifdef LV_HAVE_AVX2
+  // Word stage
+  if (length >= SEQUENCE_WORD_BITS) {
+    uint64_t w1 = sequence_window_x1(x1);
+    uint64_t w2 = sequence_window_x2(x2);
+    for (; i + SEQUENCE_WORD_BITS <= length; i += SEQUENCE_WORD_BITS) {
+      sequence_word_apply_s(w1 ^ w2, in + i, out + i);
+      w1 = sequence_word_step_x1(w1);
+      w2 = sequence_word_step_x2(w2);
+    }
+    x1 = (uint32_t)w1 & SEQUENCE_STATE_MASK;
+    x2 = (uint32_t)w2 & SEQUENCE_STATE_MASK;
+  }
+#endif // LV_HAVE_AVX2
+
   if (length >= SEQUENCE_PAR_BITS) {
     for (; i < length - (SEQUENCE_PAR_BITS - 1); i += SEQUENCE_PAR_BITS) {
       uint32_t c = (uint32_t)(x1 ^ x2);
@@ -564,6 +841,21 @@ void srsran_sequence_state_apply_c(srsran_sequence_state_t* s, const int8_t* in,
 {
   uint32_t i = 0;
 
+#ifdef LV_HAVE_AVX2
+  // Word stage
+  if (length >= SEQUENCE_WORD_BITS) {
+    uint64_t w1 = sequence_window_x1(s->x1);
+    uint64_t w2 = sequence_window_x2(s->x2);
+    for (; i + SEQUENCE_WORD_BITS <= length; i += SEQUENCE_WORD_BITS) {
+      sequence_word_apply_c(w1 ^ w2, in + i, out + i);
+      w1 = sequence_word_step_x1(w1);
+      w2 = sequence_word_step_x2(w2);
+    }
+    s->x1 = (uint32_t)w1 & SEQUENCE_STATE_MASK;
+    s->x2 = (uint32_t)w2 & SEQUENCE_STATE_MASK;
+  }
+#endif // LV_HAVE_AVX2
+
   if (length >= SEQUENCE_PAR_BITS) {
     for (; i < length - (SEQUENCE_PAR_BITS - 1); i += SEQUENCE_PAR_BITS) {
       uint32_t c = (uint32_t)(s->x1 ^ s->x2);
@@ -628,6 +920,21 @@ void srsran_sequence_state_apply_bit(srsran_sequence_state_t* s, const uint8_t*
 {
   uint32_t i = 0;
 
+#ifdef LV_HAVE_AVX2
+  // Word stage
+  if (length >= SEQUENCE_WORD_BITS) {
+    uint64_t w1 = sequence_window_x1(s->x1);
+    uint64_t w2 = sequence_window_x2(s->x2);
+    for (; i + SEQUENCE_WORD_BITS <= length; i += SEQUENCE_WORD_BITS) {
+      sequence_word_apply_bit(w1 ^ w2, in + i, out + i);
+      w1 = sequence_word_step_x1(w1);
+      w2 = sequence_word_step_x2(w2);
+    }
+    s->x1 = (uint32_t)w1 & SEQUENCE_STATE_MASK;
+    s->x2 = (uint32_t)w2 & SEQUENCE_STATE_MASK;
+  }
+#endif // LV_HAVE_AVX2
+
   if (length >= SEQUENCE_PAR_BITS) {
     for (; i < length - (SEQUENCE_PAR_BITS - 1); i += SEQUENCE_PAR_BITS) {
       uint32_t c = (uint32_t)(s->x1 ^ s->x2);
@@ -725,6 +1032,26 @@ void srsran_sequence_apply_packed(const uint8_t* in, uint8_t* out, uint32_t leng
   };
 
   uint32_t i = 0;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  // Word stage, 8 bytes at a time
+  if (length >= SEQUENCE_WORD_BITS) {
+    uint64_t w1 = sequence_window_x1(x1);
+    uint64_t w2 = sequence_window_x2(x2);
+    for (; i + SEQUENCE_WORD_BITS / 8 <= length / 8; i += SEQUENCE_WORD_BITS / 8) {
+      uint64_t v;
+      memcpy(&v, in + i, sizeof(uint64_t));
+      v ^= sequence_word_pack(w1 ^ w2);
+      memcpy(out + i, &v, sizeof(uint64_t));
+
+      w1 = sequence_word_step_x1(w1);
+      w2 = sequence_word_step_x2(w2);
+    }
+    x1 = (uint32_t)w1 & SEQUENCE_STATE_MASK;
+    x2 = (uint32_t)w2 & SEQUENCE_STATE_MASK;
+  }
+#endif // __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
 #if SEQUENCE_PAR_BITS % 8 != 0
   uint64_t buffer = 0;
   uint32_t count  = 0;
@@ -23,6 +23,7 @@
 #include "srsran/phy/utils/bit.h"
 #include "srsran/phy/utils/debug.h"
 #include "srsran/phy/utils/random.h"
+#include "srsran/phy/utils/vector.h"
 
 #define Nc 1600
 #define MAX_SEQ_LEN (256 * 1024)
@@ -189,11 +190,55 @@ static int test_sequence(srsran_sequence_t* sequence, uint32_t seed, uint32_t le
          (double)(length * repetitions) / (double)interval_xor_packed_us,
          ret == SRSRAN_SUCCESS ? 'y' : 'n');
 
+  return ret;
+}
+
+// Applies the sequence in chunks of random size through the sequence state, skipping some of them. It must be called
+// after test_sequence() with the same seed and length.
+static int test_sequence_state(srsran_random_t random_gen, uint32_t seed, uint32_t length)
+{
+  srsran_sequence_state_t state = {};
+  uint32_t                i     = 0;
+
+  srsran_sequence_state_init(&state, seed);
+  while (i < length) {
+    uint32_t n  = (uint32_t)srsran_random_uniform_int_dist(random_gen, 1, 300);
+    uint32_t op = (uint32_t)srsran_random_uniform_int_dist(random_gen, 0, 3);
+    n           = SRSRAN_MIN(n, length - i);
+    switch (op) {
+      case 0:
+        srsran_sequence_state_apply_f(&state, ones_float, c_float + i, n);
+        break;
+      case 1:
+        srsran_sequence_state_apply_c(&state, ones_char, c_char + i, n);
+        break;
+      case 2:
+        srsran_sequence_state_apply_bit(&state, ones_unpacked, c_unpacked + i, n);
+        break;
+      default:
+        srsran_sequence_state_advance(&state, n);
+        break;
+    }
+
+    for (uint32_t j = i; j < i + n && op < 3; j++) {
+      uint8_t gold = (x1[j + Nc] + x2[j + Nc]) & 0x1;
+      bool    ok   = (op == 0)   ? (c_float[j] == (gold ? -1.0F : +1.0F))
+                     : (op == 1) ? (c_char[j] == (gold ? -1 : +1))
+                                 : (c_unpacked[j] == gold);
+      if (!ok) {
+        ERROR("Unmatched sequence state; seed=%08x; length=%d; op=%d; index=%d", seed, length, op, j);
+        return SRSRAN_ERROR;
+      }
+    }
+    i += n;
+  }
+
   return SRSRAN_SUCCESS;
 }
 
 int main(int argc, char** argv)
 {
+  int      ret         = SRSRAN_SUCCESS;
   uint32_t repetitions = 1;
   uint32_t min_length  = 16;
   uint32_t max_length  = MAX_SEQ_LEN;
@@ -230,12 +275,16 @@ int main(int argc, char** argv)
          "Passed");
 
   for (uint32_t length = min_length; length <= max_length; length = (length * 5) / 4) {
-    test_sequence(&sequence, (uint32_t)srsran_random_uniform_int_dist(random_gen, 1, INT32_MAX), length, repetitions);
+    uint32_t seed = (uint32_t)srsran_random_uniform_int_dist(random_gen, 1, INT32_MAX);
+    if (test_sequence(&sequence, seed, length, repetitions) != SRSRAN_SUCCESS ||
+        test_sequence_state(random_gen, seed, length) != SRSRAN_SUCCESS) {
+      ret = SRSRAN_ERROR;
+    }
   }
 
   // Free sequence object
   srsran_sequence_free(&sequence);
   srsran_random_free(random_gen);
 
-  return SRSRAN_SUCCESS;
+  return ret;
 }
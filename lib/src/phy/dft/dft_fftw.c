@@ -27,6 +27,7 @@
 #include <string.h>
 #include <unistd.h>
 
+#include "dft_native.h"
 #include "srsran/phy/dft/dft.h"
 #include "srsran/phy/utils/vector.h"
 
@@ -53,9 +54,172 @@ static int get_fftw_wisdom_file(char* full_path, uint32_t n)
 
 static pthread_mutex_t fft_mutex = PTHREAD_MUTEX_INITIALIZER;
 
+#ifdef DFT_NATIVE_DEFAULT
+static srsran_dft_backend_t dft_backend = SRSRAN_DFT_BACKEND_NATIVE;
+#else
+static srsran_dft_backend_t dft_backend = SRSRAN_DFT_BACKEND_FFTW;
+#endif
+
+#define DFT_CACHE_MAX_NOF_PLANS 128
+
+/* Non-guru plans are shared by all the DFT objects with the same size, direction, mode and buffer alignment. Each
+ * object keeps its own buffers and executes the shared plan with the new-array interface, which is thread-safe. The
+ * cache is protected by fft_mutex.
+ */
+typedef struct {
+  int               size;
+  srsran_dft_dir_t  dir;
+  srsran_dft_mode_t mode;
+  int               alignment;
+  uint32_t          count;  // Number of references, zero if the entry is free
+  bool              pinned; // Holds a reference from srsran_dft_plan_prewarm() until the process exits
+  fftwf_plan        p;
+} dft_cache_entry_t;
+
+static dft_cache_entry_t dft_cache[DFT_CACHE_MAX_NOF_PLANS] = {};
+
+static int dft_cache_alignment(void* in, void* out)
+{
+  return (fftwf_alignment_of((float*)in) << 8) | fftwf_alignment_of((float*)out);
+}
+
+// Gets a plan from the cache or creates it. Must be called with fft_mutex locked
+static fftwf_plan dft_cache_get(int size, srsran_dft_dir_t dir, srsran_dft_mode_t mode, void* in, void* out)
+{
+  int alignment = dft_cache_alignment(in, out);
+
+  // Look for an existing plan
+  for (uint32_t i = 0; i < DFT_CACHE_MAX_NOF_PLANS; i++) {
+    dft_cache_entry_t* e = &dft_cache[i];
+    if (e->count > 0 && e->size == size && e->dir == dir && e->mode == mode && e->alignment == alignment) {
+      e->count++;
+      return e->p;
+    }
+  }
+
+  fftwf_plan p = NULL;
+  if (mode == SRSRAN_DFT_COMPLEX) {
+    int sign = (dir == SRSRAN_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
+    p        = fftwf_plan_dft_1d(size, in, out, sign, FFTW_TYPE);
+  } else {
+    int sign = (dir == SRSRAN_DFT_FORWARD) ? FFTW_R2HC : FFTW_HC2R;
+    p        = fftwf_plan_r2r_1d(size, in, out, sign, FFTW_TYPE);
+  }
+  if (p == NULL) {
+    return NULL;
+  }
+
+  // Store the new plan, if the cache is full the plan is owned by the caller only
+  for (uint32_t i = 0; i < DFT_CACHE_MAX_NOF_PLANS; i++) {
+    dft_cache_entry_t* e = &dft_cache[i];
+    if (e->count == 0) {
+      e->size      = size;
+      e->dir       = dir;
+      e->mode      = mode;
+      e->alignment = alignment;
+      e->count     = 1;
+      e->pinned    = false;
+      e->p         = p;
+      break;
+    }
+  }
+
+  return p;
+}
+
+static dft_cache_entry_t* dft_cache_find(fftwf_plan p)
+{
+  for (uint32_t i = 0; i < DFT_CACHE_MAX_NOF_PLANS; i++) {
+    if (dft_cache[i].count > 0 && dft_cache[i].p == p) {
+      return &dft_cache[i];
+    }
+  }
+  return NULL;
+}
+
+// Releases a plan obtained from dft_cache_get(). Must be called with fft_mutex locked
+static void dft_cache_put(fftwf_plan p)
+{
+  dft_cache_entry_t* e = dft_cache_find(p);
+
+  // The plan was not cached
+  if (e == NULL) {
+    fftwf_destroy_plan(p);
+    return;
+  }
+
+  e->count--;
+  if (e->count == 0) {
+    fftwf_destroy_plan(e->p);
+    bzero(e, sizeof(dft_cache_entry_t));
+  }
+}
+
+int srsran_dft_plan_prewarm(const int* sizes, uint32_t nof_sizes)
+{
+  if (sizes == NULL && nof_sizes > 0) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  for (uint32_t i = 0; i < nof_sizes; i++) {
+    cf_t* in  = fftwf_malloc(sizeof(cf_t) * sizes[i]);
+    cf_t* out = fftwf_malloc(sizeof(cf_t) * sizes[i]);
+    if (in == NULL || out == NULL) {
+      fftwf_free(in);
+      fftwf_free(out);
+      return SRSRAN_ERROR;
+    }
+
+    pthread_mutex_lock(&fft_mutex);
+    for (srsran_dft_dir_t dir = SRSRAN_DFT_FORWARD; dir <= SRSRAN_DFT_BACKWARD; dir++) {
+      fftwf_plan p = dft_cache_get(sizes[i], dir, SRSRAN_DFT_COMPLEX, in, out);
+      if (p == NULL) {
+        ERROR("Error pre-warming DFT plan of size %d", sizes[i]);
+        continue;
+      }
+
+      // Keep the reference if the entry was not pinned yet, drop it otherwise
+      dft_cache_entry_t* e = dft_cache_find(p);
+      if (e != NULL && !e->pinned) {
+        e->pinned = true;
+      } else {
+        dft_cache_put(p);
+      }
+    }
+    pthread_mutex_unlock(&fft_mutex);
+
+    fftwf_free(in);
+    fftwf_free(out);
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+uint32_t srsran_dft_plan_cache_nof_plans()
+{
+  uint32_t count = 0;
+  pthread_mutex_lock(&fft_mutex);
+  for (uint32_t i = 0; i < DFT_CACHE_MAX_NOF_PLANS; i++) {
+    count += (dft_cache[i].count > 0) ? 1 : 0;
+  }
+  pthread_mutex_unlock(&fft_mutex);
+  return count;
+}
+
 // This function is called in the beggining of any executable where it is linked
 __attribute__((constructor)) static void srsran_dft_load()
 {
+  const char* backend = getenv("SRSRAN_DFT_BACKEND");
+  if (backend != NULL) {
+    if (strcmp(backend, "native") == 0) {
+      dft_backend = SRSRAN_DFT_BACKEND_NATIVE;
+    } else if (strcmp(backend, "fftw") == 0) {
+      dft_backend = SRSRAN_DFT_BACKEND_FFTW;
+    } else {
+      fprintf(stderr, "Warning: unknown DFT backend '%s', using %s\n", backend, srsran_dft_backend_string(dft_backend));
+    }
+  }
+
 #ifdef FFTW_WISDOM_FILE
   char full_path[256];
   get_fftw_wisdom_file(full_path, sizeof(full_path));
@@ -104,9 +268,69 @@ __attribute__((destructor)) void srsran_dft_exit()
   }
   fclose(fd);
 #endif
+
+  // Release the pre-warmed plans, the plans still in use are left to their owners
+  pthread_mutex_lock(&fft_mutex);
+  for (uint32_t i = 0; i < DFT_CACHE_MAX_NOF_PLANS; i++) {
+    if (dft_cache[i].pinned) {
+      dft_cache[i].pinned = false;
+      dft_cache_put(dft_cache[i].p);
+    }
+  }
+  pthread_mutex_unlock(&fft_mutex);
+
   fftwf_cleanup();
 }
 
+void srsran_dft_set_backend(srsran_dft_backend_t backend)
+{
+  dft_backend = backend;
+}
+
+srsran_dft_backend_t srsran_dft_get_backend()
+{
+  return dft_backend;
+}
+
+const char* srsran_dft_backend_string(srsran_dft_backend_t backend)
+{
+  switch (backend) {
+    case SRSRAN_DFT_BACKEND_FFTW:
+      return "fftw";
+    case SRSRAN_DFT_BACKEND_NATIVE:
+      return "native";
+    default:
+      break;
+  }
+  return "invalid";
+}
+
+// Creates a complex plan with the selected backend. Must be called with fft_mutex locked
+static void* dft_plan_create_c(srsran_dft_plan_t* plan, int dft_points, srsran_dft_dir_t dir)
+{
+  // Sizes that are not a product of 2, 3 and 5 fall back to FFTW
+  if (dft_backend == SRSRAN_DFT_BACKEND_NATIVE && dft_native_size_supported(dft_points)) {
+    plan->backend = SRSRAN_DFT_BACKEND_NATIVE;
+    return dft_native_plan_create(dft_points, dir);
+  }
+
+  plan->backend = SRSRAN_DFT_BACKEND_FFTW;
+  return dft_cache_get(dft_points, dir, SRSRAN_DFT_COMPLEX, plan->in, plan->out);
+}
+
+// Releases the plan of any backend. Must be called with fft_mutex locked
+static void dft_plan_destroy(srsran_dft_plan_t* plan)
+{
+  if (plan->backend == SRSRAN_DFT_BACKEND_NATIVE) {
+    dft_native_plan_destroy(plan->p);
+  } else if (plan->is_guru) {
+    fftwf_destroy_plan(plan->p);
+  } else {
+    dft_cache_put(plan->p);
+  }
+  plan->p = NULL;
+}
+
 int srsran_dft_plan(srsran_dft_plan_t* plan, const int dft_points, srsran_dft_dir_t dir, srsran_dft_mode_t mode)
 {
   bzero(plan, sizeof(srsran_dft_plan_t));
@@ -151,33 +375,17 @@ int srsran_dft_replan_guru_c(srsran_dft_plan_t* plan,
                              int                idist,
                              int                odist)
 {
-  int sign = (plan->forward) ? FFTW_FORWARD : FFTW_BACKWARD;
-
-  const fftwf_iodim iodim        = {new_dft_points, istride, ostride};
-  const fftwf_iodim howmany_dims = {how_many, idist, odist};
-
-  pthread_mutex_lock(&fft_mutex);
-
   /* Destroy current plan */
-  fftwf_destroy_plan(plan->p);
-
-  plan->p = fftwf_plan_guru_dft(1, &iodim, 1, &howmany_dims, in_buffer, out_buffer, sign, FFTW_TYPE);
-
+  pthread_mutex_lock(&fft_mutex);
+  dft_plan_destroy(plan);
   pthread_mutex_unlock(&fft_mutex);
 
-  if (!plan->p) {
-    return -1;
-  }
-  plan->size      = new_dft_points;
-  plan->init_size = plan->size;
-
-  return 0;
+  return srsran_dft_plan_guru_c(
+      plan, new_dft_points, plan->dir, in_buffer, out_buffer, istride, ostride, how_many, idist, odist);
 }
 
 int srsran_dft_replan_c(srsran_dft_plan_t* plan, const int new_dft_points)
 {
-  int sign = (plan->dir == SRSRAN_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
-
   // No change in size, skip re-planning
   if (plan->size == new_dft_points) {
     return 0;
@@ -185,10 +393,9 @@ int srsran_dft_replan_c(srsran_dft_plan_t* plan, const int new_dft_points)
 
   pthread_mutex_lock(&fft_mutex);
   if (plan->p) {
-    fftwf_destroy_plan(plan->p);
-    plan->p = NULL;
+    dft_plan_destroy(plan);
   }
-  plan->p = fftwf_plan_dft_1d(new_dft_points, plan->in, plan->out, sign, FFTW_TYPE);
+  plan->p = dft_plan_create_c(plan, new_dft_points, plan->dir);
   pthread_mutex_unlock(&fft_mutex);
 
   if (!plan->p) {
@@ -198,25 +405,31 @@ int srsran_dft_replan_c(srsran_dft_plan_t* plan, const int new_dft_points)
   return 0;
 }
 
-int srsran_dft_plan_guru_c(srsran_dft_plan_t* plan,
-                           const int          dft_points,
-                           srsran_dft_dir_t   dir,
-                           cf_t*              in_buffer,
-                           cf_t*              out_buffer,
-                           int                istride,
-                           int                ostride,
-                           int                how_many,
-                           int                idist,
-                           int                odist)
+static int dft_plan_guru(srsran_dft_plan_t* plan,
+                         const int          dft_points,
+                         srsran_dft_dir_t   dir,
+                         cf_t*              in_buffer,
+                         cf_t*              out_buffer,
+                         const fftwf_iodim* iodim,
+                         int                howmany_rank,
+                         const fftwf_iodim* howmany_dims)
 {
   int sign = (dir == SRSRAN_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
 
-  const fftwf_iodim iodim        = {dft_points, istride, ostride};
-  const fftwf_iodim howmany_dims = {how_many, idist, odist};
-
   pthread_mutex_lock(&fft_mutex);
 
-  plan->p = fftwf_plan_guru_dft(1, &iodim, 1, &howmany_dims, in_buffer, out_buffer, sign, FFTW_TYPE);
+  // The native backend only transforms contiguous samples
+  if (dft_backend == SRSRAN_DFT_BACKEND_NATIVE && dft_native_size_supported(dft_points) && iodim->is == 1 &&
+      iodim->os == 1) {
+    const fftwf_iodim* inner = &howmany_dims[howmany_rank - 1];
+    const fftwf_iodim  batch = (howmany_rank == 2) ? howmany_dims[0] : (fftwf_iodim){1, 0, 0};
+    plan->p                  = dft_native_plan_create_guru(
+        dft_points, dir, in_buffer, out_buffer, inner->n, inner->is, inner->os, batch.n, batch.is, batch.os);
+    plan->backend = SRSRAN_DFT_BACKEND_NATIVE;
+  } else {
+    plan->p       = fftwf_plan_guru_dft(1, iodim, howmany_rank, howmany_dims, in_buffer, out_buffer, sign, FFTW_TYPE);
+    plan->backend = SRSRAN_DFT_BACKEND_FFTW;
+  }
   pthread_mutex_unlock(&fft_mutex);
 
   if (!plan->p) {
@@ -237,15 +450,47 @@ int srsran_dft_plan_guru_c(srsran_dft_plan_t* plan,
   return 0;
 }
 
+int srsran_dft_plan_guru_c(srsran_dft_plan_t* plan,
+                           const int          dft_points,
+                           srsran_dft_dir_t   dir,
+                           cf_t*              in_buffer,
+                           cf_t*              out_buffer,
+                           int                istride,
+                           int                ostride,
+                           int                how_many,
+                           int                idist,
+                           int                odist)
+{
+  const fftwf_iodim iodim        = {dft_points, istride, ostride};
+  const fftwf_iodim howmany_dims = {how_many, idist, odist};
+
+  return dft_plan_guru(plan, dft_points, dir, in_buffer, out_buffer, &iodim, 1, &howmany_dims);
+}
+
+int srsran_dft_plan_guru_batch_c(srsran_dft_plan_t* plan,
+                                 const int          dft_points,
+                                 srsran_dft_dir_t   dir,
+                                 cf_t*              in_buffer,
+                                 cf_t*              out_buffer,
+                                 int                how_many,
+                                 int                idist,
+                                 int                odist,
+                                 int                nof_batches,
+                                 int                batch_idist,
+                                 int                batch_odist)
+{
+  const fftwf_iodim iodim           = {dft_points, 1, 1};
+  const fftwf_iodim howmany_dims[2] = {{nof_batches, batch_idist, batch_odist}, {how_many, idist, odist}};
+
+  return dft_plan_guru(plan, dft_points, dir, in_buffer, out_buffer, &iodim, 2, howmany_dims);
+}
+
 int srsran_dft_plan_c(srsran_dft_plan_t* plan, const int dft_points, srsran_dft_dir_t dir)
 {
   allocate(plan, sizeof(fftwf_complex), sizeof(fftwf_complex), dft_points);
 
   pthread_mutex_lock(&fft_mutex);
-
-  int sign = (dir == SRSRAN_DFT_FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
-  plan->p  = fftwf_plan_dft_1d(dft_points, plan->in, plan->out, sign, FFTW_TYPE);
-
+  plan->p = dft_plan_create_c(plan, dft_points, dir);
   pthread_mutex_unlock(&fft_mutex);
 
   if (!plan->p) {
@@ -267,14 +512,11 @@ int srsran_dft_plan_c(srsran_dft_plan_t* plan, const int dft_points, srsran_dft_
 
 int srsran_dft_replan_r(srsran_dft_plan_t* plan, const int new_dft_points)
 {
-  int sign = (plan->dir == SRSRAN_DFT_FORWARD) ? FFTW_R2HC : FFTW_HC2R;
-
   pthread_mutex_lock(&fft_mutex);
   if (plan->p) {
-    fftwf_destroy_plan(plan->p);
-    plan->p = NULL;
+    dft_plan_destroy(plan);
   }
-  plan->p = fftwf_plan_r2r_1d(new_dft_points, plan->in, plan->out, sign, FFTW_TYPE);
+  plan->p = dft_cache_get(new_dft_points, plan->dir, SRSRAN_REAL, plan->in, plan->out);
   pthread_mutex_unlock(&fft_mutex);
 
   if (!plan->p) {
@@ -287,10 +529,10 @@ int srsran_dft_replan_r(srsran_dft_plan_t* plan, const int new_dft_points)
 int srsran_dft_plan_r(srsran_dft_plan_t* plan, const int dft_points, srsran_dft_dir_t dir)
 {
   allocate(plan, sizeof(float), sizeof(float), dft_points);
-  int sign = (dir == SRSRAN_DFT_FORWARD) ? FFTW_R2HC : FFTW_HC2R;
 
   pthread_mutex_lock(&fft_mutex);
-  plan->p = fftwf_plan_r2r_1d(dft_points, plan->in, plan->out, sign, FFTW_TYPE);
+  plan->p       = dft_cache_get(dft_points, dir, SRSRAN_REAL, plan->in, plan->out);
+  plan->backend = SRSRAN_DFT_BACKEND_FFTW;
   pthread_mutex_unlock(&fft_mutex);
 
   if (!plan->p) {
@@ -362,7 +604,11 @@ void srsran_dft_run(srsran_dft_plan_t* plan, const void* in, void* out)
 
 void srsran_dft_run_c_zerocopy(srsran_dft_plan_t* plan, const cf_t* in, cf_t* out)
 {
-  fftwf_execute_dft(plan->p, (cf_t*)in, out);
+  if (plan->backend == SRSRAN_DFT_BACKEND_NATIVE) {
+    dft_native_execute(plan->p, in, out);
+  } else {
+    fftwf_execute_dft(plan->p, (cf_t*)in, out);
+  }
 }
 
 void srsran_dft_run_c(srsran_dft_plan_t* plan, const cf_t* in, cf_t* out)
@@ -372,7 +618,11 @@ void srsran_dft_run_c(srsran_dft_plan_t* plan, const cf_t* in, cf_t* out)
   fftwf_complex* f_out = plan->out;
 
   copy_pre((uint8_t*)plan->in, (uint8_t*)in, sizeof(cf_t), plan->size, plan->forward, plan->mirror, plan->dc);
-  fftwf_execute(plan->p);
+  if (plan->backend == SRSRAN_DFT_BACKEND_NATIVE) {
+    dft_native_execute(plan->p, plan->in, plan->out);
+  } else {
+    fftwf_execute_dft(plan->p, plan->in, plan->out);
+  }
   if (plan->norm) {
     norm = 1.0 / sqrtf(plan->size);
     srsran_vec_sc_prod_cfc(f_out, norm, f_out, plan->size);
@@ -388,12 +638,41 @@ void srsran_dft_run_c(srsran_dft_plan_t* plan, const cf_t* in, cf_t* out)
 void srsran_dft_run_guru_c(srsran_dft_plan_t* plan)
 {
   if (plan->is_guru == true) {
-    fftwf_execute(plan->p);
+    if (plan->backend == SRSRAN_DFT_BACKEND_NATIVE) {
+      dft_native_execute_guru(plan->p);
+    } else {
+      fftwf_execute(plan->p);
+    }
   } else {
     ERROR("srsran_dft_run_guru_c: the selected plan is not guru!");
   }
 }
 
+void srsran_dft_run_batch_c(srsran_dft_plan_t* plan, const cf_t* in, cf_t* out, uint32_t nof_batches)
+{
+  int  len      = plan->size;
+  bool zerocopy = !plan->mirror && !plan->db && !plan->dc;
+
+  // FFTW new-array execution requires the same alignment and placement the plan was created with
+  if (zerocopy && plan->backend == SRSRAN_DFT_BACKEND_FFTW) {
+    zerocopy = in != out && dft_cache_alignment((void*)in, out) == dft_cache_alignment(plan->in, plan->out);
+  }
+
+  if (!zerocopy) {
+    for (uint32_t i = 0; i < nof_batches; i++) {
+      srsran_dft_run_c(plan, &in[i * len], &out[i * len]);
+    }
+    return;
+  }
+
+  for (uint32_t i = 0; i < nof_batches; i++) {
+    srsran_dft_run_c_zerocopy(plan, &in[i * len], &out[i * len]);
+  }
+  if (plan->norm) {
+    srsran_vec_sc_prod_cfc(out, 1.0f / sqrtf(len), out, len * nof_batches);
+  }
+}
+
 void srsran_dft_run_r(srsran_dft_plan_t* plan, const float* in, float* out)
 {
   float  norm;
@@ -402,7 +681,7 @@ void srsran_dft_run_r(srsran_dft_plan_t* plan, const float* in, float* out)
   float* f_out = plan->out;
 
   memcpy(plan->in, in, sizeof(float) * plan->size);
-  fftwf_execute(plan->p);
+  fftwf_execute_r2r(plan->p, plan->in, plan->out);
   if (plan->norm) {
     norm = 1.0 / plan->size;
     srsran_vec_sc_prod_fff(f_out, norm, f_out, plan->size);
@@ -429,8 +708,9 @@ void srsran_dft_plan_free(srsran_dft_plan_t* plan)
     if (plan->out)
       fftwf_free(plan->out);
   }
-  if (plan->p)
-    fftwf_destroy_plan(plan->p);
+  if (plan->p) {
+    dft_plan_destroy(plan);
+  }
   pthread_mutex_unlock(&fft_mutex);
   bzero(plan, sizeof(srsran_dft_plan_t));
 }
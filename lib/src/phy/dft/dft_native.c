@@ -0,0 +1,509 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "dft_native.h"
+#include "srsran/phy/utils/simd.h"
+#include "srsran/phy/utils/vector.h"
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Self-sorting (Stockham) decimation in frequency FFT. A stage of radix r, stride s and m = n / r transforms the
+ * input x[q + s * (p + j * m)] into y[q + s * (r * p + k)] for q in [0, s), p in [0, m), j and k in [0, r). The
+ * butterflies of a stage are independent, they are vectorized along t = q + s * p which makes the r inputs of the
+ * butterflies contiguous in memory.
+ *
+ * The data is kept in split real/imaginary buffers between stages. The backward transform is computed as the
+ * conjugate of the forward transform of the conjugated input.
+ */
+
+#define DFT_NATIVE_MAX_RADIX 5
+#define DFT_NATIVE_MAX_STAGES 32
+
+#define DFT_NATIVE_COS_2PI_5 0.309016994374947f
+#define DFT_NATIVE_COS_4PI_5 -0.809016994374947f
+#define DFT_NATIVE_SIN_2PI_5 0.951056516295154f
+#define DFT_NATIVE_SIN_4PI_5 0.587785252292473f
+#define DFT_NATIVE_SIN_2PI_3 0.866025403784439f
+
+typedef struct {
+  int    radix;
+  int    s;          // Stride, product of the radices of the previous stages
+  int    m;          // Number of butterflies per stride
+  bool   contiguous; // Each SIMD word has a single twiddle and contiguous outputs
+  float* tw_re;      // Twiddles, (radix - 1) x m if contiguous, (radix - 1) x (s * m) otherwise
+  float* tw_im;
+} dft_native_stage_t;
+
+struct dft_native_plan_s {
+  int                size;
+  bool               forward;
+  uint32_t           nof_stages;
+  dft_native_stage_t stages[DFT_NATIVE_MAX_STAGES];
+  float*             buf_re[2];
+  float*             buf_im[2];
+
+  // Guru batch, only used by plans created with dft_native_plan_create_guru()
+  cf_t* in;
+  cf_t* out;
+  int   how_many;
+  int   idist;
+  int   odist;
+  int   nof_batches;
+  int   batch_idist;
+  int   batch_odist;
+};
+
+static int dft_native_factorize(int n, int* radices)
+{
+  int nof_radices = 0;
+
+  if (n < 1) {
+    return -1;
+  }
+
+  // Radix 4 and 2 first, so the stride of the later stages is a multiple of the SIMD size
+  const int factors[4] = {4, 2, 3, 5};
+  for (uint32_t i = 0; i < 4; i++) {
+    while (n % factors[i] == 0 && nof_radices < DFT_NATIVE_MAX_STAGES) {
+      radices[nof_radices++] = factors[i];
+      n /= factors[i];
+    }
+  }
+
+  return (n == 1) ? nof_radices : -1;
+}
+
+bool dft_native_size_supported(int dft_points)
+{
+  int radices[DFT_NATIVE_MAX_STAGES];
+  return dft_native_factorize(dft_points, radices) >= 0;
+}
+
+// Complex products written out, so they do not go through the C99 NaN/Inf handling of the compiler
+static inline cf_t dft_native_prod(cf_t a, cf_t b)
+{
+  return (__real__ a * __real__ b - __imag__ a * __imag__ b) + I * (__real__ a * __imag__ b + __imag__ a * __real__ b);
+}
+
+static inline cf_t dft_native_mulj(cf_t a)
+{
+  return -__imag__ a + I * __real__ a;
+}
+
+static inline void dft_native_bfly(cf_t* a, int radix)
+{
+  switch (radix) {
+    case 2: {
+      cf_t t = a[0];
+      a[0]   = t + a[1];
+      a[1]   = t - a[1];
+    } break;
+    case 3: {
+      cf_t t1 = a[1] + a[2];
+      cf_t t2 = a[0] - 0.5f * t1;
+      cf_t d  = dft_native_mulj(DFT_NATIVE_SIN_2PI_3 * (a[1] - a[2]));
+      a[0]    = a[0] + t1;
+      a[1]    = t2 - d;
+      a[2]    = t2 + d;
+    } break;
+    case 4: {
+      cf_t t0 = a[0] + a[2];
+      cf_t t1 = a[0] - a[2];
+      cf_t t2 = a[1] + a[3];
+      cf_t t3 = dft_native_mulj(a[1] - a[3]);
+      a[0]    = t0 + t2;
+      a[1]    = t1 - t3;
+      a[2]    = t0 - t2;
+      a[3]    = t1 + t3;
+    } break;
+    case 5: {
+      cf_t b1 = a[1] + a[4];
+      cf_t b2 = a[2] + a[3];
+      cf_t d1 = a[1] - a[4];
+      cf_t d2 = a[2] - a[3];
+      cf_t t1 = a[0] + DFT_NATIVE_COS_2PI_5 * b1 + DFT_NATIVE_COS_4PI_5 * b2;
+      cf_t t2 = a[0] + DFT_NATIVE_COS_4PI_5 * b1 + DFT_NATIVE_COS_2PI_5 * b2;
+      cf_t u1 = dft_native_mulj(DFT_NATIVE_SIN_2PI_5 * d1 + DFT_NATIVE_SIN_4PI_5 * d2);
+      cf_t u2 = dft_native_mulj(DFT_NATIVE_SIN_4PI_5 * d1 - DFT_NATIVE_SIN_2PI_5 * d2);
+      a[0]    = a[0] + b1 + b2;
+      a[1]    = t1 - u1;
+      a[2]    = t2 - u2;
+      a[3]    = t2 + u2;
+      a[4]    = t1 + u1;
+    } break;
+    default:
+      break;
+  }
+}
+
+#if SRSRAN_SIMD_CF_SIZE
+static inline void dft_native_bfly_simd(simd_cf_t* a, int radix)
+{
+  switch (radix) {
+    case 2: {
+      simd_cf_t t = a[0];
+      a[0]        = srsran_simd_cf_add(t, a[1]);
+      a[1]        = srsran_simd_cf_sub(t, a[1]);
+    } break;
+    case 3: {
+      simd_cf_t t1 = srsran_simd_cf_add(a[1], a[2]);
+      simd_cf_t t2 = srsran_simd_cf_sub(a[0], srsran_simd_cf_mul(t1, srsran_simd_f_set1(0.5f)));
+      simd_cf_t d  = srsran_simd_cf_mulj(
+          srsran_simd_cf_mul(srsran_simd_cf_sub(a[1], a[2]), srsran_simd_f_set1(DFT_NATIVE_SIN_2PI_3)));
+      a[0] = srsran_simd_cf_add(a[0], t1);
+      a[1] = srsran_simd_cf_sub(t2, d);
+      a[2] = srsran_simd_cf_add(t2, d);
+    } break;
+    case 4: {
+      simd_cf_t t0 = srsran_simd_cf_add(a[0], a[2]);
+      simd_cf_t t1 = srsran_simd_cf_sub(a[0], a[2]);
+      simd_cf_t t2 = srsran_simd_cf_add(a[1], a[3]);
+      simd_cf_t t3 = srsran_simd_cf_mulj(srsran_simd_cf_sub(a[1], a[3]));
+      a[0]         = srsran_simd_cf_add(t0, t2);
+      a[1]         = srsran_simd_cf_sub(t1, t3);
+      a[2]         = srsran_simd_cf_sub(t0, t2);
+      a[3]         = srsran_simd_cf_add(t1, t3);
+    } break;
+    case 5: {
+      simd_f_t  c1 = srsran_simd_f_set1(DFT_NATIVE_COS_2PI_5);
+      simd_f_t  c2 = srsran_simd_f_set1(DFT_NATIVE_COS_4PI_5);
+      simd_f_t  s1 = srsran_simd_f_set1(DFT_NATIVE_SIN_2PI_5);
+      simd_f_t  s2 = srsran_simd_f_set1(DFT_NATIVE_SIN_4PI_5);
+      simd_cf_t b1 = srsran_simd_cf_add(a[1], a[4]);
+      simd_cf_t b2 = srsran_simd_cf_add(a[2], a[3]);
+      simd_cf_t d1 = srsran_simd_cf_sub(a[1], a[4]);
+      simd_cf_t d2 = srsran_simd_cf_sub(a[2], a[3]);
+      simd_cf_t t1 = srsran_simd_cf_add(srsran_simd_cf_mul(b1, c1), srsran_simd_cf_mul(b2, c2));
+      simd_cf_t t2 = srsran_simd_cf_add(srsran_simd_cf_mul(b1, c2), srsran_simd_cf_mul(b2, c1));
+      simd_cf_t u1 = srsran_simd_cf_add(srsran_simd_cf_mul(d1, s1), srsran_simd_cf_mul(d2, s2));
+      simd_cf_t u2 = srsran_simd_cf_sub(srsran_simd_cf_mul(d1, s2), srsran_simd_cf_mul(d2, s1));
+      t1           = srsran_simd_cf_add(a[0], t1);
+      t2           = srsran_simd_cf_add(a[0], t2);
+      u1           = srsran_simd_cf_mulj(u1);
+      u2           = srsran_simd_cf_mulj(u2);
+      a[0]         = srsran_simd_cf_add(a[0], srsran_simd_cf_add(b1, b2));
+      a[1]         = srsran_simd_cf_sub(t1, u1);
+      a[2]         = srsran_simd_cf_sub(t2, u2);
+      a[3]         = srsran_simd_cf_add(t2, u2);
+      a[4]         = srsran_simd_cf_add(t1, u1);
+    } break;
+    default:
+      break;
+  }
+}
+#endif /* SRSRAN_SIMD_CF_SIZE */
+
+static void dft_native_stage(const dft_native_stage_t* st,
+                             int                       len,
+                             const float*              x_re,
+                             const float*              x_im,
+                             float*                    y_re,
+                             float*                    y_im)
+{
+  int r = st->radix;
+  int s = st->s;
+  int m = st->m;
+  int t = 0;
+
+#if SRSRAN_SIMD_CF_SIZE
+  for (; t + SRSRAN_SIMD_CF_SIZE <= len; t += SRSRAN_SIMD_CF_SIZE) {
+    simd_cf_t a[DFT_NATIVE_MAX_RADIX];
+    int       p = t / s;
+    int       q = t % s;
+
+    for (int j = 0; j < r; j++) {
+      a[j] = srsran_simd_cf_loadu(&x_re[t + j * len], &x_im[t + j * len]);
+    }
+
+    dft_native_bfly_simd(a, r);
+
+    if (st->contiguous) {
+      srsran_simd_cf_storeu(&y_re[q + s * r * p], &y_im[q + s * r * p], a[0]);
+      for (int k = 1; k < r; k++) {
+        int idx = (k - 1) * m + p;
+        a[k]    = srsran_simd_cf_prod(a[k], srsran_simd_cf_set1(st->tw_re[idx] + I * st->tw_im[idx]));
+        srsran_simd_cf_storeu(&y_re[q + s * (r * p + k)], &y_im[q + s * (r * p + k)], a[k]);
+      }
+    } else {
+      // The outputs are spread in blocks of s samples
+      float tmp_re[SRSRAN_SIMD_CF_SIZE];
+      float tmp_im[SRSRAN_SIMD_CF_SIZE];
+      for (int k = 0; k < r; k++) {
+        if (k > 0) {
+          int idx = (k - 1) * len + t;
+          a[k]    = srsran_simd_cf_prod(a[k], srsran_simd_cf_loadu(&st->tw_re[idx], &st->tw_im[idx]));
+        }
+        srsran_simd_cf_storeu(tmp_re, tmp_im, a[k]);
+        for (int i = 0, qq = q, pp = p; i < SRSRAN_SIMD_CF_SIZE; i++) {
+          y_re[qq + s * (r * pp + k)] = tmp_re[i];
+          y_im[qq + s * (r * pp + k)] = tmp_im[i];
+          if (++qq == s) {
+            qq = 0;
+            pp++;
+          }
+        }
+      }
+    }
+  }
+#endif /* SRSRAN_SIMD_CF_SIZE */
+
+  for (int p = t / s, q = t % s; t < len; t++) {
+    cf_t a[DFT_NATIVE_MAX_RADIX];
+
+    for (int j = 0; j < r; j++) {
+      a[j] = x_re[t + j * len] + I * x_im[t + j * len];
+    }
+
+    dft_native_bfly(a, r);
+
+    for (int k = 0; k < r; k++) {
+      if (k > 0) {
+        int idx = st->contiguous ? (k - 1) * m + p : (k - 1) * len + t;
+        a[k]    = dft_native_prod(a[k], st->tw_re[idx] + I * st->tw_im[idx]);
+      }
+      y_re[q + s * (r * p + k)] = __real__ a[k];
+      y_im[q + s * (r * p + k)] = __imag__ a[k];
+    }
+
+    if (++q == s) {
+      q = 0;
+      p++;
+    }
+  }
+}
+
+#if SRSRAN_SIMD_CF_SIZE
+/* The AVX2 interleaved load and store keep the samples in 128-bit lane order, the stages need them in memory order */
+static inline simd_cf_t dft_native_cfi_loadu(const cf_t* ptr)
+{
+  simd_cf_t a = srsran_simd_cfi_loadu(ptr);
+#if defined(LV_HAVE_AVX2) && !defined(LV_HAVE_AVX512)
+  __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  a.re        = _mm256_permutevar8x32_ps(a.re, idx);
+  a.im        = _mm256_permutevar8x32_ps(a.im, idx);
+#endif /* LV_HAVE_AVX2 && !LV_HAVE_AVX512 */
+  return a;
+}
+
+static inline void dft_native_cfi_storeu(cf_t* ptr, simd_cf_t a)
+{
+#if defined(LV_HAVE_AVX2) && !defined(LV_HAVE_AVX512)
+  __m256i idx = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  a.re        = _mm256_permutevar8x32_ps(a.re, idx);
+  a.im        = _mm256_permutevar8x32_ps(a.im, idx);
+#endif /* LV_HAVE_AVX2 && !LV_HAVE_AVX512 */
+  srsran_simd_cfi_storeu(ptr, a);
+}
+#endif /* SRSRAN_SIMD_CF_SIZE */
+
+static void dft_native_split(const cf_t* in, float* re, float* im, int n, bool conj)
+{
+  int i = 0;
+
+#if SRSRAN_SIMD_CF_SIZE
+  for (; i + SRSRAN_SIMD_CF_SIZE <= n; i += SRSRAN_SIMD_CF_SIZE) {
+    simd_cf_t a = dft_native_cfi_loadu(&in[i]);
+    if (conj) {
+      a = srsran_simd_cf_conj(a);
+    }
+    srsran_simd_cf_storeu(&re[i], &im[i], a);
+  }
+#endif /* SRSRAN_SIMD_CF_SIZE */
+
+  for (; i < n; i++) {
+    re[i] = __real__ in[i];
+    im[i] = conj ? -__imag__ in[i] : __imag__ in[i];
+  }
+}
+
+static void dft_native_merge(const float* re, const float* im, cf_t* out, int n, bool conj)
+{
+  int i = 0;
+
+#if SRSRAN_SIMD_CF_SIZE
+  for (; i + SRSRAN_SIMD_CF_SIZE <= n; i += SRSRAN_SIMD_CF_SIZE) {
+    simd_cf_t a = srsran_simd_cf_loadu(&re[i], &im[i]);
+    if (conj) {
+      a = srsran_simd_cf_conj(a);
+    }
+    dft_native_cfi_storeu(&out[i], a);
+  }
+#endif /* SRSRAN_SIMD_CF_SIZE */
+
+  for (; i < n; i++) {
+    out[i] = re[i] + I * (conj ? -im[i] : im[i]);
+  }
+}
+
+dft_native_plan_t* dft_native_plan_create(int dft_points, srsran_dft_dir_t dir)
+{
+  int radices[DFT_NATIVE_MAX_STAGES];
+  int nof_radices = dft_native_factorize(dft_points, radices);
+  if (nof_radices < 0) {
+    return NULL;
+  }
+
+  dft_native_plan_t* plan = calloc(1, sizeof(dft_native_plan_t));
+  if (plan == NULL) {
+    return NULL;
+  }
+  plan->size       = dft_points;
+  plan->forward    = (dir == SRSRAN_DFT_FORWARD);
+  plan->nof_stages = (uint32_t)nof_radices;
+
+  for (uint32_t i = 0; i < 2; i++) {
+    plan->buf_re[i] = srsran_vec_f_malloc(dft_points);
+    plan->buf_im[i] = srsran_vec_f_malloc(dft_points);
+    if (plan->buf_re[i] == NULL || plan->buf_im[i] == NULL) {
+      dft_native_plan_destroy(plan);
+      return NULL;
+    }
+  }
+
+  int n = dft_points;
+  int s = 1;
+  for (uint32_t i = 0; i < plan->nof_stages; i++) {
+    dft_native_stage_t* st = &plan->stages[i];
+    st->radix              = radices[i];
+    st->s                  = s;
+    st->m                  = n / st->radix;
+#if SRSRAN_SIMD_CF_SIZE
+    st->contiguous = (s % SRSRAN_SIMD_CF_SIZE == 0);
+#else
+    st->contiguous = true;
+#endif
+
+    // Twiddles w_p^k = exp(-2 * pi * i * p * k / n), expanded along t for the non-contiguous stages
+    int len    = st->contiguous ? st->m : s * st->m;
+    int nof_tw = (st->radix - 1) * len;
+    st->tw_re  = srsran_vec_f_malloc(nof_tw);
+    st->tw_im  = srsran_vec_f_malloc(nof_tw);
+    if (st->tw_re == NULL || st->tw_im == NULL) {
+      dft_native_plan_destroy(plan);
+      return NULL;
+    }
+    for (int k = 1; k < st->radix; k++) {
+      for (int t = 0; t < len; t++) {
+        int    p                     = st->contiguous ? t : t / s;
+        double arg                   = -2.0 * M_PI * (double)(p * k) / (double)n;
+        st->tw_re[(k - 1) * len + t] = (float)cos(arg);
+        st->tw_im[(k - 1) * len + t] = (float)sin(arg);
+      }
+    }
+
+    s *= st->radix;
+    n = st->m;
+  }
+
+  return plan;
+}
+
+dft_native_plan_t* dft_native_plan_create_guru(int              dft_points,
+                                               srsran_dft_dir_t dir,
+                                               cf_t*            in_buffer,
+                                               cf_t*            out_buffer,
+                                               int              how_many,
+                                               int              idist,
+                                               int              odist,
+                                               int              nof_batches,
+                                               int              batch_idist,
+                                               int              batch_odist)
+{
+  dft_native_plan_t* plan = dft_native_plan_create(dft_points, dir);
+  if (plan == NULL) {
+    return NULL;
+  }
+
+  plan->in          = in_buffer;
+  plan->out         = out_buffer;
+  plan->how_many    = how_many;
+  plan->idist       = idist;
+  plan->odist       = odist;
+  plan->nof_batches = nof_batches;
+  plan->batch_idist = batch_idist;
+  plan->batch_odist = batch_odist;
+
+  return plan;
+}
+
+void dft_native_plan_destroy(dft_native_plan_t* plan)
+{
+  if (plan == NULL) {
+    return;
+  }
+
+  for (uint32_t i = 0; i < 2; i++) {
+    if (plan->buf_re[i]) {
+      free(plan->buf_re[i]);
+    }
+    if (plan->buf_im[i]) {
+      free(plan->buf_im[i]);
+    }
+  }
+  for (uint32_t i = 0; i < plan->nof_stages; i++) {
+    if (plan->stages[i].tw_re) {
+      free(plan->stages[i].tw_re);
+    }
+    if (plan->stages[i].tw_im) {
+      free(plan->stages[i].tw_im);
+    }
+  }
+  free(plan);
+}
+
+void dft_native_execute(dft_native_plan_t* plan, const cf_t* in, cf_t* out)
+{
+  int    n    = plan->size;
+  float* x_re = plan->buf_re[0];
+  float* x_im = plan->buf_im[0];
+  float* y_re = plan->buf_re[1];
+  float* y_im = plan->buf_im[1];
+
+  dft_native_split(in, x_re, x_im, n, !plan->forward);
+
+  for (uint32_t i = 0; i < plan->nof_stages; i++) {
+    const dft_native_stage_t* st = &plan->stages[i];
+    dft_native_stage(st, n / st->radix, x_re, x_im, y_re, y_im);
+
+    float* tmp_re = x_re;
+    float* tmp_im = x_im;
+    x_re          = y_re;
+    x_im          = y_im;
+    y_re          = tmp_re;
+    y_im          = tmp_im;
+  }
+
+  dft_native_merge(x_re, x_im, out, n, !plan->forward);
+}
+
+void dft_native_execute_guru(dft_native_plan_t* plan)
+{
+  for (int b = 0; b < plan->nof_batches; b++) {
+    for (int h = 0; h < plan->how_many; h++) {
+      dft_native_execute(plan,
+                         plan->in + b * plan->batch_idist + h * plan->idist,
+                         plan->out + b * plan->batch_odist + h * plan->odist);
+    }
+  }
+}
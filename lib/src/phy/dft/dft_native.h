@@ -0,0 +1,56 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSRAN_DFT_NATIVE_H_
+#define SRSRAN_DFT_NATIVE_H_
+
+#include "srsran/config.h"
+#include "srsran/phy/dft/dft.h"
+
+/* Built-in mixed radix (2, 3, 4 and 5) complex FFT used by the native DFT backend. The plans are not thread-safe, every
+ * srsran_dft_plan_t owns its native plan.
+ */
+typedef struct dft_native_plan_s dft_native_plan_t;
+
+/* Returns true if the size can be factorized in radices 2, 3 and 5 */
+bool dft_native_size_supported(int dft_points);
+
+dft_native_plan_t* dft_native_plan_create(int dft_points, srsran_dft_dir_t dir);
+
+/* Creates a plan that transforms a two level batch of contiguous DFTs, see srsran_dft_plan_guru_batch_c() */
+dft_native_plan_t* dft_native_plan_create_guru(int              dft_points,
+                                               srsran_dft_dir_t dir,
+                                               cf_t*            in_buffer,
+                                               cf_t*            out_buffer,
+                                               int              how_many,
+                                               int              idist,
+                                               int              odist,
+                                               int              nof_batches,
+                                               int              batch_idist,
+                                               int              batch_odist);
+
+void dft_native_plan_destroy(dft_native_plan_t* plan);
+
+void dft_native_execute(dft_native_plan_t* plan, const cf_t* in, cf_t* out);
+
+void dft_native_execute_guru(dft_native_plan_t* plan);
+
+#endif /* SRSRAN_DFT_NATIVE_H_ */
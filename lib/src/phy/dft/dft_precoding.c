@@ -34,34 +34,20 @@
 #include "srsran/phy/utils/debug.h"
 #include "srsran/phy/utils/vector.h"
 
-/* Create DFT plans for transform precoding */
+/* Initialize transform precoding, the DFT plans are created on first use */
 
 int srsran_dft_precoding_init(srsran_dft_precoding_t* q, uint32_t max_prb, bool is_tx)
 {
-  int ret = SRSRAN_ERROR_INVALID_INPUTS;
   bzero(q, sizeof(srsran_dft_precoding_t));
 
-  if (max_prb <= SRSRAN_MAX_PRB) {
-    ret = SRSRAN_ERROR;
-    for (uint32_t i = 1; i <= max_prb; i++) {
-      if (srsran_dft_precoding_valid_prb(i)) {
-        DEBUG("Initiating DFT precoding plan for %d PRBs", i);
-        if (srsran_dft_plan_c(&q->dft_plan[i], i * SRSRAN_NRE, is_tx ? SRSRAN_DFT_FORWARD : SRSRAN_DFT_BACKWARD)) {
-          ERROR("Error: Creating DFT plan %d", i);
-          goto clean_exit;
-        }
-        srsran_dft_plan_set_norm(&q->dft_plan[i], true);
-      }
-    }
-    q->max_prb = max_prb;
-    ret        = SRSRAN_SUCCESS;
+  if (max_prb > SRSRAN_MAX_PRB) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
   }
 
-clean_exit:
-  if (ret == SRSRAN_ERROR) {
-    srsran_dft_precoding_free(q);
-  }
-  return ret;
+  q->max_prb = max_prb;
+  q->is_tx   = is_tx;
+
+  return SRSRAN_SUCCESS;
 }
 
 int srsran_dft_precoding_init_rx(srsran_dft_precoding_t* q, uint32_t max_prb)
@@ -78,11 +64,27 @@ int srsran_dft_precoding_init_tx(srsran_dft_precoding_t* q, uint32_t max_prb)
 void srsran_dft_precoding_free(srsran_dft_precoding_t* q)
 {
   for (uint32_t i = 1; i <= q->max_prb; i++) {
+    srsran_dft_plan_free(&q->dft_plan[i]);
+  }
+  bzero(q, sizeof(srsran_dft_precoding_t));
+}
+
+int srsran_dft_precoding_prewarm(uint32_t max_prb)
+{
+  int      sizes[SRSRAN_MAX_PRB];
+  uint32_t nof_sizes = 0;
+
+  if (max_prb > SRSRAN_MAX_PRB) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  for (uint32_t i = 1; i <= max_prb; i++) {
     if (srsran_dft_precoding_valid_prb(i)) {
-      srsran_dft_plan_free(&q->dft_plan[i]);
+      sizes[nof_sizes++] = i * SRSRAN_NRE;
     }
   }
-  bzero(q, sizeof(srsran_dft_precoding_t));
+
+  return srsran_dft_plan_prewarm(sizes, nof_sizes);
 }
 
 static bool valid_prb[101] = {true,  true,  true,  true,  true,  true,  true,  false, true,  true,  true,  false, true,
@@ -113,14 +115,22 @@ uint32_t srsran_dft_precoding_get_valid_prb(uint32_t nof_prb)
 
 int srsran_dft_precoding(srsran_dft_precoding_t* q, cf_t* input, cf_t* output, uint32_t nof_prb, uint32_t nof_symbols)
 {
-  if (!srsran_dft_precoding_valid_prb(nof_prb) && nof_prb <= q->max_prb) {
+  if (!srsran_dft_precoding_valid_prb(nof_prb) || nof_prb > q->max_prb) {
     ERROR("Error invalid number of PRB (%d)", nof_prb);
     return SRSRAN_ERROR;
   }
 
-  for (uint32_t i = 0; i < nof_symbols; i++) {
-    srsran_dft_run_c(&q->dft_plan[nof_prb], &input[i * SRSRAN_NRE * nof_prb], &output[i * SRSRAN_NRE * nof_prb]);
+  srsran_dft_plan_t* plan = &q->dft_plan[nof_prb];
+  if (plan->size == 0) {
+    DEBUG("Initiating DFT precoding plan for %d PRBs", nof_prb);
+    if (srsran_dft_plan_c(plan, nof_prb * SRSRAN_NRE, q->is_tx ? SRSRAN_DFT_FORWARD : SRSRAN_DFT_BACKWARD)) {
+      ERROR("Error: Creating DFT plan %d", nof_prb);
+      return SRSRAN_ERROR;
+    }
+    srsran_dft_plan_set_norm(plan, true);
   }
 
+  srsran_dft_run_batch_c(plan, input, output, nof_symbols);
+
   return SRSRAN_SUCCESS;
 }
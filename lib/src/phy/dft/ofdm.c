@@ -167,28 +167,35 @@ static int ofdm_init_mbsfn_(srsran_ofdm_t* q, srsran_ofdm_cfg_t* cfg, srsran_dft
     srsran_vec_cf_zero(in_buffer, q->sf_sz);
   }
 
-  for (int slot = 0; slot < SRSRAN_NOF_SLOTS_PER_SF; slot++) {
+  if (dir == SRSRAN_DFT_FORWARD) {
     // If Guru DFT was allocated, free
-    if (q->fft_plan_sf[slot].size) {
-      srsran_dft_plan_free(&q->fft_plan_sf[slot]);
+    if (q->fft_plan_rx_sf.size) {
+      srsran_dft_plan_free(&q->fft_plan_rx_sf);
     }
 
-    // Create Tx/Rx plans
-    if (dir == SRSRAN_DFT_FORWARD) {
-      if (srsran_dft_plan_guru_c(&q->fft_plan_sf[slot],
-                                 symbol_sz,
-                                 dir,
-                                 in_buffer + cp1 + q->slot_sz * slot - q->window_offset_n,
-                                 q->tmp,
-                                 1,
-                                 1,
-                                 SRSRAN_CP_NSYMB(cp),
-                                 symbol_sz + cp2,
-                                 symbol_sz)) {
-        ERROR("Creating Guru DFT plan (%d)", slot);
-        return SRSRAN_ERROR;
+    // Create a single Rx plan for both slots, the cyclic prefixes are skipped through the strides
+    if (srsran_dft_plan_guru_batch_c(&q->fft_plan_rx_sf,
+                                     symbol_sz,
+                                     dir,
+                                     in_buffer + cp1 - q->window_offset_n,
+                                     q->tmp,
+                                     SRSRAN_CP_NSYMB(cp),
+                                     symbol_sz + cp2,
+                                     symbol_sz,
+                                     SRSRAN_NOF_SLOTS_PER_SF,
+                                     q->slot_sz,
+                                     SRSRAN_CP_NSYMB(cp) * symbol_sz)) {
+      ERROR("Creating Guru DFT plan");
+      return SRSRAN_ERROR;
+    }
+  } else {
+    for (int slot = 0; slot < SRSRAN_NOF_SLOTS_PER_SF; slot++) {
+      // If Guru DFT was allocated, free
+      if (q->fft_plan_sf[slot].size) {
+        srsran_dft_plan_free(&q->fft_plan_sf[slot]);
       }
-    } else {
+
+      // Create Tx plans
       if (srsran_dft_plan_guru_c(&q->fft_plan_sf[slot],
                                  symbol_sz,
                                  dir,
@@ -253,6 +260,9 @@ void srsran_ofdm_free_(srsran_ofdm_t* q)
       srsran_dft_plan_free(&q->fft_plan_sf[slot]);
     }
   }
+  if (q->fft_plan_rx_sf.init_size) {
+    srsran_dft_plan_free(&q->fft_plan_rx_sf);
+  }
 #endif
 
   if (q->tmp) {
@@ -468,8 +478,43 @@ void srsran_ofdm_rx_slot_ng(srsran_ofdm_t* q, cf_t* input, cf_t* output)
   }
 }
 
+#ifndef AVOID_GURU
+/* Writes the resource elements of a transformed symbol to the output. The FFT shift, the DFT window offset, the phase
+ * compensation and the normalization are applied while the output is written.
+ */
+static void ofdm_rx_symbol(srsran_ofdm_t* q, const cf_t* tmp, cf_t* output, uint32_t symbol_idx)
+{
+  uint32_t    symbol_sz = q->cfg.symbol_sz;
+  uint32_t    half_re   = q->nof_re / 2;
+  uint32_t    neg_idx   = symbol_sz - half_re;
+  uint32_t    pos_idx   = (q->fft_plan.dc) ? 1 : 0;
+  bool        phase     = isnormal(q->cfg.phase_compensation_hz);
+  float       norm      = (q->fft_plan.norm) ? 1.0f / sqrtf(q->fft_plan.size) : 1.0f;
+  cf_t        factor    = phase ? conjf(q->phase_compensation[symbol_idx]) * norm : norm;
+  const cf_t* window    = q->window_offset_buffer;
+
+  if (q->window_offset_n) {
+    // Apply frequency domain window offset
+    srsran_vec_prod_ccc(&tmp[neg_idx], &window[neg_idx], output, half_re);
+    srsran_vec_prod_ccc(&tmp[pos_idx], &window[pos_idx], &output[half_re], half_re);
+    if (phase || q->fft_plan.norm) {
+      srsran_vec_sc_prod_ccc(output, factor, output, 2 * half_re);
+    }
+  } else if (phase) {
+    srsran_vec_sc_prod_ccc(&tmp[neg_idx], factor, output, half_re);
+    srsran_vec_sc_prod_ccc(&tmp[pos_idx], factor, &output[half_re], half_re);
+  } else if (q->fft_plan.norm) {
+    srsran_vec_sc_prod_cfc(&tmp[neg_idx], norm, output, half_re);
+    srsran_vec_sc_prod_cfc(&tmp[pos_idx], norm, &output[half_re], half_re);
+  } else {
+    srsran_vec_cf_copy(output, &tmp[neg_idx], half_re);
+    srsran_vec_cf_copy(&output[half_re], &tmp[pos_idx], half_re);
+  }
+}
+#endif /* AVOID_GURU */
+
 /* Transforms input samples into output OFDM symbols.
- * Performs FFT on a each symbol and removes CP.
+ * Performs FFT on a each symbol and removes CP. Without AVOID_GURU, the subframe plan must have been executed before.
  */
 static void ofdm_rx_slot(srsran_ofdm_t* q, int slot_in_sf)
 {
@@ -477,44 +522,9 @@ static void ofdm_rx_slot(srsran_ofdm_t* q, int slot_in_sf)
   srsran_ofdm_rx_slot_ng(
       q, q->cfg.in_buffer + slot_in_sf * q->slot_sz, q->cfg.out_buffer + slot_in_sf * q->nof_re * q->nof_symbols);
 #else
-  uint32_t nof_symbols = q->nof_symbols;
-  uint32_t nof_re = q->nof_re;
-  cf_t* output = q->cfg.out_buffer + slot_in_sf * nof_re * nof_symbols;
-  uint32_t symbol_sz = q->cfg.symbol_sz;
-  float norm = 1.0f / sqrtf(q->fft_plan.size);
-  cf_t* tmp = q->tmp;
-  uint32_t dc = (q->fft_plan.dc) ? 1 : 0;
-
-  srsran_dft_run_guru_c(&q->fft_plan_sf[slot_in_sf]);
-
-  for (int i = 0; i < q->nof_symbols; i++) {
-    // Apply frequency domain window offset
-    if (q->window_offset_n) {
-      srsran_vec_prod_ccc(tmp, q->window_offset_buffer, tmp, symbol_sz);
-    }
-
-    // Perform FFT shift
-    memcpy(output, tmp + symbol_sz - nof_re / 2, sizeof(cf_t) * nof_re / 2);
-    memcpy(output + nof_re / 2, &tmp[dc], sizeof(cf_t) * nof_re / 2);
-
-    // Normalize output
-    if (isnormal(q->cfg.phase_compensation_hz)) {
-      // Get phase compensation
-      cf_t phase_compensation = conjf(q->phase_compensation[slot_in_sf * q->nof_symbols + i]);
-
-      // Apply normalization
-      if (q->fft_plan.norm) {
-        phase_compensation *= norm;
-      }
-
-      // Apply correction
-      srsran_vec_sc_prod_ccc(output, phase_compensation, output, nof_re);
-    } else if (q->fft_plan.norm) {
-      srsran_vec_sc_prod_cfc(output, norm, output, nof_re);
-    }
-
-    tmp += symbol_sz;
-    output += nof_re;
+  for (uint32_t i = 0; i < q->nof_symbols; i++) {
+    uint32_t symbol_idx = slot_in_sf * q->nof_symbols + i;
+    ofdm_rx_symbol(q, &q->tmp[symbol_idx * q->cfg.symbol_sz], &q->cfg.out_buffer[symbol_idx * q->nof_re], symbol_idx);
   }
 #endif
 }
@@ -553,6 +563,9 @@ void srsran_ofdm_rx_sf(srsran_ofdm_t* q)
   if (isnormal(q->cfg.freq_shift_f)) {
     srsran_vec_prod_ccc(q->cfg.in_buffer, q->shift_buffer, q->cfg.in_buffer, q->sf_sz);
   }
+#ifndef AVOID_GURU
+  srsran_dft_run_guru_c(&q->fft_plan_rx_sf);
+#endif
   if (!q->mbsfn_subframe) {
     for (uint32_t n = 0; n < SRSRAN_NOF_SLOTS_PER_SF; n++) {
       ofdm_rx_slot(q, n);
@@ -574,6 +587,9 @@ void srsran_ofdm_rx_sf_ng(srsran_ofdm_t* q, cf_t* input, cf_t* output)
       srsran_ofdm_rx_slot_ng(q, &input[n * q->slot_sz], &output[n * q->nof_re * q->nof_symbols]);
     }
   } else {
+#ifndef AVOID_GURU
+    srsran_dft_run_guru_c(&q->fft_plan_rx_sf);
+#endif
     ofdm_rx_slot_mbsfn(q, q->cfg.in_buffer, q->cfg.out_buffer);
     ofdm_rx_slot(q, 1);
   }
@@ -0,0 +1,408 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "srsran/phy/dft/dft.h"
+#include "srsran/phy/dft/dft_precoding.h"
+#include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/random.h"
+#include "srsran/phy/utils/vector.h"
+#include "srsran/support/srsran_test.h"
+
+#define NOF_THREADS 4
+#define NOF_REPETITIONS 100
+#define NOF_BENCHMARK_REPETITIONS 10000
+
+static int  N          = 256;
+static bool mirror     = false;
+static bool norm       = false;
+static bool dc         = false;
+static bool native     = false;
+static bool throughput = false;
+
+// LTE and NR OFDM sizes, and some of the LTE SC-FDMA transform precoding sizes
+static const int native_sizes[] = {12,  24,  36,  48,  60,  72,  96,   108,  120,  144,  180,  300,  600,  900, 1200,
+                                   128, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 6144, 8192, 1920, 3840};
+
+static void usage(char* prog)
+{
+  printf("Usage: %s\n", prog);
+  printf("\t-N Transform size [Default %d]\n", N);
+  printf("\t-m Mirror the frequency bins [Default %s]\n", mirror ? "true" : "false");
+  printf("\t-n Normalize the output [Default %s]\n", norm ? "true" : "false");
+  printf("\t-d Handle the DC carrier [Default %s]\n", dc ? "true" : "false");
+  printf("\t-B Use the built-in FFT backend [Default %s]\n", native ? "true" : "false");
+  printf("\t-t Measure the throughput of the fftw and built-in backends [Default %s]\n", throughput ? "true" : "false");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "NmndBt")) != -1) {
+    switch (opt) {
+      case 'N':
+        N = (int)strtol(argv[optind], NULL, 10);
+        break;
+      case 'm':
+        mirror = true;
+        break;
+      case 'n':
+        norm = true;
+        break;
+      case 'd':
+        dc = true;
+        break;
+      case 'B':
+        native = true;
+        break;
+      case 't':
+        throughput = true;
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+/* Transforms frequency domain samples backward and forward and compares with the input */
+static int test_round_trip(srsran_dft_plan_t* fwd, srsran_dft_plan_t* bwd, srsran_random_t random_gen)
+{
+  cf_t* in  = srsran_vec_cf_malloc(N);
+  cf_t* mid = srsran_vec_cf_malloc(N);
+  cf_t* out = srsran_vec_cf_malloc(N);
+  TESTASSERT(in != NULL && mid != NULL && out != NULL);
+
+  // With a mirrored null DC carrier the last frequency bin is not transmitted
+  int nof_bins = (mirror && dc) ? N - 1 : N;
+
+  srsran_random_uniform_complex_dist_vector(random_gen, in, N, -1.0f, 1.0f);
+
+  srsran_dft_run_c(bwd, in, mid);
+  srsran_dft_run_c(fwd, mid, out);
+  if (!norm) {
+    srsran_vec_sc_prod_cfc(out, 1.0f / N, out, N);
+  }
+
+  float mse = 0.0f;
+  for (int i = 0; i < nof_bins; i++) {
+    mse += __real__((in[i] - out[i]) * conjf(in[i] - out[i]));
+  }
+  mse /= nof_bins;
+
+  free(in);
+  free(mid);
+  free(out);
+
+  TESTASSERT(mse < 1e-6f);
+  return SRSRAN_SUCCESS;
+}
+
+static int init_plans(srsran_dft_plan_t* fwd, srsran_dft_plan_t* bwd)
+{
+  TESTASSERT(srsran_dft_plan_c(fwd, N, SRSRAN_DFT_FORWARD) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_plan_c(bwd, N, SRSRAN_DFT_BACKWARD) == SRSRAN_SUCCESS);
+  srsran_dft_plan_set_mirror(fwd, mirror);
+  srsran_dft_plan_set_mirror(bwd, mirror);
+  srsran_dft_plan_set_norm(fwd, norm);
+  srsran_dft_plan_set_norm(bwd, norm);
+  srsran_dft_plan_set_dc(fwd, dc);
+  srsran_dft_plan_set_dc(bwd, dc);
+  return SRSRAN_SUCCESS;
+}
+
+static void* thread_run(void* arg)
+{
+  srsran_dft_plan_t fwd        = {};
+  srsran_dft_plan_t bwd        = {};
+  srsran_random_t   random_gen = srsran_random_init((uint32_t)(size_t)arg);
+  int*              ret        = malloc(sizeof(int));
+
+  *ret = init_plans(&fwd, &bwd);
+  for (uint32_t i = 0; i < NOF_REPETITIONS && *ret == SRSRAN_SUCCESS; i++) {
+    *ret = test_round_trip(&fwd, &bwd, random_gen);
+  }
+
+  srsran_dft_plan_free(&fwd);
+  srsran_dft_plan_free(&bwd);
+  srsran_random_free(random_gen);
+  return ret;
+}
+
+/* Checks that the plans are shared and released through the cache */
+static int test_cache(srsran_random_t random_gen)
+{
+  srsran_dft_backend_t backend   = srsran_dft_get_backend();
+  uint32_t             nof_plans = srsran_dft_plan_cache_nof_plans();
+  srsran_dft_plan_t    fwd[2]    = {};
+  srsran_dft_plan_t    bwd[2]    = {};
+
+  // Only FFTW plans are cached
+  srsran_dft_set_backend(SRSRAN_DFT_BACKEND_FFTW);
+
+  TESTASSERT(init_plans(&fwd[0], &bwd[0]) == SRSRAN_SUCCESS);
+  TESTASSERT(init_plans(&fwd[1], &bwd[1]) == SRSRAN_SUCCESS);
+  TESTASSERT(fwd[0].p == fwd[1].p);
+  TESTASSERT(bwd[0].p == bwd[1].p);
+  TESTASSERT(fwd[0].p != bwd[0].p);
+  TESTASSERT(srsran_dft_plan_cache_nof_plans() == nof_plans + 2);
+
+  // Freeing one of the objects keeps the shared plan alive
+  srsran_dft_plan_free(&fwd[0]);
+  srsran_dft_plan_free(&bwd[0]);
+  TESTASSERT(srsran_dft_plan_cache_nof_plans() == nof_plans + 2);
+  TESTASSERT(test_round_trip(&fwd[1], &bwd[1], random_gen) == SRSRAN_SUCCESS);
+
+  // Re-planning releases the previous plan
+  TESTASSERT(srsran_dft_replan_c(&fwd[1], N / 2) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_replan_c(&bwd[1], N / 2) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_replan_c(&fwd[1], N) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_replan_c(&bwd[1], N) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_plan_cache_nof_plans() == nof_plans + 2);
+  TESTASSERT(test_round_trip(&fwd[1], &bwd[1], random_gen) == SRSRAN_SUCCESS);
+
+  srsran_dft_plan_free(&fwd[1]);
+  srsran_dft_plan_free(&bwd[1]);
+  TESTASSERT(srsran_dft_plan_cache_nof_plans() == nof_plans);
+
+  // Pre-warmed plans are kept after their users are freed
+  TESTASSERT(srsran_dft_plan_prewarm(&N, 1) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_plan_cache_nof_plans() == nof_plans + 2);
+  TESTASSERT(srsran_dft_plan_prewarm(&N, 1) == SRSRAN_SUCCESS);
+  TESTASSERT(init_plans(&fwd[0], &bwd[0]) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_plan_cache_nof_plans() == nof_plans + 2);
+  srsran_dft_plan_free(&fwd[0]);
+  srsran_dft_plan_free(&bwd[0]);
+  TESTASSERT(srsran_dft_plan_cache_nof_plans() == nof_plans + 2);
+
+  srsran_dft_set_backend(backend);
+
+  return SRSRAN_SUCCESS;
+}
+
+/* Compares the built-in FFT against FFTW */
+static int test_native(srsran_random_t random_gen)
+{
+  for (uint32_t i = 0; i < sizeof(native_sizes) / sizeof(native_sizes[0]); i++) {
+    int   n        = native_sizes[i];
+    cf_t* in       = srsran_vec_cf_malloc(n);
+    cf_t* out_fftw = srsran_vec_cf_malloc(n);
+    cf_t* out      = srsran_vec_cf_malloc(n);
+    TESTASSERT(in != NULL && out_fftw != NULL && out != NULL);
+
+    for (srsran_dft_dir_t dir = SRSRAN_DFT_FORWARD; dir <= SRSRAN_DFT_BACKWARD; dir++) {
+      srsran_dft_plan_t plan_fftw = {};
+      srsran_dft_plan_t plan      = {};
+      srsran_dft_set_backend(SRSRAN_DFT_BACKEND_FFTW);
+      TESTASSERT(srsran_dft_plan_c(&plan_fftw, n, dir) == SRSRAN_SUCCESS);
+      srsran_dft_set_backend(SRSRAN_DFT_BACKEND_NATIVE);
+      TESTASSERT(srsran_dft_plan_c(&plan, n, dir) == SRSRAN_SUCCESS);
+      TESTASSERT(plan.backend == SRSRAN_DFT_BACKEND_NATIVE);
+
+      srsran_random_uniform_complex_dist_vector(random_gen, in, n, -1.0f, 1.0f);
+      srsran_dft_run_c_zerocopy(&plan_fftw, in, out_fftw);
+      srsran_dft_run_c_zerocopy(&plan, in, out);
+
+      // Relative error, the transforms are not normalized
+      float err = 0.0f;
+      for (int j = 0; j < n; j++) {
+        err += __real__((out[j] - out_fftw[j]) * conjf(out[j] - out_fftw[j]));
+      }
+      err /= (float)n * (float)n;
+      if (err > 1e-10f) {
+        printf("Native FFT size %d %s error=%e\n", n, dir == SRSRAN_DFT_FORWARD ? "forward" : "backward", err);
+      }
+      TESTASSERT(err < 1e-10f);
+
+      srsran_dft_plan_free(&plan_fftw);
+      srsran_dft_plan_free(&plan);
+    }
+
+    free(in);
+    free(out_fftw);
+    free(out);
+  }
+
+  // Sizes with other prime factors fall back to FFTW
+  srsran_dft_plan_t plan = {};
+  TESTASSERT(srsran_dft_plan_c(&plan, 839, SRSRAN_DFT_FORWARD) == SRSRAN_SUCCESS);
+  TESTASSERT(plan.backend == SRSRAN_DFT_BACKEND_FFTW);
+  srsran_dft_plan_free(&plan);
+
+  return SRSRAN_SUCCESS;
+}
+
+static float mse(const cf_t* a, const cf_t* b, uint32_t len)
+{
+  float err = 0.0f;
+  for (uint32_t i = 0; i < len; i++) {
+    err += __real__((a[i] - b[i]) * conjf(a[i] - b[i]));
+  }
+  return err / len;
+}
+
+/* Checks the lazily created transform precoding plans and the batched transform */
+static int test_precoding(srsran_random_t random_gen)
+{
+  const uint32_t         nof_prb  = 25;
+  const uint32_t         nof_symb = SRSRAN_NOF_SLOTS_PER_SF * (SRSRAN_CP_NORM_NSYMB - 1);
+  const uint32_t         nof_re   = nof_prb * SRSRAN_NRE * nof_symb;
+  srsran_dft_precoding_t precoding[2];
+  srsran_dft_precoding_t predecoding;
+  srsran_dft_plan_t      plan = {};
+  cf_t*                  x    = srsran_vec_cf_malloc(nof_re);
+  cf_t*                  y    = srsran_vec_cf_malloc(nof_re);
+  cf_t*                  z    = srsran_vec_cf_malloc(nof_re);
+  TESTASSERT(x != NULL && y != NULL && z != NULL);
+
+  TESTASSERT(srsran_dft_precoding_init_tx(&precoding[0], SRSRAN_MAX_PRB) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_precoding_init_tx(&precoding[1], SRSRAN_MAX_PRB) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_precoding_init_rx(&predecoding, SRSRAN_MAX_PRB) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_precoding(&precoding[0], x, y, 7, 1) == SRSRAN_ERROR);
+
+  // No plan exists until a PRB count is used
+  for (uint32_t i = 0; i <= SRSRAN_MAX_PRB; i++) {
+    TESTASSERT(precoding[0].dft_plan[i].size == 0);
+  }
+
+  // The batched transform matches the transform of every symbol
+  srsran_random_uniform_complex_dist_vector(random_gen, x, nof_re, -1.0f, 1.0f);
+  TESTASSERT(srsran_dft_precoding(&precoding[0], x, y, nof_prb, nof_symb) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_dft_precoding(&precoding[1], x, z, nof_prb, nof_symb) == SRSRAN_SUCCESS);
+  TESTASSERT(precoding[0].dft_plan[nof_prb].size == nof_prb * SRSRAN_NRE);
+  if (precoding[0].dft_plan[nof_prb].backend == SRSRAN_DFT_BACKEND_FFTW) {
+    TESTASSERT(precoding[0].dft_plan[nof_prb].p == precoding[1].dft_plan[nof_prb].p);
+  }
+  TESTASSERT(mse(y, z, nof_re) < 1e-12f);
+
+  TESTASSERT(srsran_dft_plan_c(&plan, nof_prb * SRSRAN_NRE, SRSRAN_DFT_FORWARD) == SRSRAN_SUCCESS);
+  srsran_dft_plan_set_norm(&plan, true);
+  for (uint32_t i = 0; i < nof_symb; i++) {
+    srsran_dft_run_c(&plan, &x[i * nof_prb * SRSRAN_NRE], &z[i * nof_prb * SRSRAN_NRE]);
+  }
+  TESTASSERT(mse(y, z, nof_re) < 1e-10f);
+
+  // Predecoding in-place recovers the symbols
+  TESTASSERT(srsran_dft_precoding(&predecoding, y, y, nof_prb, nof_symb) == SRSRAN_SUCCESS);
+  TESTASSERT(mse(x, y, nof_re) < 1e-10f);
+
+  srsran_dft_plan_free(&plan);
+  srsran_dft_precoding_free(&precoding[0]);
+  srsran_dft_precoding_free(&precoding[1]);
+  srsran_dft_precoding_free(&predecoding);
+  free(x);
+  free(y);
+  free(z);
+
+  return SRSRAN_SUCCESS;
+}
+
+/* Measures the forward transform throughput of a backend */
+static void benchmark(srsran_dft_backend_t backend, srsran_random_t random_gen)
+{
+  srsran_dft_plan_t plan = {};
+  cf_t*             in   = srsran_vec_cf_malloc(N);
+  cf_t*             out  = srsran_vec_cf_malloc(N);
+  struct timeval    t[3];
+
+  srsran_dft_set_backend(backend);
+  if (in == NULL || out == NULL || srsran_dft_plan_c(&plan, N, SRSRAN_DFT_FORWARD) != SRSRAN_SUCCESS) {
+    ERROR("Error initialising benchmark");
+    free(in);
+    free(out);
+    return;
+  }
+  srsran_random_uniform_complex_dist_vector(random_gen, in, N, -1.0f, 1.0f);
+
+  gettimeofday(&t[1], NULL);
+  for (uint32_t i = 0; i < NOF_BENCHMARK_REPETITIONS; i++) {
+    srsran_dft_run_c_zerocopy(&plan, in, out);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  double elapsed_us = t[0].tv_sec * 1e6 + t[0].tv_usec;
+  printf("%-6s N=%5d: %8.1f ns/transform, %7.1f MS/s\n",
+         srsran_dft_backend_string(plan.backend),
+         N,
+         elapsed_us * 1e3 / NOF_BENCHMARK_REPETITIONS,
+         (double)N * NOF_BENCHMARK_REPETITIONS / elapsed_us);
+
+  srsran_dft_plan_free(&plan);
+  free(in);
+  free(out);
+}
+
+int main(int argc, char** argv)
+{
+  srsran_random_t random_gen = srsran_random_init(0);
+  pthread_t       threads[NOF_THREADS];
+  int             ret = SRSRAN_SUCCESS;
+
+  parse_args(argc, argv);
+
+  if (throughput) {
+    benchmark(SRSRAN_DFT_BACKEND_FFTW, random_gen);
+    benchmark(SRSRAN_DFT_BACKEND_NATIVE, random_gen);
+    srsran_random_free(random_gen);
+    return SRSRAN_SUCCESS;
+  }
+
+  if (test_cache(random_gen) != SRSRAN_SUCCESS) {
+    ret = SRSRAN_ERROR;
+  }
+
+  if (native) {
+    if (test_native(random_gen) != SRSRAN_SUCCESS) {
+      ret = SRSRAN_ERROR;
+    }
+    srsran_dft_set_backend(SRSRAN_DFT_BACKEND_NATIVE);
+  }
+
+  if (test_precoding(random_gen) != SRSRAN_SUCCESS) {
+    ret = SRSRAN_ERROR;
+  }
+
+  // Several threads use the same plans at the same time
+  for (uint32_t i = 0; i < NOF_THREADS; i++) {
+    pthread_create(&threads[i], NULL, thread_run, (void*)(size_t)(i + 1));
+  }
+  for (uint32_t i = 0; i < NOF_THREADS; i++) {
+    int* thread_ret = NULL;
+    pthread_join(threads[i], (void**)&thread_ret);
+    if (thread_ret == NULL || *thread_ret != SRSRAN_SUCCESS) {
+      ret = SRSRAN_ERROR;
+    }
+    free(thread_ret);
+  }
+
+  srsran_random_free(random_gen);
+
+  printf("%s\n", ret == SRSRAN_SUCCESS ? "Ok" : "Error");
+  return ret;
+}
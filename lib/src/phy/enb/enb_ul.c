@@ -47,6 +47,7 @@ int srsran_enb_ul_init(srsran_enb_ul_t* q, cf_t* in_buffer, uint32_t max_prb)
       goto clean_exit;
     }
     q->in_buffer = in_buffer;
+    q->max_prb   = max_prb;
 
     if (srsran_pucch_init_enb(&q->pucch)) {
       ERROR("Error creating PUCCH object");
@@ -90,6 +91,27 @@ void srsran_enb_ul_free(srsran_enb_ul_t* q)
     if (q->chest_res.ce) {
       free(q->chest_res.ce);
     }
+    if (q->pucch_cand_cfg) {
+      free(q->pucch_cand_cfg);
+    }
+    if (q->pucch_cand_res) {
+      free(q->pucch_cand_res);
+    }
+    if (q->pucch_cand_cfg_ptr) {
+      free(q->pucch_cand_cfg_ptr);
+    }
+    if (q->pucch_cand_res_ptr) {
+      free(q->pucch_cand_res_ptr);
+    }
+    for (uint32_t i = 0; i < q->pucch_chest_size; i++) {
+      srsran_chest_ul_res_free(&q->pucch_chest_res[i]);
+    }
+    if (q->pucch_chest_res) {
+      free(q->pucch_chest_res);
+    }
+    if (q->pucch_chest_res_ptr) {
+      free(q->pucch_chest_res_ptr);
+    }
     bzero(q, sizeof(srsran_enb_ul_t));
   }
 }
@@ -153,11 +175,11 @@ void srsran_enb_ul_fft(srsran_enb_ul_t* q)
   srsran_ofdm_rx_sf(&q->fft);
 }
 
-static int get_pucch(srsran_enb_ul_t* q, srsran_ul_sf_cfg_t* ul_sf, srsran_pucch_cfg_t* cfg, srsran_pucch_res_t* res)
+static int get_pucch_resources(srsran_enb_ul_t*    q,
+                               srsran_pucch_cfg_t* cfg,
+                               uint32_t            n_pucch_i[SRSRAN_PUCCH_MAX_ALLOC])
 {
-  int      ret                               = SRSRAN_SUCCESS;
-  uint32_t n_pucch_i[SRSRAN_PUCCH_MAX_ALLOC] = {};
-  uint32_t uci_cfg_total_ack                 = srsran_uci_cfg_total_ack(&cfg->uci_cfg);
+  uint32_t uci_cfg_total_ack = srsran_uci_cfg_total_ack(&cfg->uci_cfg);
 
   // Drop CQI if there is collision with ACK
   if (!cfg->simul_cqi_ack && uci_cfg_total_ack > 0 && cfg->uci_cfg.cqi.data_enable) {
@@ -178,6 +200,35 @@ static int get_pucch(srsran_enb_ul_t* q, srsran_ul_sf_cfg_t* ul_sf, srsran_pucch
     return SRSRAN_ERROR;
   }
 
+  return nof_resources;
+}
+
+// Applies PUCCH format 1b with channel selection to the result of the resource index i if:
+// - At least one ACK bit needs to be received; and
+// - PUCCH Format 1b was used; and
+// - HARQ feedback mode is set to PUCCH Format1b with Channel Selection (CS); and
+// - No scheduling request is expected; and
+// - Data is valid (invalid data does not make sense to decode).
+static void get_pucch_cs_ack(srsran_pucch_cfg_t* cfg, uint32_t i, srsran_pucch_res_t* pucch_res)
+{
+  if (srsran_uci_cfg_total_ack(&cfg->uci_cfg) > 0 && cfg->format == SRSRAN_PUCCH_FORMAT_1B &&
+      cfg->ack_nack_feedback_mode == SRSRAN_PUCCH_ACK_NACK_FEEDBACK_MODE_CS &&
+      !cfg->uci_cfg.is_scheduling_request_tti && pucch_res->uci_data.ack.valid) {
+    uint8_t b[2] = {pucch_res->uci_data.ack.ack_value[0], pucch_res->uci_data.ack.ack_value[1]};
+    srsran_pucch_cs_get_ack(cfg, &cfg->uci_cfg, i, b, &pucch_res->uci_data);
+  }
+}
+
+static int get_pucch(srsran_enb_ul_t* q, srsran_ul_sf_cfg_t* ul_sf, srsran_pucch_cfg_t* cfg, srsran_pucch_res_t* res)
+{
+  int      ret                               = SRSRAN_SUCCESS;
+  uint32_t n_pucch_i[SRSRAN_PUCCH_MAX_ALLOC] = {};
+
+  int nof_resources = get_pucch_resources(q, cfg, n_pucch_i);
+  if (nof_resources < SRSRAN_SUCCESS) {
+    return SRSRAN_ERROR;
+  }
+
   // Initialise minimum correlation
   res->correlation = 0.0f;
 
@@ -201,18 +252,8 @@ static int get_pucch(srsran_enb_ul_t* q, srsran_ul_sf_cfg_t* ul_sf, srsran_pucch
     if (ret < SRSRAN_SUCCESS) {
       ERROR("Error decoding PUCCH");
     } else {
-      // Get PUCCH Format 1b with channel selection if:
-      // - At least one ACK bit needs to be received; and
-      // - PUCCH Format 1b was used; and
-      // - HARQ feedback mode is set to PUCCH Format1b with Channel Selection (CS); and
-      // - No scheduling request is expected; and
-      // - Data is valid (invalid data does not make sense to decode).
-      if (uci_cfg_total_ack > 0 && cfg->format == SRSRAN_PUCCH_FORMAT_1B &&
-          cfg->ack_nack_feedback_mode == SRSRAN_PUCCH_ACK_NACK_FEEDBACK_MODE_CS &&
-          !cfg->uci_cfg.is_scheduling_request_tti && pucch_res.uci_data.ack.valid) {
-        uint8_t b[2] = {pucch_res.uci_data.ack.ack_value[0], pucch_res.uci_data.ack.ack_value[1]};
-        srsran_pucch_cs_get_ack(cfg, &cfg->uci_cfg, i, b, &pucch_res.uci_data);
-      }
+      // Get PUCCH Format 1b with channel selection
+      get_pucch_cs_ack(cfg, i, &pucch_res);
 
       // Compares correlation value, it stores the PUCCH result with the greatest correlation
       if (i == 0 || pucch_res.correlation > res->correlation) {
@@ -272,6 +313,258 @@ int srsran_enb_ul_get_pucch(srsran_enb_ul_t*    q,
   return SRSRAN_SUCCESS;
 }
 
+// Maximum number of format 1 candidates of a UE, with and without SR, for every channel selection resource
+#define ENB_UL_PUCCH_CAND_X_UE (2 * SRSRAN_PUCCH_CS_MAX_ACK)
+
+static int get_pucch_batch_resize(srsran_enb_ul_t* q, uint32_t size)
+{
+  if (size <= q->pucch_cand_size) {
+    return SRSRAN_SUCCESS;
+  }
+
+  srsran_pucch_cfg_t* cand_cfg = realloc(q->pucch_cand_cfg, sizeof(srsran_pucch_cfg_t) * size);
+  if (cand_cfg == NULL) {
+    return SRSRAN_ERROR;
+  }
+  q->pucch_cand_cfg = cand_cfg;
+
+  srsran_pucch_res_t* cand_res = realloc(q->pucch_cand_res, sizeof(srsran_pucch_res_t) * size);
+  if (cand_res == NULL) {
+    return SRSRAN_ERROR;
+  }
+  q->pucch_cand_res = cand_res;
+
+  srsran_pucch_cfg_t** cand_cfg_ptr = realloc(q->pucch_cand_cfg_ptr, sizeof(srsran_pucch_cfg_t*) * size);
+  if (cand_cfg_ptr == NULL) {
+    return SRSRAN_ERROR;
+  }
+  q->pucch_cand_cfg_ptr = cand_cfg_ptr;
+
+  srsran_pucch_res_t** cand_res_ptr = realloc(q->pucch_cand_res_ptr, sizeof(srsran_pucch_res_t*) * size);
+  if (cand_res_ptr == NULL) {
+    return SRSRAN_ERROR;
+  }
+  q->pucch_cand_res_ptr = cand_res_ptr;
+
+  q->pucch_cand_size = size;
+  return SRSRAN_SUCCESS;
+}
+
+static int get_pucch_batch_chest_resize(srsran_enb_ul_t* q, uint32_t size)
+{
+  if (size <= q->pucch_chest_size) {
+    return SRSRAN_SUCCESS;
+  }
+
+  srsran_chest_ul_res_t* chest_res = realloc(q->pucch_chest_res, sizeof(srsran_chest_ul_res_t) * size);
+  if (chest_res == NULL) {
+    return SRSRAN_ERROR;
+  }
+  q->pucch_chest_res = chest_res;
+
+  srsran_chest_ul_res_t** chest_res_ptr = realloc(q->pucch_chest_res_ptr, sizeof(srsran_chest_ul_res_t*) * size);
+  if (chest_res_ptr == NULL) {
+    return SRSRAN_ERROR;
+  }
+  q->pucch_chest_res_ptr = chest_res_ptr;
+
+  for (; q->pucch_chest_size < size; q->pucch_chest_size++) {
+    if (srsran_chest_ul_res_init(&q->pucch_chest_res[q->pucch_chest_size], q->max_prb) < SRSRAN_SUCCESS) {
+      return SRSRAN_ERROR;
+    }
+  }
+  return SRSRAN_SUCCESS;
+}
+
+// Fills the format 1 candidates of a UE. Returns 1 on success, 0 if the UE does not use format 1, 1a or 1b
+static int get_pucch_batch_candidates(srsran_enb_ul_t* q, srsran_pucch_cfg_t* cfg, srsran_pucch_cfg_t* cand)
+{
+  uint32_t n_pucch_i[SRSRAN_PUCCH_MAX_ALLOC] = {};
+
+  for (uint32_t i = 0; i < ENB_UL_PUCCH_CAND_X_UE; i++) {
+    cand[i].format = SRSRAN_PUCCH_FORMAT_ERROR;
+  }
+
+  // If SR and ACK are expected at the same time, the ACK without SR is also a hypothesis
+  uint32_t nof_hyp =
+      (cfg->uci_cfg.is_scheduling_request_tti && srsran_uci_cfg_total_ack(&cfg->uci_cfg) > 0) ? 2 : 1;
+
+  for (uint32_t h = 0; h < nof_hyp; h++) {
+    srsran_pucch_cfg_t* hyp = &cand[h * SRSRAN_PUCCH_CS_MAX_ACK];
+    int                 nof_resources;
+
+    if (h == 0) {
+      nof_resources = get_pucch_resources(q, cfg, n_pucch_i);
+      *hyp          = *cfg;
+    } else {
+      *hyp                                   = *cfg;
+      hyp->uci_cfg.is_scheduling_request_tti = false;
+      nof_resources                          = get_pucch_resources(q, hyp, n_pucch_i);
+    }
+    if (nof_resources < SRSRAN_SUCCESS) {
+      return SRSRAN_ERROR;
+    }
+
+    if (hyp->format != SRSRAN_PUCCH_FORMAT_1 && hyp->format != SRSRAN_PUCCH_FORMAT_1A &&
+        hyp->format != SRSRAN_PUCCH_FORMAT_1B) {
+      for (uint32_t i = 0; i < ENB_UL_PUCCH_CAND_X_UE; i++) {
+        cand[i].format = SRSRAN_PUCCH_FORMAT_ERROR;
+      }
+      return false;
+    }
+
+    for (int i = 0; i < nof_resources; i++) {
+      if (i > 0) {
+        hyp[i] = hyp[0];
+      }
+      hyp[i].n_pucch = n_pucch_i[i];
+    }
+  }
+
+  return true;
+}
+
+// Selects the result of a UE from its candidates, same criteria as srsran_enb_ul_get_pucch()
+static void get_pucch_batch_select(srsran_pucch_cfg_t* cand,
+                                   srsran_pucch_res_t* cand_res,
+                                   srsran_pucch_cfg_t* cfg,
+                                   srsran_pucch_res_t* res)
+{
+  srsran_pucch_res_t best[2]     = {};
+  uint32_t           best_idx[2] = {};
+
+  for (uint32_t h = 0; h < 2; h++) {
+    srsran_pucch_cfg_t* hyp     = &cand[h * SRSRAN_PUCCH_CS_MAX_ACK];
+    srsran_pucch_res_t* hyp_res = &cand_res[h * SRSRAN_PUCCH_CS_MAX_ACK];
+
+    for (uint32_t i = 0; i < SRSRAN_PUCCH_CS_MAX_ACK && hyp[i].format != SRSRAN_PUCCH_FORMAT_ERROR; i++) {
+      get_pucch_cs_ack(&hyp[i], i, &hyp_res[i]);
+
+      if (i == 0 || hyp_res[i].correlation > best[h].correlation) {
+        best[h]     = hyp_res[i];
+        best_idx[h] = h * SRSRAN_PUCCH_CS_MAX_ACK + i;
+      }
+    }
+  }
+
+  // Override the result with SR by the one without SR if the hypothesis without SR was detected, and
+  // - the hypothesis with SR was not detected; or
+  // - the hypothesis without SR has better correlation
+  uint32_t h = 0;
+  if (cand[SRSRAN_PUCCH_CS_MAX_ACK].format != SRSRAN_PUCCH_FORMAT_ERROR && best[1].detected &&
+      (!best[0].detected || best[1].correlation > best[0].correlation)) {
+    h = 1;
+  }
+
+  *res = best[h];
+  *cfg = cand[best_idx[h]];
+}
+
+int srsran_enb_ul_get_pucch_batch(srsran_enb_ul_t*     q,
+                                  srsran_ul_sf_cfg_t*  ul_sf,
+                                  srsran_pucch_cfg_t** cfg,
+                                  srsran_pucch_res_t** res,
+                                  uint32_t             nof_ue)
+{
+  if (q == NULL || ul_sf == NULL || cfg == NULL || res == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  if (get_pucch_batch_resize(q, nof_ue * ENB_UL_PUCCH_CAND_X_UE) < SRSRAN_SUCCESS) {
+    ERROR("Error allocating PUCCH candidates");
+    return SRSRAN_ERROR;
+  }
+
+  // Gather the format 1 candidates of all the UEs, the rest are decoded one by one
+  uint32_t nof_cand = 0;
+  for (uint32_t u = 0; u < nof_ue; u++) {
+    srsran_pucch_cfg_t* cand     = &q->pucch_cand_cfg[u * ENB_UL_PUCCH_CAND_X_UE];
+    srsran_pucch_res_t* cand_res = &q->pucch_cand_res[u * ENB_UL_PUCCH_CAND_X_UE];
+
+    if (!srsran_pucch_cfg_isvalid(cfg[u], q->cell.nof_prb)) {
+      ERROR("Invalid PUCCH configuration");
+      return SRSRAN_ERROR_INVALID_INPUTS;
+    }
+
+    int ret = get_pucch_batch_candidates(q, cfg[u], cand);
+    if (ret < SRSRAN_SUCCESS) {
+      return SRSRAN_ERROR;
+    }
+
+    if (!ret) {
+      if (srsran_enb_ul_get_pucch(q, ul_sf, cfg[u], res[u])) {
+        return SRSRAN_ERROR;
+      }
+      continue;
+    }
+
+    for (uint32_t i = 0; i < ENB_UL_PUCCH_CAND_X_UE; i++) {
+      if (cand[i].format != SRSRAN_PUCCH_FORMAT_ERROR) {
+        cand_res[i]                       = (srsran_pucch_res_t){};
+        q->pucch_cand_cfg_ptr[nof_cand]   = &cand[i];
+        q->pucch_cand_res_ptr[nof_cand++] = &cand_res[i];
+      }
+    }
+  }
+
+  if (nof_cand > 0 && srsran_pucch_decode_format1_joint(&q->pucch,
+                                                        &q->chest.dmrs_signal,
+                                                        ul_sf,
+                                                        q->pucch_cand_cfg_ptr,
+                                                        q->sf_symbols,
+                                                        q->pucch_cand_res_ptr,
+                                                        nof_cand) < SRSRAN_SUCCESS) {
+    ERROR("Error decoding PUCCH");
+    return SRSRAN_ERROR;
+  }
+
+  // The joint detector does not measure the time alignment, the detected UEs are estimated in a single batch. The
+  // candidate pointers are not needed any more, they hold the configuration of these UEs
+  uint32_t nof_ta = 0;
+  for (uint32_t u = 0; u < nof_ue; u++) {
+    srsran_pucch_cfg_t* cand     = &q->pucch_cand_cfg[u * ENB_UL_PUCCH_CAND_X_UE];
+    srsran_pucch_res_t* cand_res = &q->pucch_cand_res[u * ENB_UL_PUCCH_CAND_X_UE];
+
+    if (cand[0].format == SRSRAN_PUCCH_FORMAT_ERROR) {
+      continue;
+    }
+
+    get_pucch_batch_select(cand, cand_res, cfg[u], res[u]);
+
+    if (res[u]->detected && cfg[u]->meas_ta_en) {
+      q->pucch_cand_cfg_ptr[nof_ta] = cfg[u];
+      q->pucch_cand_res_ptr[nof_ta] = res[u];
+      nof_ta++;
+    }
+  }
+
+  if (nof_ta == 0) {
+    return SRSRAN_SUCCESS;
+  }
+
+  if (get_pucch_batch_chest_resize(q, nof_ta) < SRSRAN_SUCCESS) {
+    ERROR("Error allocating PUCCH channel estimates");
+    return SRSRAN_ERROR;
+  }
+  for (uint32_t i = 0; i < nof_ta; i++) {
+    q->pucch_chest_res_ptr[i] = &q->pucch_chest_res[i];
+  }
+
+  if (srsran_chest_ul_estimate_pucch_batch(
+          &q->chest, ul_sf, q->pucch_cand_cfg_ptr, q->sf_symbols, q->pucch_chest_res_ptr, nof_ta)) {
+    ERROR("Error estimating PUCCH DMRS");
+    return SRSRAN_ERROR;
+  }
+
+  for (uint32_t i = 0; i < nof_ta; i++) {
+    float ta_us                        = q->pucch_chest_res[i].ta_us;
+    q->pucch_cand_res_ptr[i]->ta_valid = !(isnan(ta_us) || isinf(ta_us));
+    q->pucch_cand_res_ptr[i]->ta_us    = ta_us;
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
 int srsran_enb_ul_get_pusch(srsran_enb_ul_t*    q,
                             srsran_ul_sf_cfg_t* ul_sf,
                             srsran_pusch_cfg_t* cfg,
@@ -281,3 +574,35 @@ int srsran_enb_ul_get_pusch(srsran_enb_ul_t*    q,
 
   return srsran_pusch_decode(&q->pusch, ul_sf, cfg, &q->chest_res, q->sf_symbols, res);
 }
+
+int srsran_enb_ul_estimate_pusch_batch(srsran_enb_ul_t*        q,
+                                       srsran_ul_sf_cfg_t*     ul_sf,
+                                       srsran_pusch_cfg_t**    cfg,
+                                       srsran_chest_ul_res_t** chest_res,
+                                       uint32_t                nof_pusch)
+{
+  if (q == NULL || ul_sf == NULL || cfg == NULL || chest_res == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  return srsran_chest_ul_estimate_pusch_batch(&q->chest, ul_sf, cfg, q->sf_symbols, chest_res, nof_pusch);
+}
+
+int srsran_enb_ul_decode_pusch(srsran_enb_ul_t*       q,
+                               srsran_ul_sf_cfg_t*    ul_sf,
+                               srsran_pusch_cfg_t*    cfg,
+                               srsran_chest_ul_res_t* chest_res,
+                               srsran_pusch_res_t*    res)
+{
+  return srsran_pusch_decode(&q->pusch, ul_sf, cfg, chest_res, q->sf_symbols, res);
+}
+
+int srsran_enb_ul_set_pusch_batch_decoding(srsran_enb_ul_t* q, bool enable)
+{
+  return srsran_sch_set_batch_decoding(&q->pusch.ul_sch, enable);
+}
+
+int srsran_enb_ul_decode_pusch_pending(srsran_enb_ul_t* q)
+{
+  return srsran_pusch_decode_pending(&q->pusch);
+}
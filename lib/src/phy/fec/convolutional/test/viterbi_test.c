@@ -38,6 +38,7 @@ static uint32_t seed        = 0;
 static bool     tail_biting = false;
 
 #define SNR_POINTS 10
+#define NOF_BATCH 12
 #define SNR_MIN 0.0
 #define SNR_MAX 5.0
 
@@ -114,6 +115,9 @@ int main(int argc, char** argv)
   int       errors_c   = 0;
   int       errors_f   = 0;
   int       errors_sse = 0;
+  int       errors_b   = 0;
+  float*    llr_b[NOF_BATCH];
+  uint8_t*  data_b[NOF_BATCH];
 #ifdef TEST_SSE
   srsran_viterbi_t dec_sse;
 #endif
@@ -186,6 +190,15 @@ int main(int argc, char** argv)
     exit(-1);
   }
 
+  for (uint32_t i = 0; i < NOF_BATCH; i++) {
+    llr_b[i]  = srsran_vec_f_malloc(coded_length);
+    data_b[i] = srsran_vec_u8_malloc(frame_length);
+    if (!llr_b[i] || !data_b[i]) {
+      perror("malloc");
+      exit(-1);
+    }
+  }
+
   float ebno_inc, esno_db;
   ebno_inc = (SNR_MAX - SNR_MIN) / SNR_POINTS;
   if (ebno_db == 100.0) {
@@ -209,6 +222,7 @@ int main(int argc, char** argv)
     errors_c   = 0;
     errors_f   = 0;
     errors_sse = 0;
+    errors_b   = 0;
     while (frame_cnt < nof_frames) {
       /* generate data_tx */
       srsran_random_t random_gen = srsran_random_init(0);
@@ -244,6 +258,19 @@ int main(int argc, char** argv)
 #ifdef TEST_SSE
       VITERBI_TEST(srsran_viterbi_decode_uc, dec_sse, llr_c, errors_sse);
 #endif
+
+      /* Frames are accumulated and decoded together */
+      uint32_t nof_b = frame_cnt % NOF_BATCH + 1;
+      srsran_vec_f_copy(llr_b[nof_b - 1], llr, coded_length);
+      if (errors_b >= 0 && (nof_b == NOF_BATCH || frame_cnt + 1 == nof_frames)) {
+        if (srsran_viterbi_decode_batch(&dec, llr_b, data_b, nof_b, frame_length) < SRSRAN_SUCCESS) {
+          errors_b = SRSRAN_ERROR;
+        } else {
+          for (uint32_t j = 0; j < nof_b; j++) {
+            errors_b += srsran_bit_diff(data_tx, data_b[j], frame_length);
+          }
+        }
+      }
       frame_cnt++;
       printf("     Eb/No: %3.2f %10d/%d   ", SNR_MIN + i * ebno_inc, frame_cnt, nof_frames);
       if (errors_s >= 0)
@@ -254,6 +281,8 @@ int main(int argc, char** argv)
         printf("uint8  BER: %.2e  ", (float)errors_c / (frame_cnt * frame_length));
       if (errors_f >= 0)
         printf("float  BER: %.2e  ", (float)errors_f / (frame_cnt * frame_length));
+      if (errors_b >= 0)
+        printf("batch  BER: %.2e  ", (float)errors_b / (frame_cnt * frame_length));
 #ifdef TEST_SSE
       printf("sse    BER: %.2e  ", (float)errors_sse / (frame_cnt * frame_length));
 #endif
@@ -270,6 +299,8 @@ int main(int argc, char** argv)
         printf("uint8  BER    :    %g\t%u errors\n", (float)errors_c / (frame_cnt * frame_length), errors_c);
       if (errors_f >= 0)
         printf("float  BER    :    %g\t%u errors\n", (float)errors_f / (frame_cnt * frame_length), errors_f);
+      if (errors_b >= 0)
+        printf("batch  BER    :    %g\t%u errors\n", (float)errors_b / (frame_cnt * frame_length), errors_b);
 #ifdef TEST_SSE
       printf("sse    BER    :    %g\t%u errors\n", (float)errors_sse / (frame_cnt * frame_length), errors_sse);
 #endif
@@ -287,6 +318,10 @@ int main(int argc, char** argv)
   free(llr_s);
   free(llr_us);
   free(data_rx);
+  for (uint32_t i = 0; i < NOF_BATCH; i++) {
+    free(llr_b[i]);
+    free(data_b[i]);
+  }
 
   if (snr_points == 1) {
     int expected_e = get_expected_errors(nof_frames, seed, frame_length, tail_biting, ebno_db);
@@ -294,14 +329,21 @@ int main(int argc, char** argv)
       ERROR("Test parameters not defined in test_results.h");
       exit(-1);
     } else {
-      printf(
-          "errors =(%d,%d,%d,%d,%d), expected =%d\n", errors_s, errors_us, errors_c, errors_f, errors_sse, expected_e);
+      printf("errors =(%d,%d,%d,%d,%d,%d), expected =%d\n",
+             errors_s,
+             errors_us,
+             errors_c,
+             errors_f,
+             errors_sse,
+             errors_b,
+             expected_e);
       bool passed = true;
       passed &= (bool)(errors_us <= expected_e);
       passed &= (bool)(errors_s <= expected_e);
       passed &= (bool)(errors_c <= expected_e);
       passed &= (bool)(errors_f <= expected_e);
       passed &= (bool)(errors_sse <= expected_e);
+      passed &= (bool)(errors_b >= 0 && errors_b <= expected_e);
       exit(!passed);
     }
   } else {
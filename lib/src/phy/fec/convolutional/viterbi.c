@@ -29,6 +29,7 @@
 #include "parity.h"
 #include "srsran/phy/fec/convolutional/viterbi.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/vector.h"
 #include "viterbi37.h"
 
@@ -39,11 +40,9 @@
 #define DEFAULT_GAIN 100
 
 #define DEFAULT_GAIN_16 500
-#define VITERBI_16
 
-#ifndef LV_HAVE_AVX2
-#undef VITERBI_16
-#endif
+/* Below this number of frames, decoding them one by one is faster than the multi-stream decoder */
+#define BATCH_MIN_FRAMES 3
 
 //#undef LV_HAVE_SSE
 
@@ -125,7 +124,7 @@ void free37_sse(void* o)
 
 #endif
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
 int decode37_avx2_16bit(void* o, uint16_t* symbols, uint8_t* data, uint32_t frame_length)
 {
   srsran_viterbi_t* q = o;
@@ -285,6 +284,8 @@ int init37(srsran_viterbi_t* q, int poly[3], uint32_t framebits, bool tail_bitin
   q->decode       = decode37;
   q->free         = free37;
   q->decode_f     = NULL;
+  q->batch        = NULL;
+  memcpy(q->poly, poly, sizeof(q->poly));
   q->symbols_uc   = srsran_vec_u8_malloc(3 * (q->framebits + q->K - 1));
   if (!q->symbols_uc) {
     perror("malloc");
@@ -323,18 +324,13 @@ int init37_sse(srsran_viterbi_t* q, int poly[3], uint32_t framebits, bool tail_b
   q->decode       = decode37_sse;
   q->free         = free37_sse;
   q->decode_f     = NULL;
+  q->batch        = NULL;
+  memcpy(q->poly, poly, sizeof(q->poly));
   q->symbols_uc   = srsran_vec_u8_malloc(3 * (q->framebits + q->K - 1));
   if (!q->symbols_uc) {
     perror("malloc");
     return -1;
   }
-#ifdef VITERBI_16
-  q->symbols_us = srsran_vec_u16_malloc(3 * (q->framebits + q->K - 1));
-  if (!q->symbols_us) {
-    perror("malloc");
-    return -1;
-  }
-#endif
   if (q->tail_biting) {
     q->tmp = srsran_vec_u8_malloc(TB_ITER * 3 * (q->framebits + q->K - 1));
     if (!q->tmp) {
@@ -368,6 +364,8 @@ int init37_neon(srsran_viterbi_t* q, int poly[3], uint32_t framebits, bool tail_
   q->decode       = decode37_neon;
   q->free         = free37_neon;
   q->decode_f     = NULL;
+  q->batch        = NULL;
+  memcpy(q->poly, poly, sizeof(q->poly));
   q->symbols_uc   = srsran_vec_u8_malloc(3 * (q->framebits + q->K - 1));
   if (!q->symbols_uc) {
     perror("malloc");
@@ -394,7 +392,7 @@ int init37_neon(srsran_viterbi_t* q, int poly[3], uint32_t framebits, bool tail_
 }
 #endif
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
 int init37_avx2(srsran_viterbi_t* q, int poly[3], uint32_t framebits, bool tail_biting)
 {
   q->K            = 7;
@@ -406,6 +404,8 @@ int init37_avx2(srsran_viterbi_t* q, int poly[3], uint32_t framebits, bool tail_
   q->decode       = decode37_avx2;
   q->free         = free37_avx2;
   q->decode_f     = NULL;
+  q->batch        = NULL;
+  memcpy(q->poly, poly, sizeof(q->poly));
   q->symbols_uc   = srsran_vec_u8_malloc(3 * (q->framebits + q->K - 1));
   if (!q->symbols_uc) {
     perror("malloc");
@@ -442,6 +442,8 @@ int init37_avx2_16bit(srsran_viterbi_t* q, int poly[3], uint32_t framebits, bool
   q->decode_s     = decode37_avx2_16bit;
   q->free         = free37_avx2_16bit;
   q->decode_f     = NULL;
+  q->batch        = NULL;
+  memcpy(q->poly, poly, sizeof(q->poly));
   q->symbols_uc   = srsran_vec_u8_malloc(3 * (q->framebits + q->K - 1));
   q->symbols_us   = srsran_vec_u16_malloc(3 * (q->framebits + q->K - 1));
   if (!q->symbols_uc || !q->symbols_us) {
@@ -491,16 +493,12 @@ int srsran_viterbi_init(srsran_viterbi_t*     q,
   switch (type) {
     case SRSRAN_VITERBI_37:
 #ifdef LV_HAVE_SSE
-
-#ifdef LV_HAVE_AVX2
-#ifdef VITERBI_16
-      return init37_avx2_16bit(q, poly, max_frame_length, tail_bitting);
-#else
-      return init37_avx2(q, poly, max_frame_length, tail_bitting);
-#endif
-#else
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+      if (srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2)) {
+        return init37_avx2_16bit(q, poly, max_frame_length, tail_bitting);
+      }
+#endif /* SRSRAN_SIMD_HAVE_AVX2 */
       return init37_sse(q, poly, max_frame_length, tail_bitting);
-#endif
 #else
 #ifdef HAVE_NEON
       return init37_neon(q, poly, max_frame_length, tail_bitting);
@@ -525,13 +523,17 @@ int srsran_viterbi_init_sse(srsran_viterbi_t*     q,
 }
 #endif
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
 int srsran_viterbi_init_avx2(srsran_viterbi_t*     q,
                              srsran_viterbi_type_t type,
                              int                   poly[3],
                              uint32_t              max_frame_length,
                              bool                  tail_bitting)
 {
+  if (!srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2)) {
+    ERROR("AVX2 decoder not supported by the selected SIMD ISA");
+    return -1;
+  }
   return init37_avx2(q, poly, max_frame_length, tail_bitting);
 }
 #endif
@@ -541,6 +543,9 @@ void srsran_viterbi_free(srsran_viterbi_t* q)
   if (q->free) {
     q->free(q);
   }
+  if (q->batch) {
+    delete_viterbi37_batch(q->batch);
+  }
   bzero(q, sizeof(srsran_viterbi_t));
 }
 
@@ -563,13 +568,13 @@ int srsran_viterbi_decode_f(srsran_viterbi_t* q, float* symbols, uint8_t* data,
     if (max_i < len && isnormal(symbols[max_i])) {
       max = fabsf(symbols[max_i]);
     }
-#ifdef VITERBI_16
-    srsran_vec_quant_fus(symbols, q->symbols_us, q->gain_quant / max, 32767.5, 65535, len);
-    return srsran_viterbi_decode_us(q, q->symbols_us, data, frame_length);
-#else
+    // The 16-bit decoder is used when it is the selected one
+    if (q->decode_s) {
+      srsran_vec_quant_fus(symbols, q->symbols_us, q->gain_quant / max, 32767.5, 65535, len);
+      return srsran_viterbi_decode_us(q, q->symbols_us, data, frame_length);
+    }
     srsran_vec_quant_fuc(symbols, q->symbols_uc, q->gain_quant / max, 127.5, 255, len);
     return srsran_viterbi_decode_uc(q, q->symbols_uc, data, frame_length);
-#endif
   } else {
     return q->decode_f(q, symbols, data, frame_length);
   }
@@ -595,13 +600,12 @@ int srsran_viterbi_decode_s(srsran_viterbi_t* q, int16_t* symbols, uint8_t* data
       max = abs(symbols[i]);
     }
   }
-#ifdef VITERBI_16
-  srsran_vec_quant_sus(symbols, q->symbols_us, 1, (float)INT16_MAX, UINT16_MAX, len);
-  return srsran_viterbi_decode_us(q, q->symbols_us, data, frame_length);
-#else
+  if (q->decode_s) {
+    srsran_vec_quant_sus(symbols, q->symbols_us, 1, (float)INT16_MAX, UINT16_MAX, len);
+    return srsran_viterbi_decode_us(q, q->symbols_us, data, frame_length);
+  }
   srsran_vec_quant_suc(symbols, q->symbols_uc, (float)q->gain_quant / max, 127, 255, len);
   return srsran_viterbi_decode_uc(q, q->symbols_uc, data, frame_length);
-#endif
 }
 
 int srsran_viterbi_decode_us(srsran_viterbi_t* q, uint16_t* symbols, uint8_t* data, uint32_t frame_length)
@@ -625,3 +629,50 @@ int srsran_viterbi_decode_uc(srsran_viterbi_t* q, uint8_t* symbols, uint8_t* dat
 
   return ret;
 }
+
+int srsran_viterbi_decode_batch(srsran_viterbi_t* q,
+                                float*            symbols[],
+                                uint8_t*          data[],
+                                uint32_t          nof_frames,
+                                uint32_t          frame_length)
+{
+  if (q == NULL || symbols == NULL || data == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  if (frame_length > q->framebits) {
+    ERROR("Initialized decoder for max frame length %d bits", q->framebits);
+    return SRSRAN_ERROR;
+  }
+
+  uint32_t nof_lanes = viterbi37_batch_nof_lanes();
+
+  // Few frames, or frames too short for the tail-biting trellis, are decoded one by one
+  if (nof_lanes == 0 || nof_frames < BATCH_MIN_FRAMES || frame_length < q->K) {
+    for (uint32_t i = 0; i < nof_frames; i++) {
+      if (srsran_viterbi_decode_f(q, symbols[i], data[i], frame_length) < SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
+      }
+    }
+    return SRSRAN_SUCCESS;
+  }
+
+  // The multi-stream decoder is only created by the users of this function
+  if (q->batch == NULL) {
+    q->batch = create_viterbi37_batch(q->poly, q->framebits);
+    if (q->batch == NULL) {
+      ERROR("create_viterbi37_batch failed");
+      return SRSRAN_ERROR;
+    }
+  }
+
+  for (uint32_t i = 0; i < nof_frames; i += nof_lanes) {
+    uint32_t n = SRSRAN_MIN(nof_lanes, nof_frames - i);
+    if (decode_viterbi37_batch(q->batch, &symbols[i], &data[i], n, frame_length, q->tail_biting ? TB_ITER : 0)) {
+      ERROR("Error decoding Viterbi batch");
+      return SRSRAN_ERROR;
+    }
+  }
+
+  return SRSRAN_SUCCESS;
+}
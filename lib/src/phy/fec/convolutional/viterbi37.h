@@ -22,6 +22,7 @@
 #ifndef SRSRAN_VITERBI37_H_
 #define SRSRAN_VITERBI37_H_
 
+#include "srsran/phy/utils/simd_dispatch.h"
 #include <stdbool.h>
 
 void* create_viterbi37_port(int polys[3], uint32_t len);
@@ -82,4 +83,32 @@ void delete_viterbi37_avx2_16bit(void* p);
 
 int update_viterbi37_blk_avx2_16bit(void* p, uint16_t* syms, uint32_t nbits, uint32_t* best_state);
 
+/* The batched decoder is built once per ISA in dispatch builds, see simd_dispatch.h */
+#ifdef SRSRAN_SIMD_DISPATCH_ISA
+#define viterbi37_batch_nof_lanes SRSRAN_SIMD_DISPATCH_NAME(viterbi37_batch_nof_lanes)
+#define create_viterbi37_batch SRSRAN_SIMD_DISPATCH_NAME(create_viterbi37_batch)
+#define delete_viterbi37_batch SRSRAN_SIMD_DISPATCH_NAME(delete_viterbi37_batch)
+#define decode_viterbi37_batch SRSRAN_SIMD_DISPATCH_NAME(decode_viterbi37_batch)
+#endif /* SRSRAN_SIMD_DISPATCH_ISA */
+
+uint32_t viterbi37_batch_nof_lanes(void);
+
+void* create_viterbi37_batch(int polys[3], uint32_t len);
+
+void delete_viterbi37_batch(void* p);
+
+int decode_viterbi37_batch(void*    p,
+                           float*   symbols[],
+                           uint8_t* data[],
+                           uint32_t nof_frames,
+                           uint32_t frame_length,
+                           uint32_t tb_iter);
+
+typedef struct {
+  uint32_t (*nof_lanes)(void);
+  void* (*create)(int polys[3], uint32_t len);
+  void (*delete)(void* p);
+  int (*decode)(void* p, float* symbols[], uint8_t* data[], uint32_t nof_frames, uint32_t frame_length, uint32_t tb_iter);
+} viterbi37_batch_kernels_t;
+
 #endif /* SRSRAN_VITERBI37_H_ */
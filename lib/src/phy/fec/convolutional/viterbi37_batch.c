@@ -0,0 +1,372 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Multi-stream r=1/3 K=7 Viterbi decoder. Every SIMD lane carries the trellis of a different frame, so that several
+ * frames of the same length (e.g. the PDCCH candidates of a blind search) are decoded at the cost of one. Path metrics
+ * are 16-bit correlations compared with modulo arithmetic, hence they never need to be normalised.
+ *
+ * The trellis follows the same convention as the single-stream decoders: the new states 2i and 2i+1 are reached from
+ * the old states i and i+32, and the decision bit of a state is set when the survivor comes from state i+32.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parity.h"
+#include "srsran/phy/utils/vector.h"
+#include "viterbi37.h"
+
+#ifdef LV_HAVE_AVX512
+
+#include <immintrin.h>
+
+#define VITERBI_BATCH_LANES 32
+#define VITERBI_BATCH_LANE_SHIFT 0
+
+typedef __m512i batch_metric_t;
+
+static inline batch_metric_t batch_load(const int16_t* ptr)
+{
+  return _mm512_load_si512(ptr);
+}
+
+static inline void batch_store(int16_t* ptr, batch_metric_t m)
+{
+  _mm512_store_si512(ptr, m);
+}
+
+static inline batch_metric_t batch_set1(int16_t x)
+{
+  return _mm512_set1_epi16(x);
+}
+
+static inline batch_metric_t batch_add(batch_metric_t a, batch_metric_t b)
+{
+  return _mm512_add_epi16(a, b);
+}
+
+static inline batch_metric_t batch_sub(batch_metric_t a, batch_metric_t b)
+{
+  return _mm512_sub_epi16(a, b);
+}
+
+/* Add-compare-select, returns one decision bit per lane */
+static inline uint32_t batch_acs(batch_metric_t m0, batch_metric_t m1, batch_metric_t* survivor)
+{
+  __mmask32 d = _mm512_cmpgt_epi16_mask(_mm512_sub_epi16(m1, m0), _mm512_setzero_si512());
+  *survivor   = _mm512_mask_blend_epi16(d, m0, m1);
+  return (uint32_t)d;
+}
+
+#elif defined(LV_HAVE_AVX2)
+
+#include <immintrin.h>
+
+#define VITERBI_BATCH_LANES 16
+#define VITERBI_BATCH_LANE_SHIFT 1
+
+typedef __m256i batch_metric_t;
+
+static inline batch_metric_t batch_load(const int16_t* ptr)
+{
+  return _mm256_load_si256((const __m256i*)ptr);
+}
+
+static inline void batch_store(int16_t* ptr, batch_metric_t m)
+{
+  _mm256_store_si256((__m256i*)ptr, m);
+}
+
+static inline batch_metric_t batch_set1(int16_t x)
+{
+  return _mm256_set1_epi16(x);
+}
+
+static inline batch_metric_t batch_add(batch_metric_t a, batch_metric_t b)
+{
+  return _mm256_add_epi16(a, b);
+}
+
+static inline batch_metric_t batch_sub(batch_metric_t a, batch_metric_t b)
+{
+  return _mm256_sub_epi16(a, b);
+}
+
+/* Add-compare-select, returns two identical decision bits per lane */
+static inline uint32_t batch_acs(batch_metric_t m0, batch_metric_t m1, batch_metric_t* survivor)
+{
+  __m256i d = _mm256_cmpgt_epi16(_mm256_sub_epi16(m1, m0), _mm256_setzero_si256());
+  *survivor = _mm256_blendv_epi8(m0, m1, d);
+  return (uint32_t)_mm256_movemask_epi8(d);
+}
+
+#else
+
+#define VITERBI_BATCH_LANES 0
+
+#endif
+
+/* Symbols are quantized to 8-bit range, leaving plenty of room for the 16-bit path metrics */
+#define VITERBI_BATCH_QUANT 127.0f
+
+/* Penalty of the unknown initial states when the encoder starts in the zero state */
+#define VITERBI_BATCH_BIAS 8192
+
+/* Maximum number of tail-biting trellis steps run before and after the decoded copy of the frame. Beyond a few times
+ * the constraint length the extra steps no longer improve the decoding */
+#define VITERBI_BATCH_TB_DEPTH 64
+
+uint32_t viterbi37_batch_nof_lanes(void)
+{
+  return VITERBI_BATCH_LANES;
+}
+
+#if VITERBI_BATCH_LANES > 0
+
+struct v37_batch {
+  uint8_t   code[32];  /* Encoder output for the transition from state i to state 2i */
+  uint32_t  max_bits;  /* Maximum number of bits per frame */
+  uint32_t  max_steps; /* Maximum number of trellis steps with stored decisions */
+  int16_t*  syms;      /* Quantized symbols, one lane per frame */
+  int16_t*  tmp;       /* Quantized symbols of a single frame */
+  uint32_t* decisions; /* Decision bits of every lane, for each trellis step and state */
+};
+
+void* create_viterbi37_batch(int polys[3], uint32_t len)
+{
+  struct v37_batch* vp = calloc(1, sizeof(struct v37_batch));
+  if (vp == NULL) {
+    return NULL;
+  }
+
+  for (uint32_t state = 0; state < 32; state++) {
+    vp->code[state] = 0;
+    for (uint32_t j = 0; j < 3; j++) {
+      uint32_t bit = (polys[j] < 0) ^ parity((2 * state) & abs(polys[j]));
+      vp->code[state] |= (uint8_t)(bit << j);
+    }
+  }
+
+  // Decisions are kept for the decoded frame, its tail and, if tail-biting, the steps after it
+  vp->max_bits  = len;
+  vp->max_steps = len + 6 + VITERBI_BATCH_TB_DEPTH;
+  vp->syms      = srsran_vec_i16_malloc(3 * (len + 6) * VITERBI_BATCH_LANES);
+  vp->tmp       = srsran_vec_i16_malloc(3 * (len + 6));
+  vp->decisions = srsran_vec_u32_malloc(vp->max_steps * 64);
+  if (vp->syms == NULL || vp->tmp == NULL || vp->decisions == NULL) {
+    delete_viterbi37_batch(vp);
+    return NULL;
+  }
+
+  return vp;
+}
+
+void delete_viterbi37_batch(void* p)
+{
+  struct v37_batch* vp = p;
+
+  if (vp != NULL) {
+    if (vp->syms) {
+      free(vp->syms);
+    }
+    if (vp->tmp) {
+      free(vp->tmp);
+    }
+    if (vp->decisions) {
+      free(vp->decisions);
+    }
+    free(vp);
+  }
+}
+
+/* Quantizes the symbols of every frame and interleaves them so that each frame occupies one lane */
+static void batch_load_symbols(struct v37_batch* vp, float* symbols[], uint32_t nof_frames, uint32_t len)
+{
+  srsran_vec_i16_zero(vp->syms, len * VITERBI_BATCH_LANES);
+
+  for (uint32_t f = 0; f < nof_frames; f++) {
+    float    max   = 1e-9f;
+    uint32_t max_i = srsran_vec_max_abs_fi(symbols[f], len);
+    if (max_i < len && isnormal(symbols[f][max_i])) {
+      max = fabsf(symbols[f][max_i]);
+    }
+    srsran_vec_convert_fi(symbols[f], VITERBI_BATCH_QUANT / max, vp->tmp, len);
+    for (uint32_t i = 0; i < len; i++) {
+      vp->syms[i * VITERBI_BATCH_LANES + f] = vp->tmp[i];
+    }
+  }
+}
+
+/* Runs nof_steps trellis steps, the symbols are read cyclically from the first nof_syms triplets. Decisions are stored
+ * only if dec is not NULL */
+static void batch_update(struct v37_batch* vp,
+                         batch_metric_t*   metrics,
+                         uint32_t          first_step,
+                         uint32_t          nof_steps,
+                         uint32_t          nof_syms,
+                         uint32_t*         dec)
+{
+  // Work on local copies, otherwise every decision store could alias the metrics and the code words
+  batch_metric_t  m[2][64];
+  batch_metric_t* old_m = m[0];
+  batch_metric_t* new_m = m[1];
+  uint32_t        d[64];
+  uint8_t         code[32];
+  memcpy(old_m, metrics, sizeof(m[0]));
+  memcpy(code, vp->code, sizeof(code));
+
+  for (uint32_t t = 0; t < nof_steps; t++) {
+    const int16_t* syms = &vp->syms[((first_step + t) % nof_syms) * 3 * VITERBI_BATCH_LANES];
+    batch_metric_t a    = batch_load(&syms[0]);
+    batch_metric_t b    = batch_load(&syms[VITERBI_BATCH_LANES]);
+    batch_metric_t c    = batch_load(&syms[2 * VITERBI_BATCH_LANES]);
+
+    // Branch metrics are correlations: bit j of the code word adds the j-th symbol if set, subtracts it otherwise
+    batch_metric_t bm[8];
+    batch_metric_t zero = batch_set1(0);
+    batch_metric_t ab   = batch_add(a, b);
+    batch_metric_t a_b  = batch_sub(a, b);
+    bm[3]               = batch_sub(ab, c);
+    bm[1]               = batch_sub(a_b, c);
+    bm[2]               = batch_sub(zero, batch_add(a_b, c));
+    bm[0]               = batch_sub(zero, batch_add(ab, c));
+    bm[4]               = batch_sub(zero, bm[3]);
+    bm[5]               = batch_sub(zero, bm[2]);
+    bm[6]               = batch_sub(zero, bm[1]);
+    bm[7]               = batch_sub(zero, bm[0]);
+
+    for (uint32_t i = 0; i < 32; i++) {
+      batch_metric_t mu = bm[code[i]];
+      d[2 * i]          = batch_acs(batch_add(old_m[i], mu), batch_sub(old_m[i + 32], mu), &new_m[2 * i]);
+      d[2 * i + 1]      = batch_acs(batch_sub(old_m[i], mu), batch_add(old_m[i + 32], mu), &new_m[2 * i + 1]);
+    }
+    if (dec) {
+      memcpy(dec, d, sizeof(d));
+      dec += 64;
+    }
+
+    batch_metric_t* tmp = old_m;
+    old_m               = new_m;
+    new_m               = tmp;
+  }
+
+  memcpy(metrics, old_m, sizeof(m[0]));
+}
+
+int decode_viterbi37_batch(void*    p,
+                           float*   symbols[],
+                           uint8_t* data[],
+                           uint32_t nof_frames,
+                           uint32_t frame_length,
+                           uint32_t tb_iter)
+{
+  struct v37_batch* vp = p;
+
+  if (vp == NULL || nof_frames > VITERBI_BATCH_LANES || frame_length > vp->max_bits) {
+    return -1;
+  }
+
+  bool     tail_biting = (tb_iter > 0);
+  uint32_t nof_syms    = tail_biting ? frame_length : frame_length + 6;
+  batch_load_symbols(vp, symbols, nof_frames, 3 * nof_syms);
+
+  batch_metric_t metrics[64];
+  for (uint32_t i = 0; i < 64; i++) {
+    metrics[i] = batch_set1((tail_biting || i == 0) ? 0 : -VITERBI_BATCH_BIAS);
+  }
+
+  // Tail-biting frames are decoded from the middle one of tb_iter consecutive copies: the copies before it let the
+  // path metrics converge from an unknown state and the ones after it let the survivors merge. Both are shortened to
+  // VITERBI_BATCH_TB_DEPTH steps
+  uint32_t first_step = 0;
+  uint32_t nof_steps  = nof_syms;
+  if (tail_biting) {
+    uint32_t depth = SRSRAN_MIN((tb_iter / 2) * frame_length, VITERBI_BATCH_TB_DEPTH);
+    first_step     = (tb_iter / 2) * frame_length;
+    nof_steps      = frame_length + 6 + depth;
+    batch_update(vp, metrics, first_step - depth, depth, nof_syms, NULL);
+  }
+  batch_update(vp, metrics, first_step, nof_steps, nof_syms, vp->decisions);
+
+  int16_t final_metrics[64 * VITERBI_BATCH_LANES] __attribute__((aligned(64)));
+  for (uint32_t i = 0; i < 64; i++) {
+    batch_store(&final_metrics[i * VITERBI_BATCH_LANES], metrics[i]);
+  }
+
+  for (uint32_t f = 0; f < nof_frames; f++) {
+    // Tail-biting frames trace back from the best state, terminated frames from the zero state
+    uint32_t state = 0;
+    if (tail_biting) {
+      int16_t best = final_metrics[f];
+      for (uint32_t i = 1; i < 64; i++) {
+        int16_t m = final_metrics[i * VITERBI_BATCH_LANES + f];
+        if ((int16_t)(m - best) > 0) {
+          best  = m;
+          state = i;
+        }
+      }
+    }
+
+    // The decision at each step is the input bit of 6 steps before
+    uint32_t shift = f << VITERBI_BATCH_LANE_SHIFT;
+    for (uint32_t t = nof_steps - 1; t >= 6; t--) {
+      uint32_t k = (vp->decisions[t * 64 + state] >> shift) & 1;
+      if (t - 6 < frame_length) {
+        data[f][t - 6] = (uint8_t)k;
+      }
+      state = (state >> 1) | (k << 5);
+    }
+  }
+
+  return 0;
+}
+
+#else /* VITERBI_BATCH_LANES > 0 */
+
+void* create_viterbi37_batch(int polys[3], uint32_t len)
+{
+  return NULL;
+}
+
+void delete_viterbi37_batch(void* p) {}
+
+int decode_viterbi37_batch(void*    p,
+                           float*   symbols[],
+                           uint8_t* data[],
+                           uint32_t nof_frames,
+                           uint32_t frame_length,
+                           uint32_t tb_iter)
+{
+  return -1;
+}
+
+#endif /* VITERBI_BATCH_LANES > 0 */
+
+#ifdef SRSRAN_SIMD_DISPATCH_ISA
+const viterbi37_batch_kernels_t SRSRAN_SIMD_DISPATCH_NAME(viterbi37_batch_kernels) = {
+    .nof_lanes = viterbi37_batch_nof_lanes,
+    .create    = create_viterbi37_batch,
+    .delete    = delete_viterbi37_batch,
+    .decode    = decode_viterbi37_batch,
+};
+#endif /* SRSRAN_SIMD_DISPATCH_ISA */
@@ -0,0 +1,54 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "viterbi37.h"
+
+#ifdef SRSRAN_SIMD_DISPATCH
+
+SRSRAN_SIMD_DISPATCH_DECLARE(viterbi37_batch_kernels_t, viterbi37_batch_kernels)
+
+uint32_t viterbi37_batch_nof_lanes(void)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(viterbi37_batch_kernels)->nof_lanes();
+}
+
+void* create_viterbi37_batch(int polys[3], uint32_t len)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(viterbi37_batch_kernels)->create(polys, len);
+}
+
+void delete_viterbi37_batch(void* p)
+{
+  SRSRAN_SIMD_DISPATCH_SELECT(viterbi37_batch_kernels)->delete(p);
+}
+
+int decode_viterbi37_batch(void*    p,
+                           float*   symbols[],
+                           uint8_t* data[],
+                           uint32_t nof_frames,
+                           uint32_t frame_length,
+                           uint32_t tb_iter)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(viterbi37_batch_kernels)
+      ->decode(p, symbols, data, nof_frames, frame_length, tb_iter);
+}
+
+#endif /* SRSRAN_SIMD_DISPATCH */
@@ -27,6 +27,16 @@
 #include <immintrin.h>
 #endif // LV_HAVE_SSE
 
+#include <string.h>
+
+// The carry-less multiplication engine is compiled for PCLMULQDQ and selected at run time
+#if defined(LV_HAVE_SSE) && defined(__x86_64__) && defined(__GNUC__)
+#define CRC_HAVE_CLMUL
+#endif
+
+// Messages shorter than this are faster with the byte table
+#define CRC_CLMUL_MIN_BYTES 32
+
 static void gen_crc_table(srsran_crc_t* h)
 {
   uint32_t pad        = (h->order < 8) ? (8 - h->order) : 0;
@@ -60,6 +70,32 @@ uint64_t reversecrcbit(uint32_t crc, int nbits, srsran_crc_t* h)
   return (crc & h->crcmask);
 }
 
+// Computes x^k mod polynom, bit by bit
+static uint64_t crc_xpow_mod(srsran_crc_t* h, uint32_t k)
+{
+  uint64_t r = 1;
+  for (uint32_t i = 0; i < k; i++) {
+    r <<= 1U;
+    if (r & ((uint64_t)1 << h->order)) {
+      r ^= (uint64_t)h->polynom;
+    }
+  }
+  return r;
+}
+
+static void gen_crc_clmul(srsran_crc_t* h)
+{
+  for (uint32_t i = 0; i < 9; i++) {
+    h->clmul_k[i] = crc_xpow_mod(h, 64 * (i + 1));
+  }
+
+  // Constants must fit in 32 bits for the 64-bit reduction
+  h->clmul = false;
+#ifdef CRC_HAVE_CLMUL
+  h->clmul = (h->order <= 32) && __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+#endif // CRC_HAVE_CLMUL
+}
+
 int srsran_crc_set_init(srsran_crc_t* crc_par, uint64_t crc_init_value)
 {
   crc_par->crcinit = crc_init_value;
@@ -89,6 +125,9 @@ int srsran_crc_init(srsran_crc_t* h, uint32_t crc_poly, int crc_order)
   // generate lookup table
   gen_crc_table(h);
 
+  // generate folding constants
+  gen_crc_clmul(h);
+
   return 0;
 }
 
@@ -143,12 +182,80 @@ uint32_t srsran_crc_checksum(srsran_crc_t* h, uint8_t* data, int len)
   return crc;
 }
 
+#ifdef CRC_HAVE_CLMUL
+// Folds 128 bits by d bits: clmul(x_hi, x^(d+64) mod P) ^ clmul(x_lo, x^d mod P)
+#define CRC_CLMUL_FOLD(X, K) _mm_xor_si128(_mm_clmulepi64_si128(X, K, 0x11), _mm_clmulepi64_si128(X, K, 0x00))
+#define CRC_CLMUL_K(h, d) _mm_set_epi64x((long long)(h)->clmul_k[(d) / 64], (long long)(h)->clmul_k[(d) / 64 - 1])
+
+/*
+ * The message is read as a polynomial, most significant bit first, in 128-bit blocks. The first block is padded with
+ * leading zeros. Blocks are folded into four accumulators 512 bits apart, which are then combined into one and
+ * reduced to 64 bits U such that U = M mod P. The remaining U * x^order mod P is done with the byte table.
+ */
+__attribute__((target("pclmul,ssse3"))) static uint32_t
+crc_checksum_byte_clmul(srsran_crc_t* h, const uint8_t* data, uint32_t nbytes)
+{
+  const __m128i bswap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+  // First block, 1 to 16 bytes
+  uint8_t  first[16] = {};
+  uint32_t r         = (nbytes - 1) % 16 + 1;
+  memcpy(&first[16 - r], data, r);
+  const uint8_t* ptr     = data + r;
+  uint32_t       nblocks = (nbytes - r) / 16;
+
+  __m128i x0 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)first), bswap);
+
+  if (nblocks >= 7) {
+    __m128i x1 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(ptr + 0)), bswap);
+    __m128i x2 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(ptr + 16)), bswap);
+    __m128i x3 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(ptr + 32)), bswap);
+    ptr += 48;
+    nblocks -= 3;
+
+    const __m128i k512 = CRC_CLMUL_K(h, 512);
+    for (; nblocks >= 4; nblocks -= 4, ptr += 64) {
+      x0 = _mm_xor_si128(CRC_CLMUL_FOLD(x0, k512), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(ptr + 0)), bswap));
+      x1 = _mm_xor_si128(CRC_CLMUL_FOLD(x1, k512), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(ptr + 16)), bswap));
+      x2 = _mm_xor_si128(CRC_CLMUL_FOLD(x2, k512), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(ptr + 32)), bswap));
+      x3 = _mm_xor_si128(CRC_CLMUL_FOLD(x3, k512), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)(ptr + 48)), bswap));
+    }
+
+    x0 = _mm_xor_si128(CRC_CLMUL_FOLD(x0, CRC_CLMUL_K(h, 384)), CRC_CLMUL_FOLD(x1, CRC_CLMUL_K(h, 256)));
+    x0 = _mm_xor_si128(x0, _mm_xor_si128(CRC_CLMUL_FOLD(x2, CRC_CLMUL_K(h, 128)), x3));
+  }
+
+  const __m128i k128 = CRC_CLMUL_K(h, 128);
+  for (; nblocks > 0; nblocks--, ptr += 16) {
+    x0 = _mm_xor_si128(CRC_CLMUL_FOLD(x0, k128), _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)ptr), bswap));
+  }
+
+  // Reduce 128 to 64 bits, twice since the first product can take up to 96 bits
+  const __m128i k64 = _mm_set_epi64x(0, (long long)h->clmul_k[0]);
+  x0                = _mm_xor_si128(_mm_clmulepi64_si128(x0, k64, 0x01), _mm_move_epi64(x0));
+  x0                = _mm_xor_si128(_mm_clmulepi64_si128(x0, k64, 0x01), _mm_move_epi64(x0));
+  uint64_t u        = (uint64_t)_mm_cvtsi128_si64(x0);
+
+  srsran_crc_set_init(h, 0);
+  for (int i = 56; i >= 0; i -= 8) {
+    srsran_crc_checksum_put_byte(h, (uint8_t)(u >> (uint32_t)i));
+  }
+  return (uint32_t)srsran_crc_checksum_get(h);
+}
+#endif // CRC_HAVE_CLMUL
+
 // len is multiple of 8
 uint32_t srsran_crc_checksum_byte(srsran_crc_t* h, const uint8_t* data, int len)
 {
   int      i;
   uint32_t crc = 0;
 
+#ifdef CRC_HAVE_CLMUL
+  if (h->clmul && len / 8 >= CRC_CLMUL_MIN_BYTES) {
+    return crc_checksum_byte_clmul(h, data, (uint32_t)len / 8);
+  }
+#endif // CRC_HAVE_CLMUL
+
   srsran_crc_set_init(h, 0);
 
   // Calculate CRC
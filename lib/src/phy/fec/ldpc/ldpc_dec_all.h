@@ -201,6 +201,17 @@ void delete_ldpc_dec_c(void* p);
  */
 int init_ldpc_dec_c(void* p, const int8_t* llrs, uint16_t ls);
 
+/*!
+ * Initializes the inner registers of the decoder without loading any LLR, so that the caller can write the
+ * channel LLRs directly in the soft bits. The LLR of the i-th transmitted bit (i.e., excluding the two punctured
+ * base nodes) goes to `ptr[(i / ls) * node_size + i % ls]`, where `ptr` is the returned pointer. All other soft
+ * bits are cleared.
+ * \param[in,out] p         A pointer to the decoder registers (an ldpc_regs_c structure).
+ * \param[out]    node_size The distance, in bytes, between two consecutive lifted nodes in the soft bits.
+ * \return A pointer to the soft bit of the first transmitted bit, NULL if an error occurred.
+ */
+int8_t* init_ldpc_dec_inplace_c(void* p, uint32_t* node_size);
+
 /*!
  * Updates the messages from variable nodes to check nodes (8-bit version).
  * \param[in,out] p       A pointer to the decoder registers (an ldpc_regs_c structure).
@@ -338,6 +349,17 @@ void delete_ldpc_dec_c_avx2(void* p);
  */
 int init_ldpc_dec_c_avx2(void* p, const int8_t* llrs, uint16_t ls);
 
+/*!
+ * Initializes the inner registers of the decoder without loading any LLR, so that the caller can write the
+ * channel LLRs directly in the soft bits. The LLR of the i-th transmitted bit (i.e., excluding the two punctured
+ * base nodes) goes to `ptr[(i / ls) * node_size + i % ls]`, where `ptr` is the returned pointer. All other soft
+ * bits are cleared.
+ * \param[in,out] p         A pointer to the decoder registers (an ldpc_regs_c_avx2 structure).
+ * \param[out]    node_size The distance, in bytes, between two consecutive lifted nodes in the soft bits.
+ * \return A pointer to the soft bit of the first transmitted bit, NULL if an error occurred.
+ */
+int8_t* init_ldpc_dec_inplace_c_avx2(void* p, uint32_t* node_size);
+
 /*!
  * Updates the messages from variable nodes to check nodes (optimized 8-bit version, LS <= \ref SRSRAN_AVX2_B_SIZE).
  * \param[in,out] p       A pointer to the decoder registers (an ldpc_regs_c_avx2 structure).
@@ -408,6 +430,17 @@ void delete_ldpc_dec_c_avx2long(void* p);
  */
 int init_ldpc_dec_c_avx2long(void* p, const int8_t* llrs, uint16_t ls);
 
+/*!
+ * Initializes the inner registers of the decoder without loading any LLR, so that the caller can write the
+ * channel LLRs directly in the soft bits. The LLR of the i-th transmitted bit (i.e., excluding the two punctured
+ * base nodes) goes to `ptr[(i / ls) * node_size + i % ls]`, where `ptr` is the returned pointer. All other soft
+ * bits are cleared.
+ * \param[in,out] p         A pointer to the decoder registers (an ldpc_regs_c_avx2long structure).
+ * \param[out]    node_size The distance, in bytes, between two consecutive lifted nodes in the soft bits.
+ * \return A pointer to the soft bit of the first transmitted bit, NULL if an error occurred.
+ */
+int8_t* init_ldpc_dec_inplace_c_avx2long(void* p, uint32_t* node_size);
+
 /*!
  * Updates the messages from variable nodes to check nodes (optimized 8-bit version, LS > \ref SRSRAN_AVX2_B_SIZE).
  * \param[in,out] p       A pointer to the decoder registers (an ldpc_regs_c_avx2long structure).
@@ -625,6 +658,17 @@ void delete_ldpc_dec_c_avx512long(void* p);
  */
 int init_ldpc_dec_c_avx512long(void* p, const int8_t* llrs, uint16_t ls);
 
+/*!
+ * Initializes the inner registers of the decoder without loading any LLR, so that the caller can write the
+ * channel LLRs directly in the soft bits. The LLR of the i-th transmitted bit (i.e., excluding the two punctured
+ * base nodes) goes to `ptr[(i / ls) * node_size + i % ls]`, where `ptr` is the returned pointer. All other soft
+ * bits are cleared.
+ * \param[in,out] p         A pointer to the decoder registers (an ldpc_regs_c_avx512long structure).
+ * \param[out]    node_size The distance, in bytes, between two consecutive lifted nodes in the soft bits.
+ * \return A pointer to the soft bit of the first transmitted bit, NULL if an error occurred.
+ */
+int8_t* init_ldpc_dec_inplace_c_avx512long(void* p, uint32_t* node_size);
+
 /*!
  * Updates the messages from variable nodes to check nodes (optimized 8-bit version, LS > \ref SRSRAN_AVX512_B_SIZE).
  * \param[in,out] p       A pointer to the decoder registers (an ldpc_regs_c_avx512long structure).
@@ -694,6 +738,38 @@ void delete_ldpc_dec_c_avx512(void* p);
  */
 int init_ldpc_dec_c_avx512(void* p, const int8_t* llrs, uint16_t ls);
 
+/*!
+ * Initializes the inner registers of the decoder without loading any LLR, so that the caller can write the
+ * channel LLRs directly in the soft bits. The LLR of the i-th transmitted bit (i.e., excluding the two punctured
+ * base nodes) goes to `ptr[(i / ls) * node_size + i % ls]`, where `ptr` is the returned pointer. All other soft
+ * bits are cleared.
+ * \param[in,out] p         A pointer to the decoder registers (an ldpc_regs_c_avx512 structure).
+ * \param[out]    node_size The distance, in bytes, between two consecutive lifted nodes in the soft bits.
+ * \return A pointer to the soft bit of the first transmitted bit, NULL if an error occurred.
+ */
+int8_t* init_ldpc_dec_inplace_c_avx512(void* p, uint32_t* node_size);
+
+/*!
+ * Initializes the inner registers of the 8-bit integer-based LDPC decoder (AVX512 version) for decoding several
+ * codewords at once. Each node holds up to SRSRAN_AVX512_B_SIZE / ls codewords, one after the other.
+ * \param[in,out] p      A pointer to the decoder registers (an ldpc_regs_c_avx512 structure).
+ * \param[in]     llrs   The arrays of LLR values from the channel, one for each codeword.
+ * \param[in]     nof_cw The number of codewords, at most SRSRAN_AVX512_B_SIZE / ls.
+ * \param[in]     ls     The lifting size.
+ * \return An integer: 0 if the function executes correctly, -1 otherwise.
+ */
+int init_ldpc_dec_batch_c_avx512(void* p, const int8_t* const* llrs, uint32_t nof_cw, uint16_t ls);
+
+/*!
+ * Returns the decoded message (hard bits) of one of the codewords decoded together (AVX512 version).
+ * \param[in]  p       A pointer to the decoder registers (an ldpc_regs_c_avx512 structure).
+ * \param[out] message The decoded message.
+ * \param[in]  liftK   The length of the decoded message.
+ * \param[in]  i_cw    The index of the codeword, as given to init_ldpc_dec_batch_c_avx512().
+ * \return An integer: 0 if the function executes correctly, -1 otherwise.
+ */
+int extract_ldpc_message_batch_c_avx512(void* p, uint8_t* message, uint16_t liftK, uint32_t i_cw);
+
 /*!
  * Updates the messages from variable nodes to check nodes (optimized 8-bit version, LS <= \ref SRSRAN_AVX512_B_SIZE).
  * \param[in,out] p       A pointer to the decoder registers (an ldpc_regs_c_avx512 structure).
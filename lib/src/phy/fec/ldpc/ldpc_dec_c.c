@@ -187,6 +187,23 @@ int init_ldpc_dec_c(void* p, const int8_t* llrs, uint16_t ls)
   return 0;
 }
 
+int8_t* init_ldpc_dec_inplace_c(void* p, uint32_t* node_size)
+{
+  struct ldpc_regs_c* vp = p;
+
+  if (p == NULL || node_size == NULL) {
+    return NULL;
+  }
+
+  srsran_vec_i8_zero(vp->soft_bits, vp->liftN);
+  srsran_vec_i8_zero(vp->check_to_var, (vp->hrrN + vp->ls) * (uint32_t)vp->bgM);
+  srsran_vec_i8_zero(vp->var_to_check, vp->hrrN + vp->ls);
+
+  // the first 2 x LS bits of the codeword are not sent
+  *node_size = vp->ls;
+  return &vp->soft_bits[2 * vp->ls];
+}
+
 int update_ldpc_var_to_check_c(void* p, int i_layer)
 {
   struct ldpc_regs_c* vp = p;
@@ -237,6 +237,23 @@ int init_ldpc_dec_c_avx2(void* p, const int8_t* llrs, uint16_t ls)
   return 0;
 }
 
+int8_t* init_ldpc_dec_inplace_c_avx2(void* p, uint32_t* node_size)
+{
+  struct ldpc_regs_c_avx2* vp = p;
+
+  if (p == NULL || node_size == NULL) {
+    return NULL;
+  }
+
+  SRSRAN_MEM_ZERO(vp->soft_bits.v, __m256i, vp->bgN);
+  SRSRAN_MEM_ZERO(vp->check_to_var, __m256i, (vp->hrr + 1) * (uint32_t)vp->bgM);
+  SRSRAN_MEM_ZERO(vp->var_to_check, __m256i, vp->hrr + 1);
+
+  // the first 2 x LS bits of the codeword are not sent
+  *node_size = SRSRAN_AVX2_B_SIZE;
+  return &vp->soft_bits.c[2 * SRSRAN_AVX2_B_SIZE];
+}
+
 int update_ldpc_var_to_check_c_avx2(void* p, int i_layer)
 {
   struct ldpc_regs_c_avx2* vp = p;
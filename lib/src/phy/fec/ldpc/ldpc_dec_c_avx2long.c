@@ -276,6 +276,26 @@ int init_ldpc_dec_c_avx2long(void* p, const int8_t* llrs, uint16_t ls)
   return 0;
 }
 
+int8_t* init_ldpc_dec_inplace_c_avx2long(void* p, uint32_t* node_size)
+{
+  struct ldpc_regs_c_avx2long* vp = p;
+
+  if (p == NULL || node_size == NULL) {
+    return NULL;
+  }
+
+  SRSRAN_MEM_ZERO(vp->soft_bits, bg_node_t, vp->bgN * vp->n_subnodes);
+  SRSRAN_MEM_ZERO(vp->check_to_var, __m256i, (vp->hrr + 1) * vp->bgM * vp->n_subnodes);
+  SRSRAN_MEM_ZERO(vp->var_to_check, __m256i, (vp->hrr + 1) * vp->n_subnodes);
+  SRSRAN_MEM_ZERO(vp->this_c2v_epi8_to_free, __m256i, vp->n_subnodes + 2);
+  SRSRAN_MEM_ZERO(vp->min_ix_epi8, __m256i, vp->n_subnodes);
+  SRSRAN_MEM_ZERO(vp->var_to_check_to_free, __m256i, (vp->hrr + 1) * vp->n_subnodes + 2);
+
+  // the first 2 x LS bits of the codeword are not sent
+  *node_size = SRSRAN_AVX2_B_SIZE * vp->n_subnodes;
+  return vp->soft_bits[2 * vp->n_subnodes].c;
+}
+
 int update_ldpc_var_to_check_c_avx2long(void* p, int i_layer)
 {
   struct ldpc_regs_c_avx2long* vp = p;
@@ -83,11 +83,13 @@ struct ldpc_regs_c_avx512 {
   __m512i* this_c2v_epi8_to_free; /*!< \brief Helper register for the current c2v node with one extra __m512 allocated
                                      space. */
 
-  uint16_t ls;     /*!< \brief Lifting size. */
-  uint8_t  hrr;    /*!< \brief Number of variable nodes in the high-rate region (before lifting). */
-  uint8_t  bgM;    /*!< \brief Number of check nodes (before lifting). */
-  uint8_t  bgN;    /*!< \brief Number of variable nodes (before lifting). */
-  uint16_t finalN; /*!< \brief (bgN-2)*ls */
+  uint16_t ls;      /*!< \brief Lifting size. */
+  uint8_t  hrr;     /*!< \brief Number of variable nodes in the high-rate region (before lifting). */
+  uint8_t  bgM;     /*!< \brief Number of check nodes (before lifting). */
+  uint8_t  bgN;     /*!< \brief Number of variable nodes (before lifting). */
+  uint16_t finalN;  /*!< \brief (bgN-2)*ls */
+  uint8_t  n_cw;    /*!< \brief Number of codewords that fit side by side in a node. */
+  uint64_t cw_mask; /*!< \brief Mask with the first lane of each codeword in a node. */
 };
 
 /*!
@@ -109,13 +111,15 @@ static void inner_var_to_check_c_avx512(const __m512i* x, const __m512i* y, __m5
 /*!
  * Rotate the contents of a node towards the right by \b shift chars, that is the
  * \b shift * 8 most significant bits become the least significant ones.
+ * When several codewords are packed in the node, each group of \b ls chars is rotated independently.
  * \param[in]  mem_addr   The node to rotate.
  * \param[out] out        The rotated node.
  * \param[in]  shift      The order of the rotation in number of chars.
  * \param[in]  ls         The size of the node (lifting size).
- * \param[in]  n_subnodes The number of subnodes in each node.
+ * \param[in]  cw_mask    Mask with the first lane of each codeword packed in the node.
  */
-static void rotate_node_right(const uint8_t* mem_addr, __m512i* out, uint16_t this_shift, uint16_t ls);
+static void
+rotate_node_right(const uint8_t* mem_addr, __m512i* out, uint16_t this_shift, uint16_t ls, uint64_t cw_mask);
 
 /*!
  * Scale packed 8-bit integers in \b a by the scaling factor \b sf / #F2I.
@@ -171,6 +175,14 @@ void* create_ldpc_dec_c_avx512(uint8_t bgN, uint8_t bgM, uint16_t ls, float scal
   vp->ls  = ls;
 
   vp->finalN = (bgN - 2) * ls;
+
+  // All lanes work independently except for the rotations, so short codewords can share the node
+  vp->n_cw    = SRSRAN_AVX512_B_SIZE / ls;
+  vp->cw_mask = 0;
+  for (uint32_t i = 0; i < vp->n_cw; i++) {
+    vp->cw_mask |= 1ULL << (i * ls);
+  }
+
   // correction > 1/16 to compensate the scaling error (2^16-1)/2^16 incurred in _mm512_scalei_epi8
   vp->scaling_fctr = _mm512_set1_epi16((uint16_t)((scaling_fctr + 0.00001525879) * F2I));
 
@@ -232,6 +244,67 @@ int init_ldpc_dec_c_avx512(void* p, const int8_t* llrs, uint16_t ls)
   return 0;
 }
 
+int8_t* init_ldpc_dec_inplace_c_avx512(void* p, uint32_t* node_size)
+{
+  struct ldpc_regs_c_avx512* vp = p;
+
+  if (p == NULL || node_size == NULL) {
+    return NULL;
+  }
+
+  SRSRAN_MEM_ZERO(vp->soft_bits.v, __m512i, vp->bgN);
+  SRSRAN_MEM_ZERO(vp->check_to_var, __m512i, (vp->hrr + 1) * vp->bgM);
+  SRSRAN_MEM_ZERO(vp->var_to_check, __m512i, vp->hrr + 1);
+
+  // First 2 punctured bits
+  *node_size = SRSRAN_AVX512_B_SIZE;
+  return &vp->soft_bits.c[2 * SRSRAN_AVX512_B_SIZE];
+}
+
+int init_ldpc_dec_batch_c_avx512(void* p, const int8_t* const* llrs, uint32_t nof_cw, uint16_t ls)
+{
+  struct ldpc_regs_c_avx512* vp = p;
+
+  if (p == NULL || llrs == NULL || nof_cw == 0 || nof_cw > vp->n_cw) {
+    return -1;
+  }
+
+  // First 2 punctured bits and unused lanes
+  SRSRAN_MEM_ZERO(vp->soft_bits.v, __m512i, vp->bgN);
+
+  // Codeword i_cw takes the lanes [i_cw * ls, (i_cw + 1) * ls) of every node
+  for (uint32_t i_cw = 0; i_cw < nof_cw; i_cw++) {
+    int ini = 2 * SRSRAN_AVX512_B_SIZE + i_cw * ls;
+    for (int i = 0; i < vp->finalN; i = i + ls) {
+      srsran_vec_i8_copy(&vp->soft_bits.c[ini], &llrs[i_cw][i], ls);
+      ini = ini + SRSRAN_AVX512_B_SIZE;
+    }
+  }
+
+  SRSRAN_MEM_ZERO(vp->check_to_var, __m512i, (vp->hrr + 1) * vp->bgM);
+  SRSRAN_MEM_ZERO(vp->var_to_check, __m512i, vp->hrr + 1);
+
+  return 0;
+}
+
+int extract_ldpc_message_batch_c_avx512(void* p, uint8_t* message, uint16_t liftK, uint32_t i_cw)
+{
+  if (p == NULL) {
+    return -1;
+  }
+  struct ldpc_regs_c_avx512* vp = p;
+
+  int ini = i_cw * vp->ls;
+  for (int i = 0; i < liftK; i = i + vp->ls) {
+    for (int k = 0; k < vp->ls; k++) {
+      message[i + k] = (vp->soft_bits.c[ini + k] < 0);
+    }
+    ini = ini + SRSRAN_AVX512_B_SIZE;
+  }
+
+  return 0;
+}
+
 int extract_ldpc_message_c_avx512(void* p, uint8_t* message, uint16_t liftK)
 {
   if (p == NULL) {
@@ -309,7 +382,7 @@ int update_ldpc_check_to_var_c_avx512(void*           p,
 
     this_rotated_v2c = vp->rotated_v2c + i;
 
-    rotate_node_right((uint8_t*)(vp->var_to_check + i_v2c_base), this_rotated_v2c, shift, vp->ls);
+    rotate_node_right((uint8_t*)(vp->var_to_check + i_v2c_base), this_rotated_v2c, shift, vp->ls, vp->cw_mask);
 
     prod_v2c_epi8 = _mm512_xor_si512(prod_v2c_epi8, *this_rotated_v2c);
 
@@ -354,7 +427,8 @@ int update_ldpc_check_to_var_c_avx512(void*           p,
     this_c2v_epi8[0] = _mm512_mask_sub_epi8(this_c2v_epi8[0], negmask, _mm512_setzero_si512(), this_c2v_epi8[0]);
 
     // rotating right LS - shift positions is the same as rotating left shift positions
-    rotate_node_right((uint8_t*)vp->this_c2v_epi8, this_check_to_var + i_v2c_base, (vp->ls - shift) % vp->ls, vp->ls);
+    rotate_node_right(
+        (uint8_t*)vp->this_c2v_epi8, this_check_to_var + i_v2c_base, (vp->ls - shift) % vp->ls, vp->ls, vp->cw_mask);
 
     current_var_index = (*these_var_indices)[(i + 1) % MAX_CNCT];
   }
@@ -428,7 +502,7 @@ inner_var_to_check_c_avx512(const __m512i* x, const __m512i* y, __m512i* z, cons
     z[i]      = _mm512_mask_blend_epi8(mask_epi8, _mm512_neg_infty8_epi8, z_epi8);
   }
 }
-static void rotate_node_right(const uint8_t* mem_addr, __m512i* out, uint16_t this_shift, uint16_t ls)
+static void rotate_node_right(const uint8_t* mem_addr, __m512i* out, uint16_t this_shift, uint16_t ls, uint64_t cw_mask)
 {
   const __m512i MZERO = _mm512_set1_epi8(0);
 
@@ -448,6 +522,12 @@ static void rotate_node_right(const uint8_t* mem_addr, __m512i* out, uint16_t th
     mask2 = (1ULL << shift) - 1;
     mask2 = mask2 << _shift; //    i.e. 000110000  shift = 2, _shift = 4
 
+    // repeat the pattern for every packed codeword, the multiplication does not carry since lanes do not overlap
+    if (cw_mask != 1) {
+      mask2 = (mask2 & ((1ULL << ls) - 1)) * cw_mask;
+      mask1 = mask1 * cw_mask;
+    }
+
     out[0] = _mm512_mask_loadu_epi8(MZERO, mask1, mem_addr + this_shift);
     out[0] = _mm512_mask_loadu_epi8(out[0], mask2, mem_addr - _shift);
   }
@@ -292,6 +292,23 @@ int init_ldpc_dec_c_avx512long(void* p, const int8_t* llrs, uint16_t ls)
   return 0;
 }
 
+int8_t* init_ldpc_dec_inplace_c_avx512long(void* p, uint32_t* node_size)
+{
+  struct ldpc_regs_c_avx512long* vp = p;
+
+  if (p == NULL || node_size == NULL) {
+    return NULL;
+  }
+
+  bzero(vp->soft_bits, vp->bgN * vp->n_subnodes * sizeof(bg_node_avx512_t));
+  bzero(vp->check_to_var, (vp->hrr + 1) * vp->bgM * vp->n_subnodes * sizeof(__m512i));
+  bzero(vp->var_to_check, (vp->hrr + 1) * vp->n_subnodes * sizeof(__m512i));
+
+  // First 2 punctured bits
+  *node_size = vp->node_size;
+  return &vp->soft_bits->c[2 * vp->node_size];
+}
+
 int extract_ldpc_message_c_avx512long(void* p, uint8_t* message, uint16_t liftK)
 {
   if (p == NULL) {
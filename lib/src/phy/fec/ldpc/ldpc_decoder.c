@@ -37,13 +37,13 @@
 #include "srsran/phy/fec/ldpc/base_graph.h"
 #include "srsran/phy/fec/ldpc/ldpc_decoder.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/vector.h"
 
 #define LDPC_DECODER_DEFAULT_MAX_NOF_ITER 10 /*!< \brief Default maximum number of iterations of the BP algorithm. */
 
 #define LDPC_DECODER_TEMPLATE(LLR_TYPE, SUFFIX)                                                                        \
-  static int decode_##SUFFIX(                                                                                          \
-      void* o, const LLR_TYPE* llrs, uint8_t* message, uint32_t cdwd_rm_length, srsran_crc_t* crc)                     \
+  static int iterate_##SUFFIX(void* o, uint8_t* message, uint32_t cdwd_rm_length, srsran_crc_t* crc)                   \
   {                                                                                                                    \
     srsran_ldpc_decoder_t* q = o;                                                                                      \
                                                                                                                        \
@@ -63,7 +63,6 @@
       /* ERROR("The rate-matched codeword length should be a multiple of the lifting size."); */                       \
       /* return -1;*/                                                                                                  \
     }                                                                                                                  \
-    init_ldpc_dec_##SUFFIX(q->ptr, llrs, q->ls);                                                                       \
                                                                                                                        \
     uint16_t* this_pcm                   = NULL;                                                                       \
     int8_t(*these_var_indices)[MAX_CNCT] = NULL;                                                                       \
@@ -101,6 +100,15 @@
     /* Without CRC, extract message and return the maximum number of iterations */                                     \
     extract_ldpc_message_##SUFFIX(q->ptr, message, q->liftK);                                                          \
     return q->max_nof_iter;                                                                                            \
+  }                                                                                                                    \
+                                                                                                                       \
+  static int decode_##SUFFIX(                                                                                          \
+      void* o, const LLR_TYPE* llrs, uint8_t* message, uint32_t cdwd_rm_length, srsran_crc_t* crc)                     \
+  {                                                                                                                    \
+    srsran_ldpc_decoder_t* q = o;                                                                                      \
+                                                                                                                       \
+    init_ldpc_dec_##SUFFIX(q->ptr, llrs, q->ls);                                                                       \
+    return iterate_##SUFFIX(o, message, cdwd_rm_length, crc);                                                          \
   }
 #define LDPC_DECODER_TEMPLATE_FLOOD(LLR_TYPE, SUFFIX)                                                                  \
   static int decode_##SUFFIX(                                                                                          \
@@ -258,7 +266,9 @@ static int init_c(srsran_ldpc_decoder_t* q)
     return -1;
   }
 
-  q->decode_c = decode_c;
+  q->decode_c         = decode_c;
+  q->init_inplace_c   = init_ldpc_dec_inplace_c;
+  q->decode_inplace_c = iterate_c;
 
   return 0;
 }
@@ -292,10 +302,16 @@ static int init_c_flood(srsran_ldpc_decoder_t* q)
 
   q->decode_c = decode_c_flood;
 
+  // Flooded decoders are loaded in place through an intermediate LLR buffer
+  if ((q->inplace_llrs = srsran_vec_i8_malloc(q->liftN)) == NULL) {
+    free_dec_c_flood(q);
+    return -1;
+  }
+
   return 0;
 }
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
 /*! Carries out the actual destruction of the memory allocated to the decoder, 8-bit-LLR case (AVX2 implementation). */
 static void free_dec_c_avx2(void* o)
 {
@@ -323,7 +339,9 @@ static int init_c_avx2(srsran_ldpc_decoder_t* q)
     return -1;
   }
 
-  q->decode_c = decode_c_avx2;
+  q->decode_c         = decode_c_avx2;
+  q->init_inplace_c   = init_ldpc_dec_inplace_c_avx2;
+  q->decode_inplace_c = iterate_c_avx2;
 
   return 0;
 }
@@ -356,7 +374,9 @@ static int init_c_avx2long(srsran_ldpc_decoder_t* q)
     return -1;
   }
 
-  q->decode_c = decode_c_avx2long;
+  q->decode_c         = decode_c_avx2long;
+  q->init_inplace_c   = init_ldpc_dec_inplace_c_avx2long;
+  q->decode_inplace_c = iterate_c_avx2long;
 
   return 0;
 }
@@ -391,6 +411,12 @@ static int init_c_avx2_flood(srsran_ldpc_decoder_t* q)
 
   q->decode_c = decode_c_avx2_flood;
 
+  // Flooded decoders are loaded in place through an intermediate LLR buffer
+  if ((q->inplace_llrs = srsran_vec_i8_malloc(q->liftN)) == NULL) {
+    free_dec_c_avx2_flood(q);
+    return -1;
+  }
+
   return 0;
 }
 
@@ -426,13 +452,19 @@ static int init_c_avx2long_flood(srsran_ldpc_decoder_t* q)
 
   q->decode_c = decode_c_avx2long_flood;
 
+  // Flooded decoders are loaded in place through an intermediate LLR buffer
+  if ((q->inplace_llrs = srsran_vec_i8_malloc(q->liftN)) == NULL) {
+    free_dec_c_avx2long_flood(q);
+    return -1;
+  }
+
   return 0;
 }
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
 // AVX512 Declarations
 
-#ifdef LV_HAVE_AVX512
+#ifdef SRSRAN_SIMD_HAVE_AVX512
 
 /*! Carries out the actual destruction of the memory allocated to the decoder, 8-bit-LLR case (AVX512 implementation).
  */
@@ -451,6 +483,75 @@ static void free_dec_c_avx512(void* o)
 /*! Carries out the decoding with 8-bit integer-valued LLRs (AVX512 implementation). */
 LDPC_DECODER_TEMPLATE(int8_t, c_avx512)
 
+/*! Carries out the decoding of several codewords packed side by side in the nodes (AVX512 implementation). */
+static int decode_batch_c_avx512(void*                o,
+                                 const int8_t* const* llrs,
+                                 uint8_t**            messages,
+                                 int*                 results,
+                                 uint32_t             nof_cw,
+                                 uint32_t             cdwd_rm_length,
+                                 srsran_crc_t*        crc)
+{
+  srsran_ldpc_decoder_t* q = o;
+
+  if (init_ldpc_dec_batch_c_avx512(q->ptr, llrs, nof_cw, q->ls) < 0) {
+    return -1;
+  }
+
+  // Same codeword length limits as the single codeword decoder
+  if (cdwd_rm_length > q->liftN - 2 * q->ls) {
+    cdwd_rm_length = q->liftN - 2 * q->ls;
+  }
+  if (cdwd_rm_length < (q->bgK + 2) * q->ls) {
+    cdwd_rm_length = (q->bgK + 2) * q->ls;
+  }
+  if (cdwd_rm_length % q->ls) {
+    cdwd_rm_length = (cdwd_rm_length / q->ls + 1) * q->ls;
+  }
+
+  uint8_t  n_layers    = cdwd_rm_length / q->ls - q->bgK + 2;
+  uint32_t nof_pending = nof_cw;
+  for (uint32_t i = 0; i < nof_cw; i++) {
+    results[i] = 0;
+  }
+
+  for (int i_iteration = 0; i_iteration < q->max_nof_iter && nof_pending > 0; i_iteration++) {
+    for (int i_layer = 0; i_layer < n_layers; i_layer++) {
+      update_ldpc_var_to_check_c_avx512(q->ptr, i_layer);
+
+      uint16_t* this_pcm                   = q->pcm + i_layer * q->bgN;
+      int8_t(*these_var_indices)[MAX_CNCT] = q->var_indices + i_layer;
+
+      update_ldpc_check_to_var_c_avx512(q->ptr, i_layer, this_pcm, these_var_indices);
+      update_ldpc_soft_bits_c_avx512(q->ptr, i_layer, these_var_indices);
+    }
+
+    // Codewords keep the message of the first iteration that matches the CRC
+    if (crc != NULL) {
+      for (uint32_t i = 0; i < nof_cw; i++) {
+        if (results[i] != 0) {
+          continue;
+        }
+        extract_ldpc_message_batch_c_avx512(q->ptr, messages[i], q->liftK, i);
+        if (srsran_crc_match(crc, messages[i], q->liftK - crc->order)) {
+          results[i] = i_iteration + 1;
+          nof_pending--;
+        }
+      }
+    }
+  }
+
+  // Without CRC, extract messages and return the maximum number of iterations
+  if (crc == NULL) {
+    for (uint32_t i = 0; i < nof_cw; i++) {
+      extract_ldpc_message_batch_c_avx512(q->ptr, messages[i], q->liftK, i);
+      results[i] = q->max_nof_iter;
+    }
+  }
+
+  return 0;
+}
+
 /*! Initializes the decoder to work with 8-bit integer-valued LLRs (AVX512 implementation). */
 static int init_c_avx512(srsran_ldpc_decoder_t* q)
 {
@@ -462,7 +563,15 @@ static int init_c_avx512(srsran_ldpc_decoder_t* q)
     return -1;
   }
 
-  q->decode_c = decode_c_avx512;
+  q->decode_c         = decode_c_avx512;
+  q->init_inplace_c   = init_ldpc_dec_inplace_c_avx512;
+  q->decode_inplace_c = iterate_c_avx512;
+
+  // Short lifting sizes leave most of the lanes empty, fill them with other codewords
+  if (SRSRAN_AVX512_B_SIZE / q->ls > 1) {
+    q->batch_size     = SRSRAN_AVX512_B_SIZE / q->ls;
+    q->decode_batch_c = decode_batch_c_avx512;
+  }
 
   return 0;
 }
@@ -495,7 +604,9 @@ static int init_c_avx512long(srsran_ldpc_decoder_t* q)
     return -1;
   }
 
-  q->decode_c = decode_c_avx512long;
+  q->decode_c         = decode_c_avx512long;
+  q->init_inplace_c   = init_ldpc_dec_inplace_c_avx512long;
+  q->decode_inplace_c = iterate_c_avx512long;
 
   return 0;
 }
@@ -532,10 +643,31 @@ static int init_c_avx512long_flood(srsran_ldpc_decoder_t* q)
 
   q->decode_c = decode_c_avx512long_flood;
 
+  // Flooded decoders are loaded in place through an intermediate LLR buffer
+  if ((q->inplace_llrs = srsran_vec_i8_malloc(q->liftN)) == NULL) {
+    free_dec_c_avx512long_flood(q);
+    return -1;
+  }
+
   return 0;
 }
 
-#endif // LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX512
+
+/*! Checks that the SIMD ISA selected at runtime can run the given decoder type. */
+static bool ldpc_decoder_type_enabled(srsran_ldpc_decoder_type_t type)
+{
+  switch (type) {
+    case SRSRAN_LDPC_DECODER_C_AVX2:
+    case SRSRAN_LDPC_DECODER_C_AVX2_FLOOD:
+      return srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2);
+    case SRSRAN_LDPC_DECODER_C_AVX512:
+    case SRSRAN_LDPC_DECODER_C_AVX512_FLOOD:
+      return srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX512);
+    default:
+      return true;
+  }
+}
 
 int srsran_ldpc_decoder_init(srsran_ldpc_decoder_t* q, const srsran_ldpc_decoder_args_t* args)
 {
@@ -555,6 +687,11 @@ int srsran_ldpc_decoder_init(srsran_ldpc_decoder_t* q, const srsran_ldpc_decoder
     return -1;
   }
 
+  if (!ldpc_decoder_type_enabled(type)) {
+    ERROR("Decoder %d not supported by the selected SIMD ISA", type);
+    return -1;
+  }
+
   switch (bg) {
     case BG1:
       q->bgN = BG1Nfull;
@@ -606,6 +743,15 @@ int srsran_ldpc_decoder_init(srsran_ldpc_decoder_t* q, const srsran_ldpc_decoder
   }
   q->scaling_fctr = scaling_fctr;
 
+  // Only the layered 8-bit decoders can be loaded in place
+  q->init_inplace_c   = NULL;
+  q->decode_inplace_c = NULL;
+  q->inplace_llrs     = NULL;
+
+  // Only the AVX512 decoder for short lifting sizes decodes several codewords at once
+  q->batch_size     = 1;
+  q->decode_batch_c = NULL;
+
   switch (type) {
     case SRSRAN_LDPC_DECODER_F:
       return init_f(q);
@@ -615,7 +761,7 @@ int srsran_ldpc_decoder_init(srsran_ldpc_decoder_t* q, const srsran_ldpc_decoder
       return init_c(q);
     case SRSRAN_LDPC_DECODER_C_FLOOD:
       return init_c_flood(q);
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
     case SRSRAN_LDPC_DECODER_C_AVX2:
       if (ls <= SRSRAN_AVX2_B_SIZE) {
         return init_c_avx2(q);
@@ -628,8 +774,8 @@ int srsran_ldpc_decoder_init(srsran_ldpc_decoder_t* q, const srsran_ldpc_decoder
       } else {
         return init_c_avx2long_flood(q);
       }
-#endif // LV_HAVE_AVX2
-#ifdef LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX512
     case SRSRAN_LDPC_DECODER_C_AVX512:
       if (ls <= SRSRAN_AVX512_B_SIZE) {
         return init_c_avx512(q);
@@ -638,7 +784,7 @@ int srsran_ldpc_decoder_init(srsran_ldpc_decoder_t* q, const srsran_ldpc_decoder
       }
     case SRSRAN_LDPC_DECODER_C_AVX512_FLOOD:
       return init_c_avx512long_flood(q);
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX512
 
     default:
       ERROR("Unknown decoder.");
@@ -651,6 +797,9 @@ void srsran_ldpc_decoder_free(srsran_ldpc_decoder_t* q)
   if (q->free) {
     q->free(q);
   }
+  if (q->inplace_llrs) {
+    free(q->inplace_llrs);
+  }
   bzero(q, sizeof(srsran_ldpc_decoder_t));
 }
 
@@ -683,3 +832,80 @@ int srsran_ldpc_decoder_decode_crc_c(srsran_ldpc_decoder_t* q,
 {
   return q->decode_c(q, llrs, message, cdwd_rm_length, crc);
 }
+
+int8_t* srsran_ldpc_decoder_init_inplace_c(srsran_ldpc_decoder_t* q, uint32_t* node_size)
+{
+  if (q == NULL || node_size == NULL) {
+    return NULL;
+  }
+
+  if (q->init_inplace_c != NULL) {
+    return q->init_inplace_c(q->ptr, node_size);
+  }
+
+  // Otherwise, the LLRs are written in a contiguous buffer and copied when decoding
+  if (q->inplace_llrs == NULL) {
+    return NULL;
+  }
+  srsran_vec_i8_zero(q->inplace_llrs, q->liftN - 2 * q->ls);
+  *node_size = q->ls;
+  return q->inplace_llrs;
+}
+
+int srsran_ldpc_decoder_decode_inplace_c(srsran_ldpc_decoder_t* q,
+                                         uint8_t*               message,
+                                         uint32_t               cdwd_rm_length,
+                                         srsran_crc_t*          crc)
+{
+  if (q == NULL) {
+    return -1;
+  }
+
+  if (q->decode_inplace_c != NULL) {
+    return q->decode_inplace_c(q, message, cdwd_rm_length, crc);
+  }
+
+  if (q->inplace_llrs == NULL) {
+    return -1;
+  }
+  return q->decode_c(q, q->inplace_llrs, message, cdwd_rm_length, crc);
+}
+
+uint32_t srsran_ldpc_decoder_batch_size(const srsran_ldpc_decoder_t* q)
+{
+  if (q == NULL || q->decode_batch_c == NULL) {
+    return 1;
+  }
+  return q->batch_size;
+}
+
+int srsran_ldpc_decoder_decode_batch_c(srsran_ldpc_decoder_t* q,
+                                       const int8_t* const*   llrs,
+                                       uint8_t**              messages,
+                                       int*                   results,
+                                       uint32_t               nof_cw,
+                                       uint32_t               cdwd_rm_length,
+                                       srsran_crc_t*          crc)
+{
+  if (q == NULL || q->decode_c == NULL || llrs == NULL || messages == NULL || results == NULL) {
+    return -1;
+  }
+
+  // Codewords that do not fit in a single batch, or decoders that cannot pack them, are decoded in turns
+  uint32_t batch_size = srsran_ldpc_decoder_batch_size(q);
+  for (uint32_t i = 0; i < nof_cw; i += batch_size) {
+    uint32_t n = SRSRAN_MIN(batch_size, nof_cw - i);
+    if (n > 1) {
+      if (q->decode_batch_c(q, &llrs[i], &messages[i], &results[i], n, cdwd_rm_length, crc) < 0) {
+        return -1;
+      }
+      continue;
+    }
+    results[i] = q->decode_c(q, llrs[i], messages[i], cdwd_rm_length, crc);
+    if (results[i] < 0) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
@@ -37,6 +37,7 @@
 #include "srsran/phy/fec/ldpc/base_graph.h"
 #include "srsran/phy/fec/ldpc/ldpc_encoder.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/vector.h"
 
 /*! Carries out the actual destruction of the memory allocated to the encoder. */
@@ -133,7 +134,7 @@ static int init_c(srsran_ldpc_encoder_t* q)
   return 0;
 }
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
 /*! Carries out the actual destruction of the memory allocated to the encoder. */
 static void free_enc_avx2(void* o)
 {
@@ -320,7 +321,7 @@ static int init_avx2long(srsran_ldpc_encoder_t* q)
 
 #endif
 
-#ifdef LV_HAVE_AVX512
+#ifdef SRSRAN_SIMD_HAVE_AVX512
 
 /*! Carries out the actual destruction of the memory allocated to the encoder. */
 static void free_enc_avx512(void* o)
@@ -508,11 +509,29 @@ static int init_avx512long(srsran_ldpc_encoder_t* q)
 
 #endif
 
+/*! Checks that the SIMD ISA selected at runtime can run the given encoder type. */
+static bool ldpc_encoder_type_enabled(srsran_ldpc_encoder_type_t type)
+{
+  switch (type) {
+    case SRSRAN_LDPC_ENCODER_AVX2:
+      return srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2);
+    case SRSRAN_LDPC_ENCODER_AVX512:
+      return srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX512);
+    default:
+      return true;
+  }
+}
+
 int srsran_ldpc_encoder_init(srsran_ldpc_encoder_t*     q,
                              srsran_ldpc_encoder_type_t type,
                              srsran_basegraph_t         bg,
                              uint16_t                   ls)
 {
+  if (!ldpc_encoder_type_enabled(type)) {
+    ERROR("Encoder %d not supported by the selected SIMD ISA", type);
+    return -1;
+  }
+
   switch (bg) {
     case BG1:
       q->bgN = BG1Nfull;
@@ -547,22 +566,22 @@ int srsran_ldpc_encoder_init(srsran_ldpc_encoder_t*     q,
   switch (type) {
     case SRSRAN_LDPC_ENCODER_C:
       return init_c(q);
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
     case SRSRAN_LDPC_ENCODER_AVX2:
       if (ls <= SRSRAN_AVX2_B_SIZE) {
         return init_avx2(q);
       } else {
         return init_avx2long(q);
       }
-#endif // LV_HAVE_AVX2
-#ifdef LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX512
     case SRSRAN_LDPC_ENCODER_AVX512:
       if (ls <= SRSRAN_AVX512_B_SIZE) {
         return init_avx512(q);
       } else {
         return init_avx512long(q);
       }
-#endif // LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX512
     default:
       return -1;
   }
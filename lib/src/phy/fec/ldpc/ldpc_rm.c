@@ -342,6 +342,26 @@ static void bit_selection_rm_rx_c(const int8_t*  input,
   }
 }
 
+/*!
+ * Copies the rate-dematched codeword bits [ini, end) in the soft bits of the decoder, where each lifted node of ls
+ * bits takes node_size bytes.
+ */
+static void copy_rm_rx_inplace_c(const int8_t*  input,
+                                 int8_t*        soft_bits,
+                                 const uint32_t ini,
+                                 const uint32_t end,
+                                 const uint32_t ls,
+                                 const uint32_t node_size)
+{
+  uint32_t i = ini;
+  while (i < end) {
+    uint32_t offset = i % ls;
+    uint32_t count  = SRSRAN_MIN(ls - offset, end - i);
+    srsran_vec_i8_copy(&soft_bits[(i / ls) * node_size + offset], &input[i], count);
+    i += count;
+  }
+}
+
 /*!
  * Bit interleaver
  */
@@ -704,3 +724,102 @@ int srsran_ldpc_rm_rx_c(srsran_ldpc_rm_t*        q,
   // Return the number of useful LLR
   return (int)SRSRAN_MIN(q->k0 + q->E, q->Ncb);
 }
+
+int srsran_ldpc_rm_rx_inplace_c(srsran_ldpc_rm_t*        q,
+                                srsran_ldpc_decoder_t*   decoder,
+                                const int8_t*            input,
+                                int8_t*                  output,
+                                const uint32_t           E,
+                                const uint32_t           F,
+                                const srsran_basegraph_t bg,
+                                const uint32_t           ls,
+                                const uint8_t            rv,
+                                const srsran_mod_t       mod_type,
+                                const uint32_t           Nref)
+{
+  if (decoder == NULL || input == NULL || output == NULL || decoder->ls != ls || decoder->bg != bg) {
+    return -1;
+  }
+
+  if (init_rm(q, E, F, bg, ls, rv, mod_type, Nref) != 0) {
+    ERROR("Error initializing rate dematcher");
+    return -1;
+  }
+
+  uint32_t node_size = 0;
+  int8_t*  soft_bits = srsran_ldpc_decoder_init_inplace_c(decoder, &node_size);
+  if (soft_bits == NULL) {
+    ERROR("The LDPC decoder does not support in-place loading");
+    return -1;
+  }
+
+  const uint32_t Ncb         = q->Ncb;
+  const uint32_t end_exclude = q->K - 2 * q->ls;
+  const uint32_t ini_exclude = end_exclude - q->F;
+  const uint32_t rows        = q->mod_order;
+  const uint32_t cols        = q->E / rows;
+  const int16_t  infinity7   = (1U << 6U) - 1;
+
+  // set filler bits to INFINITY
+  const long infinity8 = (1U << 7U) - 1;
+  for (uint32_t i = ini_exclude; i < end_exclude; i++) {
+    output[i] = infinity8;
+  }
+
+  // Walk the circular buffer in the order given by the bit deinterleaver, add soft bits in case of repetition and
+  // write the result in both the soft buffer and the decoder
+  uint32_t icwd    = q->k0;
+  uint32_t node    = 0;
+  uint32_t offset  = 0;
+  bool     wrapped = false;
+  bool     jumped  = true;
+  for (uint32_t i = 0; i < rows; i++) {
+    for (uint32_t j = 0; j < cols; j++) {
+      if (icwd >= ini_exclude && icwd < end_exclude) { // avoid filler bits
+        icwd   = end_exclude;
+        jumped = true;
+      }
+      if (icwd >= Ncb) {
+        icwd    = 0;
+        wrapped = true;
+        jumped  = true;
+      }
+      if (jumped) {
+        node   = icwd / ls;
+        offset = icwd % ls;
+        jumped = false;
+      }
+
+      int16_t tmp = (int16_t)output[icwd] + input[j * rows + i];
+      tmp         = SRSRAN_MIN(tmp, infinity7);
+      tmp         = SRSRAN_MAX(tmp, -infinity7);
+
+      output[icwd]                         = (int8_t)tmp;
+      soft_bits[node * node_size + offset] = (int8_t)tmp;
+
+      icwd++;
+      offset++;
+      if (offset == ls) {
+        node++;
+        offset = 0;
+      }
+    }
+  }
+
+  // Load the bits that were not transmitted this time: filler bits, previous redundancy versions and the bits beyond
+  // the limited buffer
+  const uint32_t cdwd_len = decoder->liftN - 2 * decoder->ls;
+  copy_rm_rx_inplace_c(output, soft_bits, ini_exclude, end_exclude, ls, node_size);
+  if (q->E + q->F < Ncb) {
+    if (wrapped) {
+      copy_rm_rx_inplace_c(output, soft_bits, icwd, q->k0, ls, node_size);
+    } else {
+      copy_rm_rx_inplace_c(output, soft_bits, 0, q->k0, ls, node_size);
+      copy_rm_rx_inplace_c(output, soft_bits, icwd, Ncb, ls, node_size);
+    }
+  }
+  copy_rm_rx_inplace_c(output, soft_bits, Ncb, cdwd_len, ls, node_size);
+
+  // Return the number of useful LLR
+  return (int)SRSRAN_MIN(q->k0 + q->E, q->Ncb);
+}
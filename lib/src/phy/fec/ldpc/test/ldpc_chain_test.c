@@ -61,6 +61,7 @@
 #include "srsran/phy/fec/ldpc/ldpc_encoder.h"
 #include "srsran/phy/utils/debug.h"
 #include "srsran/phy/utils/random.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/vector.h"
 
 static srsran_basegraph_t base_graph = BG1; /*!< \brief Base Graph (BG1 or BG2). */
@@ -156,26 +157,31 @@ int main(int argc, char** argv)
 
   parse_args(argc, argv);
 
+  // The SIMD versions are tested only if the selected instruction set can run them
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  bool avx2 = srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2);
+#endif // SRSRAN_SIMD_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+  bool avx512 = srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX512);
+#endif // SRSRAN_SIMD_HAVE_AVX512
+
   // create an LDPC encoder
-  srsran_ldpc_encoder_t encoder;
-#ifdef LV_HAVE_AVX512
-  if (srsran_ldpc_encoder_init(&encoder, SRSRAN_LDPC_ENCODER_AVX512, base_graph, lift_size) != 0) {
-    perror("encoder init");
-    exit(-1);
+  srsran_ldpc_encoder_t      encoder;
+  srsran_ldpc_encoder_type_t encoder_type = SRSRAN_LDPC_ENCODER_C;
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (avx2) {
+    encoder_type = SRSRAN_LDPC_ENCODER_AVX2;
   }
-#else
-#ifdef LV_HAVE_AVX2
-  if (srsran_ldpc_encoder_init(&encoder, SRSRAN_LDPC_ENCODER_AVX2, base_graph, lift_size) != 0) {
-    perror("encoder init");
-    exit(-1);
+#endif // SRSRAN_SIMD_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+  if (avx512) {
+    encoder_type = SRSRAN_LDPC_ENCODER_AVX512;
   }
-#else // no AVX2
-  if (srsran_ldpc_encoder_init(&encoder, SRSRAN_LDPC_ENCODER_C, base_graph, lift_size) != 0) {
+#endif // SRSRAN_SIMD_HAVE_AVX512
+  if (srsran_ldpc_encoder_init(&encoder, encoder_type, base_graph, lift_size) != 0) {
     perror("encoder init");
     exit(-1);
   }
-#endif // LV_HAVE_AVX2
-#endif // LV_HAVE_AVX512
 
   // Create LDPC configuration arguments
   srsran_ldpc_decoder_args_t decoder_args = {};
@@ -211,41 +217,45 @@ int main(int argc, char** argv)
     perror("decoder init");
     exit(-1);
   }
-#ifdef LV_HAVE_AVX2
-  // create an LDPC decoder (8 bit, AVX2 version)
-  srsran_ldpc_decoder_t decoder_avx;
-  decoder_args.type = SRSRAN_LDPC_DECODER_C_AVX2;
-  if (srsran_ldpc_decoder_init(&decoder_avx, &decoder_args) != 0) {
-    perror("decoder init");
-    exit(-1);
-  }
-
-  // create an LDPC decoder (8 bit, flooded scheduling, AVX2 version)
-  srsran_ldpc_decoder_t decoder_avx_flood;
-  decoder_args.type = SRSRAN_LDPC_DECODER_C_AVX2_FLOOD;
-  if (srsran_ldpc_decoder_init(&decoder_avx_flood, &decoder_args) != 0) {
-    perror("decoder init");
-    exit(-1);
-  }
-#endif // LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  srsran_ldpc_decoder_t decoder_avx       = {};
+  srsran_ldpc_decoder_t decoder_avx_flood = {};
+  if (avx2) {
+    // create an LDPC decoder (8 bit, AVX2 version)
+    decoder_args.type = SRSRAN_LDPC_DECODER_C_AVX2;
+    if (srsran_ldpc_decoder_init(&decoder_avx, &decoder_args) != 0) {
+      perror("decoder init");
+      exit(-1);
+    }
 
-#ifdef LV_HAVE_AVX512
-  // create an LDPC decoder (8 bit, AVX512 version)
-  srsran_ldpc_decoder_t decoder_avx512;
-  decoder_args.type = SRSRAN_LDPC_DECODER_C_AVX512;
-  if (srsran_ldpc_decoder_init(&decoder_avx512, &decoder_args) != 0) {
-    perror("decoder init");
-    exit(-1);
+    // create an LDPC decoder (8 bit, flooded scheduling, AVX2 version)
+    decoder_args.type = SRSRAN_LDPC_DECODER_C_AVX2_FLOOD;
+    if (srsran_ldpc_decoder_init(&decoder_avx_flood, &decoder_args) != 0) {
+      perror("decoder init");
+      exit(-1);
+    }
   }
+#endif // SRSRAN_SIMD_HAVE_AVX2
+
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+  srsran_ldpc_decoder_t decoder_avx512       = {};
+  srsran_ldpc_decoder_t decoder_avx512_flood = {};
+  if (avx512) {
+    // create an LDPC decoder (8 bit, AVX512 version)
+    decoder_args.type = SRSRAN_LDPC_DECODER_C_AVX512;
+    if (srsran_ldpc_decoder_init(&decoder_avx512, &decoder_args) != 0) {
+      perror("decoder init");
+      exit(-1);
+    }
 
-  // create an LDPC decoder (8 bit, flooded scheduling, AVX512 version)
-  srsran_ldpc_decoder_t decoder_avx512_flood;
-  decoder_args.type = SRSRAN_LDPC_DECODER_C_AVX512_FLOOD;
-  if (srsran_ldpc_decoder_init(&decoder_avx512_flood, &decoder_args) != 0) {
-    perror("decoder init");
-    exit(-1);
+    // create an LDPC decoder (8 bit, flooded scheduling, AVX512 version)
+    decoder_args.type = SRSRAN_LDPC_DECODER_C_AVX512_FLOOD;
+    if (srsran_ldpc_decoder_init(&decoder_avx512_flood, &decoder_args) != 0) {
+      perror("decoder init");
+      exit(-1);
+    }
   }
-#endif // LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX512
   // create a random generator
   srsran_random_t random_gen = srsran_random_init(0);
 
@@ -310,18 +320,18 @@ int main(int argc, char** argv)
   int            n_error_words_c          = 0;
   int            n_error_words_c_flood    = 0;
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
   double elapsed_time_dec_avx       = 0;
   double elapsed_time_dec_avx_flood = 0;
   int    n_error_words_avx          = 0;
   int    n_error_words_avx_flood    = 0;
-#endif // LV_HAVE_AVX2
-#ifdef LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX512
   double elapsed_time_dec_avx512       = 0;
   int    n_error_words_avx512          = 0;
   double elapsed_time_dec_avx512_flood = 0;
   int    n_error_words_avx512_flood    = 0;
-#endif // lV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX512
 
   float noise_var     = srsran_convert_dB_to_power(-snr);
   float noise_std_dev = srsran_convert_dB_to_amplitude(-snr);
@@ -482,96 +492,102 @@ int main(int argc, char** argv)
       }
     }
 
-#ifdef LV_HAVE_AVX2
-    //////// Fixed point - 8 bit - AVX2 version
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+    if (avx2) {
+      //////// Fixed point - 8 bit - AVX2 version
 
-    // Recover messages
-    gettimeofday(&t[1], NULL);
-    for (j = 0; j < batch_size; j++) {
-      srsran_ldpc_decoder_decode_c(
-          &decoder_avx, symbols_c + j * finalN, messages_sim_avx + j * finalK, n_useful_symbols);
-    }
-    gettimeofday(&t[2], NULL);
-    get_time_interval(t);
-    elapsed_time_dec_avx += t[0].tv_sec + 1e-6 * t[0].tv_usec;
-
-    for (i = 0; i < batch_size; i++) {
-      for (j = 0; j < finalK; j++) {
-        i_bit = i * finalK + j;
-        if (messages_sim_avx[i_bit] != (1U & messages_true[i_bit])) {
-          n_error_words_avx++;
-          break;
+      // Recover messages
+      gettimeofday(&t[1], NULL);
+      for (j = 0; j < batch_size; j++) {
+        srsran_ldpc_decoder_decode_c(
+            &decoder_avx, symbols_c + j * finalN, messages_sim_avx + j * finalK, n_useful_symbols);
+      }
+      gettimeofday(&t[2], NULL);
+      get_time_interval(t);
+      elapsed_time_dec_avx += t[0].tv_sec + 1e-6 * t[0].tv_usec;
+
+      for (i = 0; i < batch_size; i++) {
+        for (j = 0; j < finalK; j++) {
+          i_bit = i * finalK + j;
+          if (messages_sim_avx[i_bit] != (1U & messages_true[i_bit])) {
+            n_error_words_avx++;
+            break;
+          }
         }
       }
-    }
 
-    //////// Fixed point - 8 bit, flooded scheduling - AVX2 version
+      //////// Fixed point - 8 bit, flooded scheduling - AVX2 version
 
-    // Recover messages
-    gettimeofday(&t[1], NULL);
-    for (j = 0; j < batch_size; j++) {
-      srsran_ldpc_decoder_decode_c(
-          &decoder_avx_flood, symbols_c + j * finalN, messages_sim_avx_flood + j * finalK, n_useful_symbols);
-    }
-    gettimeofday(&t[2], NULL);
-    get_time_interval(t);
-    elapsed_time_dec_avx_flood += t[0].tv_sec + 1e-6 * t[0].tv_usec;
-
-    for (i = 0; i < batch_size; i++) {
-      for (j = 0; j < finalK; j++) {
-        i_bit = i * finalK + j;
-        if (messages_sim_avx_flood[i_bit] != (1U & messages_true[i_bit])) {
-          n_error_words_avx_flood++;
-          break;
+      // Recover messages
+      gettimeofday(&t[1], NULL);
+      for (j = 0; j < batch_size; j++) {
+        srsran_ldpc_decoder_decode_c(
+            &decoder_avx_flood, symbols_c + j * finalN, messages_sim_avx_flood + j * finalK, n_useful_symbols);
+      }
+      gettimeofday(&t[2], NULL);
+      get_time_interval(t);
+      elapsed_time_dec_avx_flood += t[0].tv_sec + 1e-6 * t[0].tv_usec;
+
+      for (i = 0; i < batch_size; i++) {
+        for (j = 0; j < finalK; j++) {
+          i_bit = i * finalK + j;
+          if (messages_sim_avx_flood[i_bit] != (1U & messages_true[i_bit])) {
+            n_error_words_avx_flood++;
+            break;
+          }
         }
       }
     }
-#endif // LV_HAVE_AVX2
-
-#ifdef LV_HAVE_AVX512
-    //////// Fixed point - 8 bit - AVX512 version
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
-    // Recover messages
-    gettimeofday(&t[1], NULL);
-    for (j = 0; j < batch_size; j++) {
-      srsran_ldpc_decoder_decode_c(
-          &decoder_avx512, symbols_c + j * finalN, messages_sim_avx512 + j * finalK, n_useful_symbols);
-    }
-    gettimeofday(&t[2], NULL);
-    get_time_interval(t);
-    elapsed_time_dec_avx512 += t[0].tv_sec + 1e-6 * t[0].tv_usec;
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+    if (avx512) {
+      //////// Fixed point - 8 bit - AVX512 version
 
-    for (i = 0; i < batch_size; i++) {
-      for (j = 0; j < finalK; j++) {
-        i_bit = i * finalK + j;
-        if (messages_sim_avx512[i_bit] != (1U & messages_true[i_bit])) {
-          n_error_words_avx512++;
-          break;
+      // Recover messages
+      gettimeofday(&t[1], NULL);
+      for (j = 0; j < batch_size; j++) {
+        srsran_ldpc_decoder_decode_c(
+            &decoder_avx512, symbols_c + j * finalN, messages_sim_avx512 + j * finalK, n_useful_symbols);
+      }
+      gettimeofday(&t[2], NULL);
+      get_time_interval(t);
+      elapsed_time_dec_avx512 += t[0].tv_sec + 1e-6 * t[0].tv_usec;
+
+      for (i = 0; i < batch_size; i++) {
+        for (j = 0; j < finalK; j++) {
+          i_bit = i * finalK + j;
+          if (messages_sim_avx512[i_bit] != (1U & messages_true[i_bit])) {
+            n_error_words_avx512++;
+            break;
+          }
         }
       }
-    }
 
-    //////// Fixed point - 8 bit, flooded scheduling - AVX512 version
-    // Recover messages
-    gettimeofday(&t[1], NULL);
-    for (j = 0; j < batch_size; j++) {
-      srsran_ldpc_decoder_decode_c(
-          &decoder_avx512_flood, symbols_c + j * finalN, messages_sim_avx512_flood + j * finalK, n_useful_symbols);
-    }
-    gettimeofday(&t[2], NULL);
-    get_time_interval(t);
-    elapsed_time_dec_avx512_flood += t[0].tv_sec + 1e-6 * t[0].tv_usec;
-
-    for (i = 0; i < batch_size; i++) {
-      for (j = 0; j < finalK; j++) {
-        i_bit = i * finalK + j;
-        if (messages_sim_avx512_flood[i_bit] != (1U & messages_true[i_bit])) {
-          n_error_words_avx512_flood++;
-          break;
+      //////// Fixed point - 8 bit, flooded scheduling - AVX512 version
+      // Recover messages
+      gettimeofday(&t[1], NULL);
+      for (j = 0; j < batch_size; j++) {
+        srsran_ldpc_decoder_decode_c(&decoder_avx512_flood,
+                                     symbols_c + j * finalN,
+                                     messages_sim_avx512_flood + j * finalK,
+                                     n_useful_symbols);
+      }
+      gettimeofday(&t[2], NULL);
+      get_time_interval(t);
+      elapsed_time_dec_avx512_flood += t[0].tv_sec + 1e-6 * t[0].tv_usec;
+
+      for (i = 0; i < batch_size; i++) {
+        for (j = 0; j < finalK; j++) {
+          i_bit = i * finalK + j;
+          if (messages_sim_avx512_flood[i_bit] != (1U & messages_true[i_bit])) {
+            n_error_words_avx512_flood++;
+            break;
+          }
         }
       }
     }
-#endif // LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX512
   }
 
   printf("\nEstimated throughput encoder:\n  %e word/s\n  %e bit/s (information)\n  %e bit/s (encoded)\n",
@@ -584,20 +600,26 @@ int main(int argc, char** argv)
   print_decoder("FIXED POINT (8 bits)", i_batch, n_error_words_c, elapsed_time_dec_c);
   print_decoder("FIXED POINT (8 bits, flooded scheduling)", i_batch, n_error_words_c_flood, elapsed_time_dec_c_flood);
 
-#ifdef LV_HAVE_AVX2
-  print_decoder("FIXED POINT (8 bits - AVX2)", i_batch, n_error_words_avx, elapsed_time_dec_avx);
-  print_decoder(
-      "FIXED POINT (8 bits, flooded scheduling - AVX2)", i_batch, n_error_words_avx_flood, elapsed_time_dec_avx_flood);
-#endif // LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (avx2) {
+    print_decoder("FIXED POINT (8 bits - AVX2)", i_batch, n_error_words_avx, elapsed_time_dec_avx);
+    print_decoder("FIXED POINT (8 bits, flooded scheduling - AVX2)",
+                  i_batch,
+                  n_error_words_avx_flood,
+                  elapsed_time_dec_avx_flood);
+  }
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
-#ifdef LV_HAVE_AVX512
-  print_decoder("FIXED POINT (8 bits - AVX512)", i_batch, n_error_words_avx512, elapsed_time_dec_avx512);
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+  if (avx512) {
+    print_decoder("FIXED POINT (8 bits - AVX512)", i_batch, n_error_words_avx512, elapsed_time_dec_avx512);
 
-  print_decoder("FIXED POINT (8 bits, flooded scheduling - AVX512)",
-                i_batch,
-                n_error_words_avx512_flood,
-                elapsed_time_dec_avx512_flood);
-#endif // LV_HAVE_AVX512
+    print_decoder("FIXED POINT (8 bits, flooded scheduling - AVX512)",
+                  i_batch,
+                  n_error_words_avx512_flood,
+                  elapsed_time_dec_avx512_flood);
+  }
+#endif // SRSRAN_SIMD_HAVE_AVX512
 
   if (n_error_words_s > 10 * n_error_words_f) {
     perror("16-bit performance too low!");
@@ -607,17 +629,19 @@ int main(int argc, char** argv)
     perror("8-bit performance too low!");
     exit(-1);
   }
-#ifdef LV_HAVE_AVX512
-  if (n_error_words_avx512 != n_error_words_avx) {
-    perror("The number of errors AVX512 and AVX2 differs !");
-    exit(-1);
-  }
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+  if (avx512) {
+    if (n_error_words_avx512 != n_error_words_avx) {
+      perror("The number of errors AVX512 and AVX2 differs !");
+      exit(-1);
+    }
 
-  if (n_error_words_avx512_flood != n_error_words_avx_flood) {
-    perror("The number of errors of flood AVX512 and AVX2 differs !");
-    exit(-1);
+    if (n_error_words_avx512_flood != n_error_words_avx_flood) {
+      perror("The number of errors of flood AVX512 and AVX2 differs !");
+      exit(-1);
+    }
   }
-#endif // LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX512
   printf("\nTest completed successfully!\n\n");
 
   free(symbols_c);
@@ -635,14 +659,14 @@ int main(int argc, char** argv)
   free(messages_sim_f);
   free(messages_true);
   srsran_random_free(random_gen);
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
   srsran_ldpc_decoder_free(&decoder_avx);
   srsran_ldpc_decoder_free(&decoder_avx_flood);
-#endif // LV_HAVE_AVX2
-#ifdef LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX512
   srsran_ldpc_decoder_free(&decoder_avx512);
   srsran_ldpc_decoder_free(&decoder_avx512_flood);
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX512
   srsran_ldpc_decoder_free(&decoder_c_flood);
   srsran_ldpc_decoder_free(&decoder_c);
   srsran_ldpc_decoder_free(&decoder_s);
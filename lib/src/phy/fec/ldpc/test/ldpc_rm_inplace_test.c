@@ -0,0 +1,240 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*!
+ * \file ldpc_rm_inplace_test.c
+ * \brief Checks the fused rate-dematcher against the rate-dematcher followed by the decoder.
+ *
+ * For every base graph, lifting size, modulation and limited buffer size, a sequence of redundancy versions with
+ * random LLRs is rate-dematched and decoded in two ways: with srsran_ldpc_rm_rx_c() followed by
+ * srsran_ldpc_decoder_decode_c(), and with srsran_ldpc_rm_rx_inplace_c() followed by
+ * srsran_ldpc_decoder_decode_inplace_c(). The soft buffers and the decoded messages must be identical for all the
+ * 8-bit decoders.
+ *
+ * Synopsis: **ldpc_rm_inplace_test [options]**
+ *
+ * Options:
+ *  - **-b \<number\>** Base Graph (1 or 2, 0 for both. Default 0).
+ *  - **-l \<number\>** Lifting Size (0 for a selection of lifting sizes. Default 0).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "srsran/phy/fec/ldpc/ldpc_decoder.h"
+#include "srsran/phy/fec/ldpc/ldpc_rm.h"
+#include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/random.h"
+#include "srsran/phy/utils/simd_dispatch.h"
+#include "srsran/phy/utils/vector.h"
+#include "srsran/support/srsran_test.h"
+
+#define NOF_RV 4
+#define NOF_FILLER 10
+#define MS_SF 0.75f
+
+static uint32_t base_graph = 0; /*!< \brief Base Graph (1 or 2), 0 for both. */
+static uint32_t lift_size  = 0; /*!< \brief Lifting Size, 0 for a selection of them. */
+
+static const uint32_t     lifting_sizes[] = {2, 7, 36, 64, 104, 208};
+static const uint32_t     rv_sequence[]   = {0, 2, 3, 1};
+static const srsran_mod_t modulations[]   = {SRSRAN_MOD_BPSK, SRSRAN_MOD_QPSK, SRSRAN_MOD_64QAM};
+
+/*!
+ * \brief Decoder types under test and the instruction set each of them needs.
+ */
+static const struct {
+  srsran_ldpc_decoder_type_t type;
+  srsran_simd_isa_t          isa;
+} decoder_types[] = {
+    {SRSRAN_LDPC_DECODER_C, SRSRAN_SIMD_ISA_GENERIC},
+    {SRSRAN_LDPC_DECODER_C_FLOOD, SRSRAN_SIMD_ISA_GENERIC},
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+    {SRSRAN_LDPC_DECODER_C_AVX2, SRSRAN_SIMD_ISA_AVX2},
+    {SRSRAN_LDPC_DECODER_C_AVX2_FLOOD, SRSRAN_SIMD_ISA_AVX2},
+#endif // SRSRAN_SIMD_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+    {SRSRAN_LDPC_DECODER_C_AVX512, SRSRAN_SIMD_ISA_AVX512},
+    {SRSRAN_LDPC_DECODER_C_AVX512_FLOOD, SRSRAN_SIMD_ISA_AVX512},
+#endif // SRSRAN_SIMD_HAVE_AVX512
+};
+
+#define NOF_DECODER_TYPES (sizeof(decoder_types) / sizeof(decoder_types[0]))
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [-bX] [-lX]\n", prog);
+  printf("\t-b Base Graph [(1 or 2), 0 for both. Default %d]\n", base_graph);
+  printf("\t-l Lifting Size [0 for a selection of lifting sizes. Default %d]\n", lift_size);
+}
+
+static int parse_args(int argc, char** argv)
+{
+  int opt = 0;
+  while ((opt = getopt(argc, argv, "b:l:")) != -1) {
+    switch (opt) {
+      case 'b':
+        base_graph = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      case 'l':
+        lift_size = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        return SRSRAN_ERROR;
+    }
+  }
+  return SRSRAN_SUCCESS;
+}
+
+static int test_case(srsran_random_t          random_gen,
+                     srsran_ldpc_decoder_t*   decoder,
+                     srsran_ldpc_rm_t*        rm_ref,
+                     srsran_ldpc_rm_t*        rm_inplace,
+                     const srsran_basegraph_t bg,
+                     const uint32_t           ls,
+                     const srsran_mod_t       mod,
+                     const uint32_t           E,
+                     const uint32_t           Nref)
+{
+  uint32_t N       = decoder->liftN - 2 * ls;
+  int8_t*  llr     = srsran_vec_i8_malloc(E);
+  int8_t*  harq    = srsran_vec_i8_malloc(N);
+  int8_t*  harq_rm = srsran_vec_i8_malloc(N);
+  uint8_t* msg     = srsran_vec_u8_malloc(decoder->liftK);
+  uint8_t* msg_rm  = srsran_vec_u8_malloc(decoder->liftK);
+  TESTASSERT(llr && harq && harq_rm && msg && msg_rm);
+
+  srsran_vec_i8_zero(harq, N);
+  srsran_vec_i8_zero(harq_rm, N);
+
+  for (uint32_t i = 0; i < NOF_RV; i++) {
+    for (uint32_t j = 0; j < E; j++) {
+      llr[j] = (int8_t)srsran_random_uniform_int_dist(random_gen, -40, 40);
+    }
+
+    uint32_t rv    = rv_sequence[i];
+    int      n_llr = srsran_ldpc_rm_rx_c(rm_ref, llr, harq, E, NOF_FILLER, bg, ls, rv, mod, Nref);
+    int      n_llr_rm =
+        srsran_ldpc_rm_rx_inplace_c(rm_inplace, decoder, llr, harq_rm, E, NOF_FILLER, bg, ls, rv, mod, Nref);
+    TESTASSERT(n_llr == n_llr_rm);
+    TESTASSERT(memcmp(harq, harq_rm, N) == 0);
+
+    int ret_rm = srsran_ldpc_decoder_decode_inplace_c(decoder, msg_rm, n_llr_rm, NULL);
+    int ret    = srsran_ldpc_decoder_decode_crc_c(decoder, harq, msg, n_llr, NULL);
+    TESTASSERT(ret == ret_rm);
+    TESTASSERT(memcmp(msg, msg_rm, decoder->liftK) == 0);
+  }
+
+  free(llr);
+  free(harq);
+  free(harq_rm);
+  free(msg);
+  free(msg_rm);
+
+  return SRSRAN_SUCCESS;
+}
+
+static int test_lifting_size(srsran_random_t random_gen, srsran_basegraph_t bg, uint32_t ls)
+{
+  srsran_ldpc_rm_t rm_ref     = {};
+  srsran_ldpc_rm_t rm_inplace = {};
+  TESTASSERT(srsran_ldpc_rm_rx_init_c(&rm_ref) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_ldpc_rm_rx_init_c(&rm_inplace) == SRSRAN_SUCCESS);
+
+  for (uint32_t t = 0; t < NOF_DECODER_TYPES; t++) {
+    // Skip the SIMD decoders that the selected instruction set can not run
+    if (!srsran_simd_isa_enabled(decoder_types[t].isa)) {
+      continue;
+    }
+
+    srsran_ldpc_decoder_t      decoder      = {};
+    srsran_ldpc_decoder_args_t decoder_args = {};
+    decoder_args.type                       = decoder_types[t].type;
+    decoder_args.bg                         = bg;
+    decoder_args.ls                         = ls;
+    decoder_args.scaling_fctr               = MS_SF;
+    TESTASSERT(srsran_ldpc_decoder_init(&decoder, &decoder_args) == SRSRAN_SUCCESS);
+
+    uint32_t N = decoder.liftN - 2 * ls;
+    for (uint32_t m = 0; m < sizeof(modulations) / sizeof(modulations[0]); m++) {
+      srsran_mod_t mod = modulations[m];
+      uint32_t     Qm  = srsran_mod_bits_x_symbol(mod);
+      for (uint32_t n = 0; n < 2; n++) {
+        uint32_t Nref = (n == 0) ? N : N / 2;
+
+        // High code rate, low code rate and repetition
+        uint32_t E_list[3] = {(decoder.liftK / 2) / Qm * Qm, (2 * N) / 3 / Qm * Qm, (3 * N) / 2 / Qm * Qm};
+        for (uint32_t e = 0; e < 3; e++) {
+          if (test_case(random_gen, &decoder, &rm_ref, &rm_inplace, bg, ls, mod, E_list[e], Nref) != SRSRAN_SUCCESS) {
+            ERROR("Failed decoder=%d; bg=%d; ls=%d; mod=%d; E=%d; Nref=%d",
+                  decoder_types[t].type,
+                  bg + 1,
+                  ls,
+                  mod,
+                  E_list[e],
+                  Nref);
+            return SRSRAN_ERROR;
+          }
+        }
+      }
+    }
+
+    srsran_ldpc_decoder_free(&decoder);
+  }
+
+  srsran_ldpc_rm_rx_free_c(&rm_ref);
+  srsran_ldpc_rm_rx_free_c(&rm_inplace);
+
+  return SRSRAN_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  int             ret        = SRSRAN_SUCCESS;
+  srsran_random_t random_gen = srsran_random_init(0);
+
+  if (parse_args(argc, argv) < SRSRAN_SUCCESS) {
+    srsran_random_free(random_gen);
+    return SRSRAN_ERROR;
+  }
+
+  for (uint32_t bg = BG1; bg <= BG2 && ret == SRSRAN_SUCCESS; bg++) {
+    if (base_graph != 0 && base_graph != bg + 1) {
+      continue;
+    }
+    for (uint32_t i = 0; i < sizeof(lifting_sizes) / sizeof(lifting_sizes[0]) && ret == SRSRAN_SUCCESS; i++) {
+      uint32_t ls = (lift_size != 0) ? lift_size : lifting_sizes[i];
+      ret         = test_lifting_size(random_gen, (srsran_basegraph_t)bg, ls);
+      printf("BG%d; ls=%3d; %s\n", bg + 1, ls, ret == SRSRAN_SUCCESS ? "OK" : "KO");
+      if (lift_size != 0) {
+        break;
+      }
+    }
+  }
+
+  srsran_random_free(random_gen);
+
+  printf("%s\n", ret == SRSRAN_SUCCESS ? "Ok" : "Error");
+  return ret;
+}
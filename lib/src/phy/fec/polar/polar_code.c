@@ -34,8 +34,10 @@
  */
 
 #include "srsran/phy/utils/vector.h"
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "srsran/phy/fec/polar/polar_code.h"
 #include "srsran/phy/utils/debug.h"
@@ -196,6 +198,7 @@ void srsran_polar_code_free(srsran_polar_code_t* c)
   if (c != NULL) {
     free(c->F_set);
     free(c->tmp_K_set); // also removes K_set
+    free(c->node_type);
   }
 }
 
@@ -215,6 +218,14 @@ int srsran_polar_code_init(srsran_polar_code_t* c)
     exit(-1);
   }
 
+  c->node_type = srsran_vec_u8_malloc(2 * NMAX);
+  if (!c->node_type) {
+    free(c->F_set);
+    free(c->tmp_K_set);
+    perror("malloc");
+    exit(-1);
+  }
+
   return 0;
 }
 
@@ -308,5 +319,55 @@ int srsran_polar_code_get(srsran_polar_code_t* c, uint16_t K, uint16_t E, uint8_
   c->K_set[c->K + c->nPC] = 1024;
   c->PC_set[c->nPC]       = 1024;
 
+  // decoding tree (used by the Fast-SSC decoder)
+  return srsran_polar_code_node_type(c->F_set, c->F_set_size, n, c->node_type);
+}
+
+int srsran_polar_code_node_type(const uint16_t* frozen_set,
+                                const uint16_t  frozen_set_size,
+                                const uint8_t   n,
+                                uint8_t*        node_type)
+{
+  if (frozen_set == NULL || node_type == NULL || n > NMAX_LOG) {
+    return -1;
+  }
+
+  uint16_t code_size = (1U << n);
+
+  // leaves (stage 0): rate-0 if frozen, rate-1 otherwise
+  memset(node_type, SRSRAN_POLAR_NODE_RATE_1, code_size);
+  for (uint16_t i = 0; i < frozen_set_size; i++) {
+    node_type[frozen_set[i]] = SRSRAN_POLAR_NODE_RATE_0;
+  }
+
+  // every other node is obtained from its two children
+  const uint8_t* child = node_type;
+  uint8_t*       node  = node_type + code_size;
+  for (uint8_t s = 1; s <= n; s++) {
+    uint16_t stage_nof_nodes = (1U << (n - s));
+    for (uint16_t j = 0; j < stage_nof_nodes; j++) {
+      uint8_t left  = child[2 * j];
+      uint8_t right = child[2 * j + 1];
+
+      // at stage 1, a frozen bit followed by an information bit is both a repetition and a parity check node
+      bool right_is_rep = (right == SRSRAN_POLAR_NODE_REP) || (s == 1 && right == SRSRAN_POLAR_NODE_RATE_1);
+      bool left_is_spc  = (left == SRSRAN_POLAR_NODE_SPC) || (s == 2 && left == SRSRAN_POLAR_NODE_REP);
+
+      if (left == SRSRAN_POLAR_NODE_RATE_0 && right == SRSRAN_POLAR_NODE_RATE_0) {
+        node[j] = SRSRAN_POLAR_NODE_RATE_0;
+      } else if (left == SRSRAN_POLAR_NODE_RATE_1 && right == SRSRAN_POLAR_NODE_RATE_1) {
+        node[j] = SRSRAN_POLAR_NODE_RATE_1;
+      } else if (left == SRSRAN_POLAR_NODE_RATE_0 && right_is_rep) {
+        node[j] = SRSRAN_POLAR_NODE_REP;
+      } else if (left_is_spc && right == SRSRAN_POLAR_NODE_RATE_1) {
+        node[j] = SRSRAN_POLAR_NODE_SPC;
+      } else {
+        node[j] = SRSRAN_POLAR_NODE_RATE_R;
+      }
+    }
+    child = node;
+    node += stage_nof_nodes;
+  }
+
   return 0;
 }
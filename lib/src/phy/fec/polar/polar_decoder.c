@@ -37,12 +37,14 @@
 #include <math.h>
 #include <string.h>
 
+#include "polar_decoder_fssc_c.h"
 #include "polar_decoder_ssc_c.h"
 #include "polar_decoder_ssc_c_avx2.h"
 #include "polar_decoder_ssc_f.h"
 #include "polar_decoder_ssc_s.h"
 #include "srsran/phy/fec/polar/polar_decoder.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 
 /*! SSC Polar decoder with float LLR inputs. */
 static int decode_ssc_f(void*           o,
@@ -95,7 +97,7 @@ static int decode_ssc_c(void*           o,
   return 0;
 }
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
 /*! SSC Polar decoder AVX2 with int8_t LLR inputs . */
 static int decode_ssc_c_avx2(void*           o,
                              const int8_t*   symbols,
@@ -112,7 +114,36 @@ static int decode_ssc_c_avx2(void*           o,
 
   return 0;
 }
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
+
+/*! Fast-SSC Polar decoder with int8_t LLR inputs. */
+static int decode_fssc_c(void*           o,
+                         const int8_t*   symbols,
+                         uint8_t*        data,
+                         const uint8_t   n,
+                         const uint16_t* frozen_set,
+                         const uint16_t  frozen_set_size)
+{
+  srsran_polar_decoder_t* q = o;
+
+  if (init_polar_decoder_fssc_c_frozen_set(q->ptr, symbols, data, n, frozen_set, frozen_set_size) != 0) {
+    return -1;
+  }
+
+  return polar_decoder_fssc_c(q->ptr, data);
+}
+
+/*! Fast-SSC Polar decoder with int8_t LLR inputs and the node types of the given code. */
+static int decode_code_fssc_c(void* o, const int8_t* symbols, uint8_t* data, const srsran_polar_code_t* code)
+{
+  srsran_polar_decoder_t* q = o;
+
+  if (init_polar_decoder_fssc_c(q->ptr, symbols, data, code->n, code->node_type) != 0) {
+    return -1;
+  }
+
+  return polar_decoder_fssc_c(q->ptr, data);
+}
 
 /*! Destructor of a (float) SSC polar decoder. */
 static void free_ssc_f(void* o)
@@ -135,7 +166,7 @@ static void free_ssc_c(void* o)
   delete_polar_decoder_ssc_c(q->ptr);
 }
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
 /*! Destructor of a (int8_t, avx2) SSC polar decoder. */
 static void free_ssc_c_avx2(void* o)
 {
@@ -144,6 +175,13 @@ static void free_ssc_c_avx2(void* o)
 }
 #endif
 
+/*! Destructor of a (int8_t) Fast-SSC polar decoder. */
+static void free_fssc_c(void* o)
+{
+  srsran_polar_decoder_t* q = o;
+  delete_polar_decoder_fssc_c(q->ptr);
+}
+
 /*! Initializes a polar decoder structure to use the SSC polar decoder algorithm with float LLR inputs. */
 static int init_ssc_f(srsran_polar_decoder_t* q)
 {
@@ -186,7 +224,7 @@ static int init_ssc_c(srsran_polar_decoder_t* q)
   return 0;
 }
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
 /*! Initializes a polar decoder structure to use the SSC polar decoder algorithm with uint8_t LLR inputs and AVX2
  * instructions. */
 static int init_ssc_c_avx2(srsran_polar_decoder_t* q)
@@ -203,9 +241,25 @@ static int init_ssc_c_avx2(srsran_polar_decoder_t* q)
 }
 #endif
 
+/*! Initializes a polar decoder structure to use the Fast-SSC polar decoder algorithm with uint8_t LLR inputs. */
+static int init_fssc_c(srsran_polar_decoder_t* q)
+{
+  q->decode_c      = decode_fssc_c;
+  q->decode_code_c = decode_code_fssc_c;
+  q->free          = free_fssc_c;
+
+  if ((q->ptr = create_polar_decoder_fssc_c(q->nMax)) == NULL) {
+    ERROR("create_polar_decoder_fssc_c failed");
+    free_fssc_c(q);
+    return -1;
+  }
+  return 0;
+}
+
 int srsran_polar_decoder_init(srsran_polar_decoder_t* q, srsran_polar_decoder_type_t type, const uint8_t nMax)
 {
-  q->nMax = nMax;
+  q->nMax          = nMax;
+  q->decode_code_c = NULL;
   switch (type) {
     case SRSRAN_POLAR_DECODER_SSC_F:
       return init_ssc_f(q);
@@ -213,10 +267,16 @@ int srsran_polar_decoder_init(srsran_polar_decoder_t* q, srsran_polar_decoder_ty
       return init_ssc_s(q);
     case SRSRAN_POLAR_DECODER_SSC_C:
       return init_ssc_c(q);
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
     case SRSRAN_POLAR_DECODER_SSC_C_AVX2:
+      if (!srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2)) {
+        ERROR("Decoder not supported by the selected SIMD ISA");
+        return -1;
+      }
       return init_ssc_c_avx2(q);
 #endif
+    case SRSRAN_POLAR_DECODER_FSSC_C:
+      return init_fssc_c(q);
     default:
       ERROR("Decoder not implemented");
       return -1;
@@ -273,3 +333,19 @@ int srsran_polar_decoder_decode_c(srsran_polar_decoder_t* q,
 
   return -1;
 }
+
+int srsran_polar_decoder_decode_code_c(srsran_polar_decoder_t*    q,
+                                       const int8_t*              llr,
+                                       uint8_t*                   data_decoded,
+                                       const srsran_polar_code_t* code)
+{
+  if (code == NULL || q->nMax < code->n) {
+    return -1;
+  }
+
+  if (q->decode_code_c != NULL) {
+    return q->decode_code_c(q, llr, data_decoded, code);
+  }
+
+  return q->decode_c(q, llr, data_decoded, code->n, code->F_set, code->F_set_size);
+}
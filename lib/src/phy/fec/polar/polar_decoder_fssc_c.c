@@ -0,0 +1,381 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*!
+ * \file polar_decoder_fssc_c.c
+ * \brief Definition of the Fast-SSC polar decoder inner functions working with
+ * 8-bit integer-valued LLRs.
+ *
+ * \copyright Software Radio Systems Limited
+ *
+ * The Fast-SSC decoder walks the same decoding tree as the SSC decoder but, besides rate-0 and rate-1 nodes,
+ * it also decodes repetition (REP) and single parity-check (SPC) nodes in closed form, without visiting their
+ * children. The node types are computed by srsran_polar_code_node_type().
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "polar_decoder_fssc_c.h"
+#include "polar_decoder_vector.h"
+#include "srsran/phy/fec/polar/polar_code.h"
+#include "srsran/phy/fec/polar/polar_encoder.h"
+#include "srsran/phy/utils/simd_dispatch.h"
+#include "srsran/phy/utils/vector.h"
+
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+#include "polar_decoder_vector_avx2.h"
+#endif // SRSRAN_SIMD_HAVE_AVX2
+
+/*!
+ * \brief Describes a Fast-SSC polar decoder (8-bit version).
+ */
+struct pFSSC_c {
+  uint8_t                 nMax;          /*!< \brief \f$log_2\f$ of the maximum code size. */
+  uint8_t                 code_size_log; /*!< \brief \f$log_2\f$ of the current code size. */
+  int8_t**                llr0;          /*!< \brief Pointers to the upper half of LLRs values at all stages. */
+  int8_t**                llr1;          /*!< \brief Pointers to the lower half of LLRs values at all stages. */
+  uint8_t*                est_bit;       /*!< \brief Pointer to the temporary estimated bits. */
+  const uint8_t**         node_type;     /*!< \brief Pointers to the node types at all stages. */
+  uint8_t*                node_type_buf; /*!< \brief Node types computed from a frozen set. */
+  srsran_polar_encoder_t* enc;           /*!< \brief Pointer to a srsran_polar_encoder_t. */
+  bool                    avx2;          /*!< \brief True if the AVX2 functions can be used. */
+};
+
+/*!
+ * Computes \f$ z = sign(x) \times sign(y) \times \min(abs(x), abs(y)) \f$ elementwise, it uses AVX2 instructions
+ * for the stages with at least \ref SRSRAN_AVX2_B_SIZE LLRs per half node. Same output as
+ * srsran_vec_function_f_ccc().
+ */
+static void function_f(const struct pFSSC_c* pp, const int8_t* x, const int8_t* y, int8_t* z, const uint16_t len)
+{
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (pp->avx2 && len >= SRSRAN_AVX2_B_SIZE) {
+    srsran_vec_function_f_ccc_avx2(x, y, z, len);
+    return;
+  }
+#endif // SRSRAN_SIMD_HAVE_AVX2
+  for (uint16_t i = 0; i < len; i++) {
+    int8_t abs_x = (int8_t)abs(x[i]);
+    int8_t abs_y = (int8_t)abs(y[i]);
+    int8_t min   = (abs_x < abs_y) ? abs_x : abs_y;
+    z[i]         = ((x[i] < 0) != (y[i] < 0)) ? -min : min;
+  }
+}
+
+/*!
+ * Returns \f$ z = -x + y \f$ if \f$ (b = 1) \f$ and \f$ z = x + y \f$ if \f$ (b = 0)\f$ saturated to \f$\pm 127\f$,
+ * it uses AVX2 instructions for the stages with at least \ref SRSRAN_AVX2_B_SIZE LLRs per half node. Same output
+ * as srsran_vec_function_g_bccc(); the bits are represented by {0, 1}.
+ */
+static void
+function_g(const struct pFSSC_c* pp, const uint8_t* b, const int8_t* x, const int8_t* y, int8_t* z, const uint16_t len)
+{
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (pp->avx2 && len >= SRSRAN_AVX2_B_SIZE) {
+    srsran_vec_function_g_bccc_01_avx2(b, x, y, z, len);
+    return;
+  }
+#endif // SRSRAN_SIMD_HAVE_AVX2
+  for (uint16_t i = 0; i < len; i++) {
+    int16_t tmp = (int16_t)(b[i] ? y[i] - x[i] : y[i] + x[i]);
+    tmp         = (tmp > 127) ? 127 : tmp;
+    z[i]        = (int8_t)((tmp < -127) ? -127 : tmp);
+  }
+}
+
+/*!
+ * Returns 1 if \f$ (x < 0) \f$ and 0 if \f$ (x >= 0) \f$.
+ */
+static void hard_bit(const int8_t* x, uint8_t* z, const uint16_t len)
+{
+  for (uint16_t i = 0; i < len; i++) {
+    z[i] = (uint8_t)(x[i] < 0);
+  }
+}
+
+/*!
+ * Decodes the node of the decoding tree at stage \f$ s \f$ whose first bit is \a bit_pos. The \f$2^s\f$ LLRs of
+ * the node are read from \a llr0[s] and the associated \f$2^s\f$ estimated bits are written in \a est_bit.
+ */
+static void fast_node(struct pFSSC_c* pp, uint8_t stage, uint16_t bit_pos, uint8_t* message);
+
+void delete_polar_decoder_fssc_c(void* p)
+{
+  struct pFSSC_c* pp = p;
+
+  if (p != NULL) {
+    if (pp->llr0) {
+      free(pp->llr0[0]); // remove LLR buffer.
+      free(pp->llr0);
+    }
+    free(pp->llr1);
+    free(pp->est_bit);
+    free(pp->node_type);
+    free(pp->node_type_buf);
+    if (pp->enc) {
+      srsran_polar_encoder_free(pp->enc);
+      free(pp->enc);
+    }
+    free(pp);
+  }
+}
+
+void* create_polar_decoder_fssc_c(const uint8_t nMax)
+{
+  struct pFSSC_c* pp = NULL; // pointer to the polar decoder instance
+
+  if (nMax > NMAX_LOG) {
+    return NULL;
+  }
+
+  // allocate memory to the polar decoder instance
+  if ((pp = malloc(sizeof(struct pFSSC_c))) == NULL) {
+    return NULL;
+  }
+  SRSRAN_MEM_ZERO(pp, struct pFSSC_c, 1);
+  pp->nMax = nMax;
+
+  // encoder of maximum size
+  if ((pp->enc = SRSRAN_MEM_ALLOC(srsran_polar_encoder_t, 1)) == NULL) {
+    delete_polar_decoder_fssc_c(pp);
+    return NULL;
+  }
+  srsran_polar_encoder_type_t encoder_type = SRSRAN_POLAR_ENCODER_PIPELINED;
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  pp->avx2 = srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2);
+  if (pp->avx2) {
+    encoder_type = SRSRAN_POLAR_ENCODER_AVX2;
+  }
+#endif // SRSRAN_SIMD_HAVE_AVX2
+  if (srsran_polar_encoder_init(pp->enc, encoder_type, nMax) != 0) {
+    free(pp->enc);
+    pp->enc = NULL;
+    delete_polar_decoder_fssc_c(pp);
+    return NULL;
+  }
+
+  // There are LLR buffers for n = 0 to n = code_size_log. Each with size 2^n. Thus,
+  // the total memory needed is 2^(n+1)-1.
+  uint16_t llr_all_stages = 1U << (nMax + 1U);
+
+  pp->est_bit       = srsran_vec_u8_malloc(1U << nMax);
+  pp->node_type_buf = srsran_vec_u8_malloc(llr_all_stages);
+  pp->node_type     = malloc((nMax + 1) * sizeof(uint8_t*));
+  pp->llr0          = malloc((nMax + 1) * sizeof(int8_t*));
+  pp->llr1          = malloc((nMax + 1) * sizeof(int8_t*));
+  if (pp->est_bit == NULL || pp->node_type_buf == NULL || pp->node_type == NULL || pp->llr0 == NULL ||
+      pp->llr1 == NULL) {
+    delete_polar_decoder_fssc_c(pp);
+    return NULL;
+  }
+
+  pp->llr0[0] = srsran_vec_i8_malloc(llr_all_stages);
+  if (pp->llr0[0] == NULL) {
+    delete_polar_decoder_fssc_c(pp);
+    return NULL;
+  }
+
+  // initialize all LLR pointers, the LLRs of a node at stage s are contiguous from llr0[s]
+  pp->llr1[0] = pp->llr0[0] + 1;
+  for (uint8_t s = 1; s < nMax + 1; s++) {
+    pp->llr0[s] = pp->llr0[0] + (1U << s);
+    pp->llr1[s] = pp->llr0[s] + (1U << (s - 1U));
+  }
+
+  return pp;
+}
+
+int init_polar_decoder_fssc_c(void*          p,
+                              const int8_t*  input_llr,
+                              uint8_t*       data_decoded,
+                              const uint8_t  code_size_log,
+                              const uint8_t* node_type)
+{
+  struct pFSSC_c* pp = p;
+
+  if (p == NULL || node_type == NULL || code_size_log > pp->nMax) {
+    return -1;
+  }
+
+  uint16_t code_size = 1U << code_size_log;
+  pp->code_size_log  = code_size_log;
+
+  // Initializes the data_decoded_vector to all zeros
+  memset(data_decoded, 0, code_size);
+
+  // Initializes LLR buffer for the last stage/level with the input LLRs values
+  memcpy(pp->llr0[code_size_log], input_llr, code_size);
+
+  // Stage s holds 2^(n-s) nodes (see srsran_polar_code_node_type())
+  const uint8_t* stage_node_type = node_type;
+  for (uint8_t s = 0; s < code_size_log + 1; s++) {
+    pp->node_type[s] = stage_node_type;
+    stage_node_type += (1U << (code_size_log - s));
+  }
+
+  return 0;
+}
+
+int init_polar_decoder_fssc_c_frozen_set(void*           p,
+                                         const int8_t*   input_llr,
+                                         uint8_t*        data_decoded,
+                                         const uint8_t   code_size_log,
+                                         const uint16_t* frozen_set,
+                                         const uint16_t  frozen_set_size)
+{
+  struct pFSSC_c* pp = p;
+
+  if (p == NULL || code_size_log > pp->nMax) {
+    return -1;
+  }
+
+  if (srsran_polar_code_node_type(frozen_set, frozen_set_size, code_size_log, pp->node_type_buf) != 0) {
+    return -1;
+  }
+
+  return init_polar_decoder_fssc_c(p, input_llr, data_decoded, code_size_log, pp->node_type_buf);
+}
+
+int polar_decoder_fssc_c(void* p, uint8_t* data_decoded)
+{
+  struct pFSSC_c* pp = p;
+
+  if (p == NULL) {
+    return -1;
+  }
+
+  fast_node(pp, pp->code_size_log, 0, data_decoded);
+  return 0;
+}
+
+/*!
+ * ::SRSRAN_POLAR_NODE_RATE_1 nodes at stage \f$ s \f$ return the associated \f$2^s\f$ estimated bits by
+ * making a hard decision on them. The message bits are obtained by polar encoding the estimated bits.
+ */
+static void rate_1_node(struct pFSSC_c* pp, uint8_t stage, uint16_t bit_pos, uint8_t* message)
+{
+  uint8_t* codeword = pp->est_bit + bit_pos;
+
+  hard_bit(pp->llr0[stage], codeword, 1U << stage);
+
+  if (stage != 0) {
+    srsran_polar_encoder_encode(pp->enc, codeword, message + bit_pos, stage);
+  } else {
+    message[bit_pos] = codeword[0];
+  }
+}
+
+/*!
+ * ::SRSRAN_POLAR_NODE_REP nodes at stage \f$ s \f$ only admit the all-zero and the all-one codewords. The
+ * maximum-likelihood decision is given by the sign of the sum of the \f$2^s\f$ LLRs and only the last message
+ * bit can be different from zero.
+ */
+static void rep_node(struct pFSSC_c* pp, uint8_t stage, uint16_t bit_pos, uint8_t* message)
+{
+  uint16_t      stage_size = 1U << stage;
+  const int8_t* llr        = pp->llr0[stage];
+
+  // 32-bit accumulator, the 8-bit LLRs of up to 1024 bits cannot overflow it
+  int32_t sum = 0;
+  for (uint16_t i = 0; i < stage_size; i++) {
+    sum += llr[i];
+  }
+  uint8_t bit = (sum < 0) ? 1 : 0;
+
+  memset(pp->est_bit + bit_pos, bit, stage_size);
+  message[bit_pos + stage_size - 1] = bit;
+}
+
+/*!
+ * ::SRSRAN_POLAR_NODE_SPC nodes at stage \f$ s \f$ make a hard decision on the \f$2^s\f$ LLRs and, if the
+ * parity check fails, flip the least reliable bit (Wagner decoding). The message bits are obtained by polar
+ * encoding the estimated bits.
+ */
+static void spc_node(struct pFSSC_c* pp, uint8_t stage, uint16_t bit_pos, uint8_t* message)
+{
+  uint16_t      stage_size = 1U << stage;
+  const int8_t* llr        = pp->llr0[stage];
+  uint8_t*      codeword   = pp->est_bit + bit_pos;
+
+  hard_bit(llr, codeword, stage_size);
+
+  uint8_t  parity  = 0;
+  int      min_abs = INT32_MAX;
+  uint16_t i_min   = 0;
+  for (uint16_t i = 0; i < stage_size; i++) {
+    int abs_llr = abs(llr[i]);
+    parity ^= codeword[i];
+    if (abs_llr < min_abs) {
+      min_abs = abs_llr;
+      i_min   = i;
+    }
+  }
+  codeword[i_min] ^= parity;
+
+  srsran_polar_encoder_encode(pp->enc, codeword, message + bit_pos, stage);
+}
+
+/*!
+ * ::SRSRAN_POLAR_NODE_RATE_R nodes at stage \f$ s \f$ return the associated \f$2^s\f$ estimated bits by calling
+ * the child nodes to the left and right of the decoding tree and then polar encoding (xor) their output.
+ */
+static void rate_r_node(struct pFSSC_c* pp, uint8_t stage, uint16_t bit_pos, uint8_t* message)
+{
+  uint16_t stage_half_size = 1U << (stage - 1U);
+  uint8_t* estbits0        = pp->est_bit + bit_pos;
+  uint8_t* estbits1        = estbits0 + stage_half_size;
+
+  // move to the child node to the left (up) of the tree.
+  function_f(pp, pp->llr0[stage], pp->llr1[stage], pp->llr0[stage - 1], stage_half_size);
+  fast_node(pp, stage - 1, bit_pos, message);
+
+  // move to the child node to the right (down) of the tree.
+  function_g(pp, estbits0, pp->llr0[stage], pp->llr1[stage], pp->llr0[stage - 1], stage_half_size);
+  fast_node(pp, stage - 1, bit_pos + stage_half_size, message);
+
+  srsran_vec_xor_bbb(estbits0, estbits1, estbits0, stage_half_size);
+}
+
+static void fast_node(struct pFSSC_c* pp, uint8_t stage, uint16_t bit_pos, uint8_t* message)
+{
+  switch (pp->node_type[stage][bit_pos >> stage]) {
+    case SRSRAN_POLAR_NODE_RATE_0:
+      // message bits are initialized to 0
+      memset(pp->est_bit + bit_pos, 0, 1U << stage);
+      break;
+    case SRSRAN_POLAR_NODE_RATE_1:
+      rate_1_node(pp, stage, bit_pos, message);
+      break;
+    case SRSRAN_POLAR_NODE_REP:
+      rep_node(pp, stage, bit_pos, message);
+      break;
+    case SRSRAN_POLAR_NODE_SPC:
+      spc_node(pp, stage, bit_pos, message);
+      break;
+    case SRSRAN_POLAR_NODE_RATE_R:
+      rate_r_node(pp, stage, bit_pos, message);
+      break;
+    default:
+      ERROR("Wrong node type %d", pp->node_type[stage][bit_pos >> stage]);
+      break;
+  }
+}
@@ -87,6 +87,28 @@ void srsran_vec_function_g_bccc_avx2(const uint8_t* b, const int8_t* x, const in
   }
 }
 
+void srsran_vec_function_g_bccc_01_avx2(const uint8_t* b,
+                                        const int8_t*  x,
+                                        const int8_t*  y,
+                                        int8_t*        z,
+                                        const uint16_t len)
+{
+  const __m256i M_1      = _mm256_set1_epi8(1);
+  const __m256i M_NEG127 = _mm256_set1_epi8(-127);
+
+  for (int i = 0; i < len; i += SRSRAN_AVX2_B_SIZE) {
+    __m256i m_x = _mm256_loadu_si256((__m256i*)&x[i]);
+    __m256i m_y = _mm256_loadu_si256((__m256i*)&y[i]);
+    __m256i m_b = _mm256_loadu_si256((__m256i*)&b[i]);
+
+    __m256i m_v  = _mm256_sub_epi8(M_1, _mm256_add_epi8(m_b, m_b)); // 1 - 2b
+    __m256i m_z  = _mm256_adds_epi8(_mm256_sign_epi8(m_x, m_v), m_y);
+    __m256i m_sz = _mm256_max_epi8(M_NEG127, m_z);
+
+    _mm256_storeu_si256((__m256i*)&z[i], m_sz);
+  }
+}
+
 void srsran_vec_xor_bbb_avx2(const uint8_t* x, const uint8_t* y, uint8_t* z, uint16_t len)
 {
 
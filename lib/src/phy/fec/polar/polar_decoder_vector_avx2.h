@@ -67,6 +67,19 @@ SRSRAN_API void srsran_vec_function_f_ccc_avx2(const int8_t* x, const int8_t* y,
 SRSRAN_API void
 srsran_vec_function_g_bccc_avx2(const uint8_t* b, const int8_t* x, const int8_t* y, int8_t* z, uint16_t len);
 
+/*!
+ * Returns \f$ z = -x + y \f$ if \f$ (b = 1) \f$ and \f$ z = x + y \f$ if \f$ (b = 0)\f$ saturated to \f$\pm 127\f$
+ * with AVX2 instructions, the output must have size larger than \ref SRSRAN_AVX2_B_SIZE.
+ * Unlike srsran_vec_function_g_bccc_avx2(), the bits are represented by {0, 1}.
+ * \param[in] b A pointer to a vectors of uint8_t with 0's and 1's.
+ * \param[in] x A pointer to a vector of int8_t.
+ * \param[in] y A pointer to a vector of int8_t.
+ * \param[out] z A pointer to a vector of int8_t.
+ * \param[in] len Length of vectors b, x, y and z.
+ */
+SRSRAN_API void
+srsran_vec_function_g_bccc_01_avx2(const uint8_t* b, const int8_t* x, const int8_t* y, int8_t* z, uint16_t len);
+
 /*!
  * Computes \f$ z = x \oplus y \f$ elementwise with AVX2 instructions,
  * the output must have size larger than \ref SRSRAN_AVX2_B_SIZE.
@@ -33,13 +33,14 @@
 #include "srsran/phy/fec/polar/polar_encoder.h"
 #include "polar_encoder_avx2.h"
 #include "polar_encoder_pipelined.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
 
 /*! AVX2 polar encoder */
 static int encode_avx2(void* o, const uint8_t* input, uint8_t* output, const uint8_t code_size_log)
@@ -68,7 +69,7 @@ static int init_avx2(srsran_polar_encoder_t* q, const uint8_t code_size_log)
   }
   return 0;
 }
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
 /*! Pipelined polar encoder */
 static int encode_pipelined(void* o, const uint8_t* input, uint8_t* output, const uint8_t code_size_log)
@@ -103,10 +104,13 @@ int srsran_polar_encoder_init(srsran_polar_encoder_t* q, srsran_polar_encoder_ty
   switch (type) { // NOLINT
     case SRSRAN_POLAR_ENCODER_PIPELINED:
       return init_pipelined(q, code_size_log);
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
     case SRSRAN_POLAR_ENCODER_AVX2:
+      if (!srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2)) {
+        return -1;
+      }
       return init_avx2(q, code_size_log);
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
     default:
       return -1;
   }
@@ -25,7 +25,7 @@
  rate-dematcher, decoder and subchannel deallocation.
  *
  * A batch of example messages is randomly generated, frozen bits are added, encoded, rate-matched, 2-PAM modulated,
- * sent over an AWGN channel, rate-dematched, and, finally, decoded by all three types of
+ * sent over an AWGN channel, rate-dematched, and, finally, decoded by all the types of
  * decoder. Transmitted and received messages are compared to estimate the WER.
  * Multiple batches are simulated if the number of errors is not significant
  * enough.
@@ -66,6 +66,7 @@
 #include "srsran/phy/utils/debug.h"
 #include "srsran/phy/utils/phy_logger.h"
 #include "srsran/phy/utils/random.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/vector.h"
 
 #include <inttypes.h>
@@ -162,6 +163,7 @@ int main(int argc, char** argv)
   uint8_t* data_rx_s      = NULL;
   uint8_t* data_rx_c      = NULL;
   uint8_t* data_rx_c_avx2 = NULL;
+  uint8_t* data_rx_c_fssc = NULL;
 
   uint8_t* input_enc       = NULL; // input encoder
   uint8_t* output_enc      = NULL; // output encoder
@@ -183,6 +185,7 @@ int main(int argc, char** argv)
   uint8_t* output_dec_s      = NULL; // output decoder
   uint8_t* output_dec_c      = NULL; // output decoder
   uint8_t* output_dec_c_avx2 = NULL; // output decoder
+  uint8_t* output_dec_c_fssc = NULL; // output decoder
 
   double var[SNR_POINTS + 1];
 
@@ -193,17 +196,19 @@ int main(int argc, char** argv)
   int j          = 0;
   int snr_points = 0;
 
-  int errors_symb   = 0;
-  int errors_symb_s = 0;
-  int errors_symb_c = 0;
-#ifdef LV_HAVE_AVX2
+  int errors_symb        = 0;
+  int errors_symb_s      = 0;
+  int errors_symb_c      = 0;
+  int errors_symb_c_fssc = 0;
+#ifdef SRSRAN_SIMD_HAVE_AVX2
   int errors_symb_c_avx2 = 0;
-#endif
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
   int n_error_words[SNR_POINTS + 1];
   int n_error_words_s[SNR_POINTS + 1];
   int n_error_words_c[SNR_POINTS + 1];
   int n_error_words_c_avx2[SNR_POINTS + 1];
+  int n_error_words_c_fssc[SNR_POINTS + 1];
 
   int last_i_batch[SNR_POINTS + 1];
 
@@ -212,6 +217,7 @@ int main(int argc, char** argv)
   double         elapsed_time_dec_s[SNR_POINTS + 1];
   double         elapsed_time_dec_c[SNR_POINTS + 1];
   double         elapsed_time_dec_c_avx2[SNR_POINTS + 1];
+  double         elapsed_time_dec_c_fssc[SNR_POINTS + 1];
 
   double elapsed_time_enc[SNR_POINTS + 1];
   double elapsed_time_enc_avx2[SNR_POINTS + 1];
@@ -221,24 +227,28 @@ int main(int argc, char** argv)
   int8_t  inf8   = (1U << 7U) - 1;
   float   gain_s = NAN;
   float   gain_c = NAN;
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
   float gain_c_avx2 = NAN;
-#endif
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
   srsran_polar_code_t    code;
   srsran_polar_encoder_t enc;
   srsran_polar_decoder_t dec;
-  srsran_polar_decoder_t dec_s; // 16-bit
-  srsran_polar_decoder_t dec_c; // 8-bit
+  srsran_polar_decoder_t dec_s;      // 16-bit
+  srsran_polar_decoder_t dec_c;      // 8-bit
+  srsran_polar_decoder_t dec_c_fssc; // 8-bit, Fast-SSC
   srsran_polar_rm_t      rm_tx;
   srsran_polar_rm_t      rm_rx_f;
   srsran_polar_rm_t      rm_rx_s;
   srsran_polar_rm_t      rm_rx_c;
 
-#ifdef LV_HAVE_AVX2
-  srsran_polar_encoder_t enc_avx2;
-  srsran_polar_decoder_t dec_c_avx2; // 8-bit
-#endif                               // LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  srsran_polar_encoder_t enc_avx2   = {};
+  srsran_polar_decoder_t dec_c_avx2 = {}; // 8-bit
+
+  // The AVX2 versions are tested only if the selected instruction set can run them
+  bool avx2 = srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2);
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
   parse_args(argc, argv);
 
@@ -269,14 +279,18 @@ int main(int argc, char** argv)
   // initialize a POLAR decoder (8 bit)
   srsran_polar_decoder_init(&dec_c, SRSRAN_POLAR_DECODER_SSC_C, nMax);
 
-#ifdef LV_HAVE_AVX2
+  // initialize a POLAR decoder (8 bit, Fast-SSC)
+  srsran_polar_decoder_init(&dec_c_fssc, SRSRAN_POLAR_DECODER_FSSC_C, nMax);
 
-  // initialize encoder  avx2
-  srsran_polar_encoder_init(&enc_avx2, SRSRAN_POLAR_ENCODER_AVX2, nMax);
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (avx2) {
+    // initialize encoder  avx2
+    srsran_polar_encoder_init(&enc_avx2, SRSRAN_POLAR_ENCODER_AVX2, nMax);
 
-  // initialize a POLAR decoder (8 bit, avx2)
-  srsran_polar_decoder_init(&dec_c_avx2, SRSRAN_POLAR_DECODER_SSC_C_AVX2, nMax);
-#endif // LV_HAVE_AVX2
+    // initialize a POLAR decoder (8 bit, avx2)
+    srsran_polar_decoder_init(&dec_c_avx2, SRSRAN_POLAR_DECODER_SSC_C_AVX2, nMax);
+  }
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
 #ifdef DATA_ALL_ONES
 #else
@@ -288,6 +302,7 @@ int main(int argc, char** argv)
   data_rx_s      = srsran_vec_u8_malloc(K * BATCH_SIZE);
   data_rx_c      = srsran_vec_u8_malloc(K * BATCH_SIZE);
   data_rx_c_avx2 = srsran_vec_u8_malloc(K * BATCH_SIZE);
+  data_rx_c_fssc = srsran_vec_u8_malloc(K * BATCH_SIZE);
 
   input_enc       = srsran_vec_u8_malloc(NMAX * BATCH_SIZE);
   output_enc      = srsran_vec_u8_malloc(NMAX * BATCH_SIZE);
@@ -309,10 +324,12 @@ int main(int argc, char** argv)
   output_dec_s      = srsran_vec_u8_malloc(NMAX * BATCH_SIZE);
   output_dec_c      = srsran_vec_u8_malloc(NMAX * BATCH_SIZE);
   output_dec_c_avx2 = srsran_vec_u8_malloc(NMAX * BATCH_SIZE);
+  output_dec_c_fssc = srsran_vec_u8_malloc(NMAX * BATCH_SIZE);
 
   if (!data_tx || !data_rx || !data_rx_s || !data_rx_c || !data_rx_c_avx2 || !input_enc || !output_enc ||
       !output_enc_avx2 || !rm_codeword || !rm_llr || !rm_llr_s || !rm_llr_c || !rm_llr_c_avx2 || !llr || !llr_s ||
-      !llr_c || !llr_c_avx2 || !output_dec || !output_dec_s || !output_dec_c || !output_dec_c_avx2) {
+      !llr_c || !llr_c_avx2 || !output_dec || !output_dec_s || !output_dec_c || !output_dec_c_avx2 || !data_rx_c_fssc ||
+      !output_dec_c_fssc) {
     perror("malloc");
     exit(-1);
   }
@@ -359,11 +376,13 @@ int main(int argc, char** argv)
     elapsed_time_dec_s[i_snr]      = 0;
     elapsed_time_dec_c[i_snr]      = 0;
     elapsed_time_dec_c_avx2[i_snr] = 0;
+    elapsed_time_dec_c_fssc[i_snr] = 0;
 
     n_error_words[i_snr]        = 0;
     n_error_words_s[i_snr]      = 0;
     n_error_words_c[i_snr]      = 0;
     n_error_words_c_avx2[i_snr] = 0;
+    n_error_words_c_fssc[i_snr] = 0;
 
     int i_batch = 0;
     printf("\nBatch:\n  ");
@@ -443,25 +462,27 @@ int main(int argc, char** argv)
         srsran_polar_rm_tx(&rm_tx, output_enc + j * code.N, rm_codeword + j * E, code.n, E, K, bil);
       }
 
-#ifdef LV_HAVE_AVX2
-      // encoding  avx2
-      gettimeofday(&t[1], NULL);
-      for (j = 0; j < BATCH_SIZE; j++) {
-        srsran_polar_encoder_encode(&enc_avx2, input_enc + j * code.N, output_enc_avx2 + j * code.N, code.n);
-      }
-      gettimeofday(&t[2], NULL);
-      get_time_interval(t);
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+      if (avx2) {
+        // encoding  avx2
+        gettimeofday(&t[1], NULL);
+        for (j = 0; j < BATCH_SIZE; j++) {
+          srsran_polar_encoder_encode(&enc_avx2, input_enc + j * code.N, output_enc_avx2 + j * code.N, code.n);
+        }
+        gettimeofday(&t[2], NULL);
+        get_time_interval(t);
 
-      elapsed_time_enc_avx2[i_snr] += t[0].tv_sec + 1e-6 * t[0].tv_usec;
+        elapsed_time_enc_avx2[i_snr] += t[0].tv_sec + 1e-6 * t[0].tv_usec;
 
-      // check errors with respect the output of the pipeline encoder
-      for (int i = 0; i < BATCH_SIZE; i++) {
-        if (srsran_bit_diff(output_enc + i * code.N, output_enc_avx2 + i * code.N, code.N) != 0) {
-          printf("ERROR: Wrong avx2 encoder output. SNR= %f, Batch: %d\n", snr_db_vec[i_snr], i);
-          exit(-1);
+        // check errors with respect the output of the pipeline encoder
+        for (int i = 0; i < BATCH_SIZE; i++) {
+          if (srsran_bit_diff(output_enc + i * code.N, output_enc_avx2 + i * code.N, code.N) != 0) {
+            printf("ERROR: Wrong avx2 encoder output. SNR= %f, Batch: %d\n", snr_db_vec[i_snr], i);
+            exit(-1);
+          }
         }
       }
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
       for (j = 0; j < E * BATCH_SIZE; j++) {
         rm_llr[j] = rm_codeword[j] ? -1 : 1;
@@ -591,45 +612,75 @@ int main(int argc, char** argv)
         }
       }
 
-#ifdef LV_HAVE_AVX2
-      // 8-bit avx2 decoding
-      // 8-bit quantization
-      if (snr_db_vec[i_snr] == 101) {
-        srsran_vec_quant_fc(rm_llr, rm_llr_c_avx2, 32, 0, 127, BATCH_SIZE * E);
-      } else {
-        gain_c_avx2 = inf8 * var[i_snr] / 20 / (1 / var[i_snr] + 2);
-        srsran_vec_quant_fc(rm_llr, rm_llr_c_avx2, gain_c_avx2, 0, inf8, BATCH_SIZE * E);
-      }
-
-      // Rate dematcher
-      for (j = 0; j < BATCH_SIZE; j++) {
-        srsran_polar_rm_rx_c(&rm_rx_c, rm_llr_c_avx2 + j * E, llr_c_avx2 + j * code.N, E, code.n, K, bil);
-      }
-
+      // 8-bit Fast-SSC decoding, same LLRs as the 8-bit SSC decoder
       gettimeofday(&t[1], NULL);
       for (j = 0; j < BATCH_SIZE; j++) {
-        srsran_polar_decoder_decode_c(
-            &dec_c_avx2, llr_c_avx2 + j * code.N, output_dec_c_avx2 + j * code.N, code.n, code.F_set, code.F_set_size);
+        srsran_polar_decoder_decode_code_c(&dec_c_fssc, llr_c + j * code.N, output_dec_c_fssc + j * code.N, &code);
       }
       gettimeofday(&t[2], NULL);
       get_time_interval(t);
-      elapsed_time_dec_c_avx2[i_snr] += t[0].tv_sec + 1e-6 * t[0].tv_usec;
+      elapsed_time_dec_c_fssc[i_snr] += t[0].tv_sec + 1e-6 * t[0].tv_usec;
 
       // extract message bits
       for (j = 0; j < BATCH_SIZE; j++) {
         srsran_polar_chanalloc_rx(
-            output_dec_c_avx2 + j * code.N, data_rx_c_avx2 + j * K, code.K, code.nPC, code.K_set, code.PC_set);
+            output_dec_c_fssc + j * code.N, data_rx_c_fssc + j * K, code.K, code.nPC, code.K_set, code.PC_set);
       }
 
-      // check errors 8-bits decoder
+      // check errors 8-bits Fast-SSC decoder
       for (int i = 0; i < BATCH_SIZE; i++) {
-        errors_symb_c_avx2 = srsran_bit_diff(data_tx + i * K, data_rx_c_avx2 + i * K, K);
+        errors_symb_c_fssc = srsran_bit_diff(data_tx + i * K, data_rx_c_fssc + i * K, K);
+
+        if (errors_symb_c_fssc != 0) {
+          n_error_words_c_fssc[i_snr]++;
+        }
+      }
+
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+      if (avx2) {
+        // 8-bit avx2 decoding
+        // 8-bit quantization
+        if (snr_db_vec[i_snr] == 101) {
+          srsran_vec_quant_fc(rm_llr, rm_llr_c_avx2, 32, 0, 127, BATCH_SIZE * E);
+        } else {
+          gain_c_avx2 = inf8 * var[i_snr] / 20 / (1 / var[i_snr] + 2);
+          srsran_vec_quant_fc(rm_llr, rm_llr_c_avx2, gain_c_avx2, 0, inf8, BATCH_SIZE * E);
+        }
+
+        // Rate dematcher
+        for (j = 0; j < BATCH_SIZE; j++) {
+          srsran_polar_rm_rx_c(&rm_rx_c, rm_llr_c_avx2 + j * E, llr_c_avx2 + j * code.N, E, code.n, K, bil);
+        }
 
-        if (errors_symb_c_avx2 != 0) {
-          n_error_words_c_avx2[i_snr]++;
+        gettimeofday(&t[1], NULL);
+        for (j = 0; j < BATCH_SIZE; j++) {
+          srsran_polar_decoder_decode_c(&dec_c_avx2,
+                                        llr_c_avx2 + j * code.N,
+                                        output_dec_c_avx2 + j * code.N,
+                                        code.n,
+                                        code.F_set,
+                                        code.F_set_size);
+        }
+        gettimeofday(&t[2], NULL);
+        get_time_interval(t);
+        elapsed_time_dec_c_avx2[i_snr] += t[0].tv_sec + 1e-6 * t[0].tv_usec;
+
+        // extract message bits
+        for (j = 0; j < BATCH_SIZE; j++) {
+          srsran_polar_chanalloc_rx(
+              output_dec_c_avx2 + j * code.N, data_rx_c_avx2 + j * K, code.K, code.nPC, code.K_set, code.PC_set);
+        }
+
+        // check errors 8-bits decoder
+        for (int i = 0; i < BATCH_SIZE; i++) {
+          errors_symb_c_avx2 = srsran_bit_diff(data_tx + i * K, data_rx_c_avx2 + i * K, K);
+
+          if (errors_symb_c_avx2 != 0) {
+            n_error_words_c_avx2[i_snr]++;
+          }
         }
       }
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
       last_i_batch[i_snr] = i_batch;
     } // end while BATCH
@@ -663,13 +714,21 @@ int main(int argc, char** argv)
       }
       printf("];\n");
 
-#ifdef LV_HAVE_AVX2
-      printf("WER_8_AVX2=[");
+      printf("WER_8_FSSC=[");
       for (int i_snr = 0; i_snr < snr_points; i_snr++) {
-        printf("%e ", (float)n_error_words_c_avx2[i_snr] / last_i_batch[i_snr] / BATCH_SIZE);
+        printf("%e ", (float)n_error_words_c_fssc[i_snr] / last_i_batch[i_snr] / BATCH_SIZE);
       }
       printf("];\n");
-#endif // LV_HAVE_AVX2
+
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+      if (avx2) {
+        printf("WER_8_AVX2=[");
+        for (int i_snr = 0; i_snr < snr_points; i_snr++) {
+          printf("%e ", (float)n_error_words_c_avx2[i_snr] / last_i_batch[i_snr] / BATCH_SIZE);
+        }
+        printf("];\n");
+      }
+#endif // SRSRAN_SIMD_HAVE_AVX2
       break;
     case 1:
       for (int i_snr = 0; i_snr < snr_points; i_snr++) {
@@ -697,14 +756,22 @@ int main(int argc, char** argv)
                n_error_words_c[i_snr],
                last_i_batch[i_snr] * BATCH_SIZE * code.N,
                last_i_batch[i_snr] * BATCH_SIZE * code.N / (1000000 * elapsed_time_dec_c[i_snr]));
-#ifdef LV_HAVE_AVX2
-        printf("SNR: %3.1f\t INT8-AVX2  WER: %.8f %d/%d \t dec_thrput(Mbps): %.2f\n",
+        printf("SNR: %3.1f\t INT8-FSSC  WER: %.8f %d/%d \t dec_thrput(Mbps): %.2f\n",
                snr_db_vec[i_snr],
-               (double)n_error_words_c_avx2[i_snr] / last_i_batch[i_snr] / BATCH_SIZE,
-               n_error_words_c_avx2[i_snr],
+               (double)n_error_words_c_fssc[i_snr] / last_i_batch[i_snr] / BATCH_SIZE,
+               n_error_words_c_fssc[i_snr],
                last_i_batch[i_snr] * BATCH_SIZE * code.N,
-               last_i_batch[i_snr] * BATCH_SIZE * code.N / (1000000 * elapsed_time_dec_c_avx2[i_snr]));
-#endif // LV_HAVE_AVX2
+               last_i_batch[i_snr] * BATCH_SIZE * code.N / (1000000 * elapsed_time_dec_c_fssc[i_snr]));
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+        if (avx2) {
+          printf("SNR: %3.1f\t INT8-AVX2  WER: %.8f %d/%d \t dec_thrput(Mbps): %.2f\n",
+                 snr_db_vec[i_snr],
+                 (double)n_error_words_c_avx2[i_snr] / last_i_batch[i_snr] / BATCH_SIZE,
+                 n_error_words_c_avx2[i_snr],
+                 last_i_batch[i_snr] * BATCH_SIZE * code.N,
+                 last_i_batch[i_snr] * BATCH_SIZE * code.N / (1000000 * elapsed_time_dec_c_avx2[i_snr]));
+        }
+#endif // SRSRAN_SIMD_HAVE_AVX2
         printf("\n");
       }
 
@@ -718,14 +785,16 @@ int main(int argc, char** argv)
                last_i_batch[i_snr] * BATCH_SIZE * K / elapsed_time_enc[i_snr],
                last_i_batch[i_snr] * BATCH_SIZE * code.N / elapsed_time_enc[i_snr]);
 
-#ifdef LV_HAVE_AVX2
-        printf("\n**** AVX2 ENCODER ****\n");
-        printf("Estimated throughput:\n  %e word/s\n  %e bit/s (information)\n  %e bit/s "
-               "(encoded)\n",
-               last_i_batch[i_snr] * BATCH_SIZE / elapsed_time_enc_avx2[i_snr],
-               last_i_batch[i_snr] * BATCH_SIZE * K / elapsed_time_enc_avx2[i_snr],
-               last_i_batch[i_snr] * BATCH_SIZE * code.N / elapsed_time_enc_avx2[i_snr]);
-#endif // LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+        if (avx2) {
+          printf("\n**** AVX2 ENCODER ****\n");
+          printf("Estimated throughput:\n  %e word/s\n  %e bit/s (information)\n  %e bit/s "
+                 "(encoded)\n",
+                 last_i_batch[i_snr] * BATCH_SIZE / elapsed_time_enc_avx2[i_snr],
+                 last_i_batch[i_snr] * BATCH_SIZE * K / elapsed_time_enc_avx2[i_snr],
+                 last_i_batch[i_snr] * BATCH_SIZE * code.N / elapsed_time_enc_avx2[i_snr]);
+        }
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
         printf("\n**** FLOATING POINT ****");
         printf("\nEstimated word error rate:\n  %e (%d errors)\n",
@@ -757,17 +826,29 @@ int main(int argc, char** argv)
                last_i_batch[i_snr] * BATCH_SIZE * K / elapsed_time_dec_c[i_snr],
                last_i_batch[i_snr] * BATCH_SIZE * code.N / elapsed_time_dec_c[i_snr]);
 
-#ifdef LV_HAVE_AVX2
-        printf("\n**** FIXED POINT (8 bits, AVX2) ****");
+        printf("\n**** FIXED POINT (8 bits, Fast-SSC) ****");
         printf("\nEstimated word error rate:\n  %e (%d errors)\n",
-               (double)n_error_words_c_avx2[i_snr] / last_i_batch[i_snr] / BATCH_SIZE,
-               n_error_words_c_avx2[i_snr]);
+               (double)n_error_words_c_fssc[i_snr] / last_i_batch[i_snr] / BATCH_SIZE,
+               n_error_words_c_fssc[i_snr]);
 
         printf("Estimated throughput decoder:\n  %e word/s\n  %e bit/s (information)\n  %e bit/s (encoded)\n",
-               last_i_batch[i_snr] * BATCH_SIZE / elapsed_time_dec_c_avx2[i_snr],
-               last_i_batch[i_snr] * BATCH_SIZE * K / elapsed_time_dec_c_avx2[i_snr],
-               last_i_batch[i_snr] * BATCH_SIZE * code.N / elapsed_time_dec_c_avx2[i_snr]);
-#endif // LV_HAVE_AVX2
+               last_i_batch[i_snr] * BATCH_SIZE / elapsed_time_dec_c_fssc[i_snr],
+               last_i_batch[i_snr] * BATCH_SIZE * K / elapsed_time_dec_c_fssc[i_snr],
+               last_i_batch[i_snr] * BATCH_SIZE * code.N / elapsed_time_dec_c_fssc[i_snr]);
+
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+        if (avx2) {
+          printf("\n**** FIXED POINT (8 bits, AVX2) ****");
+          printf("\nEstimated word error rate:\n  %e (%d errors)\n",
+                 (double)n_error_words_c_avx2[i_snr] / last_i_batch[i_snr] / BATCH_SIZE,
+                 n_error_words_c_avx2[i_snr]);
+
+          printf("Estimated throughput decoder:\n  %e word/s\n  %e bit/s (information)\n  %e bit/s (encoded)\n",
+                 last_i_batch[i_snr] * BATCH_SIZE / elapsed_time_dec_c_avx2[i_snr],
+                 last_i_batch[i_snr] * BATCH_SIZE * K / elapsed_time_dec_c_avx2[i_snr],
+                 last_i_batch[i_snr] * BATCH_SIZE * code.N / elapsed_time_dec_c_avx2[i_snr]);
+        }
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
         printf("\n");
       }
@@ -801,6 +882,8 @@ int main(int argc, char** argv)
   free(output_dec_c_avx2);
   free(output_enc_avx2);
   free(data_rx_c_avx2);
+  free(output_dec_c_fssc);
+  free(data_rx_c_fssc);
 
 #ifdef DATA_ALL_ONES
 #else
@@ -812,14 +895,15 @@ int main(int argc, char** argv)
   srsran_polar_decoder_free(&dec);
   srsran_polar_decoder_free(&dec_s);
   srsran_polar_decoder_free(&dec_c);
+  srsran_polar_decoder_free(&dec_c_fssc);
   srsran_polar_rm_rx_free_f(&rm_rx_f);
   srsran_polar_rm_rx_free_s(&rm_rx_s);
   srsran_polar_rm_rx_free_c(&rm_rx_c);
   srsran_polar_rm_tx_free(&rm_tx);
-#ifdef LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
   srsran_polar_encoder_free(&enc_avx2);
   srsran_polar_decoder_free(&dec_c_avx2);
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
   int expected_errors = 0;
   int i_snr           = 0;
@@ -845,20 +929,29 @@ int main(int argc, char** argv)
     }
     printf("\r");
 
-#ifdef LV_HAVE_AVX2
-    if (n_error_words_c_avx2[0] > expected_errors) {
-      printf("\n(8 bit, avx2) Test failed!\n\n");
+    if (n_error_words_c_fssc[0] > expected_errors) {
+      printf("\n(8 bit, Fast-SSC) Test failed!\n\n");
     } else {
-      printf("\n(8 bit, avx2) Test completed successfully!\n\n");
+      printf("\n(8 bit, Fast-SSC) Test completed successfully!\n\n");
+    }
+    printf("\r");
+
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+    if (avx2) {
+      if (n_error_words_c_avx2[0] > expected_errors) {
+        printf("\n(8 bit, avx2) Test failed!\n\n");
+      } else {
+        printf("\n(8 bit, avx2) Test completed successfully!\n\n");
+      }
     }
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
     printf("\r");
 
     exit((n_error_words[0] > expected_errors) || (n_error_words_s[0] > expected_errors) ||
-         (n_error_words_c[0] > expected_errors)
-#ifdef LV_HAVE_AVX2
-         || (n_error_words_c_avx2[0] > expected_errors)
-#endif // LV_HAVE_AVX2
+         (n_error_words_c[0] > expected_errors) || (n_error_words_c_fssc[0] > expected_errors)
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+         || (avx2 && n_error_words_c_avx2[0] > expected_errors)
+#endif // SRSRAN_SIMD_HAVE_AVX2
     );
 
   } else {
@@ -871,12 +964,18 @@ int main(int argc, char** argv)
         perror("8-bit performance at SNR = %d too low!");
         exit(-1);
       }
-#ifdef LV_HAVE_AVX2
-      if (n_error_words_c_avx2[i_snr] > 10 * n_error_words[i_snr]) {
-        perror("8-bit avx2 performance at SNR = %d too low!");
+      if (n_error_words_c_fssc[i_snr] > 10 * n_error_words[i_snr]) {
+        perror("8-bit Fast-SSC performance at SNR = %d too low!");
         exit(-1);
       }
-#endif // LV_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+      if (avx2) {
+        if (n_error_words_c_avx2[i_snr] > 10 * n_error_words[i_snr]) {
+          perror("8-bit avx2 performance at SNR = %d too low!");
+          exit(-1);
+        }
+      }
+#endif // SRSRAN_SIMD_HAVE_AVX2
     }
 
     printf("\nTest completed successfully!\n\n");
@@ -29,24 +29,45 @@
 #include "srsran/phy/fec/softbuffer.h"
 #include "srsran/phy/fec/turbo/turbodecoder_gen.h"
 #include "srsran/phy/phch/ra.h"
+#include "srsran/phy/utils/simd.h"
 #include "srsran/phy/utils/vector.h"
 
 #define MAX_PDSCH_RE(cp) (2 * SRSRAN_CP_NSYMB(cp) * 12)
 
-int srsran_softbuffer_rx_init(srsran_softbuffer_rx_t* q, uint32_t nof_prb)
+static uint32_t softbuffer_rx_max_cb(uint32_t nof_prb)
 {
   int ret = srsran_ra_tbs_from_idx(SRSRAN_RA_NOF_TBS_IDX - 1, nof_prb);
-
   if (ret == SRSRAN_ERROR) {
+    return 0;
+  }
+  return (uint32_t)ret / (SRSRAN_TCOD_MAX_LEN_CB - 24) + 1;
+}
+
+int srsran_softbuffer_rx_init(srsran_softbuffer_rx_t* q, uint32_t nof_prb)
+{
+  uint32_t max_cb = softbuffer_rx_max_cb(nof_prb);
+  if (max_cb == 0) {
     return SRSRAN_ERROR;
   }
-  uint32_t max_cb      = (uint32_t)ret / (SRSRAN_TCOD_MAX_LEN_CB - 24) + 1;
-  uint32_t max_cb_size = SOFTBUFFER_SIZE;
 
-  return srsran_softbuffer_rx_init_guru(q, max_cb, max_cb_size);
+  return srsran_softbuffer_rx_init_guru(q, max_cb, SOFTBUFFER_SIZE);
 }
 
-int srsran_softbuffer_rx_init_guru(srsran_softbuffer_rx_t* q, uint32_t max_cb, uint32_t max_cb_size)
+int srsran_softbuffer_rx_init_8bit(srsran_softbuffer_rx_t* q, uint32_t nof_prb)
+{
+  uint32_t max_cb = softbuffer_rx_max_cb(nof_prb);
+  if (max_cb == 0) {
+    return SRSRAN_ERROR;
+  }
+
+  return srsran_softbuffer_rx_init_guru_8bit(q, max_cb, SOFTBUFFER_SIZE);
+}
+
+static int softbuffer_rx_init(srsran_softbuffer_rx_t*   q,
+                              uint32_t                  max_cb,
+                              uint32_t                  max_cb_size,
+                              bool                      llr_is_8bit,
+                              srsran_softbuffer_pool_t* pool)
 {
   int ret = SRSRAN_ERROR;
 
@@ -61,6 +82,8 @@ int srsran_softbuffer_rx_init_guru(srsran_softbuffer_rx_t* q, uint32_t max_cb, u
   // Set internal attributes
   q->max_cb      = max_cb;
   q->max_cb_size = max_cb_size;
+  q->llr_is_8bit = llr_is_8bit;
+  q->pool        = pool;
 
   q->buffer_f = SRSRAN_MEM_ALLOC(int16_t*, q->max_cb);
   if (!q->buffer_f) {
@@ -83,12 +106,20 @@ int srsran_softbuffer_rx_init_guru(srsran_softbuffer_rx_t* q, uint32_t max_cb, u
   }
 
   for (uint32_t i = 0; i < q->max_cb; i++) {
-    q->buffer_f[i] = srsran_vec_i16_malloc(q->max_cb_size);
-    if (!q->buffer_f[i]) {
-      perror("malloc");
-      goto clean_exit;
+    // Pooled soft-buffers take the LLR buffers when they are needed
+    if (q->pool == NULL) {
+      if (q->llr_is_8bit) {
+        q->buffer_f[i] = (int16_t*)srsran_vec_i8_malloc(q->max_cb_size);
+      } else {
+        q->buffer_f[i] = srsran_vec_i16_malloc(q->max_cb_size);
+      }
+      if (!q->buffer_f[i]) {
+        perror("malloc");
+        goto clean_exit;
+      }
     }
 
+    // The decoded bits are small and always owned, so they survive the release of the LLR buffers
     q->data[i] = srsran_vec_u8_malloc(q->max_cb_size / 8);
     if (!q->data[i]) {
       perror("malloc");
@@ -109,16 +140,37 @@ clean_exit:
   return ret;
 }
 
+int srsran_softbuffer_rx_init_guru(srsran_softbuffer_rx_t* q, uint32_t max_cb, uint32_t max_cb_size)
+{
+  return softbuffer_rx_init(q, max_cb, max_cb_size, false, NULL);
+}
+
+int srsran_softbuffer_rx_init_guru_8bit(srsran_softbuffer_rx_t* q, uint32_t max_cb, uint32_t max_cb_size)
+{
+  return softbuffer_rx_init(q, max_cb, max_cb_size, true, NULL);
+}
+
+int srsran_softbuffer_rx_init_pool(srsran_softbuffer_rx_t* q, uint32_t nof_prb, srsran_softbuffer_pool_t* pool)
+{
+  uint32_t max_cb = softbuffer_rx_max_cb(nof_prb);
+  if (pool == NULL || pool->memory == NULL || max_cb == 0) {
+    return SRSRAN_ERROR;
+  }
+
+  return softbuffer_rx_init(q, max_cb, pool->max_cb_size, pool->llr_is_8bit, pool);
+}
+
 void srsran_softbuffer_rx_free(srsran_softbuffer_rx_t* q)
 {
   if (q) {
-    if (q->buffer_f) {
+    if (q->pool) {
+      srsran_softbuffer_rx_release(q);
+    } else if (q->buffer_f) {
       for (uint32_t i = 0; i < q->max_cb; i++) {
         if (q->buffer_f[i]) {
           free(q->buffer_f[i]);
         }
       }
-      free(q->buffer_f);
     }
     if (q->data) {
       for (uint32_t i = 0; i < q->max_cb; i++) {
@@ -126,6 +178,11 @@ void srsran_softbuffer_rx_free(srsran_softbuffer_rx_t* q)
           free(q->data[i]);
         }
       }
+    }
+    if (q->buffer_f) {
+      free(q->buffer_f);
+    }
+    if (q->data) {
       free(q->data);
     }
     if (q->cb_crc) {
@@ -136,6 +193,62 @@ void srsran_softbuffer_rx_free(srsran_softbuffer_rx_t* q)
   }
 }
 
+int srsran_softbuffer_rx_reserve_cb(srsran_softbuffer_rx_t* q, uint32_t nof_cb)
+{
+  if (q == NULL || q->buffer_f == NULL || nof_cb > q->max_cb) {
+    return SRSRAN_ERROR;
+  }
+
+  if (q->pool == NULL) {
+    return SRSRAN_SUCCESS;
+  }
+
+  // Buffers are always taken and given back all together, so the ones already held are the first ones
+  srsran_softbuffer_pool_t* pool     = q->pool;
+  uint32_t                  nof_held = 0;
+  while (nof_held < q->max_cb && q->buffer_f[nof_held] != NULL) {
+    nof_held++;
+  }
+  if (nof_held >= nof_cb) {
+    return SRSRAN_SUCCESS;
+  }
+
+  pthread_mutex_lock(&pool->mutex);
+  if (pool->nof_free < nof_cb - nof_held) {
+    pthread_mutex_unlock(&pool->mutex);
+    return SRSRAN_ERROR;
+  }
+  for (uint32_t i = nof_held; i < nof_cb; i++) {
+    q->buffer_f[i] = (int16_t*)pool->free_chunks[--pool->nof_free];
+  }
+  pthread_mutex_unlock(&pool->mutex);
+
+  // The chunks may still hold the soft bits of another soft-buffer
+  for (uint32_t i = nof_held; i < nof_cb; i++) {
+    srsran_vec_u8_zero((uint8_t*)q->buffer_f[i], pool->chunk_size);
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+void srsran_softbuffer_rx_release(srsran_softbuffer_rx_t* q)
+{
+  if (q == NULL || q->pool == NULL || q->buffer_f == NULL) {
+    return;
+  }
+
+  srsran_softbuffer_pool_t* pool = q->pool;
+
+  pthread_mutex_lock(&pool->mutex);
+  for (uint32_t i = 0; i < q->max_cb; i++) {
+    if (q->buffer_f[i] != NULL) {
+      pool->free_chunks[pool->nof_free++] = (uint8_t*)q->buffer_f[i];
+      q->buffer_f[i]                      = NULL;
+    }
+  }
+  pthread_mutex_unlock(&pool->mutex);
+}
+
 void srsran_softbuffer_rx_reset_tbs(srsran_softbuffer_rx_t* q, uint32_t tbs)
 {
   uint32_t nof_cb = (tbs + 24) / (SRSRAN_TCOD_MAX_LEN_CB - 24) + 1;
@@ -149,13 +262,21 @@ void srsran_softbuffer_rx_reset(srsran_softbuffer_rx_t* q)
 
 void srsran_softbuffer_rx_reset_cb(srsran_softbuffer_rx_t* q, uint32_t nof_cb)
 {
+  if (q->pool) {
+    // Pooled LLR buffers are given back, they are cleared when they are reserved again
+    srsran_softbuffer_rx_release(q);
+  }
   if (q->buffer_f) {
     if (nof_cb > q->max_cb) {
       nof_cb = q->max_cb;
     }
     for (uint32_t i = 0; i < nof_cb; i++) {
       if (q->buffer_f[i]) {
-        srsran_vec_i16_zero(q->buffer_f[i], q->max_cb_size);
+        if (q->llr_is_8bit) {
+          srsran_vec_i8_zero((int8_t*)q->buffer_f[i], q->max_cb_size);
+        } else {
+          srsran_vec_i16_zero(q->buffer_f[i], q->max_cb_size);
+        }
       }
       if (q->data[i]) {
         srsran_vec_u8_zero(q->data[i], q->max_cb_size / 8);
@@ -177,6 +298,80 @@ void srsran_softbuffer_rx_reset_cb_crc(srsran_softbuffer_rx_t* q, uint32_t nof_c
   SRSRAN_MEM_ZERO(q->cb_crc, bool, SRSRAN_MIN(q->max_cb, nof_cb));
 }
 
+int srsran_softbuffer_pool_init(srsran_softbuffer_pool_t* q,
+                                uint32_t                  nof_chunks,
+                                uint32_t                  max_cb_size,
+                                bool                      llr_is_8bit)
+{
+  if (q == NULL || nof_chunks == 0 || max_cb_size == 0) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  SRSRAN_MEM_ZERO(q, srsran_softbuffer_pool_t, 1);
+
+  // Keep the LLR of every chunk aligned
+  uint32_t llr_size = max_cb_size * (llr_is_8bit ? sizeof(int8_t) : sizeof(int16_t));
+
+  q->max_cb_size = max_cb_size;
+  q->llr_is_8bit = llr_is_8bit;
+  q->nof_chunks  = nof_chunks;
+  q->chunk_size  = SRSRAN_CEIL(llr_size, SRSRAN_SIMD_BIT_ALIGN) * SRSRAN_SIMD_BIT_ALIGN;
+
+  q->memory      = srsran_vec_u8_malloc(q->nof_chunks * q->chunk_size);
+  q->free_chunks = SRSRAN_MEM_ALLOC(uint8_t*, q->nof_chunks);
+  if (!q->memory || !q->free_chunks) {
+    perror("malloc");
+    // The mutex is not initialised yet, so release the memory here instead of through srsran_softbuffer_pool_free()
+    if (q->memory) {
+      free(q->memory);
+    }
+    if (q->free_chunks) {
+      free(q->free_chunks);
+    }
+    SRSRAN_MEM_ZERO(q, srsran_softbuffer_pool_t, 1);
+    return SRSRAN_ERROR;
+  }
+
+  for (uint32_t i = 0; i < q->nof_chunks; i++) {
+    q->free_chunks[i] = &q->memory[i * q->chunk_size];
+  }
+  q->nof_free = q->nof_chunks;
+
+  pthread_mutex_init(&q->mutex, NULL);
+
+  return SRSRAN_SUCCESS;
+}
+
+uint32_t srsran_softbuffer_pool_nof_free(srsran_softbuffer_pool_t* q)
+{
+  if (q == NULL || q->memory == NULL) {
+    return 0;
+  }
+
+  pthread_mutex_lock(&q->mutex);
+  uint32_t nof_free = q->nof_free;
+  pthread_mutex_unlock(&q->mutex);
+
+  return nof_free;
+}
+
+void srsran_softbuffer_pool_free(srsran_softbuffer_pool_t* q)
+{
+  if (q) {
+    // The mutex is only initialised once both allocations succeeded
+    if (q->memory && q->free_chunks) {
+      pthread_mutex_destroy(&q->mutex);
+    }
+    if (q->memory) {
+      free(q->memory);
+    }
+    if (q->free_chunks) {
+      free(q->free_chunks);
+    }
+    SRSRAN_MEM_ZERO(q, srsran_softbuffer_pool_t, 1);
+  }
+}
+
 int srsran_softbuffer_tx_init(srsran_softbuffer_tx_t* q, uint32_t nof_prb)
 {
   int ret = srsran_ra_tbs_from_idx(SRSRAN_RA_NOF_TBS_IDX - 1, nof_prb);
@@ -24,6 +24,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
+#include <sys/time.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -33,21 +34,23 @@
 int      num_bits = 5001, crc_length = 24;
 uint32_t crc_poly = 0x1864CFB;
 uint32_t seed     = 1;
+int      nof_reps = 0;
 
 void usage(char* prog)
 {
-  printf("Usage: %s [nlps]\n", prog);
+  printf("Usage: %s [nlpstv]\n", prog);
   printf("\t-n num_bits [Default %d]\n", num_bits);
   printf("\t-l crc_length [Default %d]\n", crc_length);
   printf("\t-p crc_poly (Hex) [Default 0x%x]\n", crc_poly);
   printf("\t-s seed [Default 0=time]\n");
+  printf("\t-t nof_repetitions, measures srsran_crc_checksum_byte() throughput [Default %d]\n", nof_reps);
   printf("\t-v [set srsran_verbose to debug, default none]\n");
 }
 
 void parse_args(int argc, char** argv)
 {
   int opt;
-  while ((opt = getopt(argc, argv, "nlpsv")) != -1) {
+  while ((opt = getopt(argc, argv, "nlpstv")) != -1) {
     switch (opt) {
       case 'n':
         num_bits = (int)strtol(argv[optind], NULL, 10);
@@ -61,6 +64,9 @@ void parse_args(int argc, char** argv)
       case 's':
         seed = (uint32_t)strtoul(argv[optind], NULL, 0);
         break;
+      case 't':
+        nof_reps = (int)strtol(argv[optind], NULL, 10);
+        break;
       case 'v':
         increase_srsran_verbose_level();
         break;
@@ -71,6 +77,26 @@ void parse_args(int argc, char** argv)
   }
 }
 
+// Measures the throughput of srsran_crc_checksum_byte() with the given engine, in Mbps
+static double crc_throughput(srsran_crc_t* crc_p, bool clmul, const uint8_t* packed, int len)
+{
+  struct timeval t[3];
+  uint32_t       acc = 0;
+  bool           tmp = crc_p->clmul;
+
+  crc_p->clmul = clmul;
+  gettimeofday(&t[1], NULL);
+  for (int r = 0; r < nof_reps; r++) {
+    acc ^= srsran_crc_checksum_byte(crc_p, packed, len);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+  crc_p->clmul = tmp;
+
+  INFO("acc=%x", acc);
+  return (double)len * nof_reps / (t[0].tv_sec * 1e6 + t[0].tv_usec);
+}
+
 int main(int argc, char** argv)
 {
   int          i;
@@ -111,7 +137,33 @@ int main(int argc, char** argv)
 
   INFO("checksum=%x", crc_word);
 
+  // The packed byte version must give the same checksum for any number of whole bytes
+  int      len_bytes = num_bits / 8;
+  uint8_t* packed    = srsran_vec_u8_malloc(len_bytes + 1);
+  if (!packed) {
+    perror("malloc");
+    exit(-1);
+  }
+  srsran_bit_pack_vector(data, packed, len_bytes * 8);
+  for (i = 1; i <= len_bytes; i++) {
+    uint32_t crc_bits = srsran_crc_checksum(&crc_p, data, i * 8);
+    uint32_t crc_byte = srsran_crc_checksum_byte(&crc_p, packed, i * 8);
+    if (crc_bits != crc_byte) {
+      ERROR("Byte checksum %x does not match bit checksum %x for %d bytes", crc_byte, crc_bits, i);
+      exit(-1);
+    }
+  }
+  INFO("clmul=%s", crc_p.clmul ? "yes" : "no");
+
+  if (nof_reps > 0 && len_bytes > 0) {
+    printf("table: %.1f Mbps\n", crc_throughput(&crc_p, false, packed, len_bytes * 8));
+    if (crc_p.clmul) {
+      printf("clmul: %.1f Mbps\n", crc_throughput(&crc_p, true, packed, len_bytes * 8));
+    }
+  }
+
   free(data);
+  free(packed);
 
   // check if generated word is as expected
   if (get_expected_word(num_bits, crc_length, crc_poly, seed, &expected_word)) {
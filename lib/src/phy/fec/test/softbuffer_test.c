@@ -0,0 +1,328 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "srsran/phy/phch/ra_nr.h"
+#include "srsran/phy/phch/sch_nr.h"
+#include "srsran/phy/utils/random.h"
+#include "srsran/srsran.h"
+#include "srsran/support/srsran_test.h"
+
+#define NOF_PRB 25
+#define NOF_SOFTBUFFERS 3
+#define NOF_TX 4
+
+static int test_pool(void)
+{
+  srsran_softbuffer_pool_t pool                = {};
+  srsran_softbuffer_rx_t   sb[NOF_SOFTBUFFERS] = {};
+  uint32_t                 nof_chunks          = 0;
+  uint32_t                 max_cb              = 0;
+
+  // Init a pooled soft-buffer just to know the number of code blocks
+  TESTASSERT(srsran_softbuffer_pool_init(&pool, 1, SOFTBUFFER_SIZE, true) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_rx_init_pool(&sb[0], NOF_PRB, &pool) == SRSRAN_SUCCESS);
+  max_cb = sb[0].max_cb;
+  srsran_softbuffer_rx_free(&sb[0]);
+  srsran_softbuffer_pool_free(&pool);
+
+  // Only two of the soft-buffers can hold all their code blocks at once
+  nof_chunks = 2 * max_cb;
+  TESTASSERT(srsran_softbuffer_pool_init(&pool, nof_chunks, SOFTBUFFER_SIZE, true) == SRSRAN_SUCCESS);
+  for (uint32_t i = 0; i < NOF_SOFTBUFFERS; i++) {
+    TESTASSERT(srsran_softbuffer_rx_init_pool(&sb[i], NOF_PRB, &pool) == SRSRAN_SUCCESS);
+    TESTASSERT(sb[i].llr_is_8bit);
+    TESTASSERT(sb[i].buffer_f[0] == NULL);
+  }
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == nof_chunks);
+
+  // Reserving again the same code blocks does not take more chunks
+  TESTASSERT(srsran_softbuffer_rx_reserve_cb(&sb[0], 1) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_rx_reserve_cb(&sb[0], max_cb) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_rx_reserve_cb(&sb[0], max_cb) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_rx_reserve_cb(&sb[1], max_cb) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == 0);
+  TESTASSERT(srsran_softbuffer_rx_reserve_cb(&sb[2], 1) == SRSRAN_ERROR);
+
+  // Soft bits and CRC are kept until the soft-buffer is released or reset
+  for (uint32_t i = 0; i < max_cb; i++) {
+    memset(sb[0].buffer_f[i], 0x55, SOFTBUFFER_SIZE);
+    memset(sb[0].data[i], 0xaa, SOFTBUFFER_SIZE / 8);
+  }
+  sb[0].cb_crc[0] = true;
+  srsran_softbuffer_rx_release(&sb[0]);
+  TESTASSERT(sb[0].cb_crc[0]);
+  TESTASSERT(sb[0].buffer_f[0] == NULL);
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == max_cb);
+
+  // Chunks given to another soft-buffer are cleared
+  TESTASSERT(srsran_softbuffer_rx_reserve_cb(&sb[2], max_cb) == SRSRAN_SUCCESS);
+  for (uint32_t i = 0; i < max_cb; i++) {
+    int8_t* llr = (int8_t*)sb[2].buffer_f[i];
+    for (uint32_t j = 0; j < SOFTBUFFER_SIZE; j++) {
+      TESTASSERT(llr[j] == 0);
+    }
+    for (uint32_t j = 0; j < SOFTBUFFER_SIZE / 8; j++) {
+      TESTASSERT(sb[2].data[i][j] == 0);
+    }
+  }
+
+  srsran_softbuffer_rx_reset_tbs(&sb[1], 1000);
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == max_cb);
+  srsran_softbuffer_rx_free(&sb[2]);
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == nof_chunks);
+
+  for (uint32_t i = 0; i < NOF_SOFTBUFFERS; i++) {
+    srsran_softbuffer_rx_free(&sb[i]);
+  }
+  srsran_softbuffer_pool_free(&pool);
+
+  return SRSRAN_SUCCESS;
+}
+
+/* Decodes the same retransmissions with an 8-bit pooled soft-buffer and with a 16-bit soft-buffer */
+static int test_8bit_decode(srsran_random_t random_gen)
+{
+  srsran_sch_t             sch_tx     = {};
+  srsran_sch_t             sch_rx     = {};
+  srsran_softbuffer_pool_t pool       = {};
+  srsran_softbuffer_tx_t   sb_tx      = {};
+  srsran_softbuffer_rx_t   sb_rx16    = {};
+  srsran_softbuffer_rx_t   sb_rx8     = {};
+  srsran_pdsch_cfg_t       cfg        = {};
+  const uint32_t           rv[NOF_TX] = {0, 2, 3, 1};
+
+  int      tbs       = srsran_ra_tbs_from_idx(5, NOF_PRB);
+  uint32_t nof_bits  = NOF_PRB * SRSRAN_NRE * 11 * 2;
+  uint8_t* data_tx   = srsran_vec_u8_malloc(tbs / 8);
+  uint8_t* data_rx16 = srsran_vec_u8_malloc((tbs + 24) / 8);
+  uint8_t* data_rx8  = srsran_vec_u8_malloc((tbs + 24) / 8);
+  uint8_t* packed    = srsran_vec_u8_malloc(nof_bits / 8);
+  uint8_t* bits      = srsran_vec_u8_malloc(nof_bits);
+  int8_t*  llr       = srsran_vec_i8_malloc(nof_bits);
+  TESTASSERT(data_tx && data_rx16 && data_rx8 && packed && bits && llr);
+
+  TESTASSERT(srsran_sch_init(&sch_tx) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_sch_init(&sch_rx) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_tx_init(&sb_tx, NOF_PRB) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_rx_init(&sb_rx16, NOF_PRB) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_pool_init(&pool, sb_rx16.max_cb, SOFTBUFFER_SIZE, true) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_rx_init_pool(&sb_rx8, NOF_PRB, &pool) == SRSRAN_SUCCESS);
+  sch_rx.llr_is_8bit = true;
+
+  for (uint32_t i = 0; i < tbs / 8; i++) {
+    data_tx[i] = (uint8_t)srsran_random_uniform_int_dist(random_gen, 0, 255);
+  }
+
+  cfg.grant.nof_tb         = 1;
+  cfg.grant.tb[0].tbs      = tbs;
+  cfg.grant.tb[0].mod      = SRSRAN_MOD_QPSK;
+  cfg.grant.tb[0].nof_bits = nof_bits;
+  cfg.grant.tb[0].enabled  = true;
+
+  bool crc_ok = false;
+  for (uint32_t n = 0; n < NOF_TX && !crc_ok; n++) {
+    // Tx and Rx soft-buffers share the same configuration field
+    cfg.grant.tb[0].rv    = rv[n];
+    cfg.softbuffers.tx[0] = &sb_tx;
+    TESTASSERT(srsran_dlsch_encode(&sch_tx, &cfg, data_tx, packed) == SRSRAN_SUCCESS);
+    srsran_bit_unpack_vector(packed, bits, nof_bits);
+
+    // Low SNR so that the transport block needs soft combining
+    for (uint32_t i = 0; i < nof_bits; i++) {
+      llr[i] = (int8_t)((bits[i] ? 8 : -8) + srsran_random_uniform_int_dist(random_gen, -24, 24));
+    }
+
+    cfg.softbuffers.rx[0] = &sb_rx16;
+    int ret16             = srsran_dlsch_decode(&sch_rx, &cfg, (int16_t*)llr, data_rx16);
+    cfg.softbuffers.rx[0] = &sb_rx8;
+    int ret8              = srsran_dlsch_decode(&sch_rx, &cfg, (int16_t*)llr, data_rx8);
+
+    printf("tx=%d; rv=%d; CRC %s/%s\n", n, rv[n], ret16 ? "KO" : "OK", ret8 ? "KO" : "OK");
+    TESTASSERT(ret16 == ret8);
+    crc_ok = (ret8 == SRSRAN_SUCCESS);
+  }
+  TESTASSERT(crc_ok);
+  TESTASSERT(memcmp(data_tx, data_rx16, tbs / 8) == 0);
+  TESTASSERT(memcmp(data_tx, data_rx8, tbs / 8) == 0);
+
+  // The pooled soft-buffer gives its chunks back as soon as the transport block is decoded
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == pool.nof_chunks);
+
+  srsran_sch_free(&sch_tx);
+  srsran_sch_free(&sch_rx);
+  srsran_softbuffer_tx_free(&sb_tx);
+  srsran_softbuffer_rx_free(&sb_rx16);
+  srsran_softbuffer_rx_free(&sb_rx8);
+  srsran_softbuffer_pool_free(&pool);
+  free(data_tx);
+  free(data_rx16);
+  free(data_rx8);
+  free(packed);
+  free(bits);
+  free(llr);
+
+  return SRSRAN_SUCCESS;
+}
+
+static int nr_decode(srsran_sch_nr_t*        sch,
+                     srsran_sch_cfg_nr_t*    cfg,
+                     srsran_sch_tb_t*        tb,
+                     srsran_softbuffer_rx_t* sb,
+                     int8_t*                 llr,
+                     srsran_sch_tb_res_nr_t* res)
+{
+  tb->softbuffer.rx = sb;
+  res->crc          = false;
+  return srsran_dlsch_nr_decode(sch, &cfg->sch_cfg, tb, llr, res);
+}
+
+/* Decodes an NR transport block split in two halves with a pooled soft-buffer, then retransmits it once decoded */
+static int test_nr_pool(srsran_random_t random_gen)
+{
+  srsran_carrier_nr_t      carrier = SRSRAN_DEFAULT_CARRIER_NR;
+  srsran_sch_nr_t          sch_tx  = {};
+  srsran_sch_nr_t          sch_rx  = {};
+  srsran_sch_nr_args_t     args    = {};
+  srsran_sch_cfg_nr_t      cfg     = {};
+  srsran_sch_tb_t          tb      = {};
+  srsran_sch_tb_res_nr_t   res     = {};
+  srsran_softbuffer_pool_t pool    = {};
+  srsran_softbuffer_tx_t   sb_tx   = {};
+  srsran_softbuffer_rx_t   sb_rx   = {};
+  srsran_softbuffer_rx_t   sb_ref  = {};
+
+  uint8_t* data_tx = srsran_vec_u8_malloc(SRSRAN_SLOT_MAX_NOF_BITS_NR / 8);
+  uint8_t* data_rx = srsran_vec_u8_malloc(SRSRAN_SLOT_MAX_NOF_BITS_NR / 8);
+  uint8_t* encoded = srsran_vec_u8_malloc(SRSRAN_SLOT_MAX_NOF_BITS_NR);
+  int8_t*  llr     = srsran_vec_i8_malloc(SRSRAN_SLOT_MAX_NOF_BITS_NR);
+  TESTASSERT(data_tx && data_rx && encoded && llr);
+
+  args.decoder_scaling_factor = 0.8;
+  args.max_nof_iter           = 10;
+  TESTASSERT(srsran_sch_nr_init_tx(&sch_tx, &args) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_sch_nr_init_rx(&sch_rx, &args) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_sch_nr_set_carrier(&sch_tx, &carrier) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_sch_nr_set_carrier(&sch_rx, &carrier) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_tx_init_guru(&sb_tx, SRSRAN_SCH_NR_MAX_NOF_CB_LDPC, SRSRAN_LDPC_MAX_LEN_ENCODED_CB) ==
+             SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_pool_init(&pool, SRSRAN_SCH_NR_MAX_NOF_CB_LDPC, SRSRAN_LDPC_MAX_LEN_ENCODED_CB, true) ==
+             SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_rx_init_pool(&sb_rx, carrier.nof_prb, &pool) == SRSRAN_SUCCESS);
+  TESTASSERT(srsran_softbuffer_rx_init_guru_8bit(&sb_ref, SRSRAN_SCH_NR_MAX_NOF_CB_LDPC,
+                                                 SRSRAN_LDPC_MAX_LEN_ENCODED_CB) == SRSRAN_SUCCESS);
+
+  // Several code blocks at a code rate above one half, so that half of the bits are not enough to decode it
+  cfg.sch_cfg.mcs_table                      = srsran_mcs_table_64qam;
+  cfg.grant.S                                = 1;
+  cfg.grant.L                                = 13;
+  cfg.grant.nof_layers                       = 1;
+  cfg.grant.dci_format                       = srsran_dci_format_nr_1_0;
+  cfg.grant.nof_dmrs_cdm_groups_without_data = 1;
+  for (uint32_t n = 0; n < carrier.nof_prb; n++) {
+    cfg.grant.prb_idx[n] = true;
+  }
+  TESTASSERT(srsran_ra_nr_fill_tb(&cfg, &cfg.grant, 22, &tb) == SRSRAN_SUCCESS);
+  TESTASSERT(tb.nof_bits <= SRSRAN_SLOT_MAX_NOF_BITS_NR);
+
+  for (uint32_t i = 0; i < tb.tbs / 8; i++) {
+    data_tx[i] = (uint8_t)srsran_random_uniform_int_dist(random_gen, 0, UINT8_MAX);
+  }
+  tb.softbuffer.tx = &sb_tx;
+  TESTASSERT(srsran_dlsch_nr_encode(&sch_tx, &cfg.sch_cfg, &tb, data_tx, encoded) == SRSRAN_SUCCESS);
+
+  srsran_sch_nr_tb_info_t tb_info = {};
+  TESTASSERT(srsran_sch_nr_fill_tb_info(&carrier, &cfg.sch_cfg, &tb, &tb_info) == SRSRAN_SUCCESS);
+  TESTASSERT(tb_info.C > 1);
+  res.payload = data_rx;
+
+  // First transmission with the odd bits punctured, no code block can be decoded
+  for (uint32_t i = 0; i < tb.nof_bits; i++) {
+    llr[i] = (i % 2) ? 0 : (encoded[i] ? -10 : +10);
+  }
+  TESTASSERT(nr_decode(&sch_rx, &cfg, &tb, &sb_rx, llr, &res) == SRSRAN_SUCCESS);
+  TESTASSERT(!res.crc);
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == pool.nof_chunks - tb_info.C);
+
+  // Retransmission with the even bits punctured, it is only decoded if the first transmission was retained
+  for (uint32_t i = 0; i < tb.nof_bits; i++) {
+    llr[i] = (i % 2) ? (encoded[i] ? -10 : +10) : 0;
+  }
+  TESTASSERT(nr_decode(&sch_rx, &cfg, &tb, &sb_ref, llr, &res) == SRSRAN_SUCCESS);
+  TESTASSERT(!res.crc);
+  TESTASSERT(nr_decode(&sch_rx, &cfg, &tb, &sb_rx, llr, &res) == SRSRAN_SUCCESS);
+  TESTASSERT(res.crc);
+  TESTASSERT(memcmp(data_tx, data_rx, tb.tbs / 8) == 0);
+
+  // The chunks are given back as soon as the transport block is decoded
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == pool.nof_chunks);
+
+  // A retransmission of the decoded transport block takes no chunk and still gives the payload
+  srsran_vec_i8_zero(llr, tb.nof_bits);
+  srsran_vec_u8_zero(data_rx, tb.tbs / 8);
+  TESTASSERT(nr_decode(&sch_rx, &cfg, &tb, &sb_rx, llr, &res) == SRSRAN_SUCCESS);
+  TESTASSERT(res.crc);
+  TESTASSERT(memcmp(data_tx, data_rx, tb.tbs / 8) == 0);
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == pool.nof_chunks);
+
+  // After a reset the code blocks are decoded again from cleared chunks
+  for (uint32_t i = 0; i < tb.nof_bits; i++) {
+    llr[i] = (i % 2) ? 0 : (encoded[i] ? -10 : +10);
+  }
+  srsran_softbuffer_rx_reset(&sb_rx);
+  TESTASSERT(nr_decode(&sch_rx, &cfg, &tb, &sb_rx, llr, &res) == SRSRAN_SUCCESS);
+  TESTASSERT(!res.crc);
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == pool.nof_chunks - tb_info.C);
+  srsran_softbuffer_rx_reset(&sb_rx);
+  TESTASSERT(srsran_softbuffer_pool_nof_free(&pool) == pool.nof_chunks);
+
+  srsran_sch_nr_free(&sch_tx);
+  srsran_sch_nr_free(&sch_rx);
+  srsran_softbuffer_tx_free(&sb_tx);
+  srsran_softbuffer_rx_free(&sb_rx);
+  srsran_softbuffer_rx_free(&sb_ref);
+  srsran_softbuffer_pool_free(&pool);
+  free(data_tx);
+  free(data_rx);
+  free(encoded);
+  free(llr);
+
+  return SRSRAN_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  srsran_random_t random_gen = srsran_random_init(0);
+  int             ret        = SRSRAN_SUCCESS;
+
+  if (test_pool() != SRSRAN_SUCCESS || test_8bit_decode(random_gen) != SRSRAN_SUCCESS ||
+      test_nr_pool(random_gen) != SRSRAN_SUCCESS) {
+    ret = SRSRAN_ERROR;
+  }
+
+  srsran_random_free(random_gen);
+
+  printf("%s\n", ret == SRSRAN_SUCCESS ? "Ok" : "Error");
+  return ret;
+}
@@ -30,6 +30,7 @@
 #include "srsran/phy/fec/turbo/rm_turbo.h"
 #include "srsran/phy/utils/bit.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/vector.h"
 
 #ifdef LV_HAVE_SSE
@@ -83,8 +84,13 @@ static bool                     rm_turbo_tables_generated = false;
 // Store deinterleaver version for sub-block turbo decoder
 #if SRSRAN_TDEC_EXPECT_INPUT_SB == 1
 // Prepare bit for sub-block decoder processing. These are the nof subblock sizes
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+#define NOF_DEINTER_TABLE_SB_IDX 4
+const static int deinter_table_sb_idx[NOF_DEINTER_TABLE_SB_IDX] = {8, 16, 32, 64};
+#else /* SRSRAN_SIMD_HAVE_AVX512 */
 #define NOF_DEINTER_TABLE_SB_IDX 3
 const static int deinter_table_sb_idx[NOF_DEINTER_TABLE_SB_IDX] = {8, 16, 32};
+#endif /* SRSRAN_SIMD_HAVE_AVX512 */
 int              deinter_table_idx_from_sb_len(uint32_t nof_subblocks)
 {
   for (int i = 0; i < NOF_DEINTER_TABLE_SB_IDX; i++) {
@@ -261,6 +267,12 @@ static void interleave_table_sb(uint16_t* in, uint16_t* out, uint32_t cb_idx, ui
 {
   int long_cb = srsran_cbsegm_cbsize(cb_idx);
   int out_len = 3 * long_cb + 12;
+
+  // Codeblocks shorter than the number of sub-blocks are never decoded with this table
+  if (long_cb < nof_sb) {
+    return;
+  }
+
   for (int i = 0; i < out_len; i++) {
     // Do not change tail bit order
     if (in[i] < 3 * long_cb) {
@@ -273,10 +285,315 @@ static void interleave_table_sb(uint16_t* in, uint16_t* out, uint32_t cb_idx, ui
 }
 #endif
 
+#ifdef LV_HAVE_AVX2
+
+/*
+ * Gather-free de-rate-matching for 8-bit soft bits
+ * ------------------------------------------------
+ *
+ * The received bits are a circular read of w = [v0 | v1 v2 interleaved] that skips the dummy bits, so they are
+ * combined into the three sub-block interleaver matrices with contiguous saturated additions, one per run of non-dummy
+ * bits. Each 32 x nrows matrix is then transposed back into its natural stream with 16 x 16 byte transposes, and the
+ * streams are finally transposed (sub-block decoder input) or interleaved (natural decoder input) into the soft-buffer.
+ * All the permutations are done with byte unpacks and shuffles, without gathers nor scatters.
+ */
+
+#define RM_TURBO_KPI_MAX (NCOLS * ((6144 + 4 + NCOLS - 1) / NCOLS))
+#define RM_TURBO_ROWS_PAD (((6144 + 4 + NCOLS - 1) / NCOLS + 31) / 32 * 32)
+#define RM_TURBO_MAX_RUNS 128
+
+/* Run of consecutive non-dummy bits in the circular buffer w */
+typedef struct {
+  uint16_t start;
+  uint16_t len;
+} rm_turbo_run_t;
+
+static rm_turbo_run_t rm_turbo_runs[SRSRAN_NOF_TC_CB_SIZES][RM_TURBO_MAX_RUNS];
+static uint32_t       rm_turbo_nof_runs[SRSRAN_NOF_TC_CB_SIZES];
+
+/* pshufb masks that interleave three 16-byte vectors into 48 bytes, indexed by output vector and source */
+static uint8_t rm_turbo_triplet_shuffle[3][3][16];
+
+static bool rm_turbo_w_isdummy(int jp, int nrows, int ndummy)
+{
+  int K_p = nrows * NCOLS;
+  if (jp < K_p || !(jp % 2)) {
+    int p = (jp < K_p) ? jp : (jp - K_p) / 2;
+    return (p % nrows) * NCOLS + RM_PERM_TC[p / nrows] < ndummy;
+  }
+  int jpp  = (jp - K_p - 1) / 2;
+  int kidx = (RM_PERM_TC[jpp / nrows] + NCOLS * (jpp % nrows) + 1) % K_p;
+  return kidx < ndummy;
+}
+
+static void rm_turbo_gentable_runs(uint32_t cb_idx, int nrows, int ndummy)
+{
+  int      K_p    = nrows * NCOLS;
+  uint32_t n      = 0;
+  bool     in_run = false;
+
+  for (int jp = 0; jp < 3 * K_p; jp++) {
+    // Runs do not cross the systematic and parity regions
+    if (rm_turbo_w_isdummy(jp, nrows, ndummy) || jp == K_p) {
+      in_run = false;
+    }
+    if (!rm_turbo_w_isdummy(jp, nrows, ndummy)) {
+      if (!in_run && n < RM_TURBO_MAX_RUNS) {
+        rm_turbo_runs[cb_idx][n].start = (uint16_t)jp;
+        rm_turbo_runs[cb_idx][n].len   = 0;
+        n++;
+        in_run = true;
+      }
+      rm_turbo_runs[cb_idx][n - 1].len++;
+    }
+  }
+  rm_turbo_nof_runs[cb_idx] = n;
+}
+
+static void rm_turbo_gentable_triplets()
+{
+  for (int q = 0; q < 3; q++) {
+    for (int p = 0; p < 16; p++) {
+      for (int s = 0; s < 3; s++) {
+        int g                             = 16 * q + p;
+        rm_turbo_triplet_shuffle[q][s][p] = (g % 3 == s) ? (uint8_t)(g / 3) : 0x80;
+      }
+    }
+  }
+}
+
+static inline void rm_turbo_adds_i8(int8_t* y, const int8_t* x, uint32_t len)
+{
+  uint32_t i = 0;
+#ifdef LV_HAVE_AVX512
+  for (; i + 64 <= len; i += 64) {
+    __m512i a = _mm512_loadu_si512(y + i);
+    _mm512_storeu_si512(y + i, _mm512_adds_epi8(a, _mm512_loadu_si512(x + i)));
+  }
+#endif // LV_HAVE_AVX512
+  for (; i + 32 <= len; i += 32) {
+    __m256i a = _mm256_loadu_si256((__m256i*)(y + i));
+    _mm256_storeu_si256((__m256i*)(y + i), _mm256_adds_epi8(a, _mm256_loadu_si256((__m256i*)(x + i))));
+  }
+  for (; i < len; i++) {
+    y[i] = (int8_t)SRSRAN_MAX(INT8_MIN, SRSRAN_MIN(INT8_MAX, (int)y[i] + (int)x[i]));
+  }
+}
+
+/* Adds interleaved parity bits starting at parity offset q into v1 (even offsets) and v2 (odd offsets) */
+static inline void rm_turbo_adds_parity_i8(int8_t* v1, int8_t* v2, uint32_t q, const int8_t* x, uint32_t len)
+{
+  const __m256i split = _mm256_setr_epi8(
+      0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+  uint32_t i = 0;
+
+  if (len > 0 && (q % 2) == 1) {
+    v2[q / 2] = (int8_t)SRSRAN_MAX(INT8_MIN, SRSRAN_MIN(INT8_MAX, (int)v2[q / 2] + (int)x[0]));
+    i++;
+    q++;
+  }
+
+  for (; i + 32 <= len; i += 32, q += 32) {
+    __m256i v = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)(x + i)), split);
+    v         = _mm256_permute4x64_epi64(v, 0xd8);
+    __m128i a = _mm_loadu_si128((__m128i*)(v1 + q / 2));
+    __m128i b = _mm_loadu_si128((__m128i*)(v2 + q / 2));
+    _mm_storeu_si128((__m128i*)(v1 + q / 2), _mm_adds_epi8(a, _mm256_castsi256_si128(v)));
+    _mm_storeu_si128((__m128i*)(v2 + q / 2), _mm_adds_epi8(b, _mm256_extracti128_si256(v, 1)));
+  }
+
+  for (; i < len; i++, q++) {
+    int8_t* v = (q % 2) ? &v2[q / 2] : &v1[q / 2];
+    *v        = (int8_t)SRSRAN_MAX(INT8_MIN, SRSRAN_MIN(INT8_MAX, (int)*v + (int)x[i]));
+  }
+}
+
+/* Transposes two 16 x 16 byte blocks at once, one per 128-bit lane */
+static inline void rm_turbo_transpose_16x16x2(__m256i m[16])
+{
+  for (uint32_t s = 0; s < 4; s++) {
+    __m256i u[16];
+    for (uint32_t i = 0; i < 8; i++) {
+      u[2 * i]     = _mm256_unpacklo_epi8(m[i], m[i + 8]);
+      u[2 * i + 1] = _mm256_unpackhi_epi8(m[i], m[i + 8]);
+    }
+    for (uint32_t i = 0; i < 16; i++) {
+      m[i] = u[i];
+    }
+  }
+}
+
+/* Undoes the sub-block interleaver: y[r * NCOLS + c] = v[RM_PERM_TC[c] * nrows + r] */
+static void rm_turbo_deinterleave_i8(const int8_t* v, int8_t* y, uint32_t nrows)
+{
+  for (uint32_t c0 = 0; c0 < NCOLS; c0 += 16) {
+    for (uint32_t r0 = 0; r0 < nrows; r0 += 32) {
+      __m256i m[16];
+      for (uint32_t k = 0; k < 16; k++) {
+        m[k] = _mm256_loadu_si256((__m256i*)(v + RM_PERM_TC[c0 + k] * nrows + r0));
+      }
+      rm_turbo_transpose_16x16x2(m);
+      for (uint32_t k = 0; k < 16; k++) {
+        _mm_storeu_si128((__m128i*)(y + (r0 + k) * NCOLS + c0), _mm256_castsi256_si128(m[k]));
+        _mm_storeu_si128((__m128i*)(y + (r0 + 16 + k) * NCOLS + c0), _mm256_extracti128_si256(m[k], 1));
+      }
+    }
+  }
+}
+
+/* Adds nof_sb streams of len bits, d[s * len + t], into the sub-block decoder order out[t * nof_sb + s] */
+static void rm_turbo_adds_sb_i8(const int8_t* d, int8_t* out, uint32_t len, uint32_t nof_sb)
+{
+  const __m256i zero  = _mm256_setzero_si256();
+  uint32_t      width = SRSRAN_MIN(16, nof_sb);
+
+  for (uint32_t s0 = 0; s0 < nof_sb; s0 += 16) {
+    for (uint32_t t0 = 0; t0 < len; t0 += 32) {
+      __m256i m[16];
+      for (uint32_t k = 0; k < 16; k++) {
+        m[k] = (k < width) ? _mm256_loadu_si256((__m256i*)(d + (s0 + k) * len + t0)) : zero;
+      }
+      rm_turbo_transpose_16x16x2(m);
+      for (uint32_t k = 0; k < 32 && t0 + k < len; k++) {
+        __m128i x = (k < 16) ? _mm256_castsi256_si128(m[k]) : _mm256_extracti128_si256(m[k - 16], 1);
+        int8_t* o = out + (t0 + k) * nof_sb + s0;
+        if (width == 16) {
+          _mm_storeu_si128((__m128i*)o, _mm_adds_epi8(_mm_loadu_si128((__m128i*)o), x));
+        } else {
+          _mm_storel_epi64((__m128i*)o, _mm_adds_epi8(_mm_loadl_epi64((__m128i*)o), x));
+        }
+      }
+    }
+  }
+}
+
+/* Adds three streams of len bits into the natural decoder order out[3 * k + j] */
+static void rm_turbo_adds_triplets_i8(const int8_t* d0, const int8_t* d1, const int8_t* d2, int8_t* out, uint32_t len)
+{
+  const int8_t* d[3] = {d0, d1, d2};
+  uint32_t      k    = 0;
+
+  for (; k + 16 <= len; k += 16) {
+    __m128i x[3] = {_mm_loadu_si128((__m128i*)(d0 + k)),
+                    _mm_loadu_si128((__m128i*)(d1 + k)),
+                    _mm_loadu_si128((__m128i*)(d2 + k))};
+    for (uint32_t q = 0; q < 3; q++) {
+      __m128i v = _mm_setzero_si128();
+      for (uint32_t s = 0; s < 3; s++) {
+        v = _mm_or_si128(v, _mm_shuffle_epi8(x[s], _mm_loadu_si128((__m128i*)rm_turbo_triplet_shuffle[q][s])));
+      }
+      int8_t* o = out + 3 * k + 16 * q;
+      _mm_storeu_si128((__m128i*)o, _mm_adds_epi8(_mm_loadu_si128((__m128i*)o), v));
+    }
+  }
+
+  for (; k < len; k++) {
+    for (uint32_t j = 0; j < 3; j++) {
+      out[3 * k + j] = (int8_t)SRSRAN_MAX(INT8_MIN, SRSRAN_MIN(INT8_MAX, (int)out[3 * k + j] + (int)d[j][k]));
+    }
+  }
+}
+
+static int rm_turbo_rx_8bit_avx2(int8_t* input, int8_t* output, uint32_t in_len, uint32_t cb_idx, uint32_t rv_idx)
+{
+  uint32_t K      = srsran_cbsegm_cbsize(cb_idx);
+  uint32_t D      = K + 4;
+  uint32_t nrows  = (D - 1) / NCOLS + 1;
+  uint32_t K_p    = nrows * NCOLS;
+  uint32_t ndummy = K_p - D;
+  uint32_t N_cb   = 3 * K_p;
+#if SRSRAN_TDEC_EXPECT_INPUT_SB == 1
+  uint32_t nof_sb = srsran_tdec_autoimp_get_subblocks_8bit(K);
+#else
+  uint32_t nof_sb = 0;
+#endif
+
+  // Sub-block interleaver matrices and natural streams, padded for the 32-byte reads past their end
+  int8_t v[3][RM_TURBO_KPI_MAX + 32] __attribute__((aligned(32)));
+  int8_t y[3][RM_TURBO_ROWS_PAD * NCOLS + 32] __attribute__((aligned(32)));
+
+  for (uint32_t j = 0; j < 3; j++) {
+    srsran_vec_i8_zero(v[j], K_p);
+  }
+
+  // Find the run and the offset in the run where k0 falls, skipping the dummy bits
+  const rm_turbo_run_t* runs     = rm_turbo_runs[cb_idx];
+  uint32_t              nof_runs = rm_turbo_nof_runs[cb_idx];
+  uint32_t              k0       = (uint32_t)k0_vec[cb_idx][rv_idx][0] % N_cb;
+  uint32_t              r        = 0;
+  uint32_t              k0_p     = 0;
+  while (r < nof_runs && runs[r].start + runs[r].len <= k0) {
+    k0_p += runs[r].len;
+    r++;
+  }
+  uint32_t off = (r < nof_runs && k0 > runs[r].start) ? k0 - runs[r].start : 0;
+  r            = r % nof_runs;
+
+  // Repeated bits are first folded over the 3 * D non-dummy bits, so that the runs are only walked once
+  int8_t f[3 * (6144 + 4) + 32] __attribute__((aligned(32)));
+  if (in_len > 3 * D) {
+    srsran_vec_i8_zero(f, 3 * D);
+    k0_p += off;
+    for (uint32_t i = 0; i < in_len;) {
+      uint32_t p = (k0_p + i) % (3 * D);
+      uint32_t n = SRSRAN_MIN(3 * D - p, in_len - i);
+      rm_turbo_adds_i8(&f[p], &input[i], n);
+      i += n;
+    }
+    input  = f;
+    in_len = 3 * D;
+    r      = 0;
+    off    = 0;
+  }
+
+  // Combine the received bits into the matrices, run by run
+  for (uint32_t i = 0; i < in_len;) {
+    uint32_t start = runs[r].start + off;
+    uint32_t n     = SRSRAN_MIN(runs[r].len - off, in_len - i);
+    if (start < K_p) {
+      rm_turbo_adds_i8(&v[0][start], &input[i], n);
+    } else {
+      rm_turbo_adds_parity_i8(v[1], v[2], start - K_p, &input[i], n);
+    }
+    i += n;
+    off = 0;
+    r   = (r + 1) % nof_runs;
+  }
+
+  // Back to natural order. The third stream is delayed by one bit in the interleaver
+  rm_turbo_deinterleave_i8(v[0], y[0], nrows);
+  rm_turbo_deinterleave_i8(v[1], y[1], nrows);
+  rm_turbo_deinterleave_i8(v[2], y[2] + 1, nrows);
+  y[2][0] = y[2][K_p];
+
+  const int8_t* d[3] = {y[0] + ndummy, y[1] + ndummy, y[2] + ndummy};
+  if (nof_sb == 0) {
+    rm_turbo_adds_triplets_i8(d[0], d[1], d[2], output, D);
+  } else {
+    for (uint32_t j = 0; j < 3; j++) {
+      rm_turbo_adds_sb_i8(d[j], output + j * (K + 32), K / nof_sb, nof_sb);
+    }
+    // Tail bits keep their order after the three streams
+    for (uint32_t k = K; k < D; k++) {
+      for (uint32_t j = 0; j < 3; j++) {
+        int8_t* o = &output[3 * (k - K) + j + 3 * (K + 32)];
+        *o        = (int8_t)SRSRAN_MAX(INT8_MIN, SRSRAN_MIN(INT8_MAX, (int)*o + (int)d[j][k]));
+      }
+    }
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+#endif // LV_HAVE_AVX2
+
 void srsran_rm_turbo_gentables()
 {
   if (!rm_turbo_tables_generated) {
     rm_turbo_tables_generated = true;
+#ifdef LV_HAVE_AVX2
+    rm_turbo_gentable_triplets();
+#endif // LV_HAVE_AVX2
     for (int cb_idx = 0; cb_idx < SRSRAN_NOF_TC_CB_SIZES; cb_idx++) {
       int cb_len = srsran_cbsegm_cbsize(cb_idx);
       int in_len = 3 * cb_len + 12;
@@ -302,11 +619,17 @@ void srsran_rm_turbo_gentables()
                                   interleaver_parity_bits[cb_idx],
                                   (uint32_t)(srsran_cbsegm_cbsize(cb_idx) + 4) * 2);
 
+#ifdef LV_HAVE_AVX2
+      rm_turbo_gentable_runs(cb_idx, nrows, ndummy);
+#endif // LV_HAVE_AVX2
+
       for (int i = 0; i < 4; i++) {
         srsran_rm_turbo_gentable_receive(deinterleaver[cb_idx][i], in_len, i);
 
 #if SRSRAN_TDEC_EXPECT_INPUT_SB == 1
-        for (uint32_t s = 0; s < NOF_DEINTER_TABLE_SB_IDX; s++) {
+        // Only the sub-block sizes the selected turbo decoders can use
+        uint32_t max_sb = srsran_tdec_autoimp_get_subblocks_8bit(SRSRAN_TCOD_MAX_LEN_CB);
+        for (uint32_t s = 0; s < NOF_DEINTER_TABLE_SB_IDX && deinter_table_sb_idx[s] <= max_sb; s++) {
           interleave_table_sb(
               deinterleaver[cb_idx][i], deinterleaver_sb[s][cb_idx][i], cb_idx, deinter_table_sb_idx[s]);
         }
@@ -447,6 +770,9 @@ int srsran_rm_turbo_rx_lut_(int16_t* input,
 int srsran_rm_turbo_rx_lut_8bit(int8_t* input, int8_t* output, uint32_t in_len, uint32_t cb_idx, uint32_t rv_idx)
 {
   if (rv_idx < 4 && cb_idx < SRSRAN_NOF_TC_CB_SIZES) {
+#ifdef LV_HAVE_AVX2
+    return rm_turbo_rx_8bit_avx2(input, output, in_len, cb_idx, rv_idx);
+#else
 #if SRSRAN_TDEC_EXPECT_INPUT_SB == 1
     int       cb_len  = srsran_cbsegm_cbsize(cb_idx);
     int       idx     = deinter_table_idx_from_sb_len(srsran_tdec_autoimp_get_subblocks_8bit(cb_len));
@@ -476,6 +802,7 @@ int srsran_rm_turbo_rx_lut_8bit(int8_t* input, int8_t* output, uint32_t in_len,
     }
     return 0;
 #endif
+#endif // LV_HAVE_AVX2
   } else {
     printf("Invalid inputs rv_idx=%d, cb_idx=%d\n", rv_idx, cb_idx);
     return SRSRAN_ERROR_INVALID_INPUTS;
@@ -25,6 +25,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <strings.h>
+#include <sys/time.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -33,6 +34,7 @@
 uint32_t nof_e_bits = 0;
 uint32_t rv_idx     = 0;
 uint32_t cb_idx     = 0;
+uint32_t nof_reps   = 0;
 
 uint8_t systematic[6148], parity[2 * 6148];
 uint8_t systematic_bytes[6148 / 8 + 1], parity_bytes[2 * 6148 / 8 + 1];
@@ -44,16 +46,19 @@ uint8_t buff_b[BUFFSZ];
 float   buff_f[BUFFSZ];
 float   bits_f[3 * 6144 + 12];
 short   bits2_s[3 * 6144 + 12];
+int8_t  bits_c[3 * (6144 + 32) + 12];
+int8_t  bits2_c[3 * (6144 + 32) + 12];
 
 void usage(char* prog)
 {
-  printf("Usage: %s -c cb_idx -e nof_e_bits [-i rv_idx]\n", prog);
+  printf("Usage: %s -c cb_idx -e nof_e_bits [-i rv_idx] [-b nof_reps]\n", prog);
+  printf("\t-b benchmark the 8-bit de-rate-matching for nof_reps iterations [Default disabled]\n");
 }
 
 void parse_args(int argc, char** argv)
 {
   int opt;
-  while ((opt = getopt(argc, argv, "cei")) != -1) {
+  while ((opt = getopt(argc, argv, "ceib")) != -1) {
     switch (opt) {
       case 'c':
         cb_idx = (uint32_t)strtol(argv[optind], NULL, 10);
@@ -64,6 +69,9 @@ void parse_args(int argc, char** argv)
       case 'i':
         rv_idx = (uint32_t)strtol(argv[optind], NULL, 10);
         break;
+      case 'b':
+        nof_reps = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
       default:
         usage(argv[0]);
         exit(-1);
@@ -75,6 +83,96 @@ void parse_args(int argc, char** argv)
   }
 }
 
+/* Maps the natural order output of the rate dematcher to the order expected by the 8-bit turbo decoder */
+static uint32_t rx_8bit_idx(uint32_t idx, uint32_t cb_len)
+{
+  uint32_t k      = idx / 3;
+  uint32_t j      = idx % 3;
+  uint32_t nof_sb = SRSRAN_TDEC_EXPECT_INPUT_SB ? srsran_tdec_autoimp_get_subblocks_8bit(cb_len) : 0;
+
+  if (nof_sb == 0) {
+    return idx;
+  }
+  if (k >= cb_len) {
+    return idx - 3 * cb_len + 3 * (cb_len + 32);
+  }
+  uint32_t len = cb_len / nof_sb;
+  return j * (cb_len + 32) + (k % len) * nof_sb + k / len;
+}
+
+/* Checks the 8-bit de-rate-matching against the floating point one, combining two transmissions */
+static int test_rx_8bit(uint32_t cb_len, uint32_t long_cb_enc)
+{
+  uint32_t nof_bits = 3 * (cb_len + 32) + 12;
+  uint32_t nof_rep  = (2 * nof_e_bits) / long_cb_enc + 1;
+  int      max_llr  = SRSRAN_MAX(1, 127 / nof_rep);
+
+  float*  llr_f = srsran_vec_f_malloc(nof_e_bits);
+  int8_t* llr_c = srsran_vec_i8_malloc(nof_e_bits);
+  if (!llr_f || !llr_c) {
+    perror("malloc");
+    exit(-1);
+  }
+
+  srsran_vec_f_zero(buff_f, BUFFSZ);
+  srsran_vec_i8_zero(bits2_c, nof_bits);
+  for (uint32_t n = 0; n < 2; n++) {
+    // Small soft bits so that the combined values never saturate
+    uint32_t rv = (rv_idx + 2 * n) % 4;
+    for (int i = 0; i < nof_e_bits; i++) {
+      llr_c[i] = (int8_t)(rand() % (2 * max_llr + 1) - max_llr);
+      llr_f[i] = llr_c[i];
+    }
+    srsran_rm_turbo_rx(buff_f, BUFFSZ, llr_f, nof_e_bits, bits_f, long_cb_enc, rv, 0);
+    srsran_rm_turbo_rx_lut_8bit(llr_c, bits2_c, nof_e_bits, cb_idx, rv);
+  }
+
+  srsran_vec_i8_zero(bits_c, nof_bits);
+  for (uint32_t i = 0; i < long_cb_enc; i++) {
+    bits_c[rx_8bit_idx(i, cb_len)] = (int8_t)bits_f[i];
+  }
+  free(llr_f);
+  free(llr_c);
+
+  for (uint32_t i = 0; i < nof_bits; i++) {
+    if (bits_c[i] != bits2_c[i]) {
+      printf("error RX 8-bit in bit %d %d!=%d\n", i, bits_c[i], bits2_c[i]);
+      return SRSRAN_ERROR;
+    }
+  }
+  return SRSRAN_SUCCESS;
+}
+
+static void benchmark_rx_8bit(uint32_t cb_len)
+{
+  struct timeval t[3];
+  int8_t*        llr = srsran_vec_i8_malloc(nof_e_bits);
+  if (!llr) {
+    perror("malloc");
+    exit(-1);
+  }
+  for (int i = 0; i < nof_e_bits; i++) {
+    llr[i] = (int8_t)(rand() % 10 - 5);
+  }
+
+  srsran_vec_i8_zero(bits2_c, 3 * (cb_len + 32) + 12);
+  gettimeofday(&t[1], NULL);
+  for (uint32_t n = 0; n < nof_reps; n++) {
+    srsran_rm_turbo_rx_lut_8bit(llr, bits2_c, nof_e_bits, cb_idx, rv_idx);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+
+  double usec = (double)(t[0].tv_sec * 1000000 + t[0].tv_usec) / nof_reps;
+  printf("K=%4d; E=%5d; rv=%d; 8-bit RX: %6.2f usec, %8.1f Mbps\n",
+         cb_len,
+         nof_e_bits,
+         rv_idx,
+         usec,
+         nof_e_bits / usec);
+  free(llr);
+}
+
 int main(int argc, char** argv)
 {
   int      i;
@@ -188,7 +286,15 @@ int main(int argc, char** argv)
         }
       }
 
+      if (test_rx_8bit(srsran_cbsegm_cbsize(cb_idx), long_cb_enc) != SRSRAN_SUCCESS) {
+        exit(-1);
+      }
+
       printf("OK RX\n");
+
+      if (nof_reps > 0) {
+        benchmark_rx_8bit(srsran_cbsegm_cbsize(cb_idx));
+      }
     }
   }
 
@@ -0,0 +1,272 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "srsran/phy/utils/random.h"
+#include "srsran/srsran.h"
+
+#define MIN_ITERATIONS 2
+#define EBNO_SPREAD_DB 4.0f
+
+static uint32_t long_cb        = 0;
+static uint32_t nof_cb         = 0;
+static uint32_t max_iterations = 4;
+static float    ebno_db        = 1.0f;
+
+static void usage(char* prog)
+{
+  printf("Usage: %s\n", prog);
+  printf("\t-l long_cb, 0 for all batched sizes and a batch of mixed sizes [Default %u]\n", long_cb);
+  printf("\t-c number of code blocks, 0 for 2.5 times the number of lanes [Default %u]\n", nof_cb);
+  printf("\t-i maximum number of iterations [Default %u]\n", max_iterations);
+  printf("\t-e Eb/No of the first code block in dB [Default %.1f]\n", ebno_db);
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "lcie")) != -1) {
+    switch (opt) {
+      case 'l':
+        long_cb = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'c':
+        nof_cb = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'i':
+        max_iterations = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'e':
+        ebno_db = strtof(argv[optind], NULL);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+/* Decodes with srsran_tdec_t the same way the shared channel does, one code block at a time */
+static void decode_reference(srsran_tdec_t* tdec, srsran_tdec_batch_cb_t* cb)
+{
+  srsran_tdec_new_cb(tdec, cb->long_cb);
+
+  cb->crc_ok         = false;
+  cb->nof_iterations = 0;
+  do {
+    srsran_tdec_iteration(tdec, cb->input, cb->output);
+    cb->nof_iterations++;
+    if (!srsran_crc_checksum_byte(cb->crc, cb->output, cb->crc_len) && cb->nof_iterations >= MIN_ITERATIONS) {
+      cb->crc_ok = true;
+    }
+  } while (cb->nof_iterations < max_iterations && !cb->crc_ok);
+}
+
+/* Decodes nof_cb code blocks of the given lengths with the batched decoder and compares them with the reference */
+static int test_batch(srsran_random_t         random_gen,
+                      srsran_tcod_t*          tcod,
+                      srsran_crc_t*           crc,
+                      srsran_tdec_t*          tdec,
+                      srsran_tdec_batch_t*    batch,
+                      srsran_tdec_batch_cb_t* cb_ref,
+                      srsran_tdec_batch_cb_t* cb_batch,
+                      const uint32_t*         cb_len,
+                      const char*             name)
+{
+  uint8_t bits[SRSRAN_TCOD_MAX_LEN_CB];
+  uint8_t symbols[3 * SRSRAN_TCOD_MAX_LEN_CB + SRSRAN_TCOD_TOTALTAIL];
+  float   llr[3 * SRSRAN_TCOD_MAX_LEN_CB + SRSRAN_TCOD_TOTALTAIL];
+
+  for (uint32_t i = 0; i < nof_cb; i++) {
+    // Spread the code blocks over 4 dB so that some of them stop early and some run all iterations
+    float    esno_db      = ebno_db + EBNO_SPREAD_DB * i / nof_cb + srsran_convert_power_to_dB(1.0f / 3.0f);
+    float    var          = srsran_convert_dB_to_power(-esno_db);
+    uint32_t coded_length = 3 * cb_len[i] + SRSRAN_TCOD_TOTALTAIL;
+
+    for (uint32_t j = 0; j < cb_len[i] - 24; j++) {
+      bits[j] = srsran_random_uniform_int_dist(random_gen, 0, 1);
+    }
+    srsran_crc_attach(crc, bits, cb_len[i] - 24);
+    srsran_tcod_encode(tcod, bits, symbols, cb_len[i]);
+    for (uint32_t j = 0; j < coded_length; j++) {
+      llr[j] = symbols[j] ? 1 : -1;
+    }
+    srsran_ch_awgn_f(llr, llr, var, coded_length);
+    for (uint32_t j = 0; j < coded_length; j++) {
+      cb_ref[i].input[j] = (int16_t)(100 * llr[j]);
+    }
+    cb_ref[i].long_cb = cb_len[i];
+    cb_ref[i].crc     = crc;
+    cb_ref[i].crc_len = cb_len[i];
+
+    cb_batch[i].long_cb = cb_len[i];
+    cb_batch[i].input   = cb_ref[i].input;
+    cb_batch[i].crc     = crc;
+    cb_batch[i].crc_len = cb_len[i];
+  }
+
+  struct timeval t[3];
+  gettimeofday(&t[1], NULL);
+  for (uint32_t i = 0; i < nof_cb; i++) {
+    decode_reference(tdec, &cb_ref[i]);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+  double usec_ref = t[0].tv_sec * 1e6 + t[0].tv_usec;
+
+  srsran_tdec_batch_run(batch, cb_batch, nof_cb, MIN_ITERATIONS, max_iterations);
+  gettimeofday(&t[1], NULL);
+  if (srsran_tdec_batch_run(batch, cb_batch, nof_cb, MIN_ITERATIONS, max_iterations)) {
+    ERROR("Error running batched decoder");
+    return SRSRAN_ERROR;
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+  double usec_batch = t[0].tv_sec * 1e6 + t[0].tv_usec;
+
+  uint32_t nof_crc_ok = 0;
+  for (uint32_t i = 0; i < nof_cb; i++) {
+    if (memcmp(cb_ref[i].output, cb_batch[i].output, cb_len[i] / 8) != 0 ||
+        cb_ref[i].crc_ok != cb_batch[i].crc_ok || cb_ref[i].nof_iterations != cb_batch[i].nof_iterations) {
+      ERROR("Mismatch in long_cb=%d, cb=%d (crc %d/%d, iterations %d/%d)",
+            cb_len[i],
+            i,
+            cb_ref[i].crc_ok,
+            cb_batch[i].crc_ok,
+            cb_ref[i].nof_iterations,
+            cb_batch[i].nof_iterations);
+      return SRSRAN_ERROR;
+    }
+    nof_crc_ok += cb_batch[i].crc_ok ? 1 : 0;
+  }
+
+  printf("%-12s crc_ok=%3d/%d; reference %8.1f us; batch %8.1f us; speedup %.1f\n",
+         name,
+         nof_crc_ok,
+         nof_cb,
+         usec_ref,
+         usec_batch,
+         usec_ref / usec_batch);
+
+  return SRSRAN_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  int                     ret        = SRSRAN_ERROR;
+  srsran_random_t         random_gen = srsran_random_init(0);
+  srsran_tcod_t           tcod       = {};
+  srsran_tdec_t           tdec       = {};
+  srsran_tdec_batch_t     batch      = {};
+  srsran_crc_t            crc        = {};
+  srsran_tdec_batch_cb_t* cb_ref     = NULL;
+  srsran_tdec_batch_cb_t* cb_batch   = NULL;
+  uint32_t*               cb_len     = NULL;
+  char                    name[32];
+
+  parse_args(argc, argv);
+
+  if (nof_cb == 0) {
+    nof_cb = (5 * srsran_tdec_batch_nof_lanes() + 1) / 2;
+  }
+  printf("Batched decoder lanes: %d; code blocks: %d\n", srsran_tdec_batch_nof_lanes(), nof_cb);
+
+  if (srsran_tcod_init(&tcod, SRSRAN_TCOD_MAX_LEN_CB) || srsran_tdec_init(&tdec, SRSRAN_TCOD_MAX_LEN_CB) ||
+      srsran_tdec_batch_init(&batch, SRSRAN_TDEC_BATCH_MAX_LONG_CB) || srsran_crc_init(&crc, SRSRAN_LTE_CRC24B, 24)) {
+    ERROR("Error initiating");
+    goto clean_exit;
+  }
+
+  cb_ref   = calloc(nof_cb, sizeof(srsran_tdec_batch_cb_t));
+  cb_batch = calloc(nof_cb, sizeof(srsran_tdec_batch_cb_t));
+  cb_len   = calloc(nof_cb, sizeof(uint32_t));
+  if (!cb_ref || !cb_batch || !cb_len) {
+    perror("calloc");
+    goto clean_exit;
+  }
+  for (uint32_t i = 0; i < nof_cb; i++) {
+    cb_ref[i].input    = srsran_vec_i16_malloc(3 * SRSRAN_TDEC_BATCH_MAX_LONG_CB + SRSRAN_TCOD_TOTALTAIL);
+    cb_ref[i].output   = srsran_vec_u8_malloc(SRSRAN_TDEC_BATCH_MAX_LONG_CB / 8);
+    cb_batch[i].output = srsran_vec_u8_malloc(SRSRAN_TDEC_BATCH_MAX_LONG_CB / 8);
+    if (!cb_ref[i].input || !cb_ref[i].output || !cb_batch[i].output) {
+      perror("malloc");
+      goto clean_exit;
+    }
+  }
+
+  if (long_cb) {
+    if (!srsran_tdec_batch_is_supported(&batch, long_cb)) {
+      ERROR("long_cb=%d is not decoded by the batched decoder", long_cb);
+      goto clean_exit;
+    }
+    for (uint32_t i = 0; i < nof_cb; i++) {
+      cb_len[i] = long_cb;
+    }
+    snprintf(name, sizeof(name), "long_cb=%d;", long_cb);
+    ret = test_batch(random_gen, &tcod, &crc, &tdec, &batch, cb_ref, cb_batch, cb_len, name);
+  } else {
+    ret = SRSRAN_SUCCESS;
+    for (uint32_t i = 0; i < SRSRAN_NOF_TC_CB_SIZES && ret == SRSRAN_SUCCESS; i++) {
+      long_cb = srsran_cbsegm_cbsize(i);
+      if (srsran_tdec_batch_is_supported(&batch, long_cb)) {
+        for (uint32_t j = 0; j < nof_cb; j++) {
+          cb_len[j] = long_cb;
+        }
+        snprintf(name, sizeof(name), "long_cb=%d;", long_cb);
+        ret = test_batch(random_gen, &tcod, &crc, &tdec, &batch, cb_ref, cb_batch, cb_len, name);
+      }
+    }
+
+    // Code blocks of random lengths share the lanes, the shorter ones are padded to the longest of their batch
+    uint32_t nof_sizes = 0;
+    while (srsran_tdec_batch_is_supported(&batch, srsran_cbsegm_cbsize(nof_sizes))) {
+      nof_sizes++;
+    }
+    for (uint32_t i = 0; i < nof_cb; i++) {
+      cb_len[i] = srsran_cbsegm_cbsize(srsran_random_uniform_int_dist(random_gen, 0, nof_sizes - 1));
+    }
+    if (ret == SRSRAN_SUCCESS) {
+      ret = test_batch(random_gen, &tcod, &crc, &tdec, &batch, cb_ref, cb_batch, cb_len, "mixed;");
+    }
+  }
+
+clean_exit:
+  for (uint32_t i = 0; i < nof_cb && cb_ref && cb_batch; i++) {
+    free(cb_ref[i].input);
+    free(cb_ref[i].output);
+    free(cb_batch[i].output);
+  }
+  free(cb_ref);
+  free(cb_batch);
+  free(cb_len);
+  srsran_tcod_free(&tcod);
+  srsran_tdec_free(&tdec);
+  srsran_tdec_batch_free(&batch);
+  srsran_random_free(random_gen);
+
+  printf("%s\n", ret == SRSRAN_SUCCESS ? "Ok" : "Error");
+  return ret;
+}
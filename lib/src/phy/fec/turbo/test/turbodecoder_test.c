@@ -29,6 +29,7 @@
 
 #include "srsran/srsran.h"
 #include <srsran/phy/utils/random.h>
+#include <srsran/phy/utils/simd_dispatch.h>
 #include <sys/time.h>
 #include <time.h>
 
@@ -45,16 +46,56 @@ int nof_iterations  = MAX_ITERATIONS;
 int test_known_data = 0;
 int test_errors     = 0;
 int nof_repetitions = 1;
+int benchmark_impl  = 0;
 
 srsran_tdec_impl_type_t tdec_type;
 
+// Shortest sub-block length the automatic selection would pick a windowed decoder for
+#define BENCHMARK_MIN_SB_LEN 50
+
+// From this Eb/N0 every implementation leaves the waterfall region and shall decode (almost) without errors. Below it,
+// the BER is only checked against a decoder which does not converge at all
+#define BENCHMARK_WATERFALL_EBNO_DB 4.5f
+#define BENCHMARK_MAX_BER_CONVERGED 1e-3f
+#define BENCHMARK_MAX_BER_WATERFALL 0.4f
+
+typedef struct {
+  srsran_tdec_impl_type_t type;
+  const char*             name;
+  bool                    is_8bit;
+  srsran_simd_isa_t       isa;
+} tdec_impl_desc_t;
+
+static const tdec_impl_desc_t tdec_impl_list[] = {
+    {SRSRAN_TDEC_AUTO, "auto-16", false, SRSRAN_SIMD_ISA_GENERIC},
+    {SRSRAN_TDEC_AUTO, "auto-8", true, SRSRAN_SIMD_ISA_GENERIC},
+#ifdef HAVE_NEON
+    {SRSRAN_TDEC_NEON_WINDOW, "neon16-win", false, SRSRAN_SIMD_ISA_NEON},
+#else  /* HAVE_NEON */
+    {SRSRAN_TDEC_GENERIC, "generic", false, SRSRAN_SIMD_ISA_GENERIC},
+#endif /* HAVE_NEON */
+#ifdef LV_HAVE_SSE
+    {SRSRAN_TDEC_SSE, "sse16", false, SRSRAN_SIMD_ISA_SSE41},
+    {SRSRAN_TDEC_SSE_WINDOW, "sse16-win", false, SRSRAN_SIMD_ISA_SSE41},
+    {SRSRAN_TDEC_SSE8_WINDOW, "sse8-win", true, SRSRAN_SIMD_ISA_SSE41},
+#endif /* LV_HAVE_SSE */
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+    {SRSRAN_TDEC_AVX_WINDOW, "avx16-win", false, SRSRAN_SIMD_ISA_AVX2},
+    {SRSRAN_TDEC_AVX8_WINDOW, "avx8-win", true, SRSRAN_SIMD_ISA_AVX2},
+#endif /* SRSRAN_SIMD_HAVE_AVX2 */
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+    {SRSRAN_TDEC_AVX512_WINDOW, "avx512-16-win", false, SRSRAN_SIMD_ISA_AVX512},
+    {SRSRAN_TDEC_AVX512_8_WINDOW, "avx512-8-win", true, SRSRAN_SIMD_ISA_AVX512},
+#endif /* SRSRAN_SIMD_HAVE_AVX512 */
+};
+
 #define SNR_POINTS 4
 #define SNR_MIN 1.0
 #define SNR_MAX 8.0
 
 void usage(char* prog)
 {
-  printf("Usage: %s [kcinNledts]\n", prog);
+  printf("Usage: %s [kcinNledtsb]\n", prog);
   printf("\t-k Test with known data (ignores frame_length) [Default disabled]\n");
   printf("\t-c nof_cb in parallel [Default %d]\n", nof_cb);
   printf("\t-i nof_iterations [Default %d]\n", nof_iterations);
@@ -65,12 +106,13 @@ void usage(char* prog)
   printf("\t-d Decoder implementation type: 0: Generic, 1: SSE, 2: SSE-window\n");
   printf("\t-t test: check errors on exit [Default disabled]\n");
   printf("\t-s seed [Default 0=time]\n");
+  printf("\t-b benchmark: report Mbps and check the BER of every available implementation [Default disabled]\n");
 }
 
 void parse_args(int argc, char** argv)
 {
   int opt;
-  while ((opt = getopt(argc, argv, "kcinNledts")) != -1) {
+  while ((opt = getopt(argc, argv, "kcinNledtsb")) != -1) {
     switch (opt) {
       case 'c':
         nof_cb = (int)strtol(argv[optind], NULL, 10);
@@ -102,6 +144,9 @@ void parse_args(int argc, char** argv)
       case 's':
         seed = (uint32_t)strtoul(argv[optind], NULL, 0);
         break;
+      case 'b':
+        benchmark_impl = 1;
+        break;
       case 'v':
         increase_srsran_verbose_level();
         break;
@@ -112,6 +157,118 @@ void parse_args(int argc, char** argv)
   }
 }
 
+/* Decodes the same noisy codewords with every implementation compiled in and prints throughput and BER. Fails if the
+ * BER of any implementation is above the one expected at the given Eb/N0 */
+static int benchmark(srsran_random_t random_gen, srsran_tcod_t* tcod, float ebno, uint32_t coded_length)
+{
+  // Keep every codeword aligned, some decoders load the input with aligned instructions
+  uint32_t stride        = SRSRAN_CEIL(coded_length, 64) * 64;
+  int      ret           = SRSRAN_ERROR;
+  uint8_t* data_tx       = srsran_vec_u8_malloc(frame_length * nof_frames);
+  uint8_t* data_rx       = srsran_vec_u8_malloc(frame_length);
+  uint8_t* data_rx_bytes = srsran_vec_u8_malloc(frame_length);
+  uint8_t* symbols       = srsran_vec_u8_malloc(coded_length);
+  float*   llr           = srsran_vec_f_malloc(coded_length);
+  int16_t* llr_s         = srsran_vec_i16_malloc(stride * nof_frames);
+  int8_t*  llr_c         = srsran_vec_i8_malloc(stride * nof_frames);
+  if (!data_tx || !data_rx || !data_rx_bytes || !symbols || !llr || !llr_s || !llr_c) {
+    perror("malloc");
+    goto clean_exit;
+  }
+
+  uint32_t t       = (nof_iterations == -1) ? MAX_ITERATIONS : nof_iterations;
+  float    var     = srsran_convert_dB_to_power(-(ebno + srsran_convert_power_to_dB(1.0f / 3.0f)));
+  float    max_ber = (ebno < BENCHMARK_WATERFALL_EBNO_DB) ? BENCHMARK_MAX_BER_WATERFALL : BENCHMARK_MAX_BER_CONVERGED;
+  bool     ber_ok  = true;
+
+  // Generate all codewords upfront so that only the decoder is timed
+  for (uint32_t f = 0; f < nof_frames; f++) {
+    for (uint32_t j = 0; j < frame_length; j++) {
+      data_tx[f * frame_length + j] = srsran_random_uniform_int_dist(random_gen, 0, 1);
+    }
+    srsran_tcod_encode(tcod, &data_tx[f * frame_length], symbols, frame_length);
+    for (uint32_t j = 0; j < coded_length; j++) {
+      llr[j] = symbols[j] ? 1 : -1;
+    }
+    srsran_ch_awgn_f(llr, llr, var, coded_length);
+    for (uint32_t j = 0; j < coded_length; j++) {
+      llr_s[f * stride + j] = (int16_t)(100 * llr[j]);
+    }
+    srsran_vec_convert_fb(llr, 10, &llr_c[f * stride], coded_length);
+  }
+
+  printf("%-16s %10s %12s %10s\n", "Implementation", "Mbps", "usec/cb", "BER");
+  for (uint32_t n = 0; n < sizeof(tdec_impl_list) / sizeof(tdec_impl_desc_t); n++) {
+    const tdec_impl_desc_t* impl = &tdec_impl_list[n];
+    srsran_tdec_t           tdec;
+
+    // Skip the implementations that the selected SIMD instruction set can not run
+    if (!srsran_simd_isa_enabled(impl->isa)) {
+      printf("%-16s %10s\n", impl->name, "n/a");
+      continue;
+    }
+
+    if (srsran_tdec_init_manual(&tdec, frame_length, impl->type)) {
+      ERROR("Error initiating Turbo decoder %s", impl->name);
+      goto clean_exit;
+    }
+    srsran_tdec_force_not_sb(&tdec);
+
+    // Windowed decoders only work when the codeblock splits into long enough sub-blocks
+    int nof_sb = (impl->type == SRSRAN_TDEC_AUTO) ? 1 : (impl->is_8bit ? tdec.nof_blocks8[0] : tdec.nof_blocks16[0]);
+    if (nof_sb > 1 && (frame_length % nof_sb || frame_length / nof_sb < BENCHMARK_MIN_SB_LEN)) {
+      printf("%-16s %10s\n", impl->name, "n/a");
+      srsran_tdec_free(&tdec);
+      continue;
+    }
+
+    uint32_t       errors = 0;
+    struct timeval tdata[3];
+    gettimeofday(&tdata[1], NULL);
+    for (uint32_t f = 0; f < nof_frames; f++) {
+      if (impl->is_8bit) {
+        srsran_tdec_run_all_8bit(&tdec, &llr_c[f * stride], data_rx_bytes, t, frame_length);
+      } else {
+        srsran_tdec_run_all(&tdec, &llr_s[f * stride], data_rx_bytes, t, frame_length);
+      }
+      srsran_bit_unpack_vector(data_rx_bytes, data_rx, frame_length);
+      errors += srsran_bit_diff(&data_tx[f * frame_length], data_rx, frame_length);
+    }
+    gettimeofday(&tdata[2], NULL);
+    get_time_interval(tdata);
+
+    float usec = (float)(tdata[0].tv_sec * 1e6 + tdata[0].tv_usec) / nof_frames;
+    float ber  = (float)errors / (nof_frames * frame_length);
+    printf("%-16s %10.1f %12.2f %10.2e%s\n",
+           impl->name,
+           (float)frame_length / usec,
+           usec,
+           ber,
+           (ber > max_ber) ? " *" : "");
+    if (ber > max_ber) {
+      ber_ok = false;
+    }
+
+    srsran_tdec_free(&tdec);
+  }
+
+  if (!ber_ok) {
+    ERROR("The implementations marked with * exceed the maximum BER %.1e at Eb/N0=%.1f dB", max_ber, ebno);
+    goto clean_exit;
+  }
+  ret = SRSRAN_SUCCESS;
+
+clean_exit:
+  free(data_tx);
+  free(data_rx);
+  free(data_rx_bytes);
+  free(symbols);
+  free(llr);
+  free(llr_s);
+  free(llr_c);
+  return ret;
+}
+
 int main(int argc, char** argv)
 {
   srsran_random_t random_gen = srsran_random_init(0);
@@ -196,6 +353,20 @@ int main(int argc, char** argv)
     exit(-1);
   }
 
+  if (benchmark_impl) {
+    int ret = benchmark(random_gen, &tcod, ebno_db < 100.0 ? ebno_db : SNR_MAX, coded_length);
+    free(data_rx_bytes);
+    free(data_tx);
+    free(symbols);
+    free(llr);
+    free(llr_c);
+    free(llr_s);
+    free(data_rx);
+    srsran_tcod_free(&tcod);
+    srsran_random_free(random_gen);
+    exit(ret);
+  }
+
 #ifdef HAVE_NEON
   tdec_type = SRSRAN_TDEC_NEON_WINDOW;
 #else
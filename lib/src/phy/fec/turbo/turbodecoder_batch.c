@@ -0,0 +1,523 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "srsran/phy/fec/turbo/turbodecoder.h"
+#include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd.h"
+#include "srsran/phy/utils/vector.h"
+#include "turbodecoder_batch_dispatch.h"
+
+#define NUMSTATES 8
+#define NINPUTS 2
+#define TAIL 3
+
+#define INF 10000
+
+/* All buffers are lane-interleaved: the value of trellis step k for the code block in lane l is stored at
+ * [k * NOF_LANES + l]. This way every operation of the generic decoder becomes a vertical SIMD operation. */
+#if SRSRAN_SIMD_S_SIZE
+#define NOF_LANES SRSRAN_SIMD_S_SIZE
+#define lane_t simd_s_t
+#define lane_load srsran_simd_s_load
+#define lane_store srsran_simd_s_store
+#define lane_set1 srsran_simd_s_set1
+#define lane_add srsran_simd_s_add
+#define lane_sub srsran_simd_s_sub
+#define lane_max srsran_simd_s_max
+#else /* SRSRAN_SIMD_S_SIZE */
+#define NOF_LANES 1
+#define lane_t int16_t
+#define lane_load(PTR) (*(PTR))
+#define lane_store(PTR, X) (*(PTR) = (X))
+#define lane_set1(X) ((int16_t)(X))
+#define lane_add(A, B) ((int16_t)((A) + (B)))
+#define lane_sub(A, B) ((int16_t)((A) - (B)))
+#define lane_max(A, B) ((A) > (B) ? (A) : (B))
+#endif /* SRSRAN_SIMD_S_SIZE */
+
+/* Code block lengths of the lanes decoded together. The trellis runs over the longest one, the shorter code blocks are
+ * followed by their own tail and then by zero LLR */
+typedef struct {
+  uint32_t long_cb;            // Longest code block of the batch
+  uint32_t len[NOF_LANES];     // Code block length of every lane, 0 for the unused lanes
+  uint32_t nof_resets;         // Number of distinct beta recursion starts of the shorter code blocks
+  int      reset_k[NOF_LANES]; // Trellis steps where those recursions start, in decreasing order
+  bool     mixed;              // Some code block is shorter than long_cb, the lanes need their own interleaver
+  bool     padded;             // Some code block is shorter than long_cb or some lane is unused
+} tdec_batch_lanes_t;
+
+int srsran_tdec_batch_init(srsran_tdec_batch_t* q, uint32_t max_long_cb)
+{
+  if (q == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  SRSRAN_MEM_ZERO(q, srsran_tdec_batch_t, 1);
+
+  q->max_long_cb = max_long_cb;
+
+  uint32_t len = (max_long_cb + TAIL) * NOF_LANES;
+
+  q->syst    = srsran_vec_i16_malloc(len);
+  q->parity0 = srsran_vec_i16_malloc(len);
+  q->parity1 = srsran_vec_i16_malloc(len);
+  q->app1    = srsran_vec_i16_malloc(len);
+  q->app2    = srsran_vec_i16_malloc(len);
+  q->ext1    = srsran_vec_i16_malloc(len);
+  q->ext2    = srsran_vec_i16_malloc(len);
+  q->beta    = srsran_vec_i16_malloc((max_long_cb + TAIL + 1) * NUMSTATES * NOF_LANES);
+  if (!q->syst || !q->parity0 || !q->parity1 || !q->app1 || !q->app2 || !q->ext1 || !q->ext2 || !q->beta) {
+    perror("srsran_vec_malloc");
+    srsran_tdec_batch_free(q);
+    return SRSRAN_ERROR;
+  }
+
+  // The code blocks of a batch may have different lengths, generate all the interleavers upfront
+  for (uint32_t i = 0; i < SRSRAN_NOF_TC_CB_SIZES; i++) {
+    uint32_t long_cb = (uint32_t)srsran_cbsegm_cbsize(i);
+    if (long_cb > max_long_cb) {
+      break;
+    }
+    if (srsran_tc_interl_init(&q->interleaver[i], long_cb) < SRSRAN_SUCCESS ||
+        srsran_tc_interl_LTE_gen(&q->interleaver[i], long_cb) < SRSRAN_SUCCESS) {
+      ERROR("Error initiating interleaver for long_cb=%d", long_cb);
+      srsran_tdec_batch_free(q);
+      return SRSRAN_ERROR;
+    }
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+void srsran_tdec_batch_free(srsran_tdec_batch_t* q)
+{
+  if (q == NULL) {
+    return;
+  }
+
+  if (q->syst) {
+    free(q->syst);
+  }
+  if (q->parity0) {
+    free(q->parity0);
+  }
+  if (q->parity1) {
+    free(q->parity1);
+  }
+  if (q->app1) {
+    free(q->app1);
+  }
+  if (q->app2) {
+    free(q->app2);
+  }
+  if (q->ext1) {
+    free(q->ext1);
+  }
+  if (q->ext2) {
+    free(q->ext2);
+  }
+  if (q->beta) {
+    free(q->beta);
+  }
+  for (uint32_t i = 0; i < SRSRAN_NOF_TC_CB_SIZES; i++) {
+    srsran_tc_interl_free(&q->interleaver[i]);
+  }
+
+  SRSRAN_MEM_ZERO(q, srsran_tdec_batch_t, 1);
+}
+
+uint32_t srsran_tdec_batch_nof_lanes()
+{
+  return NOF_LANES;
+}
+
+bool srsran_tdec_batch_is_supported(srsran_tdec_batch_t* q, uint32_t long_cb)
+{
+  // Code blocks suitable for the windowed decoders are faster decoded one at a time
+  return q != NULL && q->beta != NULL && long_cb <= q->max_long_cb && srsran_cbsegm_cbindex(long_cb) >= 0 &&
+         srsran_tdec_autoimp_get_subblocks(long_cb) == 0;
+}
+
+/* Sets the beta of the lanes whose tail ends at trellis step k + 1 to the terminated state */
+static void tdec_batch_beta_reset(lane_t* old, const tdec_batch_lanes_t* lanes, int k)
+{
+  int16_t tmp[NOF_LANES] __attribute__((aligned(64)));
+
+  for (uint32_t i = 0; i < NUMSTATES; i++) {
+    lane_store(tmp, old[i]);
+    for (uint32_t l = 0; l < NOF_LANES; l++) {
+      if (lanes->len[l] && (int)(lanes->len[l] + TAIL - 1) == k) {
+        tmp[l] = i ? -INF : 0;
+      }
+    }
+    old[i] = lane_load(tmp);
+  }
+}
+
+/* MAX-LOG-MAP constituent decoder, same trellis and normalization as map_gen_beta() and map_gen_alpha() */
+static void tdec_batch_map(srsran_tdec_batch_t*      q,
+                           const tdec_batch_lanes_t* lanes,
+                           int16_t*                  input,
+                           int16_t*                  app,
+                           int16_t*                  parity,
+                           int16_t*                  output)
+{
+  lane_t   m_b[NUMSTATES], new[NUMSTATES], old[NUMSTATES];
+  lane_t   x, y, xy;
+  int16_t* beta    = q->beta;
+  int      long_cb = (int)lanes->long_cb;
+  uint32_t reset   = 0;
+  int      k;
+  uint32_t i;
+
+  // Beta recursion, starts from the terminated state at the end of the tail
+  old[0] = lane_set1(0);
+  for (i = 1; i < NUMSTATES; i++) {
+    old[i] = lane_set1(-INF);
+  }
+
+  for (k = long_cb + TAIL - 1; k >= 0; k--) {
+    // Shorter code blocks start from the terminated state at the end of their own tail
+    if (reset < lanes->nof_resets && k == lanes->reset_k[reset]) {
+      tdec_batch_beta_reset(old, lanes, k);
+      reset++;
+    }
+
+    x = lane_load(&input[k * NOF_LANES]);
+    if (app && k < long_cb) {
+      x = lane_add(x, lane_load(&app[k * NOF_LANES]));
+    }
+    y  = lane_load(&parity[k * NOF_LANES]);
+    xy = lane_add(x, y);
+
+    m_b[0] = lane_add(old[4], xy);
+    m_b[1] = old[4];
+    m_b[2] = lane_add(old[5], y);
+    m_b[3] = lane_add(old[5], x);
+    m_b[4] = lane_add(old[6], x);
+    m_b[5] = lane_add(old[6], y);
+    m_b[6] = old[7];
+    m_b[7] = lane_add(old[7], xy);
+
+    new[0] = old[0];
+    new[1] = lane_add(old[0], xy);
+    new[2] = lane_add(old[1], x);
+    new[3] = lane_add(old[1], y);
+    new[4] = lane_add(old[2], y);
+    new[5] = lane_add(old[2], x);
+    new[6] = lane_add(old[3], xy);
+    new[7] = old[3];
+
+    for (i = 0; i < NUMSTATES; i++) {
+      old[i] = lane_max(m_b[i], new[i]);
+      lane_store(&beta[(NUMSTATES * k + i) * NOF_LANES], old[i]);
+    }
+
+    if ((k % 4) == 0 && k < long_cb) {
+      for (i = 1; i < NUMSTATES; i++) {
+        old[i] = lane_sub(old[i], old[0]);
+      }
+      old[0] = lane_set1(0);
+    }
+  }
+
+  // Alpha recursion and output LLR
+  old[0] = lane_set1(0);
+  for (i = 1; i < NUMSTATES; i++) {
+    old[i] = lane_set1(-INF);
+  }
+
+  for (k = 1; k < long_cb + 1; k++) {
+    x = lane_load(&input[(k - 1) * NOF_LANES]);
+    if (app) {
+      x = lane_add(x, lane_load(&app[(k - 1) * NOF_LANES]));
+    }
+    y  = lane_load(&parity[(k - 1) * NOF_LANES]);
+    xy = lane_add(x, y);
+
+    m_b[0] = old[0];
+    m_b[1] = lane_add(old[3], y);
+    m_b[2] = lane_add(old[4], y);
+    m_b[3] = old[7];
+    m_b[4] = old[1];
+    m_b[5] = lane_add(old[2], y);
+    m_b[6] = lane_add(old[5], y);
+    m_b[7] = old[6];
+
+    new[0] = lane_add(old[1], xy);
+    new[1] = lane_add(old[2], x);
+    new[2] = lane_add(old[5], x);
+    new[3] = lane_add(old[6], xy);
+    new[4] = lane_add(old[0], xy);
+    new[5] = lane_add(old[3], x);
+    new[6] = lane_add(old[4], x);
+    new[7] = lane_add(old[7], xy);
+
+    lane_t b  = lane_load(&beta[(NUMSTATES * k) * NOF_LANES]);
+    lane_t m0 = lane_add(m_b[0], b);
+    lane_t m1 = lane_add(new[0], b);
+    for (i = 1; i < NUMSTATES; i++) {
+      b  = lane_load(&beta[(NUMSTATES * k + i) * NOF_LANES]);
+      m0 = lane_max(m0, lane_add(m_b[i], b));
+      m1 = lane_max(m1, lane_add(new[i], b));
+    }
+
+    for (i = 0; i < NUMSTATES; i++) {
+      old[i] = lane_max(m_b[i], new[i]);
+    }
+
+    if ((k % 4) == 0) {
+      for (i = 1; i < NUMSTATES; i++) {
+        old[i] = lane_sub(old[i], old[0]);
+      }
+      old[0] = lane_set1(0);
+    }
+
+    lane_store(&output[(k - 1) * NOF_LANES], lane_sub(m1, m0));
+  }
+}
+
+/* Applies the permutation y[lut[i]] = x[i] of the code block length to every lane */
+static void tdec_batch_lut(srsran_tdec_batch_t* q, const tdec_batch_lanes_t* lanes, const int16_t* x, int16_t* y, bool fw)
+{
+  if (!lanes->mixed) {
+    srsran_tc_interl_t* interl = &q->interleaver[srsran_cbsegm_cbindex(lanes->long_cb)];
+    const uint16_t*     lut    = fw ? interl->forward : interl->reverse;
+    for (uint32_t i = 0; i < lanes->long_cb; i++) {
+      lane_store(&y[lut[i] * NOF_LANES], lane_load(&x[i * NOF_LANES]));
+    }
+    return;
+  }
+
+  // Every code block has its own interleaver, the padding after each of them is left untouched
+  for (uint32_t l = 0; l < NOF_LANES; l++) {
+    if (lanes->len[l] == 0) {
+      continue;
+    }
+    srsran_tc_interl_t* interl = &q->interleaver[srsran_cbsegm_cbindex(lanes->len[l])];
+    const uint16_t*     lut    = fw ? interl->forward : interl->reverse;
+    for (uint32_t i = 0; i < lanes->len[l]; i++) {
+      y[lut[i] * NOF_LANES + l] = x[i * NOF_LANES + l];
+    }
+  }
+}
+
+/* Zeroes the steps [start, end) of a lane */
+static void tdec_batch_zero(int16_t* x, uint32_t lane, uint32_t start, uint32_t end)
+{
+  for (uint32_t i = start; i < end; i++) {
+    x[i * NOF_LANES + lane] = 0;
+  }
+}
+
+/* Clears the decoder output after the end of every shorter code block and in the unused lanes, so that it never becomes
+ * a priori information of a tail or of the padding */
+static void tdec_batch_clear_padding(const tdec_batch_lanes_t* lanes, int16_t* x)
+{
+  if (!lanes->padded) {
+    return;
+  }
+  for (uint32_t l = 0; l < NOF_LANES; l++) {
+    tdec_batch_zero(x, l, lanes->len[l], lanes->long_cb);
+  }
+}
+
+/* Same input layout as tdec_gen_extract_input(), writes the code block into its lane */
+static void tdec_batch_extract_input(srsran_tdec_batch_t* q, const int16_t* input, uint32_t lane, uint32_t long_cb)
+{
+  for (uint32_t i = 0; i < long_cb; i++) {
+    q->syst[i * NOF_LANES + lane]    = input[SRSRAN_TCOD_RATE * i];
+    q->parity0[i * NOF_LANES + lane] = input[SRSRAN_TCOD_RATE * i + 1];
+    q->parity1[i * NOF_LANES + lane] = input[SRSRAN_TCOD_RATE * i + 2];
+  }
+  for (uint32_t i = long_cb; i < long_cb + TAIL; i++) {
+    const int16_t* tail = &input[SRSRAN_TCOD_RATE * long_cb];
+
+    q->syst[i * NOF_LANES + lane]    = tail[NINPUTS * (i - long_cb)];
+    q->parity0[i * NOF_LANES + lane] = tail[NINPUTS * (i - long_cb) + 1];
+    q->app2[i * NOF_LANES + lane]    = tail[NINPUTS * TAIL + NINPUTS * (i - long_cb)];
+    q->parity1[i * NOF_LANES + lane] = tail[NINPUTS * TAIL + NINPUTS * (i - long_cb) + 1];
+  }
+}
+
+static void tdec_batch_decision_byte(const int16_t* llr, uint32_t lane, uint8_t* output, uint32_t long_cb)
+{
+  for (uint32_t i = 0; i < long_cb / 8; i++) {
+    uint8_t byte = 0;
+    for (uint32_t j = 0; j < 8; j++) {
+      byte |= (llr[(8 * i + j) * NOF_LANES + lane] > 0) ? (0x80 >> j) : 0;
+    }
+    output[i] = byte;
+  }
+}
+
+/* Loads the code blocks into their lanes. Shorter code blocks and unused lanes are padded with zero LLR */
+static void tdec_batch_load_lanes(srsran_tdec_batch_t*    q,
+                                  tdec_batch_lanes_t*     lanes,
+                                  srsran_tdec_batch_cb_t* cb,
+                                  uint32_t                nof_cb)
+{
+  SRSRAN_MEM_ZERO(lanes, tdec_batch_lanes_t, 1);
+  for (uint32_t l = 0; l < nof_cb; l++) {
+    lanes->len[l]  = cb[l].long_cb;
+    lanes->long_cb = SRSRAN_MAX(lanes->long_cb, cb[l].long_cb);
+  }
+
+  for (uint32_t l = 0; l < NOF_LANES; l++) {
+    uint32_t len = lanes->len[l];
+    if (len) {
+      tdec_batch_extract_input(q, cb[l].input, l, len);
+    }
+    if (len == lanes->long_cb) {
+      continue;
+    }
+
+    // The tail of the code block is followed by zero LLR, the unused lanes are all zeros
+    lanes->padded  = true;
+    uint32_t start = len ? len + TAIL : 0;
+    tdec_batch_zero(q->syst, l, start, lanes->long_cb + TAIL);
+    tdec_batch_zero(q->parity0, l, start, lanes->long_cb + TAIL);
+    tdec_batch_zero(q->parity1, l, start, lanes->long_cb + TAIL);
+    tdec_batch_zero(q->app2, l, start, lanes->long_cb + TAIL);
+    tdec_batch_zero(q->app1, l, len, lanes->long_cb);
+
+    // Every distinct length starts its beta recursion at its own tail, keep them in decreasing order
+    if (len) {
+      lanes->mixed = true;
+
+      int      k = (int)(len + TAIL - 1);
+      uint32_t r = 0;
+      while (r < lanes->nof_resets && lanes->reset_k[r] > k) {
+        r++;
+      }
+      if (r == lanes->nof_resets || lanes->reset_k[r] != k) {
+        memmove(&lanes->reset_k[r + 1], &lanes->reset_k[r], (lanes->nof_resets - r) * sizeof(int));
+        lanes->reset_k[r] = k;
+        lanes->nof_resets++;
+      }
+    }
+  }
+}
+
+/* Decodes up to NOF_LANES code blocks, running the same iteration sequence as run_tdec_iteration_16bit() */
+static void tdec_batch_run_lanes(srsran_tdec_batch_t*    q,
+                                 srsran_tdec_batch_cb_t* cb,
+                                 uint32_t                nof_cb,
+                                 uint32_t                min_iterations,
+                                 uint32_t                max_iterations)
+{
+  tdec_batch_lanes_t lanes;
+  bool               active[NOF_LANES];
+
+  tdec_batch_load_lanes(q, &lanes, cb, nof_cb);
+  uint32_t long_cb = lanes.long_cb;
+
+  for (uint32_t l = 0; l < nof_cb; l++) {
+    cb[l].crc_ok         = false;
+    cb[l].nof_iterations = 0;
+    active[l]            = true;
+  }
+
+  uint32_t nof_active = nof_cb;
+  for (uint32_t n_iter = 0; n_iter < SRSRAN_MAX(max_iterations, 1) && nof_active > 0; n_iter++) {
+    if ((n_iter % 2) == 0) {
+      // Add apriori information to decoder 1
+      if (n_iter) {
+        srsran_vec_sub_sss(q->app1, q->ext1, q->app1, long_cb * NOF_LANES);
+      }
+
+      // Run MAP DEC #1
+      tdec_batch_map(q, &lanes, q->syst, n_iter ? q->app1 : NULL, q->parity0, q->ext1);
+      tdec_batch_clear_padding(&lanes, q->ext1);
+    } else {
+      // Convert aposteriori information into extrinsic information
+      if (n_iter > 1) {
+        srsran_vec_sub_sss(q->ext1, q->app1, q->ext1, long_cb * NOF_LANES);
+      }
+
+      tdec_batch_lut(q, &lanes, q->ext1, q->app2, false);
+
+      // Run MAP DEC #2. 2nd decoder uses apriori information as systematic bits
+      tdec_batch_map(q, &lanes, q->app2, NULL, q->parity1, q->ext2);
+      tdec_batch_clear_padding(&lanes, q->ext2);
+
+      // Deinterleaved extrinsic bits become apriori info for decoder 1
+      tdec_batch_lut(q, &lanes, q->ext2, q->app1, true);
+    }
+
+    // Decide the bits of the lanes still running and check their CRC
+    int16_t* llr = ((n_iter + 1) % 2) ? q->ext1 : q->app1;
+    for (uint32_t l = 0; l < nof_cb; l++) {
+      if (!active[l]) {
+        continue;
+      }
+
+      tdec_batch_decision_byte(llr, l, cb[l].output, cb[l].long_cb);
+      cb[l].nof_iterations = n_iter + 1;
+
+      if (cb[l].crc && !srsran_crc_checksum_byte(cb[l].crc, cb[l].output, cb[l].crc_len) &&
+          cb[l].nof_iterations >= min_iterations) {
+        cb[l].crc_ok = true;
+        active[l]    = false;
+        nof_active--;
+      }
+    }
+  }
+}
+
+int srsran_tdec_batch_run(srsran_tdec_batch_t*    q,
+                          srsran_tdec_batch_cb_t* cb,
+                          uint32_t                nof_cb,
+                          uint32_t                min_iterations,
+                          uint32_t                max_iterations)
+{
+  if (q == NULL || cb == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  for (uint32_t i = 0; i < nof_cb; i++) {
+    if (cb[i].long_cb > q->max_long_cb || srsran_cbsegm_cbindex(cb[i].long_cb) < 0) {
+      ERROR("Invalid CB length %d (max_long_cb=%d)", cb[i].long_cb, q->max_long_cb);
+      return SRSRAN_ERROR;
+    }
+  }
+
+  for (uint32_t i = 0; i < nof_cb; i += NOF_LANES) {
+    tdec_batch_run_lanes(q, &cb[i], SRSRAN_MIN(nof_cb - i, NOF_LANES), min_iterations, max_iterations);
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+#ifdef SRSRAN_SIMD_DISPATCH_ISA
+const srsran_tdec_batch_kernels_t SRSRAN_SIMD_DISPATCH_NAME(srsran_tdec_batch_kernels) = {
+    .init         = srsran_tdec_batch_init,
+    .free         = srsran_tdec_batch_free,
+    .nof_lanes    = srsran_tdec_batch_nof_lanes,
+    .is_supported = srsran_tdec_batch_is_supported,
+    .run          = srsran_tdec_batch_run,
+};
+#endif /* SRSRAN_SIMD_DISPATCH_ISA */
@@ -0,0 +1,57 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "turbodecoder_batch_dispatch.h"
+
+#ifdef SRSRAN_SIMD_DISPATCH
+
+SRSRAN_SIMD_DISPATCH_DECLARE(srsran_tdec_batch_kernels_t, srsran_tdec_batch_kernels)
+
+int srsran_tdec_batch_init(srsran_tdec_batch_t* q, uint32_t max_long_cb)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(srsran_tdec_batch_kernels)->init(q, max_long_cb);
+}
+
+void srsran_tdec_batch_free(srsran_tdec_batch_t* q)
+{
+  SRSRAN_SIMD_DISPATCH_SELECT(srsran_tdec_batch_kernels)->free(q);
+}
+
+uint32_t srsran_tdec_batch_nof_lanes()
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(srsran_tdec_batch_kernels)->nof_lanes();
+}
+
+bool srsran_tdec_batch_is_supported(srsran_tdec_batch_t* q, uint32_t long_cb)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(srsran_tdec_batch_kernels)->is_supported(q, long_cb);
+}
+
+int srsran_tdec_batch_run(srsran_tdec_batch_t*    q,
+                          srsran_tdec_batch_cb_t* cb,
+                          uint32_t                nof_cb,
+                          uint32_t                min_iterations,
+                          uint32_t                max_iterations)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(srsran_tdec_batch_kernels)->run(q, cb, nof_cb, min_iterations, max_iterations);
+}
+
+#endif /* SRSRAN_SIMD_DISPATCH */
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         turbodecoder_batch_dispatch.h
+ *
+ *  Description:  Batched turbo decoder selected at runtime. When the library
+ *                is built with ENABLE_SIMD_DISPATCH, turbodecoder_batch.c is
+ *                built once per ISA, so the number of lanes follows the
+ *                selected ISA, and every variant exports its functions in a
+ *                srsran_tdec_batch_kernels_t table, see simd_dispatch.h.
+ *
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef SRSRAN_TURBODECODER_BATCH_DISPATCH_H
+#define SRSRAN_TURBODECODER_BATCH_DISPATCH_H
+
+#include "srsran/phy/utils/simd_dispatch.h"
+
+#ifdef SRSRAN_SIMD_DISPATCH_ISA
+#define srsran_tdec_batch_init SRSRAN_SIMD_DISPATCH_NAME(srsran_tdec_batch_init)
+#define srsran_tdec_batch_free SRSRAN_SIMD_DISPATCH_NAME(srsran_tdec_batch_free)
+#define srsran_tdec_batch_nof_lanes SRSRAN_SIMD_DISPATCH_NAME(srsran_tdec_batch_nof_lanes)
+#define srsran_tdec_batch_is_supported SRSRAN_SIMD_DISPATCH_NAME(srsran_tdec_batch_is_supported)
+#define srsran_tdec_batch_run SRSRAN_SIMD_DISPATCH_NAME(srsran_tdec_batch_run)
+#endif /* SRSRAN_SIMD_DISPATCH_ISA */
+
+#include "srsran/phy/fec/turbo/turbodecoder_batch.h"
+
+typedef struct {
+  int (*init)(srsran_tdec_batch_t* q, uint32_t max_long_cb);
+  void (*free)(srsran_tdec_batch_t* q);
+  uint32_t (*nof_lanes)();
+  bool (*is_supported)(srsran_tdec_batch_t* q, uint32_t long_cb);
+  int (*run)(srsran_tdec_batch_t*    q,
+             srsran_tdec_batch_cb_t* cb,
+             uint32_t                nof_cb,
+             uint32_t                min_iterations,
+             uint32_t                max_iterations);
+} srsran_tdec_batch_kernels_t;
+
+#endif // SRSRAN_TURBODECODER_BATCH_DISPATCH_H
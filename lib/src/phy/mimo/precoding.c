@@ -62,6 +62,122 @@ int srsran_predecoding_single_avx(cf_t* y[SRSRAN_MAX_PORTS],
 
 static srsran_mimo_decoder_t mimo_decoder = SRSRAN_MIMO_DECODER_MMSE;
 
+/* Householder vectors u_n of the four antenna ports codebook, 36.211 Table 6.3.4.2.3-2 */
+static const cf_t precoding_4tx_u[16][4] = {
+    {1.0f, -1.0f, -1.0f, -1.0f},
+    {1.0f, -_Complex_I, 1.0f, _Complex_I},
+    {1.0f, 1.0f, -1.0f, 1.0f},
+    {1.0f, _Complex_I, 1.0f, -_Complex_I},
+    {1.0f, (-1.0f - _Complex_I) * (float)M_SQRT1_2, -_Complex_I, (1.0f - _Complex_I) * (float)M_SQRT1_2},
+    {1.0f, (1.0f - _Complex_I) * (float)M_SQRT1_2, _Complex_I, (-1.0f - _Complex_I) * (float)M_SQRT1_2},
+    {1.0f, (1.0f + _Complex_I) * (float)M_SQRT1_2, -_Complex_I, (-1.0f + _Complex_I) * (float)M_SQRT1_2},
+    {1.0f, (-1.0f + _Complex_I) * (float)M_SQRT1_2, _Complex_I, (1.0f + _Complex_I) * (float)M_SQRT1_2},
+    {1.0f, -1.0f, 1.0f, 1.0f},
+    {1.0f, -_Complex_I, -1.0f, -_Complex_I},
+    {1.0f, 1.0f, 1.0f, -1.0f},
+    {1.0f, _Complex_I, -1.0f, _Complex_I},
+    {1.0f, -1.0f, -1.0f, 1.0f},
+    {1.0f, -1.0f, 1.0f, -1.0f},
+    {1.0f, 1.0f, -1.0f, -1.0f},
+    {1.0f, 1.0f, 1.0f, 1.0f},
+};
+
+/* Columns of W_n taken for each number of layers, 36.211 Table 6.3.4.2.3-2 */
+static const uint8_t precoding_4tx_columns[SRSRAN_MAX_LAYERS][16][SRSRAN_MAX_LAYERS] = {
+    {{0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}},
+    {{0, 3},
+     {0, 1},
+     {0, 1},
+     {0, 1},
+     {0, 2},
+     {0, 2},
+     {0, 2},
+     {0, 2},
+     {0, 1},
+     {0, 3},
+     {0, 2},
+     {0, 2},
+     {0, 1},
+     {0, 2},
+     {0, 2},
+     {0, 1}},
+    {{0, 1, 3},
+     {0, 1, 2},
+     {0, 1, 2},
+     {0, 1, 2},
+     {0, 1, 3},
+     {0, 1, 3},
+     {0, 2, 3},
+     {0, 2, 3},
+     {0, 1, 3},
+     {0, 2, 3},
+     {0, 1, 2},
+     {0, 2, 3},
+     {0, 1, 2},
+     {0, 1, 2},
+     {0, 1, 2},
+     {0, 1, 2}},
+    {{0, 1, 2, 3},
+     {0, 1, 2, 3},
+     {2, 1, 0, 3},
+     {2, 1, 0, 3},
+     {0, 1, 2, 3},
+     {0, 1, 2, 3},
+     {0, 2, 1, 3},
+     {0, 2, 1, 3},
+     {0, 1, 2, 3},
+     {0, 1, 2, 3},
+     {0, 2, 1, 3},
+     {0, 2, 1, 3},
+     {0, 1, 2, 3},
+     {0, 2, 1, 3},
+     {2, 1, 0, 3},
+     {0, 1, 2, 3}},
+};
+
+/* Normalised spatial multiplexing precoding matrix W (ports x layers), 36.211 Section 6.3.4.2.3 */
+static int precoding_multiplex_matrix(int  nof_ports,
+                                      int  nof_layers,
+                                      int  codebook_idx,
+                                      cf_t W[SRSRAN_MAX_PORTS][SRSRAN_MAX_LAYERS])
+{
+  if (nof_ports == 2 && nof_layers == 1 && codebook_idx >= 0 && codebook_idx < 4) {
+    const cf_t w1[4] = {1.0f, -1.0f, _Complex_I, -_Complex_I};
+    W[0][0]          = (float)M_SQRT1_2;
+    W[1][0]          = w1[codebook_idx] * (float)M_SQRT1_2;
+  } else if (nof_ports == 2 && nof_layers == 2 && codebook_idx >= 0 && codebook_idx < 3) {
+    if (codebook_idx == 0) {
+      W[0][0] = (float)M_SQRT1_2;
+      W[0][1] = 0.0f;
+      W[1][0] = 0.0f;
+      W[1][1] = (float)M_SQRT1_2;
+    } else {
+      cf_t w1 = (codebook_idx == 1) ? 1.0f : _Complex_I;
+      W[0][0] = 0.5f;
+      W[0][1] = 0.5f;
+      W[1][0] = 0.5f * w1;
+      W[1][1] = -0.5f * w1;
+    }
+  } else if (nof_ports == 4 && nof_layers >= 1 && nof_layers <= 4 && codebook_idx >= 0 && codebook_idx < 16) {
+    // W_n = I - 2 u_n u_n' / (u_n' u_n), where u_n' u_n = 4
+    const cf_t* u    = precoding_4tx_u[codebook_idx];
+    float       norm = 1.0f / sqrtf((float)nof_layers);
+    for (int l = 0; l < nof_layers; l++) {
+      int c = precoding_4tx_columns[nof_layers - 1][codebook_idx][l];
+      for (int p = 0; p < nof_ports; p++) {
+        W[p][l] = ((p == c ? 1.0f : 0.0f) - 0.5f * u[p] * conjf(u[c])) * norm;
+      }
+    }
+  } else {
+    ERROR("Invalid multiplex combination: codebook_idx=%d, nof_layers=%d, nof_ports=%d",
+          codebook_idx,
+          nof_layers,
+          nof_ports);
+    return SRSRAN_ERROR;
+  }
+  return SRSRAN_SUCCESS;
+}
+
 /************************************************
  *
  * RECEIVER SIDE FUNCTIONS
@@ -1811,6 +1927,154 @@ static int srsran_predecoding_multiplex_2x1_mrc_csi(cf_t*  y[SRSRAN_MAX_PORTS],
   return SRSRAN_SUCCESS;
 }
 
+// Linear ZF or MMSE spatial multiplexing equalizer for any number of ports, receive antennas and layers. The channel
+// is combined with the precoding matrix and the regularised Gram matrices of a SIMD register worth of resource elements
+// are inverted at once.
+static int srsran_predecoding_multiplex_linear(cf_t*  y[SRSRAN_MAX_PORTS],
+                                               cf_t*  h[SRSRAN_MAX_PORTS][SRSRAN_MAX_PORTS],
+                                               cf_t*  x[SRSRAN_MAX_LAYERS],
+                                               float* csi[SRSRAN_MAX_CODEWORDS],
+                                               int    nof_rxant,
+                                               int    nof_ports,
+                                               int    nof_layers,
+                                               int    codebook_idx,
+                                               int    nof_symbols,
+                                               float  scaling,
+                                               float  noise_estimate)
+{
+  cf_t W[SRSRAN_MAX_PORTS][SRSRAN_MAX_LAYERS] = {};
+  if (precoding_multiplex_matrix(nof_ports, nof_layers, codebook_idx, W) < SRSRAN_SUCCESS) {
+    return SRSRAN_ERROR;
+  }
+
+  float norm  = 1.0f / scaling;
+  float noise = (mimo_decoder == SRSRAN_MIMO_DECODER_MMSE) ? noise_estimate : 0.0f;
+  int   i     = 0;
+
+  // CSI of each layer is interleaved in its codeword as in the layer mapping, 36.211 Table 6.3.3.2-1
+  float* csi_layer[SRSRAN_MAX_LAYERS]  = {};
+  int    csi_stride[SRSRAN_MAX_LAYERS] = {};
+  int    nof_layers_cw0                = (nof_layers == 1) ? 1 : nof_layers / 2;
+  for (int l = 0; l < nof_layers && csi != NULL; l++) {
+    int cw        = (l < nof_layers_cw0) ? 0 : 1;
+    int offset    = (cw == 0) ? l : l - nof_layers_cw0;
+    csi_stride[l] = (cw == 0) ? nof_layers_cw0 : nof_layers - nof_layers_cw0;
+    csi_layer[l]  = (csi[cw] != NULL) ? &csi[cw][offset] : NULL;
+  }
+
+#if SRSRAN_SIMD_CF_SIZE != 0
+  simd_cf_t _W[SRSRAN_MAX_PORTS][SRSRAN_MAX_LAYERS];
+  for (int p = 0; p < nof_ports; p++) {
+    for (int l = 0; l < nof_layers; l++) {
+      _W[p][l] = srsran_simd_cf_set1(W[p][l]);
+    }
+  }
+  simd_f_t  _norm  = srsran_simd_f_set1(norm);
+  simd_cf_t _noise = srsran_simd_cf_set1(noise);
+
+  for (; i < nof_symbols - SRSRAN_SIMD_CF_SIZE + 1; i += SRSRAN_SIMD_CF_SIZE) {
+    simd_cf_t g[SRSRAN_MAX_PORTS][SRSRAN_MAX_LAYERS];
+    simd_cf_t a[SRSRAN_MAT_HERM_MAX_N][SRSRAN_MAT_HERM_MAX_N];
+    simd_cf_t z[SRSRAN_MAX_LAYERS];
+
+    /* 1. G = H x W and Z = G' x Y */
+    for (int l = 0; l < nof_layers; l++) {
+      z[l] = srsran_simd_cf_zero();
+    }
+    for (int r = 0; r < nof_rxant; r++) {
+      simd_cf_t hr[SRSRAN_MAX_PORTS];
+      for (int p = 0; p < nof_ports; p++) {
+        hr[p] = srsran_simd_cfi_load(&h[p][r][i]);
+      }
+      simd_cf_t yr = srsran_simd_cfi_load(&y[r][i]);
+      for (int l = 0; l < nof_layers; l++) {
+        g[r][l] = srsran_simd_cf_prod(hr[0], _W[0][l]);
+        for (int p = 1; p < nof_ports; p++) {
+          g[r][l] = srsran_simd_cf_add(g[r][l], srsran_simd_cf_prod(hr[p], _W[p][l]));
+        }
+        z[l] = srsran_simd_cf_add(z[l], srsran_simd_cf_conjprod(yr, g[r][l]));
+      }
+    }
+
+    /* 2. A = G' x G + No, Hermitian so only the upper triangle is computed */
+    for (int l = 0; l < nof_layers; l++) {
+      for (int m = l; m < nof_layers; m++) {
+        simd_cf_t acc = (m == l) ? _noise : srsran_simd_cf_zero();
+        for (int r = 0; r < nof_rxant; r++) {
+          acc = srsran_simd_cf_add(acc, srsran_simd_cf_conjprod(g[r][m], g[r][l]));
+        }
+        a[l][m] = acc;
+        a[m][l] = srsran_simd_cf_conj(acc);
+      }
+    }
+
+    /* 3. B = inv(A) */
+    srsran_mat_herm_inv_simd(a, nof_layers);
+
+    /* 4. X = B x Z */
+    for (int l = 0; l < nof_layers; l++) {
+      simd_cf_t acc = srsran_simd_cf_prod(a[l][0], z[0]);
+      for (int m = 1; m < nof_layers; m++) {
+        acc = srsran_simd_cf_add(acc, srsran_simd_cf_prod(a[l][m], z[m]));
+      }
+      srsran_simd_cfi_store(&x[l][i], srsran_simd_cf_mul(acc, _norm));
+    }
+
+    /* 5. Extract CSI */
+    for (int l = 0; l < nof_layers; l++) {
+      if (csi_layer[l] != NULL) {
+        srsran_simd_aligned float _csi[SRSRAN_SIMD_F_SIZE];
+        srsran_simd_f_store(_csi, srsran_simd_f_rcp(srsran_simd_cf_re(a[l][l])));
+        for (int k = 0; k < SRSRAN_SIMD_CF_SIZE; k++) {
+          csi_layer[l][(i + k) * csi_stride[l]] = _csi[k];
+        }
+      }
+    }
+  }
+#endif /* SRSRAN_SIMD_CF_SIZE */
+
+  for (; i < nof_symbols; i++) {
+    cf_t g[SRSRAN_MAX_PORTS][SRSRAN_MAX_LAYERS] = {};
+    cf_t a[SRSRAN_MAT_HERM_MAX_N][SRSRAN_MAT_HERM_MAX_N];
+    cf_t z[SRSRAN_MAX_LAYERS] = {};
+
+    for (int r = 0; r < nof_rxant; r++) {
+      for (int l = 0; l < nof_layers; l++) {
+        for (int p = 0; p < nof_ports; p++) {
+          g[r][l] += h[p][r][i] * W[p][l];
+        }
+        z[l] += y[r][i] * conjf(g[r][l]);
+      }
+    }
+
+    for (int l = 0; l < nof_layers; l++) {
+      for (int m = l; m < nof_layers; m++) {
+        cf_t acc = (m == l) ? noise : 0.0f;
+        for (int r = 0; r < nof_rxant; r++) {
+          acc += g[r][m] * conjf(g[r][l]);
+        }
+        a[l][m] = acc;
+        a[m][l] = conjf(acc);
+      }
+    }
+
+    srsran_mat_herm_inv_gen(a, nof_layers);
+
+    for (int l = 0; l < nof_layers; l++) {
+      cf_t acc = 0.0f;
+      for (int m = 0; m < nof_layers; m++) {
+        acc += a[l][m] * z[m];
+      }
+      x[l][i] = acc * norm;
+
+      if (csi_layer[l] != NULL) {
+        csi_layer[l][i * csi_stride[l]] = 1.0f / crealf(a[l][l]);
+      }
+    }
+  }
+  return SRSRAN_SUCCESS;
+}
+
 static int srsran_predecoding_multiplex(cf_t*  y[SRSRAN_MAX_PORTS],
                                         cf_t*  h[SRSRAN_MAX_PORTS][SRSRAN_MAX_PORTS],
                                         cf_t*  x[SRSRAN_MAX_LAYERS],
@@ -1849,8 +2113,9 @@ static int srsran_predecoding_multiplex(cf_t*  y[SRSRAN_MAX_PORTS],
         return srsran_predecoding_multiplex_2x1_mrc(y, h, x, codebook_idx, nof_symbols, scaling);
       }
     }
-  } else if (nof_ports == 4) {
-    ERROR("Error predecoding multiplex: not implemented for %d Tx ports", nof_ports);
+  } else if ((nof_ports == 2 || nof_ports == 4) && nof_layers <= nof_rxant) {
+    return srsran_predecoding_multiplex_linear(
+        y, h, x, csi, nof_rxant, nof_ports, nof_layers, codebook_idx, nof_symbols, scaling, noise_estimate);
   } else {
     ERROR("Error predecoding multiplex: Invalid combination of ports %d and rx antennas %d", nof_ports, nof_rxant);
   }
@@ -2204,6 +2469,20 @@ int srsran_precoding_multiplex(cf_t*    x[SRSRAN_MAX_LAYERS],
     } else {
       ERROR("Not implemented");
     }
+  } else if (nof_ports == 4) {
+    cf_t W[SRSRAN_MAX_PORTS][SRSRAN_MAX_LAYERS] = {};
+    if (precoding_multiplex_matrix(nof_ports, nof_layers, codebook_idx, W) < SRSRAN_SUCCESS) {
+      return SRSRAN_ERROR;
+    }
+    for (; i < nof_symbols; i++) {
+      for (int p = 0; p < nof_ports; p++) {
+        cf_t acc = 0.0f;
+        for (int l = 0; l < nof_layers; l++) {
+          acc += W[p][l] * x[l][i];
+        }
+        y[p][i] = acc * scaling;
+      }
+    }
   } else {
     ERROR("Not implemented");
   }
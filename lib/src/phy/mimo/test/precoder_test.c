@@ -41,6 +41,7 @@ char*                  mimo_type_name        = NULL;
 char                   decoder_type_name[17] = "zf";
 float                  snr_db                = 100.0f;
 float                  scaling               = 0.1f;
+int                    nof_reps              = 0;
 static srsran_random_t random_gen            = NULL;
 
 void usage(char* prog)
@@ -57,6 +58,7 @@ void usage(char* prog)
   printf("\t-s SNR in dB [Default %.1fdB]*\n", snr_db);
   printf("\t-g Scaling [Default %.1f]*\n", scaling);
   printf("\t-d decoder type [zf|mmse] [Default %s]\n", decoder_type_name);
+  printf("\t-b benchmark the predecoding for nof_reps iterations [Default disabled]\n");
   printf("\n");
   printf("* Performance test example:\n\t for snr in {0..20..1}; do ./precoding_test -m single -s $snr; done; \n\n");
 }
@@ -64,7 +66,7 @@ void usage(char* prog)
 void parse_args(int argc, char** argv)
 {
   int opt;
-  while ((opt = getopt(argc, argv, "mplnrcdsg")) != -1) {
+  while ((opt = getopt(argc, argv, "mplnrcdsgb")) != -1) {
     switch (opt) {
       case 'n':
         nof_symbols = (int)strtol(argv[optind], NULL, 10);
@@ -94,6 +96,9 @@ void parse_args(int argc, char** argv)
       case 'g':
         scaling = strtof(argv[optind], NULL);
         break;
+      case 'b':
+        nof_reps = (int)strtol(argv[optind], NULL, 10);
+        break;
       default:
         usage(argv[0]);
         exit(-1);
@@ -339,6 +344,34 @@ int main(int argc, char** argv)
     ret = SRSRAN_ERROR;
   }
 
+  /* benchmark predecoding */
+  if (nof_reps > 0) {
+    gettimeofday(&t[1], NULL);
+    for (i = 0; i < nof_reps; i++) {
+      srsran_predecoding_type(r,
+                              h,
+                              xr,
+                              NULL,
+                              nof_rx_ports,
+                              nof_tx_ports,
+                              nof_layers,
+                              codebook_idx,
+                              nof_re,
+                              type,
+                              scaling,
+                              srsran_convert_dB_to_power(-snr_db));
+    }
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+    double elapsed_us = t[0].tv_sec * 1e6 + t[0].tv_usec;
+    printf("Predecoding %dx%d with %d layers: %.1f ns/RE, %.2f MRE/s\n",
+           nof_rx_ports,
+           nof_tx_ports,
+           nof_layers,
+           1000.0 * elapsed_us / ((double)nof_reps * nof_re),
+           (double)nof_reps * nof_re / elapsed_us);
+  }
+
 quit:
   srsran_random_free(random_gen);
 
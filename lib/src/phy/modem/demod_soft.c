@@ -23,9 +23,10 @@
 #include <stdlib.h>
 #include <strings.h>
 
-#include "srsran/phy/modem/demod_soft.h"
+#include "demod_soft_dispatch.h"
 #include "srsran/phy/utils/bit.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd.h"
 #include "srsran/phy/utils/vector.h"
 
 #ifdef HAVE_NEONv8
@@ -73,7 +74,7 @@
 
 #ifdef LV_HAVE_SSE
 #include <smmintrin.h>
-void demod_16qam_lte_s_sse(const cf_t* symbols, short* llr, int nsymbols);
+static void demod_16qam_lte_s_sse(const cf_t* symbols, short* llr, int nsymbols);
 #endif
 
 #define SCALE_SHORT_CONV_QPSK 100
@@ -86,43 +87,43 @@ void demod_16qam_lte_s_sse(const cf_t* symbols, short* llr, int nsymbols);
 #define SCALE_BYTE_CONV_QAM64 40
 #define SCALE_BYTE_CONV_QAM256 50
 
-void demod_bpsk_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
+static void demod_bpsk_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
 {
   for (int i = 0; i < nsymbols; i++) {
     llr[i] = (int8_t)(-SCALE_BYTE_CONV_QPSK * (crealf(symbols[i]) + cimagf(symbols[i])) * M_SQRT1_2);
   }
 }
 
-void demod_bpsk_lte_s(const cf_t* symbols, short* llr, int nsymbols)
+static void demod_bpsk_lte_s(const cf_t* symbols, short* llr, int nsymbols)
 {
   for (int i = 0; i < nsymbols; i++) {
     llr[i] = (short)(-SCALE_SHORT_CONV_QPSK * (crealf(symbols[i]) + cimagf(symbols[i])) * M_SQRT1_2);
   }
 }
 
-void demod_bpsk_lte(const cf_t* symbols, float* llr, int nsymbols)
+static void demod_bpsk_lte(const cf_t* symbols, float* llr, int nsymbols)
 {
   for (int i = 0; i < nsymbols; i++) {
     llr[i] = -(crealf(symbols[i]) + cimagf(symbols[i])) * M_SQRT1_2;
   }
 }
 
-void demod_qpsk_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
+static void demod_qpsk_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
 {
   srsran_vec_convert_fb((const float*)symbols, -SCALE_BYTE_CONV_QPSK * M_SQRT2, llr, nsymbols * 2);
 }
 
-void demod_qpsk_lte_s(const cf_t* symbols, short* llr, int nsymbols)
+static void demod_qpsk_lte_s(const cf_t* symbols, short* llr, int nsymbols)
 {
   srsran_vec_convert_fi((const float*)symbols, -SCALE_SHORT_CONV_QPSK * M_SQRT2, llr, nsymbols * 2);
 }
 
-void demod_qpsk_lte(const cf_t* symbols, float* llr, int nsymbols)
+static void demod_qpsk_lte(const cf_t* symbols, float* llr, int nsymbols)
 {
   srsran_vec_sc_prod_fff((const float*)symbols, -M_SQRT2, llr, nsymbols * 2);
 }
 
-void demod_16qam_lte(const cf_t* symbols, float* llr, int nsymbols)
+static void demod_16qam_lte(const cf_t* symbols, float* llr, int nsymbols)
 {
   for (int i = 0; i < nsymbols; i++) {
     float yre = crealf(symbols[i]);
@@ -137,7 +138,7 @@ void demod_16qam_lte(const cf_t* symbols, float* llr, int nsymbols)
 
 #ifdef HAVE_NEONv8
 
-void demod_16qam_lte_s_neon(const cf_t* symbols, short* llr, int nsymbols)
+static void demod_16qam_lte_s_neon(const cf_t* symbols, short* llr, int nsymbols)
 {
   float*      symbolsPtr = (float*)symbols;
   int16x8_t*  resultPtr  = (int16x8_t*)llr;
@@ -186,7 +187,7 @@ void demod_16qam_lte_s_neon(const cf_t* symbols, short* llr, int nsymbols)
   }
 }
 
-void demod_16qam_lte_b_neon(const cf_t* symbols, int8_t* llr, int nsymbols)
+static void demod_16qam_lte_b_neon(const cf_t* symbols, int8_t* llr, int nsymbols)
 {
   float*      symbolsPtr = (float*)symbols;
   int8x16_t*  resultPtr  = (int8x16_t*)llr;
@@ -247,7 +248,7 @@ void demod_16qam_lte_b_neon(const cf_t* symbols, int8_t* llr, int nsymbols)
 
 #ifdef LV_HAVE_SSE
 
-void demod_16qam_lte_s_sse(const cf_t* symbols, short* llr, int nsymbols)
+static void demod_16qam_lte_s_sse(const cf_t* symbols, short* llr, int nsymbols)
 {
   float*   symbolsPtr = (float*)symbols;
   __m128i* resultPtr  = (__m128i*)llr;
@@ -298,7 +299,7 @@ void demod_16qam_lte_s_sse(const cf_t* symbols, short* llr, int nsymbols)
   }
 }
 
-void demod_16qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
+static void demod_16qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
 {
   float*   symbolsPtr = (float*)symbols;
   __m128i* resultPtr  = (__m128i*)llr;
@@ -360,7 +361,7 @@ void demod_16qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
 
 #endif
 
-void demod_16qam_lte_s(const cf_t* symbols, short* llr, int nsymbols)
+static void demod_16qam_lte_s(const cf_t* symbols, short* llr, int nsymbols)
 {
 #ifdef LV_HAVE_SSE
   demod_16qam_lte_s_sse(symbols, llr, nsymbols);
@@ -381,7 +382,7 @@ void demod_16qam_lte_s(const cf_t* symbols, short* llr, int nsymbols)
 #endif
 }
 
-void demod_16qam_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
+static void demod_16qam_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
 {
 #ifdef LV_HAVE_SSE
   demod_16qam_lte_b_sse(symbols, llr, nsymbols);
@@ -402,7 +403,7 @@ void demod_16qam_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
 #endif
 }
 
-void demod_64qam_lte(const cf_t* symbols, float* llr, int nsymbols)
+static void demod_64qam_lte(const cf_t* symbols, float* llr, int nsymbols)
 {
   for (int i = 0; i < nsymbols; i++) {
     float yre = crealf(symbols[i]);
@@ -418,7 +419,7 @@ void demod_64qam_lte(const cf_t* symbols, float* llr, int nsymbols)
 }
 #ifdef HAVE_NEONv8
 
-void demod_64qam_lte_s_neon(const cf_t* symbols, short* llr, int nsymbols)
+static void demod_64qam_lte_s_neon(const cf_t* symbols, short* llr, int nsymbols)
 {
   float*      symbolsPtr = (float*)symbols;
   uint16x8_t* resultPtr  = (uint16x8_t*)llr;
@@ -480,7 +481,7 @@ void demod_64qam_lte_s_neon(const cf_t* symbols, short* llr, int nsymbols)
   }
 }
 
-void demod_64qam_lte_b_neon(const cf_t* symbols, int8_t* llr, int nsymbols)
+static void demod_64qam_lte_b_neon(const cf_t* symbols, int8_t* llr, int nsymbols)
 {
   float*      symbolsPtr = (float*)symbols;
   uint8x16_t* resultPtr  = (uint8x16_t*)llr;
@@ -643,7 +644,7 @@ static void demod_64qam_lte_s_sse(const cf_t* symbols, int16_t* llr, int nsymbol
   }
 }
 
-void demod_64qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
+static void demod_64qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
 {
   float*   symbolsPtr = (float*)symbols;
   __m128i* resultPtr  = (__m128i*)llr;
@@ -731,7 +732,7 @@ void demod_64qam_lte_b_sse(const cf_t* symbols, int8_t* llr, int nsymbols)
 
 #endif
 
-void demod_64qam_lte_s(const cf_t* symbols, short* llr, int nsymbols)
+static void demod_64qam_lte_s(const cf_t* symbols, short* llr, int nsymbols)
 {
 #ifdef LV_HAVE_SSE
   demod_64qam_lte_s_sse(symbols, llr, nsymbols);
@@ -754,7 +755,7 @@ void demod_64qam_lte_s(const cf_t* symbols, short* llr, int nsymbols)
 #endif
 }
 
-void demod_64qam_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
+static void demod_64qam_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
 {
 #ifdef LV_HAVE_SSE
   demod_64qam_lte_b_sse(symbols, llr, nsymbols);
@@ -777,7 +778,7 @@ void demod_64qam_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
 #endif
 }
 
-void demod_256qam_lte(const cf_t* symbols, float* llr, int nsymbols)
+static void demod_256qam_lte(const cf_t* symbols, float* llr, int nsymbols)
 {
   for (int i = 0; i < nsymbols; i++) {
     float real = -__real__ symbols[i];
@@ -799,7 +800,7 @@ void demod_256qam_lte(const cf_t* symbols, float* llr, int nsymbols)
   }
 }
 
-void demod_256qam_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
+static void demod_256qam_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
 {
   for (int i = 0; i < nsymbols; i++) {
     float real = -__real__ symbols[i];
@@ -821,7 +822,7 @@ void demod_256qam_lte_b(const cf_t* symbols, int8_t* llr, int nsymbols)
   }
 }
 
-void demod_256qam_lte_s(const cf_t* symbols, short* llr, int nsymbols)
+static void demod_256qam_lte_s(const cf_t* symbols, short* llr, int nsymbols)
 {
   for (int i = 0; i < nsymbols; i++) {
     float real = -__real__ symbols[i];
@@ -917,3 +918,108 @@ int srsran_demod_soft_demodulate_b(srsran_mod_t modulation, const cf_t* symbols,
   }
   return 0;
 }
+
+/* Number of resource elements equalized, demodulated and descrambled at once, small enough to stay in L1 */
+#define DEMOD_SOFT_EQ_BLOCK 128
+
+/* MMSE (ZF if noise_estimate is 0) combining of a single layer received on nof_rxant antennas */
+static void demod_soft_equalize(cf_t*    y[SRSRAN_MAX_PORTS],
+                                cf_t*    h[SRSRAN_MAX_PORTS],
+                                uint32_t nof_rxant,
+                                float    scaling,
+                                float    noise_estimate,
+                                cf_t*    x,
+                                uint32_t offset,
+                                uint32_t nof_re)
+{
+  uint32_t i = 0;
+
+#if SRSRAN_SIMD_CF_SIZE
+  const simd_f_t _noise   = srsran_simd_f_set1(noise_estimate);
+  const simd_f_t _scaling = srsran_simd_f_set1(1.0f / scaling);
+
+  for (; i + SRSRAN_SIMD_CF_SIZE <= nof_re; i += SRSRAN_SIMD_CF_SIZE) {
+    simd_cf_t _r  = srsran_simd_cf_zero();
+    simd_f_t  _hh = srsran_simd_f_zero();
+
+    for (uint32_t p = 0; p < nof_rxant; p++) {
+      simd_cf_t _y = srsran_simd_cfi_loadu(&y[p][offset + i]);
+      simd_cf_t _h = srsran_simd_cfi_loadu(&h[p][offset + i]);
+
+      _r  = srsran_simd_cf_add(_r, srsran_simd_cf_conjprod(_y, _h));
+      _hh = srsran_simd_f_add(_hh, srsran_simd_cf_re(srsran_simd_cf_conjprod(_h, _h)));
+    }
+
+    simd_f_t  _den = srsran_simd_f_add(_hh, _noise);
+    simd_cf_t _x   = srsran_simd_cf_mul(srsran_simd_cf_mul(_r, _scaling), srsran_simd_f_rcp(_den));
+    srsran_simd_cfi_store(&x[i], _x);
+  }
+#endif /* SRSRAN_SIMD_CF_SIZE */
+
+  for (; i < nof_re; i++) {
+    cf_t  r  = 0;
+    float hh = 0;
+    for (uint32_t p = 0; p < nof_rxant; p++) {
+      cf_t _h = h[p][offset + i];
+      r += y[p][offset + i] * conjf(_h);
+      hh += __real__ _h * __real__ _h + __imag__ _h * __imag__ _h;
+    }
+    x[i] = r / (scaling * (hh + noise_estimate));
+  }
+}
+
+int srsran_demod_soft_equalize_b(srsran_mod_t             modulation,
+                                 cf_t*                    y[SRSRAN_MAX_PORTS],
+                                 cf_t*                    h[SRSRAN_MAX_PORTS],
+                                 uint32_t                 nof_rxant,
+                                 float                    scaling,
+                                 float                    noise_estimate,
+                                 srsran_sequence_state_t* scrambling,
+                                 bool                     negate,
+                                 int8_t*                  llr,
+                                 uint32_t                 nof_re)
+{
+  if (y == NULL || y[0] == NULL || llr == NULL || nof_rxant == 0 || nof_rxant > SRSRAN_MAX_PORTS) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  uint32_t qm = srsran_mod_bits_x_symbol(modulation);
+  if (qm == 0) {
+    ERROR("Invalid modulation %d", modulation);
+    return SRSRAN_ERROR;
+  }
+
+  cf_t x[DEMOD_SOFT_EQ_BLOCK] __attribute__((aligned(64)));
+
+  for (uint32_t i = 0; i < nof_re; i += DEMOD_SOFT_EQ_BLOCK) {
+    uint32_t n   = SRSRAN_MIN(DEMOD_SOFT_EQ_BLOCK, nof_re - i);
+    int8_t*  out = &llr[i * qm];
+
+    // Without channel estimates the symbols are already equalized
+    const cf_t* symbols = &y[0][i];
+    if (h != NULL) {
+      demod_soft_equalize(y, h, nof_rxant, scaling, noise_estimate, x, i, n);
+      symbols = x;
+    }
+
+    srsran_demod_soft_demodulate_b(modulation, symbols, out, n);
+
+    if (negate) {
+      srsran_vec_neg_bb(out, out, n * qm);
+    }
+    if (scrambling != NULL) {
+      srsran_sequence_state_apply_c(scrambling, out, out, n * qm);
+    }
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+#ifdef SRSRAN_SIMD_DISPATCH_ISA
+const srsran_demod_soft_kernels_t SRSRAN_SIMD_DISPATCH_NAME(srsran_demod_soft_kernels) = {
+    .demodulate   = srsran_demod_soft_demodulate,
+    .demodulate_s = srsran_demod_soft_demodulate_s,
+    .demodulate_b = srsran_demod_soft_demodulate_b,
+    .equalize_b   = srsran_demod_soft_equalize_b,
+};
+#endif /* SRSRAN_SIMD_DISPATCH_ISA */
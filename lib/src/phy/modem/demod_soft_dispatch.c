@@ -0,0 +1,58 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "demod_soft_dispatch.h"
+
+#ifdef SRSRAN_SIMD_DISPATCH
+
+SRSRAN_SIMD_DISPATCH_DECLARE(srsran_demod_soft_kernels_t, srsran_demod_soft_kernels)
+
+int srsran_demod_soft_demodulate(srsran_mod_t modulation, const cf_t* symbols, float* llr, int nsymbols)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(srsran_demod_soft_kernels)->demodulate(modulation, symbols, llr, nsymbols);
+}
+
+int srsran_demod_soft_demodulate_s(srsran_mod_t modulation, const cf_t* symbols, short* llr, int nsymbols)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(srsran_demod_soft_kernels)->demodulate_s(modulation, symbols, llr, nsymbols);
+}
+
+int srsran_demod_soft_demodulate_b(srsran_mod_t modulation, const cf_t* symbols, int8_t* llr, int nsymbols)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(srsran_demod_soft_kernels)->demodulate_b(modulation, symbols, llr, nsymbols);
+}
+
+int srsran_demod_soft_equalize_b(srsran_mod_t             modulation,
+                                 cf_t*                    y[SRSRAN_MAX_PORTS],
+                                 cf_t*                    h[SRSRAN_MAX_PORTS],
+                                 uint32_t                 nof_rxant,
+                                 float                    scaling,
+                                 float                    noise_estimate,
+                                 srsran_sequence_state_t* scrambling,
+                                 bool                     negate,
+                                 int8_t*                  llr,
+                                 uint32_t                 nof_re)
+{
+  return SRSRAN_SIMD_DISPATCH_SELECT(srsran_demod_soft_kernels)
+      ->equalize_b(modulation, y, h, nof_rxant, scaling, noise_estimate, scrambling, negate, llr, nof_re);
+}
+
+#endif /* SRSRAN_SIMD_DISPATCH */
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         demod_soft_dispatch.h
+ *
+ *  Description:  Soft demodulator selected at runtime. When the library is
+ *                built with ENABLE_SIMD_DISPATCH, demod_soft.c is built once
+ *                per ISA and every variant exports its functions in a
+ *                srsran_demod_soft_kernels_t table, see simd_dispatch.h.
+ *
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef SRSRAN_DEMOD_SOFT_DISPATCH_H
+#define SRSRAN_DEMOD_SOFT_DISPATCH_H
+
+#include "srsran/phy/utils/simd_dispatch.h"
+
+#ifdef SRSRAN_SIMD_DISPATCH_ISA
+#define srsran_demod_soft_demodulate SRSRAN_SIMD_DISPATCH_NAME(srsran_demod_soft_demodulate)
+#define srsran_demod_soft_demodulate_s SRSRAN_SIMD_DISPATCH_NAME(srsran_demod_soft_demodulate_s)
+#define srsran_demod_soft_demodulate_b SRSRAN_SIMD_DISPATCH_NAME(srsran_demod_soft_demodulate_b)
+#define srsran_demod_soft_equalize_b SRSRAN_SIMD_DISPATCH_NAME(srsran_demod_soft_equalize_b)
+#endif /* SRSRAN_SIMD_DISPATCH_ISA */
+
+#include "srsran/phy/modem/demod_soft.h"
+
+typedef struct {
+  int (*demodulate)(srsran_mod_t modulation, const cf_t* symbols, float* llr, int nsymbols);
+  int (*demodulate_s)(srsran_mod_t modulation, const cf_t* symbols, short* llr, int nsymbols);
+  int (*demodulate_b)(srsran_mod_t modulation, const cf_t* symbols, int8_t* llr, int nsymbols);
+  int (*equalize_b)(srsran_mod_t             modulation,
+                    cf_t*                    y[SRSRAN_MAX_PORTS],
+                    cf_t*                    h[SRSRAN_MAX_PORTS],
+                    uint32_t                 nof_rxant,
+                    float                    scaling,
+                    float                    noise_estimate,
+                    srsran_sequence_state_t* scrambling,
+                    bool                     negate,
+                    int8_t*                  llr,
+                    uint32_t                 nof_re);
+} srsran_demod_soft_kernels_t;
+
+#endif // SRSRAN_DEMOD_SOFT_DISPATCH_H
@@ -30,6 +30,9 @@
 
 #include "srsran/srsran.h"
 
+#define NOF_RXANT 2
+#define NOISE_ESTIMATE 0.01f
+
 static uint32_t     nof_frames = 10;
 static uint32_t     num_bits   = 1000;
 static srsran_mod_t modulation = SRSRAN_MOD_NITEMS;
@@ -118,6 +121,10 @@ int main(int argc, char** argv)
   float*               llr;
   short*               llr_s;
   int8_t*              llr_b;
+  int8_t*              llr_e;
+  cf_t*                x;
+  cf_t*                y[SRSRAN_MAX_PORTS] = {};
+  cf_t*                h[SRSRAN_MAX_PORTS] = {};
 
   parse_args(argc, argv);
 
@@ -165,6 +172,22 @@ int main(int argc, char** argv)
     exit(-1);
   }
 
+  llr_e = srsran_vec_i8_malloc(num_bits);
+  x     = srsran_vec_cf_malloc(num_bits / mod.nbits_x_symbol);
+  if (!llr_e || !x) {
+    perror("malloc");
+    exit(-1);
+  }
+
+  for (uint32_t p = 0; p < NOF_RXANT; p++) {
+    y[p] = srsran_vec_cf_malloc(num_bits / mod.nbits_x_symbol);
+    h[p] = srsran_vec_cf_malloc(num_bits / mod.nbits_x_symbol);
+    if (!y[p] || !h[p]) {
+      perror("malloc");
+      exit(-1);
+    }
+  }
+
   /* generate random data */
   srand(0);
 
@@ -173,6 +196,7 @@ int main(int argc, char** argv)
   float          mean_texec   = 0.0;
   float          mean_texec_s = 0.0;
   float          mean_texec_b = 0.0;
+  float          mean_texec_e = 0.0;
   for (int n = 0; n < nof_frames; n++) {
     for (i = 0; i < num_bits; i++) {
       input[i] = rand() % 2;
@@ -233,10 +257,51 @@ int main(int argc, char** argv)
         goto clean_exit;
       }
     }
+
+    // Pass the symbols through a random channel
+    uint32_t nof_symbols = num_bits / mod.nbits_x_symbol;
+    for (uint32_t p = 0; p < NOF_RXANT; p++) {
+      for (i = 0; i < nof_symbols; i++) {
+        h[p][i] = ((float)rand() / RAND_MAX + 0.1f) * cexpf(_Complex_I * 2.0f * M_PI * rand() / RAND_MAX);
+        y[p][i] = symbols[i] * h[p][i];
+      }
+    }
+
+    // Equalize, demodulate and descramble in separate passes
+    srsran_sequence_state_t scrambling = {};
+    srsran_sequence_state_init(&scrambling, n);
+    srsran_predecoding_single_multi(y, h, x, NULL, NOF_RXANT, nof_symbols, 1.0f, NOISE_ESTIMATE);
+    srsran_demod_soft_demodulate_b(modulation, x, llr_b, nof_symbols);
+    srsran_sequence_state_apply_c(&scrambling, llr_b, llr_b, num_bits);
+
+    gettimeofday(&t[1], NULL);
+    srsran_sequence_state_init(&scrambling, n);
+    srsran_demod_soft_equalize_b(
+        modulation, y, h, NOF_RXANT, 1.0f, NOISE_ESTIMATE, &scrambling, false, llr_e, nof_symbols);
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+
+    if (n > 0) {
+      mean_texec_e = SRSRAN_VEC_CMA((float)t[0].tv_usec, mean_texec_e, n - 1);
+    }
+
+    // The fused kernel may differ by one unit of rounding from the separate passes
+    for (i = 0; i < num_bits; i++) {
+      if (abs(llr_e[i] - llr_b[i]) > 1) {
+        printf("Error in fused LLR %d: %d != %d\n", i, llr_e[i], llr_b[i]);
+        goto clean_exit;
+      }
+    }
   }
   ret = 0;
 
 clean_exit:
+  for (uint32_t p = 0; p < NOF_RXANT; p++) {
+    free(y[p]);
+    free(h[p]);
+  }
+  free(x);
+  free(llr_e);
   free(llr_b);
   free(llr_s);
   free(llr);
@@ -253,5 +318,6 @@ clean_exit:
          mean_texec,
          mean_texec_s,
          mean_texec_b);
+  printf("Fused equalizer Throughput: %.2f Mbps ExTime: %.2f us\n", num_bits / mean_texec_e, mean_texec_e);
   exit(ret);
 }
@@ -27,6 +27,7 @@
 #include "srsran/phy/modem/demod_soft.h"
 #include "srsran/phy/modem/mod.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/simd.h"
 #include "srsran/phy/utils/vector.h"
 
@@ -83,11 +84,11 @@ static int pbch_nr_init_encoder(srsran_pbch_nr_t* q, const srsran_pbch_nr_args_t
 
   srsran_polar_encoder_type_t encoder_type = SRSRAN_POLAR_ENCODER_PIPELINED;
 
-#ifdef LV_HAVE_AVX2
-  if (!args->disable_simd) {
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (!args->disable_simd && srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2)) {
     encoder_type = SRSRAN_POLAR_ENCODER_AVX2;
   }
-#endif /* LV_HAVE_AVX2 */
+#endif /* SRSRAN_SIMD_HAVE_AVX2 */
 
   if (srsran_polar_encoder_init(&q->polar_encoder, encoder_type, PBCH_NR_POLAR_N_MAX) < SRSRAN_SUCCESS) {
     ERROR("Error initiating polar encoder");
@@ -114,12 +115,9 @@ static int pbch_nr_init_decoder(srsran_pbch_nr_t* q, const srsran_pbch_nr_args_t
   }
 
   srsran_polar_decoder_type_t decoder_type = SRSRAN_POLAR_DECODER_SSC_C;
-
-#ifdef LV_HAVE_AVX2
   if (!args->disable_simd) {
-    decoder_type = SRSRAN_POLAR_DECODER_SSC_C_AVX2;
+    decoder_type = SRSRAN_POLAR_DECODER_FSSC_C;
   }
-#endif /* LV_HAVE_AVX2 */
 
   if (srsran_polar_decoder_init(&q->polar_decoder, decoder_type, PBCH_NR_POLAR_N_MAX) < SRSRAN_SUCCESS) {
     ERROR("Error initiating polar decoder");
@@ -351,8 +349,7 @@ static int pbch_nr_polar_decode(srsran_pbch_nr_t* q, const int8_t d[PBCH_NR_N],
 {
   // Decode bits
   uint8_t allocated[PBCH_NR_N];
-  if (srsran_polar_decoder_decode_c(&q->polar_decoder, d, allocated, q->code.n, q->code.F_set, q->code.F_set_size) <
-      SRSRAN_SUCCESS) {
+  if (srsran_polar_decoder_decode_code_c(&q->polar_decoder, d, allocated, &q->code) < SRSRAN_SUCCESS) {
     return SRSRAN_ERROR;
   }
 
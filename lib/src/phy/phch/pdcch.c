@@ -89,6 +89,15 @@ static int pdcch_init(srsran_pdcch_t* q, uint32_t max_prb, uint32_t nof_rx_anten
 
     srsran_vec_f_zero(q->llr, q->max_bits);
 
+    if (q->is_ue) {
+      for (int i = 0; i < SRSRAN_PDCCH_MAX_BATCH; i++) {
+        q->rm_batch[i] = srsran_vec_f_malloc(3 * (SRSRAN_DCI_MAX_BITS + 16));
+        if (!q->rm_batch[i]) {
+          goto clean;
+        }
+      }
+    }
+
     q->d = srsran_vec_cf_malloc(q->max_bits / 2);
     if (!q->d) {
       goto clean;
@@ -143,6 +152,11 @@ void srsran_pdcch_free(srsran_pdcch_t* q)
   if (q->d) {
     free(q->d);
   }
+  for (int i = 0; i < SRSRAN_PDCCH_MAX_BATCH; i++) {
+    if (q->rm_batch[i]) {
+      free(q->rm_batch[i]);
+    }
+  }
   for (int i = 0; i < SRSRAN_MAX_PORTS; i++) {
     if (q->x[i]) {
       free(q->x[i]);
@@ -328,6 +342,15 @@ uint32_t srsran_pdcch_common_locations_ncce(uint32_t nof_cce, srsran_dci_locatio
   return k;
 }
 
+/* Returns XOR between parity and remainder bits of a Viterbi-decoded DCI */
+static uint16_t pdcch_dci_crc_rem(srsran_pdcch_t* q, uint8_t* data, uint32_t nof_bits)
+{
+  uint8_t* x       = &data[nof_bits];
+  uint16_t p_bits  = (uint16_t)srsran_bit_pack(&x, 16);
+  uint16_t crc_res = ((uint16_t)srsran_crc_checksum(&q->crc, data, nof_bits) & 0xffff);
+  return p_bits ^ crc_res;
+}
+
 /** 36.212 5.3.3.2 to 5.3.3.4
  *
  * Returns XOR between parity and remainder bits
@@ -336,9 +359,6 @@ uint32_t srsran_pdcch_common_locations_ncce(uint32_t nof_cce, srsran_dci_locatio
  */
 int srsran_pdcch_dci_decode(srsran_pdcch_t* q, float* e, uint8_t* data, uint32_t E, uint32_t nof_bits, uint16_t* crc)
 {
-  uint16_t p_bits, crc_res;
-  uint8_t* x;
-
   if (q != NULL) {
     if (data != NULL && E <= q->max_bits && nof_bits <= SRSRAN_DCI_MAX_BITS) {
       srsran_vec_f_zero(q->rm_f, 3 * (SRSRAN_DCI_MAX_BITS + 16));
@@ -351,12 +371,8 @@ int srsran_pdcch_dci_decode(srsran_pdcch_t* q, float* e, uint8_t* data, uint32_t
       /* viterbi decoder */
       srsran_viterbi_decode_f(&q->decoder, q->rm_f, data, nof_bits + 16);
 
-      x       = &data[nof_bits];
-      p_bits  = (uint16_t)srsran_bit_pack(&x, 16);
-      crc_res = ((uint16_t)srsran_crc_checksum(&q->crc, data, nof_bits) & 0xffff);
-
       if (crc) {
-        *crc = p_bits ^ crc_res;
+        *crc = pdcch_dci_crc_rem(q, data, nof_bits);
       }
 
       return SRSRAN_SUCCESS;
@@ -369,6 +385,48 @@ int srsran_pdcch_dci_decode(srsran_pdcch_t* q, float* e, uint8_t* data, uint32_t
   }
 }
 
+/* Checks that the candidate location fits in the control region of the subframe */
+static bool pdcch_msg_location_isvalid(srsran_pdcch_t* q, srsran_dl_sf_cfg_t* sf, srsran_dci_msg_t* msg)
+{
+  if (!srsran_dci_location_isvalid(&msg->location)) {
+    ERROR("Invalid parameters, location=%d,%d", msg->location.ncce, msg->location.L);
+    return false;
+  }
+  if (msg->location.ncce * 72 + PDCCH_FORMAT_NOF_BITS(msg->location.L) > NOF_CCE(sf->cfi) * 72) {
+    ERROR("Invalid location: nCCE: %d, L: %d, NofCCE: %d", msg->location.ncce, msg->location.L, NOF_CCE(sf->cfi));
+    return false;
+  }
+  return true;
+}
+
+/* Computes absolute mean of the LLRs of a candidate */
+static double pdcch_msg_llr_mean(srsran_pdcch_t* q, srsran_dci_msg_t* msg)
+{
+  uint32_t e_bits = PDCCH_FORMAT_NOF_BITS(msg->location.L);
+  double   mean   = 0;
+  for (int i = 0; i < e_bits; i++) {
+    mean += fabsf(q->llr[msg->location.ncce * 72 + i]);
+  }
+  return mean / e_bits;
+}
+
+/* Completes a candidate once its payload and CRC remainder have been decoded */
+static void pdcch_msg_decoded(srsran_dci_cfg_t* dci_cfg, srsran_dci_msg_t* msg, uint32_t nof_bits, double mean)
+{
+  msg->nof_bits = nof_bits;
+  // Check format differentiation
+  if (msg->format == SRSRAN_DCI_FORMAT0 || msg->format == SRSRAN_DCI_FORMAT1A) {
+    msg->format = (msg->payload[dci_cfg->cif_enabled ? 3 : 0] == 0) ? SRSRAN_DCI_FORMAT0 : SRSRAN_DCI_FORMAT1A;
+  }
+  INFO("Decoded DCI: nCCE=%d, L=%d, format=%s, msg_len=%d, mean=%f, crc_rem=0x%x",
+       msg->location.ncce,
+       msg->location.L,
+       srsran_dci_format_string(msg->format),
+       nof_bits,
+       mean,
+       msg->rnti);
+}
+
 /** Tries to decode a DCI message from the LLRs stored in the srsran_pdcch_t structure by the function
  * srsran_pdcch_extract_llr(). This function can be called multiple times.
  * The location to search for is obtained from msg.
@@ -378,48 +436,130 @@ int srsran_pdcch_dci_decode(srsran_pdcch_t* q, float* e, uint8_t* data, uint32_t
 int srsran_pdcch_decode_msg(srsran_pdcch_t* q, srsran_dl_sf_cfg_t* sf, srsran_dci_cfg_t* dci_cfg, srsran_dci_msg_t* msg)
 {
   int ret = SRSRAN_ERROR_INVALID_INPUTS;
-  if (q != NULL && msg != NULL && srsran_dci_location_isvalid(&msg->location)) {
-    if (msg->location.ncce * 72 + PDCCH_FORMAT_NOF_BITS(msg->location.L) > NOF_CCE(sf->cfi) * 72) {
-      ERROR("Invalid location: nCCE: %d, L: %d, NofCCE: %d", msg->location.ncce, msg->location.L, NOF_CCE(sf->cfi));
+  if (q != NULL && msg != NULL && pdcch_msg_location_isvalid(q, sf, msg)) {
+    ret = SRSRAN_SUCCESS;
+
+    uint32_t nof_bits = srsran_dci_format_sizeof(&q->cell, sf, dci_cfg, msg->format);
+    uint32_t e_bits   = PDCCH_FORMAT_NOF_BITS(msg->location.L);
+    double   mean     = pdcch_msg_llr_mean(q, msg);
+
+    if (mean > 0.3f) {
+      ret = srsran_pdcch_dci_decode(q, &q->llr[msg->location.ncce * 72], msg->payload, e_bits, nof_bits, &msg->rnti);
+      if (ret == SRSRAN_SUCCESS) {
+        pdcch_msg_decoded(dci_cfg, msg, nof_bits, mean);
+      } else {
+        ERROR("Error calling pdcch_dci_decode");
+      }
     } else {
-      ret = SRSRAN_SUCCESS;
+      INFO("Skipping DCI:  nCCE=%d, L=%d, msg_len=%d, mean=%f", msg->location.ncce, msg->location.L, nof_bits, mean);
+    }
+  }
+  return ret;
+}
+
+/* Decodes together all the pending candidates with the same payload size as the first pending one. Returns the number
+ * of decoded candidates */
+static int pdcch_decode_msg_group(srsran_pdcch_t*   q,
+                                  srsran_dci_cfg_t* dci_cfg,
+                                  srsran_dci_msg_t* msg,
+                                  const uint32_t*   nof_bits,
+                                  const double*     mean,
+                                  bool*             pending,
+                                  uint32_t          nof_msg)
+{
+  float*   symbols[SRSRAN_PDCCH_MAX_BATCH];
+  uint8_t* data[SRSRAN_PDCCH_MAX_BATCH];
+  uint32_t idx[SRSRAN_PDCCH_MAX_BATCH];
+  uint32_t n     = 0;
+  uint32_t first = 0;
+
+  while (first < nof_msg && !pending[first]) {
+    first++;
+  }
+
+  for (uint32_t i = first; i < nof_msg; i++) {
+    if (pending[i] && nof_bits[i] == nof_bits[first]) {
+      uint32_t coded_len = 3 * (nof_bits[i] + 16);
+      uint32_t e_bits    = PDCCH_FORMAT_NOF_BITS(msg[i].location.L);
 
-      uint32_t nof_bits = srsran_dci_format_sizeof(&q->cell, sf, dci_cfg, msg->format);
-      uint32_t e_bits   = PDCCH_FORMAT_NOF_BITS(msg->location.L);
+      /* unrate matching */
+      srsran_vec_f_zero(q->rm_batch[n], coded_len);
+      srsran_rm_conv_rx(&q->llr[msg[i].location.ncce * 72], e_bits, q->rm_batch[n], coded_len);
+
+      symbols[n] = q->rm_batch[n];
+      data[n]    = msg[i].payload;
+      idx[n]     = i;
+      pending[i] = false;
+      n++;
+    }
+  }
+
+  /* viterbi decoder */
+  if (srsran_viterbi_decode_batch(&q->decoder, symbols, data, n, nof_bits[first] + 16) < SRSRAN_SUCCESS) {
+    ERROR("Error decoding DCI batch");
+    return SRSRAN_ERROR;
+  }
+
+  for (uint32_t k = 0; k < n; k++) {
+    srsran_dci_msg_t* m = &msg[idx[k]];
+    m->rnti             = pdcch_dci_crc_rem(q, m->payload, nof_bits[first]);
+    pdcch_msg_decoded(dci_cfg, m, nof_bits[first], mean[idx[k]]);
+  }
 
-      // Compute absolute mean of the LLRs
-      double mean = 0;
-      for (int i = 0; i < e_bits; i++) {
-        mean += fabsf(q->llr[msg->location.ncce * 72 + i]);
+  return n;
+}
+
+int srsran_pdcch_decode_msg_batch(srsran_pdcch_t*     q,
+                                  srsran_dl_sf_cfg_t* sf,
+                                  srsran_dci_cfg_t*   dci_cfg,
+                                  srsran_dci_msg_t*   msg,
+                                  uint32_t            nof_msg)
+{
+  if (q == NULL || msg == NULL || !q->is_ue) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  for (uint32_t offset = 0; offset < nof_msg; offset += SRSRAN_PDCCH_MAX_BATCH) {
+    srsran_dci_msg_t* m           = &msg[offset];
+    uint32_t          n           = SRSRAN_MIN(SRSRAN_PDCCH_MAX_BATCH, nof_msg - offset);
+    uint32_t          nof_pending = 0;
+    uint32_t          nof_bits[SRSRAN_PDCCH_MAX_BATCH];
+    double            mean[SRSRAN_PDCCH_MAX_BATCH];
+    bool              pending[SRSRAN_PDCCH_MAX_BATCH];
+
+    for (uint32_t i = 0; i < n; i++) {
+      if (!pdcch_msg_location_isvalid(q, sf, &m[i])) {
+        return SRSRAN_ERROR_INVALID_INPUTS;
       }
-      mean /= e_bits;
-
-      if (mean > 0.3f) {
-        ret = srsran_pdcch_dci_decode(q, &q->llr[msg->location.ncce * 72], msg->payload, e_bits, nof_bits, &msg->rnti);
-        if (ret == SRSRAN_SUCCESS) {
-          msg->nof_bits = nof_bits;
-          // Check format differentiation
-          if (msg->format == SRSRAN_DCI_FORMAT0 || msg->format == SRSRAN_DCI_FORMAT1A) {
-            msg->format = (msg->payload[dci_cfg->cif_enabled ? 3 : 0] == 0) ? SRSRAN_DCI_FORMAT0 : SRSRAN_DCI_FORMAT1A;
-          }
-        } else {
-          ERROR("Error calling pdcch_dci_decode");
-        }
-        INFO("Decoded DCI: nCCE=%d, L=%d, format=%s, msg_len=%d, mean=%f, crc_rem=0x%x",
-             msg->location.ncce,
-             msg->location.L,
-             srsran_dci_format_string(msg->format),
-             nof_bits,
-             mean,
-             msg->rnti);
+
+      nof_bits[i] = srsran_dci_format_sizeof(&q->cell, sf, dci_cfg, m[i].format);
+      mean[i]     = pdcch_msg_llr_mean(q, &m[i]);
+      pending[i]  = (mean[i] > 0.3f);
+      if (nof_bits[i] > SRSRAN_DCI_MAX_BITS) {
+        ERROR("Invalid parameters: nof_bits: %d", nof_bits[i]);
+        return SRSRAN_ERROR_INVALID_INPUTS;
+      }
+      if (pending[i]) {
+        nof_pending++;
       } else {
-        INFO("Skipping DCI:  nCCE=%d, L=%d, msg_len=%d, mean=%f", msg->location.ncce, msg->location.L, nof_bits, mean);
+        INFO("Skipping DCI:  nCCE=%d, L=%d, msg_len=%d, mean=%f",
+             m[i].location.ncce,
+             m[i].location.L,
+             nof_bits[i],
+             mean[i]);
       }
     }
-  } else if (msg != NULL) {
-    ERROR("Invalid parameters, location=%d,%d", msg->location.ncce, msg->location.L);
+
+    while (nof_pending > 0) {
+      int ret = pdcch_decode_msg_group(q, dci_cfg, m, nof_bits, mean, pending, n);
+      if (ret < SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
+      }
+      nof_pending -= ret;
+    }
   }
-  return ret;
+
+  return SRSRAN_SUCCESS;
 }
 
 float srsran_pdcch_msg_corr(srsran_pdcch_t* q, srsran_dci_msg_t* msg)
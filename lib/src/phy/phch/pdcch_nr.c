@@ -27,6 +27,7 @@
 #include "srsran/phy/modem/demod_soft.h"
 #include "srsran/phy/utils/bit.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/vector.h"
 
 #define PDCCH_NR_POLAR_RM_IBIL 0
@@ -203,11 +204,11 @@ int srsran_pdcch_nr_init_tx(srsran_pdcch_nr_t* q, const srsran_pdcch_nr_args_t*
 
   srsran_polar_encoder_type_t encoder_type = SRSRAN_POLAR_ENCODER_PIPELINED;
 
-#ifdef LV_HAVE_AVX2
-  if (!args->disable_simd) {
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (!args->disable_simd && srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2)) {
     encoder_type = SRSRAN_POLAR_ENCODER_AVX2;
   }
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
 
   if (srsran_polar_encoder_init(&q->encoder, encoder_type, NMAX_LOG) < SRSRAN_SUCCESS) {
     return SRSRAN_ERROR;
@@ -226,13 +227,11 @@ int srsran_pdcch_nr_init_rx(srsran_pdcch_nr_t* q, const srsran_pdcch_nr_args_t*
     return SRSRAN_ERROR;
   }
 
+  // Blind decoding runs the polar decoder for every candidate, use the Fast-SSC decoder unless SIMD is disabled
   srsran_polar_decoder_type_t decoder_type = SRSRAN_POLAR_DECODER_SSC_C;
-
-#ifdef LV_HAVE_AVX2
   if (!args->disable_simd) {
-    decoder_type = SRSRAN_POLAR_DECODER_SSC_C_AVX2;
+    decoder_type = SRSRAN_POLAR_DECODER_FSSC_C;
   }
-#endif // LV_HAVE_AVX2
 
   if (srsran_polar_decoder_init(&q->decoder, decoder_type, NMAX_LOG) < SRSRAN_SUCCESS) {
     return SRSRAN_ERROR;
@@ -655,8 +654,7 @@ int srsran_pdcch_nr_decode(srsran_pdcch_nr_t*      q,
   }
 
   // Decode
-  if (srsran_polar_decoder_decode_c(&q->decoder, d, q->allocated, q->code.n, q->code.F_set, q->code.F_set_size) <
-      SRSRAN_SUCCESS) {
+  if (srsran_polar_decoder_decode_code_c(&q->decoder, d, q->allocated, &q->code) < SRSRAN_SUCCESS) {
     return SRSRAN_ERROR;
   }
 
@@ -659,6 +659,14 @@ static void pdsch_decode_debug(srsran_pdsch_t*     q,
   }
 }
 
+/* Single layer transmissions are equalized, demodulated and descrambled in one pass, unless the equalized symbols
+ * are needed for the EVM, the CSI correction or by the caller */
+static bool pdsch_fused_demod(const srsran_pdsch_t* q, const srsran_pdsch_cfg_t* cfg)
+{
+  return q->llr_is_8bit && q->cell.nof_ports == 1 && cfg->grant.tx_scheme == SRSRAN_TXSCHEME_PORT0 &&
+         cfg->grant.nof_layers == 1 && !cfg->meas_evm_en && !cfg->csi_enable && !cfg->store_symbols;
+}
+
 static int srsran_pdsch_codeword_decode(srsran_pdsch_t*     q,
                                         srsran_dl_sf_cfg_t* sf,
                                         srsran_pdsch_cfg_t* cfg,
@@ -690,7 +698,9 @@ static int srsran_pdsch_codeword_decode(srsran_pdsch_t*     q,
      * The MAX-log-MAP algorithm used in turbo decoding is unsensitive to SNR estimation,
      * thus we don't need tot set it in the LLRs normalization
      */
-    if (q->llr_is_8bit) {
+    if (pdsch_fused_demod(q, cfg)) {
+      // Already demodulated and descrambled by srsran_pdsch_decode()
+    } else if (q->llr_is_8bit) {
       srsran_demod_soft_demodulate_b(mcs->mod, q->d[codeword_idx], q->e[codeword_idx], cfg->grant.nof_re);
     } else {
       srsran_demod_soft_demodulate_s(mcs->mod, q->d[codeword_idx], q->e[codeword_idx], cfg->grant.nof_re);
@@ -714,7 +724,9 @@ static int srsran_pdsch_codeword_decode(srsran_pdsch_t*     q,
     }
 
     /* Bit scrambling */
-    if (q->llr_is_8bit) {
+    if (pdsch_fused_demod(q, cfg)) {
+      // Already descrambled
+    } else if (q->llr_is_8bit) {
       srsran_sequence_pdsch_apply_c(q->e[codeword_idx],
                                     q->e[codeword_idx],
                                     cfg->rnti,
@@ -863,27 +875,53 @@ int srsran_pdsch_decode(srsran_pdsch_t*        q,
       x = q->x;
     }
 
-    // Pre-decoder
-    uint32_t codebook_idx = nof_tb == 1 ? cfg->grant.pmi : (cfg->grant.pmi + 1);
-    if (srsran_predecoding_type(q->symbols,
-                                q->ce,
-                                x,
-                                q->csi,
-                                q->nof_rx_antennas,
-                                q->cell.nof_ports,
-                                cfg->grant.nof_layers,
-                                codebook_idx,
-                                cfg->grant.nof_re,
-                                cfg->grant.tx_scheme,
-                                pdsch_scaling,
-                                noise_estimate) < 0) {
-      ERROR("Error predecoding");
-      return SRSRAN_ERROR;
-    }
+    if (pdsch_fused_demod(q, cfg)) {
+      // Equalize, demodulate and descramble the single codeword straight into its LLR buffer
+      srsran_ra_tb_t*         tb                   = &cfg->grant.tb[cfg->grant.tb[0].enabled ? 0 : 1];
+      cf_t*                   ce[SRSRAN_MAX_PORTS] = {};
+      srsran_sequence_state_t scrambling           = {};
+      for (uint32_t j = 0; j < q->nof_rx_antennas; j++) {
+        ce[j] = q->ce[0][j];
+      }
+      srsran_sequence_pdsch_state_init(
+          &scrambling, cfg->rnti, tb->cw_idx, 2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME), q->cell.id);
+      if (srsran_demod_soft_equalize_b(tb->mod,
+                                       q->symbols,
+                                       ce,
+                                       q->nof_rx_antennas,
+                                       pdsch_scaling,
+                                       noise_estimate,
+                                       &scrambling,
+                                       false,
+                                       q->e[tb->cw_idx],
+                                       cfg->grant.nof_re) < SRSRAN_SUCCESS) {
+        ERROR("Error demodulating");
+        return SRSRAN_ERROR;
+      }
+    } else {
+      // Pre-decoder
+      uint32_t codebook_idx = nof_tb == 1 ? cfg->grant.pmi : (cfg->grant.pmi + 1);
+      if (srsran_predecoding_type(q->symbols,
+                                  q->ce,
+                                  x,
+                                  q->csi,
+                                  q->nof_rx_antennas,
+                                  q->cell.nof_ports,
+                                  cfg->grant.nof_layers,
+                                  codebook_idx,
+                                  cfg->grant.nof_re,
+                                  cfg->grant.tx_scheme,
+                                  pdsch_scaling,
+                                  noise_estimate) < 0) {
+        ERROR("Error predecoding");
+        return SRSRAN_ERROR;
+      }
 
-    // Layer demapping only if necessary
-    if (cfg->grant.nof_layers != nof_tb) {
-      srsran_layerdemap_type(x, q->d, cfg->grant.nof_layers, nof_tb, nof_symbols[0], nof_symbols, cfg->grant.tx_scheme);
+      // Layer demapping only if necessary
+      if (cfg->grant.nof_layers != nof_tb) {
+        srsran_layerdemap_type(
+            x, q->d, cfg->grant.nof_layers, nof_tb, nof_symbols[0], nof_symbols, cfg->grant.tx_scheme);
+      }
     }
 
     /* Codeword decoding: Implementation of 3GPP 36.212 Table 5.3.3.1.5-1 and Table 5.3.3.1.5-2 */
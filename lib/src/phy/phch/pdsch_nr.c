@@ -423,11 +423,12 @@ int srsran_pdsch_nr_encode(srsran_pdsch_nr_t*           q,
   return SRSRAN_SUCCESS;
 }
 
-static inline int pdsch_nr_decode_codeword(srsran_pdsch_nr_t*         q,
-                                           const srsran_sch_cfg_nr_t* cfg,
-                                           const srsran_sch_tb_t*     tb,
-                                           srsran_pdsch_res_nr_t*     res,
-                                           uint16_t                   rnti)
+static inline int pdsch_nr_decode_codeword(srsran_pdsch_nr_t*           q,
+                                           const srsran_sch_cfg_nr_t*   cfg,
+                                           const srsran_sch_tb_t*       tb,
+                                           const srsran_chest_dl_res_t* channel,
+                                           srsran_pdsch_res_nr_t*       res,
+                                           uint16_t                     rnti)
 {
   // Early return if TB is not enabled
   if (!tb->enabled) {
@@ -446,28 +447,41 @@ static inline int pdsch_nr_decode_codeword(srsran_pdsch_nr_t*         q,
     return SRSRAN_ERROR_OUT_OF_BOUNDS;
   }
 
-  if (SRSRAN_DEBUG_ENABLED && get_srsran_verbose_level() >= SRSRAN_VERBOSE_DEBUG && !is_handler_registered()) {
+  if (SRSRAN_DEBUG_ENABLED && get_srsran_verbose_level() >= SRSRAN_VERBOSE_DEBUG && !is_handler_registered() &&
+      channel == NULL) {
     DEBUG("d=");
     srsran_vec_fprint_c(stdout, q->d[tb->cw_idx], tb->nof_re);
   }
 
-  // Demodulation
   int8_t* llr = (int8_t*)q->b[tb->cw_idx];
-  if (srsran_demod_soft_demodulate_b(tb->mod, q->d[tb->cw_idx], llr, tb->nof_re)) {
-    return SRSRAN_ERROR;
-  }
+  if (channel != NULL) {
+    // Equalization, demodulation, sign change and descrambling in a single pass
+    cf_t*                   ce[SRSRAN_MAX_PORTS] = {channel->ce[0][0]};
+    srsran_sequence_state_t scrambling           = {};
+    srsran_sequence_state_init(&scrambling, pdsch_nr_cinit(&q->carrier, cfg, rnti, tb->cw_idx));
+    if (srsran_demod_soft_equalize_b(
+            tb->mod, q->x, ce, 1, 1.0f, channel->noise_estimate, &scrambling, true, llr, tb->nof_re) <
+        SRSRAN_SUCCESS) {
+      return SRSRAN_ERROR;
+    }
+  } else {
+    // Demodulation
+    if (srsran_demod_soft_demodulate_b(tb->mod, q->d[tb->cw_idx], llr, tb->nof_re)) {
+      return SRSRAN_ERROR;
+    }
 
-  // EVM
-  if (q->evm_buffer != NULL) {
-    res->evm[tb->cw_idx] =
-        srsran_evm_run_b(q->evm_buffer, &q->modem_tables[tb->mod], q->d[tb->cw_idx], llr, tb->nof_bits);
-  }
+    // EVM
+    if (q->evm_buffer != NULL) {
+      res->evm[tb->cw_idx] =
+          srsran_evm_run_b(q->evm_buffer, &q->modem_tables[tb->mod], q->d[tb->cw_idx], llr, tb->nof_bits);
+    }
 
-  // Change LLR sign and set to zero the LLR that are not used
-  srsran_vec_neg_bb(llr, llr, tb->nof_bits);
+    // Change LLR sign and set to zero the LLR that are not used
+    srsran_vec_neg_bb(llr, llr, tb->nof_bits);
 
-  // Descrambling
-  srsran_sequence_apply_c(llr, llr, tb->nof_bits, pdsch_nr_cinit(&q->carrier, cfg, rnti, tb->cw_idx));
+    // Descrambling
+    srsran_sequence_apply_c(llr, llr, tb->nof_bits, pdsch_nr_cinit(&q->carrier, cfg, rnti, tb->cw_idx));
+  }
 
   if (SRSRAN_DEBUG_ENABLED && get_srsran_verbose_level() >= SRSRAN_VERBOSE_DEBUG && !is_handler_registered()) {
     DEBUG("b=");
@@ -535,9 +549,14 @@ int srsran_pdsch_nr_decode(srsran_pdsch_nr_t*           q,
   // Demapping to virtual resource blocks
   // ... Not implemented
 
+  // Single layers are equalized while they are demodulated, unless the equalized symbols are needed
+  bool fused = grant->nof_layers == 1 && q->evm_buffer == NULL && !q->store_symbols;
+
   // Antenna port demapping
   // ... Not implemented
-  srsran_predecoding_single(q->x[0], channel->ce[0][0], q->d[0], NULL, nof_re, 1.0f, channel->noise_estimate);
+  if (!fused) {
+    srsran_predecoding_single(q->x[0], channel->ce[0][0], q->d[0], NULL, nof_re, 1.0f, channel->noise_estimate);
+  }
 
   // Layer demapping
   if (grant->nof_layers > 1) {
@@ -546,7 +565,8 @@ int srsran_pdsch_nr_decode(srsran_pdsch_nr_t*           q,
 
   // SCH decode
   for (uint32_t tb = 0; tb < SRSRAN_MAX_TB; tb++) {
-    if (pdsch_nr_decode_codeword(q, cfg, &grant->tb[tb], data, grant->rnti) < SRSRAN_SUCCESS) {
+    if (pdsch_nr_decode_codeword(q, cfg, &grant->tb[tb], fused ? channel : NULL, data, grant->rnti) <
+        SRSRAN_SUCCESS) {
       ERROR("Error encoding TB %d", tb);
       return SRSRAN_ERROR;
     }
@@ -177,12 +177,6 @@ int srsran_pmch_init(srsran_pmch_t* q, uint32_t max_prb, uint32_t nof_rx_antenna
       }
     }
 
-    q->seqs = calloc(SRSRAN_MAX_MBSFN_AREA_IDS, sizeof(srsran_pmch_seq_t*));
-    if (!q->seqs) {
-      perror("calloc");
-      goto clean;
-    }
-
     ret = SRSRAN_SUCCESS;
   }
 clean:
@@ -215,14 +209,6 @@ void srsran_pmch_free(srsran_pmch_t* q)
       free(q->symbols[i]);
     }
   }
-  if (q->seqs) {
-    for (uint32_t i = 0; i < SRSRAN_MAX_MBSFN_AREA_IDS; i++) {
-      if (q->seqs[i]) {
-        srsran_pmch_free_area_id(q, i);
-      }
-    }
-    free(q->seqs);
-  }
   for (uint32_t i = 0; i < 4; i++) {
     srsran_modem_table_free(&q->mod[i]);
   }
@@ -251,35 +237,19 @@ int srsran_pmch_set_cell(srsran_pmch_t* q, srsran_cell_t cell)
   return ret;
 }
 
-/* Precalculate the scramble sequences for a given MBSFN area ID. This function takes a while
- * to execute.
+/* The scrambling sequences are generated on the fly for each subframe, only the area ID is validated.
  */
 int srsran_pmch_set_area_id(srsran_pmch_t* q, uint16_t area_id)
 {
-  uint32_t i;
-  if (!q->seqs[area_id]) {
-    q->seqs[area_id] = calloc(1, sizeof(srsran_pmch_seq_t));
-    if (q->seqs[area_id]) {
-      for (i = 0; i < SRSRAN_NOF_SF_X_FRAME; i++) {
-        if (srsran_sequence_pmch(
-                &q->seqs[area_id]->seq[i], 2 * i, area_id, q->max_re * srsran_mod_bits_x_symbol(SRSRAN_MOD_64QAM))) {
-          return SRSRAN_ERROR;
-        }
-      }
-    }
+  if (q == NULL || area_id >= SRSRAN_MAX_MBSFN_AREA_IDS) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
   }
   return SRSRAN_SUCCESS;
 }
 
 void srsran_pmch_free_area_id(srsran_pmch_t* q, uint16_t area_id)
 {
-  if (q->seqs[area_id]) {
-    for (int i = 0; i < SRSRAN_NOF_SF_X_FRAME; i++) {
-      srsran_sequence_free(&q->seqs[area_id]->seq[i]);
-    }
-    free(q->seqs[area_id]);
-    q->seqs[area_id] = NULL;
-  }
+  // Nothing to free, kept for API compatibility
 }
 
 /** Decodes the pmch from the received symbols
@@ -359,7 +329,7 @@ int srsran_pmch_decode(srsran_pmch_t*         q,
     srsran_demod_soft_demodulate_s(cfg->pdsch_cfg.grant.tb[0].mod, q->d, q->e, cfg->pdsch_cfg.grant.nof_re);
 
     /* descramble */
-    srsran_scrambling_s_offset(&q->seqs[cfg->area_id]->seq[sf->tti % 10], q->e, 0, cfg->pdsch_cfg.grant.tb[0].nof_bits);
+    srsran_sequence_pmch_apply_s(q->e, q->e, 2 * (sf->tti % 10), cfg->area_id, cfg->pdsch_cfg.grant.tb[0].nof_bits);
 
     if (SRSRAN_VERBOSE_ISDEBUG()) {
       DEBUG("SAVED FILE llr.dat: LLR estimates after demodulation and descrambling");
@@ -438,8 +408,8 @@ int srsran_pmch_encode(srsran_pmch_t*      q,
     }
 
     /* scramble */
-    srsran_scrambling_bytes(
-        &q->seqs[cfg->area_id]->seq[sf->tti % 10], (uint8_t*)q->e, cfg->pdsch_cfg.grant.tb[0].nof_bits);
+    srsran_sequence_pmch_apply_pack(
+        (uint8_t*)q->e, (uint8_t*)q->e, 2 * (sf->tti % 10), cfg->area_id, cfg->pdsch_cfg.grant.tb[0].nof_bits);
 
     srsran_mod_modulate_bytes(
         &q->mod[cfg->pdsch_cfg.grant.tb[0].mod], (uint8_t*)q->e, q->d, cfg->pdsch_cfg.grant.tb[0].nof_bits);
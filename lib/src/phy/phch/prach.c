@@ -474,6 +474,7 @@ int srsran_prach_gen_seqs(srsran_prach_t* p)
       // Generate actual sequence
       prach_cexp(p->N_zc, u, root);
 
+      p->root_d_u[p->N_roots]        = 0;
       p->root_seqs_idx[p->N_roots++] = i;
 
       // Determine v_max
@@ -509,12 +510,15 @@ int srsran_prach_gen_seqs(srsran_prach_t* p)
           if (N_neg_shift > N_shift)
             N_neg_shift = N_shift;
         } else {
-          N_shift = 0;
+          N_shift     = 0;
+          N_neg_shift = 0;
         }
         v_max = N_shift * N_group + N_neg_shift - 1;
         if (v_max < 0) {
           v_max = 0;
         }
+        // The Doppler aliases also move the peak of a root without cyclic shifts, which carries a single preamble
+        p->root_d_u[p->N_roots - 1] = d_u;
       } else {
         // Normal cell
         if (0 == p->N_cs) {
@@ -538,6 +542,8 @@ int srsran_prach_gen_seqs(srsran_prach_t* p)
       C_v = v * p->N_cs;
     }
 
+    p->seq_shift[i] = C_v;
+
     // Copy shifted sequence, equivalent to:
     // for (int j = 0; j < p->N_zc; j++) {
     //      p->seqs[i][j] = root[(j + C_v) % p->N_zc];
@@ -567,6 +573,7 @@ int srsran_prach_init(srsran_prach_t* p, uint32_t max_N_ifft_ul)
     p->prach_bins = srsran_vec_cf_malloc(SRSRAN_PRACH_N_ZC_LONG);
     p->corr_spec  = srsran_vec_cf_malloc(SRSRAN_PRACH_N_ZC_LONG);
     p->corr       = srsran_vec_f_malloc(SRSRAN_PRACH_N_ZC_LONG);
+    p->corr_hs    = srsran_vec_f_malloc(2 * SRSRAN_PRACH_N_ZC_LONG);
     p->cross      = srsran_vec_cf_malloc(SRSRAN_PRACH_N_ZC_LONG);
     p->corr_freq  = srsran_vec_cf_malloc(SRSRAN_PRACH_N_ZC_LONG);
 
@@ -866,6 +873,40 @@ void srsran_prach_calculate_correction_array(srsran_prach_t* p, cf_t* corr_freq)
   }
 }
 
+// returns the correlation windows are searched in. In a restricted set, the correlation is repeated twice so the
+// windows moved by the Doppler aliases do not need to wrap around
+static float* prach_root_corr(srsran_prach_t* p, uint32_t root)
+{
+  if (!p->hs || p->root_d_u[root] == 0) {
+    return p->corr;
+  }
+
+  srsran_vec_f_copy(p->corr_hs, p->corr, p->N_zc);
+  srsran_vec_f_copy(&p->corr_hs[p->N_zc], p->corr, p->N_zc);
+  return p->corr_hs;
+}
+
+// searches the peak of a preamble window and returns its value, the position relative to the window start is written in
+// offset. In a restricted set, a frequency offset of one PRACH subcarrier moves the peak by +/- d_u samples, the window
+// is also searched at both aliases
+static float
+prach_window_peak(srsran_prach_t* p, uint32_t root, const float* corr, uint32_t start, uint32_t len, uint32_t* offset)
+{
+  uint32_t d_u        = p->hs ? p->root_d_u[root] : 0;
+  uint32_t shifts[3]  = {0, d_u, p->N_zc - d_u};
+  uint32_t nof_shifts = (d_u == 0) ? 1 : 3;
+  float    peak       = 0;
+  for (uint32_t i = 0; i < nof_shifts; i++) {
+    uint32_t w = (start + shifts[i]) % p->N_zc;
+    uint32_t k = srsran_vec_max_fi(&corr[w], len);
+    if (i == 0 || corr[w + k] > peak) {
+      peak    = corr[w + k];
+      *offset = k;
+    }
+  }
+  return peak;
+}
+
 // This function carries out the main processing on the incomming PRACH signal
 int srsran_prach_process(srsran_prach_t* p,
                          cf_t*           signal,
@@ -879,15 +920,24 @@ int srsran_prach_process(srsran_prach_t* p,
 {
   float max_to_cancel = 0;
   cancellation_idx    = -1;
-  int max_idx         = 0;
   srsran_vec_cf_zero(p->cross, p->N_zc);
   srsran_vec_cf_zero(p->corr_freq, p->N_zc);
+
+  uint32_t winsize = 0;
+  if (p->N_cs != 0) {
+    winsize = p->N_cs;
+  } else {
+    winsize = p->N_zc;
+  }
+
   for (int i = 0; i < p->num_ra_preambles; i++) {
     cf_t* root_spec = get_precoded_dft(p, p->root_seqs_idx[i]);
 
     srsran_vec_prod_conj_ccc(p->prach_bins, root_spec, p->corr_spec, p->N_zc);
 
-    srsran_vec_prod_conj_ccc(p->corr_spec, &p->corr_spec[1], p->cross, p->N_zc - 1);
+    if (p->freq_domain_offset_calc) {
+      srsran_vec_prod_conj_ccc(p->corr_spec, &p->corr_spec[1], p->cross, p->N_zc - 1);
+    }
     if (p->successive_cancellation) {
       srsran_vec_cf_copy(p->corr_freq, p->corr_spec, p->N_zc);
     }
@@ -895,53 +945,54 @@ int srsran_prach_process(srsran_prach_t* p,
 
     srsran_vec_abs_square_cf(p->corr_spec, p->corr, p->N_zc);
 
-    float corr_ave = srsran_vec_acc_ff(p->corr, p->N_zc) / p->N_zc;
+    float corr_ave  = srsran_vec_acc_ff(p->corr, p->N_zc) / p->N_zc;
+    float threshold = p->detect_factor * corr_ave;
 
-    uint32_t winsize = 0;
-    if (p->N_cs != 0) {
-      winsize = p->N_cs;
-    } else {
-      winsize = p->N_zc;
+    // Skip the root if no correlation sample exceeds the threshold, it is the case of most roots
+    if (p->corr[srsran_vec_max_fi(p->corr, p->N_zc)] <= threshold) {
+      continue;
     }
-    uint32_t n_wins = p->N_zc / winsize;
+    float* corr = prach_root_corr(p, i);
+
+    // Preambles generated from this root
+    uint32_t seq_begin = p->root_seqs_idx[i];
+    uint32_t seq_end   = (i + 1 < p->N_roots) ? p->root_seqs_idx[i + 1] : N_SEQS;
+    uint32_t n_wins    = seq_end - seq_begin;
 
+    // Search the peak in the window of each preamble, the peak of cyclic shift C_v is located at N_zc - C_v
     float max_peak = 0;
     for (int j = 0; j < n_wins; j++) {
-      uint32_t start = (p->N_zc - (j * p->N_cs)) % p->N_zc;
+      uint32_t start = (p->N_zc - p->seq_shift[seq_begin + j]) % p->N_zc;
       uint32_t end   = start + winsize;
       if (end > p->deadzone) {
         end -= p->deadzone;
       }
       start += p->deadzone;
-      p->peak_values[j] = 0;
-      for (int k = start; k < end; k++) {
-        if (p->corr[k] > p->peak_values[j]) {
-          p->peak_values[j]  = p->corr[k];
-          p->peak_offsets[j] = k - start;
-          if (p->peak_values[j] > max_peak) {
-            max_peak = p->peak_values[j];
-            max_idx  = k;
-          }
-        }
+
+      uint32_t k        = 0;
+      p->peak_values[j] = prach_window_peak(p, i, corr, start, end - start, &k);
+      p->peak_offsets[j] = k;
+      if (p->peak_values[j] > max_peak) {
+        max_peak = p->peak_values[j];
       }
     }
-    if (max_peak > (p->detect_factor * corr_ave)) {
+    if (max_peak > threshold) {
       for (int j = 0; j < n_wins; j++) {
-        if (p->peak_values[j] > p->detect_factor * corr_ave) {
+        if (p->peak_values[j] > threshold) {
           if (indices) {
             if (p->successive_cancellation) {
               if (max_peak > max_to_cancel) {
-                cancellation_idx       = (i * n_wins) + j;
+                cancellation_idx       = seq_begin + j;
                 max_to_cancel          = max_peak;
                 p->prach_cancel.idx    = cancellation_idx;
                 p->prach_cancel.factor = (sqrt(max_peak / (p->N_zc * p->N_zc)));
                 srsran_prach_calculate_correction_array(p, p->corr_freq);
               }
-              if (srsran_prach_have_stored(((i * n_wins) + j), indices, *n_indices)) {
+              if (srsran_prach_have_stored(seq_begin + j, indices, *n_indices)) {
                 break;
               }
             }
-            indices[*n_indices] = (i * n_wins) + j;
+            indices[*n_indices] = seq_begin + j;
           }
           if (peak_to_avg) {
             peak_to_avg[*n_indices] = p->peak_values[j] / corr_ave;
@@ -1016,6 +1067,7 @@ int srsran_prach_free(srsran_prach_t* p)
   free(p->prach_bins);
   free(p->corr_spec);
   free(p->corr);
+  free(p->corr_hs);
   srsran_dft_plan_free(&p->ifft);
   free(p->ifft_in);
   free(p->ifft_out);
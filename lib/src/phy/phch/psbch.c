@@ -189,6 +189,12 @@ int srsran_psbch_init(srsran_psbch_t* q, uint32_t nof_prb, uint32_t N_sl_id, srs
     return SRSRAN_ERROR;
   }
 
+  // PSBCH always takes SRSRAN_PSBCH_NOF_PRB, so its single transform precoding plan is made here
+  if (srsran_dft_precoding_prewarm(SRSRAN_PSBCH_NOF_PRB) != SRSRAN_SUCCESS) {
+    ERROR("Error pre-warming DFT precoder");
+    return SRSRAN_ERROR;
+  }
+
   return SRSRAN_SUCCESS;
 }
 
@@ -154,6 +154,11 @@ int srsran_pscch_init(srsran_pscch_t* q, uint32_t max_prb)
       return SRSRAN_ERROR;
     }
 
+    // The PSCCH spans up to SRSRAN_PSCCH_MAX_NOF_PRB, keep those transform precoding plans ready
+    if (srsran_dft_precoding_prewarm(SRSRAN_PSCCH_MAX_NOF_PRB) < SRSRAN_SUCCESS) {
+      return SRSRAN_ERROR;
+    }
+
     ret = SRSRAN_SUCCESS;
   }
 
@@ -221,6 +221,12 @@ int srsran_pssch_init(srsran_pssch_t*                       q,
     return SRSRAN_ERROR;
   }
 
+  // Have FFTW plan the transform precoding of every PSSCH bandwidth of the cell before the first subframe
+  if (srsran_dft_precoding_prewarm(q->cell.nof_prb) < SRSRAN_SUCCESS) {
+    ERROR("Error pre-warming DFT precoder");
+    return SRSRAN_ERROR;
+  }
+
   return SRSRAN_SUCCESS;
 }
 
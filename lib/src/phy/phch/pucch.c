@@ -69,6 +69,16 @@ int srsran_pucch_init_(srsran_pucch_t* q, bool is_ue)
 
     if (!q->is_ue) {
       q->ce = srsran_vec_cf_malloc(SRSRAN_PUCCH_MAX_SYMBOLS);
+
+      // Joint format 1 detector, one row per SC-FDMA symbol of the subframe
+      q->cs_in  = srsran_vec_cf_malloc(SRSRAN_NRE * SRSRAN_CP_NORM_SF_NSYMB);
+      q->cs_out = srsran_vec_cf_malloc(SRSRAN_NRE * SRSRAN_CP_NORM_SF_NSYMB);
+      if (!q->ce || !q->cs_in || !q->cs_out) {
+        goto clean_exit;
+      }
+      if (srsran_dft_plan_c(&q->cs_dft, SRSRAN_NRE, SRSRAN_DFT_FORWARD)) {
+        goto clean_exit;
+      }
     }
 
     ret = SRSRAN_SUCCESS;
@@ -104,6 +114,16 @@ void srsran_pucch_free(srsran_pucch_t* q)
   if (q->ce) {
     free(q->ce);
   }
+  if (q->cs_in) {
+    free(q->cs_in);
+  }
+  if (q->cs_out) {
+    free(q->cs_out);
+  }
+  if (q->joint_key) {
+    free(q->joint_key);
+  }
+  srsran_dft_plan_free(&q->cs_dft);
 
   srsran_modem_table_free(&q->mod);
   bzero(q, sizeof(srsran_pucch_t));
@@ -871,6 +891,346 @@ int srsran_pucch_decode(srsran_pucch_t*        q,
   return ret;
 }
 
+/* Weight of the DMRS channel estimate noise in the joint DMRS detection metric. With the default thresholds, no empty
+ * format 1, 1a or 1b resource was detected in 2e5 subframes, and a single UE is detected down to about 6 dB lower SNR
+ * than with srsran_pucch_decode() */
+#define PUCCH_JOINT_DMRS_NOISE_SCALE (4.5f)
+
+/* Cyclic shift of a format 1 PUCCH symbol, alpha is always a multiple of 2*pi/12 */
+static uint32_t pucch_alpha_to_cs(float alpha)
+{
+  return (uint32_t)roundf(alpha * SRSRAN_NRE / (2.0f * (float)M_PI)) % SRSRAN_NRE;
+}
+
+/* PRB pair of a format 1 resource, resources with the same key are transformed together */
+static uint32_t pucch_joint_key(srsran_pucch_t* q, srsran_pucch_cfg_t* cfg)
+{
+  return srsran_pucch_n_prb(&q->cell, cfg, 0) | (srsran_pucch_n_prb(&q->cell, cfg, 1) << 8U) |
+         ((cfg->group_hopping_en ? 1U : 0U) << 16U);
+}
+
+/* Base sequence de-rotation and DFT across the cyclic shifts of every SC-FDMA symbol of a PRB pair */
+static void pucch_joint_transform(srsran_pucch_t* q, srsran_ul_sf_cfg_t* sf, srsran_pucch_cfg_t* cfg, cf_t* input)
+{
+  uint32_t nsymb  = SRSRAN_CP_NSYMB(q->cell.cp);
+  uint32_t sf_idx = sf->tti % SRSRAN_NOF_SF_X_FRAME;
+  cf_t     r_uv[SRSRAN_NRE];
+
+  for (uint32_t ns = 0; ns < SRSRAN_NOF_SLOTS_PER_SF; ns++) {
+    uint32_t f_gh = cfg->group_hopping_en ? q->f_gh[SRSRAN_NOF_SLOTS_PER_SF * sf_idx + ns] : 0;
+    srsran_zc_sequence_generate_lte((f_gh + (q->cell.id % 30)) % 30, 0, 0.0f, 1, r_uv);
+
+    uint32_t n_prb = srsran_pucch_n_prb(&q->cell, cfg, ns);
+    for (uint32_t l = 0; l < nsymb; l++) {
+      srsran_vec_prod_conj_ccc(&input[SRSRAN_RE_IDX(q->cell.nof_prb, l + ns * nsymb, n_prb * SRSRAN_NRE)],
+                               r_uv,
+                               &q->cs_in[(l + ns * nsymb) * SRSRAN_NRE],
+                               SRSRAN_NRE);
+    }
+  }
+
+  srsran_dft_run_batch_c(&q->cs_dft, q->cs_in, q->cs_out, SRSRAN_NOF_SLOTS_PER_SF * nsymb);
+}
+
+/* Orthogonal covers in use in every cyclic shift of a PRB pair. The cyclic shift of a resource relative to n_cs_cell is
+ * the same in all the symbols of a slot, so the covers are indexed by the relative cyclic shift. */
+typedef struct {
+  uint8_t data_mask[SRSRAN_NOF_SLOTS_PER_SF][SRSRAN_NRE];
+  uint8_t rs_mask[SRSRAN_NOF_SLOTS_PER_SF][SRSRAN_NRE];
+  cf_t    data_w[SRSRAN_NOF_SLOTS_PER_SF][SRSRAN_NRE][3][4];
+  cf_t    rs_w[SRSRAN_NOF_SLOTS_PER_SF][SRSRAN_NRE][3][3];
+} pucch_joint_covers_t;
+
+static int pucch_joint_add_covers(srsran_pucch_t*        q,
+                                  srsran_refsignal_ul_t* dmrs,
+                                  srsran_ul_sf_cfg_t*    sf,
+                                  srsran_pucch_cfg_t*    cfg,
+                                  pucch_joint_covers_t*  covers)
+{
+  uint32_t sf_idx = sf->tti % SRSRAN_NOF_SF_X_FRAME;
+  for (uint32_t s = 0; s < SRSRAN_NOF_SLOTS_PER_SF; s++) {
+    uint32_t ns = SRSRAN_NOF_SLOTS_PER_SF * sf_idx + s;
+
+    uint32_t N_sf      = get_N_sf(cfg->format, s, sf->shortened);
+    uint32_t N_sf_widx = N_sf == 3 ? 1 : 0;
+    for (uint32_t m = 0; m < N_sf; m++) {
+      uint32_t l     = get_pucch_symbol(m, cfg->format, q->cell.cp);
+      uint32_t n_oc  = 0;
+      float    alpha = srsran_pucch_alpha_format1(q->n_cs_cell, cfg, q->cell.cp, true, ns, l, &n_oc, NULL);
+      uint32_t b     = (pucch_alpha_to_cs(alpha) + SRSRAN_NRE - q->n_cs_cell[ns][l] % SRSRAN_NRE) % SRSRAN_NRE;
+      covers->data_mask[s][b] |= 1U << (n_oc % 3);
+      covers->data_w[s][b][n_oc % 3][m] = cexpf(I * w_n_oc[N_sf_widx][n_oc % 3][m]);
+    }
+
+    uint32_t n_rs = srsran_refsignal_dmrs_N_rs(cfg->format, q->cell.cp);
+    for (uint32_t m = 0; m < n_rs; m++) {
+      uint32_t l    = srsran_refsignal_dmrs_pucch_symbol(m, cfg->format, q->cell.cp);
+      uint32_t n_oc = 0;
+      uint32_t n_cs = 0;
+      cf_t     z    = 1.0f;
+      srsran_pucch_alpha_format1(q->n_cs_cell, cfg, q->cell.cp, true, ns, l, &n_oc, NULL);
+      if (srsran_refsignal_dmrs_pucch_cs(dmrs, cfg, ns, m, &n_cs, &z) < SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
+      }
+      uint32_t b = (n_cs + SRSRAN_NRE - q->n_cs_cell[ns][l] % SRSRAN_NRE) % SRSRAN_NRE;
+      covers->rs_mask[s][b] |= 1U << (n_oc % 3);
+      covers->rs_w[s][b][n_oc % 3][m] = z;
+    }
+  }
+  return SRSRAN_SUCCESS;
+}
+
+/* Energy of the symbols v that lies outside the covers in use, returns the number of degrees of freedom */
+static uint32_t
+pucch_joint_residual(const cf_t* v, uint32_t len, uint8_t mask, const cf_t* w, uint32_t w_stride, float* energy)
+{
+  uint32_t dof = len;
+  float    e   = crealf(srsran_vec_dot_prod_conj_ccc(v, v, len));
+  for (uint32_t oc = 0; oc < 3; oc++) {
+    if (mask & (1U << oc)) {
+      cf_t p = srsran_vec_dot_prod_conj_ccc(v, &w[oc * w_stride], len);
+      e -= (__real__ p * __real__ p + __imag__ p * __imag__ p) / (float)len;
+      dof--;
+    }
+  }
+  *energy += SRSRAN_MAX(e, 0.0f);
+  return dof;
+}
+
+/* Noise power per resource element, from the part of every cyclic shift that is not used by any cover */
+static float pucch_joint_noise(srsran_pucch_t* q, srsran_ul_sf_cfg_t* sf, pucch_joint_covers_t* covers)
+{
+  uint32_t nsymb  = SRSRAN_CP_NSYMB(q->cell.cp);
+  uint32_t sf_idx = sf->tti % SRSRAN_NOF_SF_X_FRAME;
+  float    energy = 0.0f;
+  uint32_t dof    = 0;
+  cf_t     v[4];
+
+  for (uint32_t s = 0; s < SRSRAN_NOF_SLOTS_PER_SF; s++) {
+    uint32_t ns   = SRSRAN_NOF_SLOTS_PER_SF * sf_idx + s;
+    uint32_t N_sf = get_N_sf(SRSRAN_PUCCH_FORMAT_1, s, sf->shortened);
+    uint32_t n_rs = srsran_refsignal_dmrs_N_rs(SRSRAN_PUCCH_FORMAT_1, q->cell.cp);
+    for (uint32_t b = 0; b < SRSRAN_NRE; b++) {
+      for (uint32_t m = 0; m < N_sf; m++) {
+        uint32_t l = get_pucch_symbol(m, SRSRAN_PUCCH_FORMAT_1, q->cell.cp);
+        v[m]       = q->cs_out[(l + s * nsymb) * SRSRAN_NRE + (q->n_cs_cell[ns][l] + b) % SRSRAN_NRE];
+      }
+      dof += pucch_joint_residual(v, N_sf, covers->data_mask[s][b], covers->data_w[s][b][0], 4, &energy);
+
+      for (uint32_t m = 0; m < n_rs; m++) {
+        uint32_t l = srsran_refsignal_dmrs_pucch_symbol(m, SRSRAN_PUCCH_FORMAT_1, q->cell.cp);
+        v[m]       = q->cs_out[(l + s * nsymb) * SRSRAN_NRE + (q->n_cs_cell[ns][l] + b) % SRSRAN_NRE];
+      }
+      dof += pucch_joint_residual(v, n_rs, covers->rs_mask[s][b], covers->rs_w[s][b][0], 3, &energy);
+    }
+  }
+
+  // Every cyclic shift of the DFT carries SRSRAN_NRE times the noise power of a resource element
+  return dof ? energy / (float)(dof * SRSRAN_NRE) : NAN;
+}
+
+/* Detects one format 1 resource from the cyclic shift domain of its PRB pair */
+static int pucch_joint_detect(srsran_pucch_t*        q,
+                              srsran_refsignal_ul_t* dmrs,
+                              srsran_ul_sf_cfg_t*    sf,
+                              srsran_pucch_cfg_t*    cfg,
+                              float                  rs_power,
+                              float                  noise,
+                              srsran_pucch_res_t*    res)
+{
+  uint32_t nsymb    = SRSRAN_CP_NSYMB(q->cell.cp);
+  uint32_t sf_idx   = sf->tti % SRSRAN_NOF_SF_X_FRAME;
+  uint32_t n_rs     = srsran_refsignal_dmrs_N_rs(cfg->format, q->cell.cp);
+  cf_t     e_sum    = 0.0f;
+  float    e_energy = 0.0f;
+  uint32_t nof_e    = 0;
+  float    ch_power = 0.0f;
+
+  for (uint32_t s = 0; s < SRSRAN_NOF_SLOTS_PER_SF; s++) {
+    uint32_t ns = SRSRAN_NOF_SLOTS_PER_SF * sf_idx + s;
+
+    // Channel of the slot from the DMRS cyclic shift and orthogonal sequence
+    cf_t h = 0.0f;
+    for (uint32_t m = 0; m < n_rs; m++) {
+      uint32_t l    = srsran_refsignal_dmrs_pucch_symbol(m, cfg->format, q->cell.cp);
+      uint32_t n_cs = 0;
+      cf_t     z    = 1.0f;
+      if (srsran_refsignal_dmrs_pucch_cs(dmrs, cfg, ns, m, &n_cs, &z) < SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
+      }
+      h += q->cs_out[(l + s * nsymb) * SRSRAN_NRE + n_cs] * conjf(z);
+    }
+    h /= (float)(SRSRAN_NRE * n_rs);
+
+    float h_pow = __real__ h * __real__ h + __imag__ h * __imag__ h;
+    ch_power += h_pow;
+
+    // Equalized data symbols, the same orthogonal sequence as the encoder
+    uint32_t N_sf      = get_N_sf(cfg->format, s, sf->shortened);
+    uint32_t N_sf_widx = N_sf == 3 ? 1 : 0;
+    cf_t     e[4];
+    for (uint32_t m = 0; m < N_sf; m++) {
+      uint32_t l          = get_pucch_symbol(m, cfg->format, q->cell.cp);
+      uint32_t n_oc       = 0;
+      uint32_t n_prime_ns = 0;
+      float    alpha = srsran_pucch_alpha_format1(q->n_cs_cell, cfg, q->cell.cp, true, ns, l, &n_oc, &n_prime_ns);
+      float    S_ns  = (n_prime_ns % 2) ? M_PI / 2 : 0;
+      cf_t     w     = cexpf(I * (w_n_oc[N_sf_widx][n_oc % 3][m] + S_ns));
+      cf_t     y     = q->cs_out[(l + s * nsymb) * SRSRAN_NRE + pucch_alpha_to_cs(alpha)] * conjf(w) / SRSRAN_NRE;
+      e[m]           = isnormal(h_pow) ? y * conjf(h) / h_pow : 0.0f;
+    }
+
+    // The resources with other covers in the same cyclic shift cancel out in the sum. The energy of the slot is the
+    // despread symbol energy plus the noise of the equalized symbols; without a noise measurement, the full energy.
+    cf_t  u      = srsran_vec_acc_cc(e, N_sf);
+    float u_pow  = (__real__ u * __real__ u + __imag__ u * __imag__ u) / (float)N_sf;
+    float e_pow  = crealf(srsran_vec_dot_prod_conj_ccc(e, e, N_sf));
+    e_sum       += u;
+    e_energy    += (isnormal(noise) && isnormal(h_pow)) ? u_pow + N_sf * noise / (SRSRAN_NRE * h_pow) : e_pow;
+    nof_e       += N_sf;
+  }
+
+  // Measurements
+  res->rssi_dbFs = srsran_convert_power_to_dB(rs_power / SRSRAN_NOF_SLOTS_PER_SF);
+  res->ni_dbFs   = srsran_convert_power_to_dBm(noise);
+  res->snr_db    = isnormal(noise) ? srsran_convert_power_to_dB(ch_power / SRSRAN_NOF_SLOTS_PER_SF / noise) : NAN;
+  res->ta_valid  = false;
+  res->ta_us     = 0.0f;
+
+  // Perform DMRS Detection, if enabled. The other resources of the PRB pair are in other cyclic shifts, so the DMRS
+  // power is compared with the noise of the channel estimate only, which is despread over the DMRS of the slot. If
+  // every cyclic shift is used, it is compared with the PRB power instead.
+  if (isnormal(cfg->threshold_dmrs_detection)) {
+    if (isnormal(noise)) {
+      float ch_noise        = SRSRAN_NOF_SLOTS_PER_SF * noise / (SRSRAN_NRE * n_rs);
+      res->dmrs_correlation = ch_power / (ch_power + PUCCH_JOINT_DMRS_NOISE_SCALE * ch_noise);
+    } else {
+      res->dmrs_correlation = ch_power / rs_power;
+    }
+
+    // Return not detected if the ratio is 0, NAN, +/- Infinity or below threshold
+    if (!isnormal(res->dmrs_correlation) || res->dmrs_correlation < cfg->threshold_dmrs_detection) {
+      res->correlation = 0.0f;
+      res->detected    = false;
+      return SRSRAN_SUCCESS;
+    }
+  }
+
+  // ML-decoding, the normalised correlation of the equalized symbols with every hypothesis
+  float    e_power                           = sqrtf((float)nof_e * e_energy);
+  uint8_t  pucch_bits[SRSRAN_PUCCH_MAX_BITS] = {};
+  uint32_t nof_hyp                           = 1U << srsran_pucch_nof_ack_format(cfg->format);
+  float    corr_max                          = -1e9;
+  uint32_t hyp_max                           = 0;
+  for (uint32_t hyp = 0; hyp < nof_hyp; hyp++) {
+    uint8_t b[2] = {hyp & 1U, (hyp >> 1U) & 1U};
+    cf_t    d    = uci_encode_format1();
+    if (cfg->format == SRSRAN_PUCCH_FORMAT_1A) {
+      d = uci_encode_format1a(b[0]);
+    } else if (cfg->format == SRSRAN_PUCCH_FORMAT_1B) {
+      d = uci_encode_format1b(b);
+    }
+    float corr = isnormal(e_power) ? crealf(e_sum * conjf(d)) / e_power : 0.0f;
+    if (corr > corr_max) {
+      corr_max = corr;
+      hyp_max  = hyp;
+    }
+  }
+  pucch_bits[0] = hyp_max & 1U;
+  pucch_bits[1] = (hyp_max >> 1U) & 1U;
+
+  bool pucch_found = (cfg->format == SRSRAN_PUCCH_FORMAT_1) ? (corr_max >= cfg->threshold_format1)
+                                                            : (corr_max > cfg->threshold_format1);
+
+  decode_bits(cfg, pucch_found, pucch_bits, cfg->pucch2_drs_bits, &res->uci_data);
+
+  res->correlation = corr_max;
+  res->detected    = pucch_found;
+  if (cfg->format != SRSRAN_PUCCH_FORMAT_1) {
+    res->uci_data.ack.valid = res->correlation > cfg->threshold_data_valid_format1a;
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+int srsran_pucch_decode_format1_joint(srsran_pucch_t*        q,
+                                      srsran_refsignal_ul_t* dmrs,
+                                      srsran_ul_sf_cfg_t*    sf,
+                                      srsran_pucch_cfg_t**   cfg,
+                                      cf_t*                  sf_symbols,
+                                      srsran_pucch_res_t**   res,
+                                      uint32_t               nof_resources)
+{
+  if (q == NULL || dmrs == NULL || sf == NULL || cfg == NULL || sf_symbols == NULL || res == NULL || q->is_ue) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  // Compute the PRB pair of every resource
+  if (nof_resources > q->joint_key_size) {
+    uint32_t* joint_key = realloc(q->joint_key, sizeof(uint32_t) * nof_resources);
+    if (joint_key == NULL) {
+      return SRSRAN_ERROR;
+    }
+    q->joint_key      = joint_key;
+    q->joint_key_size = nof_resources;
+  }
+  for (uint32_t i = 0; i < nof_resources; i++) {
+    if (cfg[i]->format > SRSRAN_PUCCH_FORMAT_1B) {
+      ERROR("Joint PUCCH detection does not support format %s", srsran_pucch_format_text(cfg[i]->format));
+      return SRSRAN_ERROR_INVALID_INPUTS;
+    }
+    q->joint_key[i] = pucch_joint_key(q, cfg[i]);
+  }
+
+  uint32_t nsymb = SRSRAN_CP_NSYMB(q->cell.cp);
+  for (uint32_t i = 0; i < nof_resources; i++) {
+    // Skip PRB pairs that have been processed already
+    bool done = false;
+    for (uint32_t j = 0; j < i && !done; j++) {
+      done = (q->joint_key[j] == q->joint_key[i]);
+    }
+    if (done) {
+      continue;
+    }
+
+    if (srsran_pucch_n_prb(&q->cell, cfg[i], 0) >= q->cell.nof_prb ||
+        srsran_pucch_n_prb(&q->cell, cfg[i], 1) >= q->cell.nof_prb) {
+      ERROR("Invalid PUCCH n_prb");
+      return SRSRAN_ERROR;
+    }
+
+    pucch_joint_transform(q, sf, cfg[i], sf_symbols);
+
+    // The part of the PRB pair not used by any resource only carries noise
+    pucch_joint_covers_t covers = {};
+    for (uint32_t j = i; j < nof_resources; j++) {
+      if (q->joint_key[j] == q->joint_key[i] && pucch_joint_add_covers(q, dmrs, sf, cfg[j], &covers) < SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
+      }
+    }
+    float noise = pucch_joint_noise(q, sf, &covers);
+
+    // Average power per resource element of the DMRS symbols, all resources share them
+    float    rs_power = 0.0f;
+    uint32_t n_rs     = srsran_refsignal_dmrs_N_rs(cfg[i]->format, q->cell.cp);
+    for (uint32_t s = 0; s < SRSRAN_NOF_SLOTS_PER_SF; s++) {
+      for (uint32_t m = 0; m < n_rs; m++) {
+        uint32_t l = srsran_refsignal_dmrs_pucch_symbol(m, cfg[i]->format, q->cell.cp);
+        rs_power += srsran_vec_avg_power_cf(&q->cs_in[(l + s * nsymb) * SRSRAN_NRE], SRSRAN_NRE) / n_rs;
+      }
+    }
+
+    for (uint32_t j = i; j < nof_resources; j++) {
+      if (q->joint_key[j] == q->joint_key[i] &&
+          pucch_joint_detect(q, dmrs, sf, cfg[j], rs_power, noise, res[j]) < SRSRAN_SUCCESS) {
+        return SRSRAN_ERROR;
+      }
+    }
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
 char* srsran_pucch_format_text(srsran_pucch_format_t format)
 {
   char* ret = NULL;
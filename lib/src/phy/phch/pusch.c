@@ -415,8 +415,15 @@ int srsran_pusch_decode(srsran_pusch_t*        q,
     // DFT predecoding
     srsran_dft_precoding(&q->dft_precoding, q->z, q->d, cfg->grant.L_prb, cfg->grant.nof_symb);
 
-    // Soft demodulation
-    if (q->llr_is_8bit) {
+    // Soft demodulation. Unless the EVM is measured, 8-bit LLR are descrambled in the same pass
+    bool fused_descrambling = q->llr_is_8bit && !(cfg->meas_evm_en && q->evm_buffer);
+    if (fused_descrambling) {
+      cf_t*                   d[SRSRAN_MAX_PORTS] = {q->d};
+      srsran_sequence_state_t scrambling          = {};
+      srsran_sequence_pusch_state_init(&scrambling, cfg->rnti, 2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME), q->cell.id);
+      srsran_demod_soft_equalize_b(
+          cfg->grant.tb.mod, d, NULL, 1, 1.0f, 0.0f, &scrambling, false, q->q, cfg->grant.nof_re);
+    } else if (q->llr_is_8bit) {
       srsran_demod_soft_demodulate_b(cfg->grant.tb.mod, q->d, q->q, cfg->grant.nof_re);
     } else {
       srsran_demod_soft_demodulate_s(cfg->grant.tb.mod, q->d, q->q, cfg->grant.nof_re);
@@ -433,7 +440,9 @@ int srsran_pusch_decode(srsran_pusch_t*        q,
     }
 
     // Descrambling
-    if (q->llr_is_8bit) {
+    if (fused_descrambling) {
+      // Already descrambled
+    } else if (q->llr_is_8bit) {
       srsran_sequence_pusch_apply_c(
           q->q, q->q, cfg->rnti, 2 * (sf->tti % SRSRAN_NOF_SF_X_FRAME), q->cell.id, cfg->grant.tb.nof_bits);
     } else {
@@ -456,6 +465,9 @@ int srsran_pusch_decode(srsran_pusch_t*        q,
     // Save number of iterations
     out->avg_iterations_block = q->ul_sch.avg_iterations;
 
+    // If the transport block was queued, CRC and iterations are set by srsran_pusch_decode_pending()
+    srsran_sch_set_pending_result(&q->ul_sch, &out->crc, &out->avg_iterations_block);
+
     // Save O_cqi for power control
     cfg->last_O_cqi = srsran_cqi_size(&cfg->uci_cfg.cqi);
     ret             = SRSRAN_SUCCESS;
@@ -470,6 +482,17 @@ int srsran_pusch_decode(srsran_pusch_t*        q,
   return ret;
 }
 
+/** Decodes the transport blocks queued by srsran_pusch_decode() when batched decoding is enabled in ul_sch
+ */
+int srsran_pusch_decode_pending(srsran_pusch_t* q)
+{
+  if (q == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  return srsran_sch_decode_pending(&q->ul_sch);
+}
+
 uint32_t srsran_pusch_grant_tx_info(srsran_pusch_grant_t* grant,
                                     srsran_uci_cfg_t*     uci_cfg,
                                     srsran_uci_value_t*   uci_data,
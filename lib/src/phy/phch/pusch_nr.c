@@ -783,11 +783,12 @@ int srsran_pusch_nr_encode(srsran_pusch_nr_t*            q,
   return SRSRAN_SUCCESS;
 }
 
-static inline int pusch_nr_decode_codeword(srsran_pusch_nr_t*         q,
-                                           const srsran_sch_cfg_nr_t* cfg,
-                                           const srsran_sch_tb_t*     tb,
-                                           srsran_pusch_res_nr_t*     res,
-                                           uint16_t                   rnti)
+static inline int pusch_nr_decode_codeword(srsran_pusch_nr_t*           q,
+                                           const srsran_sch_cfg_nr_t*   cfg,
+                                           const srsran_sch_tb_t*       tb,
+                                           const srsran_chest_dl_res_t* channel,
+                                           srsran_pusch_res_nr_t*       res,
+                                           uint16_t                     rnti)
 {
   // Early return if TB is not enabled
   if (!tb->enabled) {
@@ -806,7 +807,8 @@ static inline int pusch_nr_decode_codeword(srsran_pusch_nr_t*         q,
     return SRSRAN_ERROR_OUT_OF_BOUNDS;
   }
 
-  if (SRSRAN_DEBUG_ENABLED && get_srsran_verbose_level() >= SRSRAN_VERBOSE_DEBUG && !is_handler_registered()) {
+  if (SRSRAN_DEBUG_ENABLED && get_srsran_verbose_level() >= SRSRAN_VERBOSE_DEBUG && !is_handler_registered() &&
+      channel == NULL) {
     DEBUG("d=");
     srsran_vec_fprint_c(stdout, q->d[tb->cw_idx], tb->nof_re);
   }
@@ -840,19 +842,32 @@ static inline int pusch_nr_decode_codeword(srsran_pusch_nr_t*         q,
     return SRSRAN_ERROR;
   }
 
-  // Demodulation
   int8_t* llr = (int8_t*)q->b[tb->cw_idx];
-  if (srsran_demod_soft_demodulate_b(tb->mod, q->d[tb->cw_idx], llr, tb->nof_re)) {
-    return SRSRAN_ERROR;
-  }
+  if (channel != NULL) {
+    // Equalization, demodulation and descrambling in a single pass
+    cf_t*                   ce[SRSRAN_MAX_PORTS] = {channel->ce[0][0]};
+    srsran_sequence_state_t scrambling           = {};
+    srsran_sequence_state_init(&scrambling, pusch_nr_cinit(&q->carrier, cfg, rnti, tb->cw_idx));
+    if (srsran_demod_soft_equalize_b(
+            tb->mod, q->x, ce, 1, 1.0f, channel->noise_estimate, &scrambling, false, llr, tb->nof_re) <
+        SRSRAN_SUCCESS) {
+      return SRSRAN_ERROR;
+    }
+  } else {
+    // Demodulation
+    if (srsran_demod_soft_demodulate_b(tb->mod, q->d[tb->cw_idx], llr, tb->nof_re)) {
+      return SRSRAN_ERROR;
+    }
 
-  // EVM
-  if (q->evm_buffer != NULL) {
-    res->evm[tb->cw_idx] = srsran_evm_run_b(q->evm_buffer, &q->modem_tables[tb->mod], q->d[tb->cw_idx], llr, nof_bits);
-  }
+    // EVM
+    if (q->evm_buffer != NULL) {
+      res->evm[tb->cw_idx] =
+          srsran_evm_run_b(q->evm_buffer, &q->modem_tables[tb->mod], q->d[tb->cw_idx], llr, nof_bits);
+    }
 
-  // Descrambling
-  srsran_sequence_apply_c(llr, llr, nof_bits, pusch_nr_cinit(&q->carrier, cfg, rnti, tb->cw_idx));
+    // Descrambling
+    srsran_sequence_apply_c(llr, llr, nof_bits, pusch_nr_cinit(&q->carrier, cfg, rnti, tb->cw_idx));
+  }
 
   if (SRSRAN_DEBUG_ENABLED && get_srsran_verbose_level() >= SRSRAN_VERBOSE_DEBUG && !is_handler_registered()) {
     DEBUG("b=");
@@ -990,9 +1005,14 @@ int srsran_pusch_nr_decode(srsran_pusch_nr_t*           q,
   // Demapping to virtual resource blocks
   // ... Not implemented
 
+  // Single layers are equalized while they are demodulated, unless the equalized symbols are needed for the EVM
+  bool fused = grant->nof_layers == 1 && q->evm_buffer == NULL;
+
   // Antenna port demapping
   // ... Not implemented
-  srsran_predecoding_single(q->x[0], channel->ce[0][0], q->d[0], NULL, nof_re, 1.0f, channel->noise_estimate);
+  if (!fused) {
+    srsran_predecoding_single(q->x[0], channel->ce[0][0], q->d[0], NULL, nof_re, 1.0f, channel->noise_estimate);
+  }
 
   // Layer demapping
   if (grant->nof_layers > 1) {
@@ -1001,7 +1021,8 @@ int srsran_pusch_nr_decode(srsran_pusch_nr_t*           q,
 
   // SCH decode
   for (uint32_t tb = 0; tb < SRSRAN_MAX_TB; tb++) {
-    if (pusch_nr_decode_codeword(q, cfg, &grant->tb[tb], data, grant->rnti) < SRSRAN_SUCCESS) {
+    if (pusch_nr_decode_codeword(q, cfg, &grant->tb[tb], fused ? channel : NULL, data, grant->rnti) <
+        SRSRAN_SUCCESS) {
       ERROR("Error encoding TB %d", tb);
       return SRSRAN_ERROR;
     }
@@ -215,6 +215,7 @@ void srsran_sch_free(srsran_sch_t* q)
     free(q->ul_interleaver);
   }
   srsran_tdec_free(&q->decoder);
+  srsran_tdec_batch_free(&q->batch_decoder);
   srsran_tcod_free(&q->encoder);
   srsran_uci_cqi_free(&q->uci_cqi);
   bzero(q, sizeof(srsran_sch_t));
@@ -234,6 +235,32 @@ float srsran_sch_last_noi(srsran_sch_t* q)
   return q->avg_iterations;
 }
 
+int srsran_sch_set_batch_decoding(srsran_sch_t* q, bool enable)
+{
+  if (q == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  // The batched decoder buffers are only allocated the first time it is enabled
+  if (enable && q->batch_decoder.max_long_cb == 0) {
+    if (srsran_tdec_batch_init(&q->batch_decoder, SRSRAN_TDEC_BATCH_MAX_LONG_CB)) {
+      ERROR("Error initiating batched Turbo Decoder");
+      return SRSRAN_ERROR;
+    }
+  }
+
+  q->batch_enabled = enable;
+  return SRSRAN_SUCCESS;
+}
+
+void srsran_sch_set_pending_result(srsran_sch_t* q, bool* crc, float* avg_iterations)
+{
+  if (q != NULL && q->last_tb_pending) {
+    q->pending_tb[q->nof_pending_tb - 1].crc            = crc;
+    q->pending_tb[q->nof_pending_tb - 1].avg_iterations = avg_iterations;
+  }
+}
+
 /* Encode a transport block according to 36.212 5.3.2
  *
  */
@@ -493,6 +520,136 @@ bool decode_tb_cb(srsran_sch_t*           q,
   return softbuffer->tb_crc;
 }
 
+/* Rate-matches a single code block transport block and queues it for srsran_sch_decode_pending() */
+static int decode_tb_defer(srsran_sch_t*           q,
+                           srsran_softbuffer_rx_t* softbuffer,
+                           srsran_cbsegm_t*        cb_segm,
+                           uint32_t                Qm,
+                           uint32_t                rv,
+                           uint32_t                nof_e_bits,
+                           int16_t*                e_bits,
+                           uint8_t*                data)
+{
+  uint32_t n_e = Qm * (nof_e_bits / Qm);
+
+  if (srsran_rm_turbo_rx_lut(e_bits, softbuffer->buffer_f[0], n_e, cb_segm->K1_idx, rv)) {
+    ERROR("Error in rate matching");
+    return SRSRAN_ERROR;
+  }
+
+  srsran_sch_pending_tb_t* tb = &q->pending_tb[q->nof_pending_tb++];
+  tb->softbuffer              = softbuffer;
+  tb->data                    = data;
+  tb->tbs                     = cb_segm->tbs;
+  tb->cb_len                  = cb_segm->K1;
+  tb->crc                     = NULL;
+  tb->avg_iterations          = NULL;
+
+  q->last_tb_pending = true;
+  q->avg_iterations  = 0;
+
+  return SRSRAN_SUCCESS;
+}
+
+/* Decodes a single code block with the same early stopping as decode_tb_cb() */
+static void decode_cb_single(srsran_sch_t* q, srsran_tdec_batch_cb_t* cb)
+{
+  srsran_tdec_new_cb(&q->decoder, cb->long_cb);
+
+  cb->crc_ok         = false;
+  cb->nof_iterations = 0;
+  do {
+    srsran_tdec_iteration(&q->decoder, cb->input, cb->output);
+    cb->nof_iterations++;
+    if (!srsran_crc_checksum_byte(cb->crc, cb->output, cb->crc_len) &&
+        cb->nof_iterations >= SRSRAN_PDSCH_MIN_TDEC_ITERS) {
+      cb->crc_ok = true;
+    }
+  } while (cb->nof_iterations < q->max_iterations && !cb->crc_ok);
+}
+
+/**
+ * Decodes all the transport blocks queued by srsran_ulsch_decode() since the last call. The transport blocks are
+ * decoded together in order of decreasing code block length, so that the code blocks sharing the SIMD lanes have
+ * similar lengths. The CRC and number of iterations of each one are written to the pointers given in
+ * srsran_sch_set_pending_result().
+ *
+ * @param[in] q
+ * @return SRSRAN_SUCCESS if all the queued transport blocks were decoded, SRSRAN_ERROR otherwise
+ */
+int srsran_sch_decode_pending(srsran_sch_t* q)
+{
+  if (q == NULL) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  int      ret    = SRSRAN_SUCCESS;
+  uint32_t nof_cb = q->nof_pending_tb;
+  uint32_t tb_idx[SRSRAN_SCH_MAX_PENDING_TB];
+
+  // Sort the pending transport blocks by decreasing code block length
+  for (uint32_t i = 0; i < nof_cb; i++) {
+    uint32_t j = i;
+    while (j > 0 && q->pending_tb[tb_idx[j - 1]].cb_len < q->pending_tb[i].cb_len) {
+      tb_idx[j] = tb_idx[j - 1];
+      j--;
+    }
+    tb_idx[j] = i;
+  }
+
+  for (uint32_t i = 0; i < nof_cb; i++) {
+    srsran_sch_pending_tb_t* tb = &q->pending_tb[tb_idx[i]];
+    srsran_tdec_batch_cb_t*  cb = &q->batch_cb[i];
+    cb->long_cb                 = tb->cb_len;
+    cb->input                   = tb->softbuffer->buffer_f[0];
+    cb->output                  = tb->data;
+    cb->crc                     = &q->crc_tb;
+    cb->crc_len                 = tb->tbs + 24;
+  }
+
+  // Too few code blocks to fill the SIMD lanes are faster decoded one at a time
+  if (nof_cb >= SRSRAN_MAX(srsran_tdec_batch_nof_lanes() / 8, 1)) {
+    if (srsran_tdec_batch_run(&q->batch_decoder, q->batch_cb, nof_cb, SRSRAN_PDSCH_MIN_TDEC_ITERS, q->max_iterations)) {
+      ERROR("Error decoding %d code blocks", nof_cb);
+      ret = SRSRAN_ERROR;
+    }
+  } else {
+    for (uint32_t i = 0; i < nof_cb; i++) {
+      decode_cb_single(q, &q->batch_cb[i]);
+    }
+  }
+
+  // Save the result of every transport block
+  for (uint32_t i = 0; i < nof_cb; i++) {
+    srsran_tdec_batch_cb_t*  cb = &q->batch_cb[i];
+    srsran_sch_pending_tb_t* tb = &q->pending_tb[tb_idx[i]];
+
+    tb->softbuffer->cb_crc[0] = cb->crc_ok && ret == SRSRAN_SUCCESS;
+    tb->softbuffer->tb_crc    = tb->softbuffer->cb_crc[0];
+    if (tb->softbuffer->tb_crc) {
+      srsran_softbuffer_rx_release(tb->softbuffer);
+    }
+
+    INFO("TB pending: cb_len=%d, CRC=%s, iterations=%d/%d",
+         tb->cb_len,
+         tb->softbuffer->tb_crc ? "OK" : "KO",
+         cb->nof_iterations,
+         q->max_iterations);
+
+    if (tb->crc) {
+      *tb->crc = tb->softbuffer->tb_crc;
+    }
+    if (tb->avg_iterations) {
+      *tb->avg_iterations = (float)cb->nof_iterations;
+    }
+  }
+
+  q->nof_pending_tb  = 0;
+  q->last_tb_pending = false;
+
+  return ret;
+}
+
 /**
  * Decode a transport block according to 36.212 5.3.2
  *
@@ -525,6 +682,7 @@ static int decode_tb(srsran_sch_t*           q,
           Qm);
     return SRSRAN_ERROR_INVALID_INPUTS;
   }
+  q->last_tb_pending = false;
 
   // Check segmentation is valid
   if (cb_segm->tbs == 0 || cb_segm->C == 0) {
@@ -544,6 +702,22 @@ static int decode_tb(srsran_sch_t*           q,
     return SRSRAN_ERROR_INVALID_INPUTS;
   }
 
+  if (softbuffer->llr_is_8bit && !q->llr_is_8bit) {
+    ERROR("Error 8-bit soft buffer requires the 8-bit decoder");
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  if (srsran_softbuffer_rx_reserve_cb(softbuffer, cb_segm->C)) {
+    ERROR("Error no soft buffer available for %d CBs", cb_segm->C);
+    return SRSRAN_ERROR;
+  }
+
+  // Leave short transport blocks for srsran_sch_decode_pending()
+  if (q->batch_enabled && !q->llr_is_8bit && cb_segm->C == 1 && !softbuffer->cb_crc[0] &&
+      q->nof_pending_tb < SRSRAN_SCH_MAX_PENDING_TB && srsran_tdec_batch_is_supported(&q->batch_decoder, cb_segm->K1)) {
+    return decode_tb_defer(q, softbuffer, cb_segm, Qm, rv, nof_e_bits, e_bits, data);
+  }
+
   // Process Codeblocks
   bool cb_crc_ok = decode_tb_cb(q, softbuffer, cb_segm, Qm, rv, nof_e_bits, e_bits, data);
 
@@ -553,15 +727,12 @@ static int decode_tb(srsran_sch_t*           q,
     return SRSRAN_ERROR;
   }
 
-  // One CB CRC OK, means TB CRC is OK.
-  if (cb_segm->C == 1) {
+  // One CB CRC OK, means TB CRC is OK. Check TB CRC for whole TB otherwise
+  if (cb_segm->C == 1 || srsran_crc_match_byte(&q->crc_tb, data, cb_segm->tbs)) {
     INFO("TB decoded OK");
-    return SRSRAN_SUCCESS;
-  }
 
-  // Check TB CRC for whole TB
-  if (srsran_crc_match_byte(&q->crc_tb, data, cb_segm->tbs)) {
-    INFO("TB decoded OK");
+    // The soft bits are not needed anymore, retransmissions are skipped with the CB CRCs
+    srsran_softbuffer_rx_release(softbuffer);
     return SRSRAN_SUCCESS;
   }
 
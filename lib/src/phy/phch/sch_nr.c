@@ -27,6 +27,7 @@
 #include "srsran/phy/phch/ra_nr.h"
 #include "srsran/phy/utils/bit.h"
 #include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/vector.h"
 
 #define SCH_INFO_TX(...) INFO("SCH Tx: " __VA_ARGS__)
@@ -225,17 +226,16 @@ int srsran_sch_nr_init_tx(srsran_sch_nr_t* q, const srsran_sch_nr_args_t* args)
 
   srsran_ldpc_encoder_type_t encoder_type = SRSRAN_LDPC_ENCODER_C;
 
-#ifdef LV_HAVE_AVX512
-  if (!args->disable_simd) {
-    encoder_type = SRSRAN_LDPC_ENCODER_AVX512;
-  }
-#else // LV_HAVE_AVX512
-#ifdef LV_HAVE_AVX2
-  if (!args->disable_simd) {
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (!args->disable_simd && srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2)) {
     encoder_type = SRSRAN_LDPC_ENCODER_AVX2;
   }
-#endif // LV_HAVE_AVX2
-#endif // LV_HAVE_AVX612
+#endif // SRSRAN_SIMD_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+  if (!args->disable_simd && srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX512)) {
+    encoder_type = SRSRAN_LDPC_ENCODER_AVX512;
+  }
+#endif // SRSRAN_SIMD_HAVE_AVX512
 
   // Iterate over all possible lifting sizes
   for (uint16_t ls = 0; ls <= MAX_LIFTSIZE; ls++) {
@@ -290,17 +290,16 @@ int srsran_sch_nr_init_rx(srsran_sch_nr_t* q, const srsran_sch_nr_args_t* args)
   srsran_ldpc_decoder_type_t decoder_type =
       args->decoder_use_flooded ? SRSRAN_LDPC_DECODER_C_FLOOD : SRSRAN_LDPC_DECODER_C;
 
-#ifdef LV_HAVE_AVX512
-  if (!args->disable_simd) {
-    decoder_type = args->decoder_use_flooded ? SRSRAN_LDPC_DECODER_C_AVX512_FLOOD : SRSRAN_LDPC_DECODER_C_AVX512;
-  }
-#else // LV_HAVE_AVX512
-#ifdef LV_HAVE_AVX2
-  if (!args->disable_simd) {
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (!args->disable_simd && srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2)) {
     decoder_type = args->decoder_use_flooded ? SRSRAN_LDPC_DECODER_C_AVX2_FLOOD : SRSRAN_LDPC_DECODER_C_AVX2;
   }
-#endif // LV_HAVE_AVX2
-#endif // LV_HAVE_AVX512
+#endif // SRSRAN_SIMD_HAVE_AVX2
+#ifdef SRSRAN_SIMD_HAVE_AVX512
+  if (!args->disable_simd && srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX512)) {
+    decoder_type = args->decoder_use_flooded ? SRSRAN_LDPC_DECODER_C_AVX512_FLOOD : SRSRAN_LDPC_DECODER_C_AVX512;
+  }
+#endif // SRSRAN_SIMD_HAVE_AVX512
 
   // If the scaling factor is not provided use a default value that allows decoding all possible combinations of nPRB
   // and MCS indexes for all possible MCS tables
@@ -603,6 +602,16 @@ static int sch_nr_decode(srsran_sch_nr_t*        q,
     return SRSRAN_ERROR;
   }
 
+  // Pooled soft-buffers only need LLR buffers if there is any code block left to decode
+  bool pending = false;
+  for (uint32_t r = 0; r < cfg.C && !pending; r++) {
+    pending = !tb->softbuffer.rx->cb_crc[r];
+  }
+  if (pending && srsran_softbuffer_rx_reserve_cb(tb->softbuffer.rx, cfg.C) < SRSRAN_SUCCESS) {
+    ERROR("Error: no soft-buffer available for %d code blocks", cfg.C);
+    return SRSRAN_ERROR;
+  }
+
   // Counter of code blocks that have matched CRC
   uint32_t cb_ok = 0;
   res->crc       = false;
@@ -610,12 +619,7 @@ static int sch_nr_decode(srsran_sch_nr_t*        q,
   // For each code block...
   uint32_t j = 0;
   for (uint32_t r = 0; r < cfg.C; r++) {
-    bool    decoded   = tb->softbuffer.rx->cb_crc[r];
-    int8_t* rm_buffer = (int8_t*)tb->softbuffer.tx->buffer_b[r];
-    if (!rm_buffer) {
-      ERROR("Error: soft-buffer provided NULL buffer for cb_idx=%d", r);
-      return SRSRAN_ERROR;
-    }
+    bool decoded = tb->softbuffer.rx->cb_crc[r];
 
     // Skip CB if mask indicates no transmission of the CB
     if (!cfg.mask[r]) {
@@ -637,7 +641,13 @@ static int sch_nr_decode(srsran_sch_nr_t*        q,
       continue;
     }
 
-    // LDPC Rate matching
+    int8_t* rm_buffer = (int8_t*)tb->softbuffer.tx->buffer_b[r];
+    if (!rm_buffer) {
+      ERROR("Error: soft-buffer provided NULL buffer for cb_idx=%d", r);
+      return SRSRAN_ERROR;
+    }
+
+    // LDPC Rate matching, the codeword is loaded in the decoder on the fly
     SCH_INFO_RX("RM CB %d: E=%d; F=%d; BG=%d; Z=%d; RV=%d; Qm=%d; Nref=%d;",
                 r,
                 E,
@@ -647,8 +657,8 @@ static int sch_nr_decode(srsran_sch_nr_t*        q,
                 tb->rv,
                 cfg.Qm,
                 cfg.Nref);
-    int n_llr =
-        srsran_ldpc_rm_rx_c(&q->rx_rm, input_ptr, rm_buffer, E, cfg.F, cfg.bg, cfg.Z, tb->rv, tb->mod, cfg.Nref);
+    int n_llr = srsran_ldpc_rm_rx_inplace_c(
+        &q->rx_rm, decoder, input_ptr, rm_buffer, E, cfg.F, cfg.bg, cfg.Z, tb->rv, tb->mod, cfg.Nref);
     if (n_llr < SRSRAN_SUCCESS) {
       ERROR("Error in LDPC rate mateching");
       return SRSRAN_ERROR;
@@ -661,7 +671,7 @@ static int sch_nr_decode(srsran_sch_nr_t*        q,
     }
 
     // Decode. if CRC=KO, then ret=0
-    int ret = srsran_ldpc_decoder_decode_crc_c(decoder, rm_buffer, q->temp_cb, n_llr, crc);
+    int ret = srsran_ldpc_decoder_decode_inplace_c(decoder, q->temp_cb, n_llr, crc);
     if (ret < SRSRAN_SUCCESS) {
       ERROR("Error decoding CB");
       return SRSRAN_ERROR;
@@ -741,6 +751,12 @@ static int sch_nr_decode(srsran_sch_nr_t*        q,
     SCH_INFO_RX("TB: TBS=%d; CRC={%06x, %06x}", tb->tbs, checksum1, checksum2);
   }
 
+  // The soft bits are no longer needed, the decoded bits stay in the soft-buffer for retransmissions
+  if (res->crc) {
+    tb->softbuffer.rx->tb_crc = true;
+    srsran_softbuffer_rx_release(tb->softbuffer.rx);
+  }
+
   if (SRSRAN_DEBUG_ENABLED && get_srsran_verbose_level() >= SRSRAN_VERBOSE_DEBUG && !is_handler_registered()) {
     DEBUG("Decode: ");
     srsran_vec_fprint_byte(stdout, res->payload, tb->tbs / 8);
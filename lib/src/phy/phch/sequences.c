@@ -113,6 +113,15 @@ void srsran_sequence_pdsch_apply_c(const int8_t* in,
   srsran_sequence_apply_c(in, out, len, sequence_pdsch_seed(rnti, q, nslot, cell_id));
 }
 
+void srsran_sequence_pdsch_state_init(srsran_sequence_state_t* s,
+                                      uint16_t                 rnti,
+                                      int                      q,
+                                      uint32_t                 nslot,
+                                      uint32_t                 cell_id)
+{
+  srsran_sequence_state_init(s, sequence_pdsch_seed(rnti, q, nslot, cell_id));
+}
+
 /**
  * 36.211 5.3.1
  */
@@ -163,6 +172,11 @@ void srsran_sequence_pusch_apply_c(const int8_t* in,
   srsran_sequence_apply_c(in, out, len, sequence_pusch_seed(rnti, nslot, cell_id));
 }
 
+void srsran_sequence_pusch_state_init(srsran_sequence_state_t* s, uint16_t rnti, uint32_t nslot, uint32_t cell_id)
+{
+  srsran_sequence_state_init(s, sequence_pusch_seed(rnti, nslot, cell_id));
+}
+
 /**
  * 36.211 5.4.2
  */
@@ -171,10 +185,36 @@ int srsran_sequence_pucch(srsran_sequence_t* seq, uint16_t rnti, uint32_t nslot,
   return srsran_sequence_LTE_pr(seq, 12 * 4, ((((nslot / 2) + 1) * (2 * cell_id + 1)) << 16) + rnti);
 }
 
+/**
+ * 36.211 6.3.1
+ */
+static inline uint32_t sequence_pmch_seed(uint32_t nslot, uint32_t mbsfn_id)
+{
+  return (((nslot / 2) << 9) + mbsfn_id);
+}
+
 int srsran_sequence_pmch(srsran_sequence_t* seq, uint32_t nslot, uint32_t mbsfn_id, uint32_t len)
 {
   bzero(seq, sizeof(srsran_sequence_t));
-  return srsran_sequence_LTE_pr(seq, len, (((nslot / 2) << 9) + mbsfn_id));
+  return srsran_sequence_LTE_pr(seq, len, sequence_pmch_seed(nslot, mbsfn_id));
+}
+
+void srsran_sequence_pmch_apply_pack(const uint8_t* in,
+                                     uint8_t*       out,
+                                     uint32_t       nslot,
+                                     uint32_t       mbsfn_id,
+                                     uint32_t       len)
+{
+  srsran_sequence_apply_packed(in, out, len, sequence_pmch_seed(nslot, mbsfn_id));
+}
+
+void srsran_sequence_pmch_apply_s(const int16_t* in,
+                                  int16_t*       out,
+                                  uint32_t       nslot,
+                                  uint32_t       mbsfn_id,
+                                  uint32_t       len)
+{
+  srsran_sequence_apply_s(in, out, len, sequence_pmch_seed(nslot, mbsfn_id));
 }
 
 /**
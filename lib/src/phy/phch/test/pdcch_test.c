@@ -201,6 +201,8 @@ static int test_case1()
     uint64_t            t_llr_us               = 0;
     uint64_t            t_decode_us            = 0;
     uint64_t            t_decode_count         = 0;
+    uint64_t            t_batch_us             = 0;
+    uint64_t            t_batch_count          = 0;
     uint32_t            false_alarm_corr_count = 0;
     float               min_corr               = INFINITY;
 
@@ -261,6 +263,22 @@ static int test_case1()
         get_time_interval(t);
         t_llr_us += (size_t)(t[0].tv_sec * 1e6 + t[0].tv_usec);
 
+        // Decode all the locations at once, the transmitted DCI must be found among them
+        srsran_dci_msg_t dci_batch[SRSRAN_MAX_CANDIDATES] = {};
+        for (uint32_t loc_rx = 0; loc_rx < locations_count; loc_rx++) {
+          dci_batch[loc_rx].location = locations[loc_rx];
+          dci_batch[loc_rx].format   = format;
+        }
+        gettimeofday(&t[1], NULL);
+        TESTASSERT(srsran_pdcch_decode_msg_batch(&pdcch_rx, &dl_sf_cfg, &dci_cfg, dci_batch, locations_count) ==
+                   SRSRAN_SUCCESS);
+        gettimeofday(&t[2], NULL);
+        get_time_interval(t);
+        t_batch_us += (size_t)(t[0].tv_sec * 1e6 + t[0].tv_usec);
+        t_batch_count += locations_count;
+        TESTASSERT(dci_batch[loc].rnti == dci_tx.rnti);
+        TESTASSERT(memcmp(dci_tx.payload, dci_batch[loc].payload, dci_tx.nof_bits) == 0);
+
         // Try decoding the PDCCH in all possible locations
         for (uint32_t loc_rx = 0; loc_rx < locations_count; loc_rx++) {
           // Skip location if:
@@ -334,12 +352,13 @@ static int test_case1()
       return SRSRAN_ERROR;
     }
 
-    printf("test_case_1 - format %s - passed - %.1f usec/encode; %.1f usec/llr; %.1f usec/decode; min_corr=%f; "
-           "false_alarm_prob=%f;\n",
+    printf("test_case_1 - format %s - passed - %.1f usec/encode; %.1f usec/llr; %.1f usec/decode; %.1f usec/batch "
+           "decode; min_corr=%f; false_alarm_prob=%f;\n",
            srsran_dci_format_string(format),
            (double)t_encode_us / (double)(t_encode_count),
            (double)t_llr_us / (double)(t_encode_count),
            (double)t_decode_us / (double)(t_decode_count),
+           (double)t_batch_us / (double)(t_batch_count),
            min_corr,
            (double)false_alarm_corr_count / (double)t_decode_count);
   }
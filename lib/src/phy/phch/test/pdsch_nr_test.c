@@ -31,10 +31,11 @@
 
 static srsran_carrier_nr_t carrier = SRSRAN_DEFAULT_CARRIER_NR;
 
-static uint32_t            n_prb     = 0;  // Set to 0 for steering
-static uint32_t            mcs       = 30; // Set to 30 for steering
-static srsran_sch_cfg_nr_t pdsch_cfg = {};
-static uint16_t            rnti      = 0x1234;
+static uint32_t            n_prb       = 0;  // Set to 0 for steering
+static uint32_t            mcs         = 30; // Set to 30 for steering
+static srsran_sch_cfg_nr_t pdsch_cfg   = {};
+static uint16_t            rnti        = 0x1234;
+static bool                measure_evm = true;
 
 void usage(char* prog)
 {
@@ -44,13 +45,15 @@ void usage(char* prog)
   printf("\t-T Provide MCS table (64qam, 256qam, 64qamLowSE) [Default %s]\n",
          srsran_mcs_table_to_str(pdsch_cfg.sch_cfg.mcs_table));
   printf("\t-L Provide number of layers [Default %d]\n", carrier.max_mimo_layers);
+  printf("\t-E Disable the EVM measurement, the equalizer is then fused with the demodulator [Default %s]\n",
+         measure_evm ? "enabled" : "disabled");
   printf("\t-v [set srsran_verbose to debug, default none]\n");
 }
 
 int parse_args(int argc, char** argv)
 {
   int opt;
-  while ((opt = getopt(argc, argv, "pmTLv")) != -1) {
+  while ((opt = getopt(argc, argv, "pmTLEv")) != -1) {
     switch (opt) {
       case 'p':
         n_prb = (uint32_t)strtol(argv[optind], NULL, 10);
@@ -64,6 +67,9 @@ int parse_args(int argc, char** argv)
       case 'L':
         carrier.max_mimo_layers = (uint32_t)strtol(argv[optind], NULL, 10);
         break;
+      case 'E':
+        measure_evm = false;
+        break;
       case 'v':
         increase_srsran_verbose_level();
         break;
@@ -98,7 +104,7 @@ int main(int argc, char** argv)
 
   srsran_pdsch_nr_args_t pdsch_args = {};
   pdsch_args.sch.disable_simd       = false;
-  pdsch_args.measure_evm            = true;
+  pdsch_args.measure_evm            = measure_evm;
 
   if (srsran_pdsch_nr_init_enb(&pdsch_tx, &pdsch_args) < SRSRAN_SUCCESS) {
     ERROR("Error initiating PDSCH for Tx");
@@ -236,7 +242,8 @@ int main(int argc, char** argv)
 
       float    mse    = 0.0f;
       uint32_t nof_re = srsran_ra_dl_nr_slot_nof_re(&pdsch_cfg, &pdsch_cfg.grant);
-      for (uint32_t i = 0; i < pdsch_cfg.grant.nof_layers; i++) {
+      // The equalized symbols are only stored when the EVM is measured
+      for (uint32_t i = 0; i < pdsch_cfg.grant.nof_layers && measure_evm; i++) {
         for (uint32_t j = 0; j < nof_re; j++) {
           mse += cabsf(pdsch_tx.d[i][j] - pdsch_rx.d[i][j]);
         }
@@ -43,6 +43,9 @@ uint32_t root_seq_idx     = 0;
 uint32_t zero_corr_zone   = 1;
 uint32_t n_seqs           = 64;
 uint32_t num_ra_preambles = 0; // use default
+uint32_t nof_repetitions  = 10;
+bool     high_speed_flag  = false;
+float    freq_offset_hz   = 0.0f;
 
 bool freq_domain_offset_calc       = false;
 bool test_successive_cancellation  = false;
@@ -63,12 +66,15 @@ void usage(char* prog)
   printf("\t-s test_successive_cancellation  [Default false]\n");
   printf("\t-O test_offset_calculation  [Default false]\n");
   printf("\t-F freq_domain_offset_calc [Default false]\n");
+  printf("\t-H high_speed_flag, restricted set [Default false]\n");
+  printf("\t-D Frequency offset of the received signal in Hz [Default %.0f]\n", freq_offset_hz);
+  printf("\t-R Number of detection calls for measuring the latency [Default %d]\n", nof_repetitions);
 }
 
 void parse_args(int argc, char** argv)
 {
   int opt;
-  while ((opt = getopt(argc, argv, "NfrznioSsOF")) != -1) {
+  while ((opt = getopt(argc, argv, "NfrznioSsOFHRD")) != -1) {
     switch (opt) {
       case 'N':
         nof_prb = (uint32_t)strtol(argv[optind], NULL, 10);
@@ -103,6 +109,15 @@ void parse_args(int argc, char** argv)
       case 'F':
         freq_domain_offset_calc = true;
         break;
+      case 'H':
+        high_speed_flag = true;
+        break;
+      case 'R':
+        nof_repetitions = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'D':
+        freq_offset_hz = strtof(argv[optind], NULL);
+        break;
       default:
         usage(argv[0]);
         exit(-1);
@@ -153,8 +168,7 @@ int main(int argc, char** argv)
 {
   parse_args(argc, argv);
   srsran_prach_t  prach;
-  srsran_random_t random_gen      = srsran_random_init(0x1234);
-  bool            high_speed_flag = false;
+  srsran_random_t random_gen = srsran_random_init(0x1234);
   cf_t            preamble[MAX_LEN];
   memset(preamble, 0, sizeof(cf_t) * MAX_LEN);
   cf_t preamble_sum[MAX_LEN];
@@ -228,22 +242,43 @@ int main(int argc, char** argv)
     srsran_filesource_read(&fsrc, &preamble_sum[prach.N_cp], prach.N_seq);
   }
 
+  // Apply frequency offset, a high speed UE is received with Doppler
+  if (freq_offset_hz != 0.0f) {
+    for (int i = 0; i < MAX_LEN; i++) {
+      preamble_sum[i] *= cexpf(_Complex_I * 2.0f * M_PI * freq_offset_hz * i / srate);
+    }
+  }
+
   uint32_t prach_len = prach.N_seq;
   if (preamble_format == 2 || preamble_format == 3) {
     prach_len /= 2;
   }
   struct timeval t[3];
-  gettimeofday(&t[1], NULL);
-  srsran_prach_detect_offset(&prach, 0, &preamble_sum[prach.N_cp], prach_len, indices, t_offsets, NULL, &n_indices);
-  gettimeofday(&t[2], NULL);
-  get_time_interval(t);
-  printf("texec=%ld us\n", t[0].tv_usec);
+  uint64_t       t_total_us = 0;
+  uint64_t       t_max_us   = 0;
+  for (uint32_t r = 0; r < SRSRAN_MAX(nof_repetitions, 1); r++) {
+    gettimeofday(&t[1], NULL);
+    srsran_prach_detect_offset(&prach, 0, &preamble_sum[prach.N_cp], prach_len, indices, t_offsets, NULL, &n_indices);
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+    uint64_t t_us = t[0].tv_sec * 1000000UL + t[0].tv_usec;
+    t_total_us += t_us;
+    t_max_us = SRSRAN_MAX(t_max_us, t_us);
+  }
+  printf("texec=%.1f us per call; max=%ld us; calls=%d;\n",
+         (double)t_total_us / SRSRAN_MAX(nof_repetitions, 1),
+         (long)t_max_us,
+         SRSRAN_MAX(nof_repetitions, 1));
   int err = 0;
   if (n_indices != n_seqs) {
     printf("n_indices %d n_seq %d\n", n_indices, n_seqs);
     err++;
   }
   for (int i = 0; i < n_indices; i++) {
+    if (indices[i] >= n_seqs) {
+      printf("preamble %d was detected but not transmitted\n", indices[i]);
+      err++;
+    }
     if (test_offset_calculation) {
       int error = (int)(t_offsets[i] * srate) - offsets[i];
       if (abs(error) > divisor) {
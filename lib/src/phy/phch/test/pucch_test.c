@@ -138,6 +138,238 @@ int test_uci_cqi_pucch(void)
   return ret;
 }
 
+#define TEST_JOINT_NOF_UE 24
+#define TEST_JOINT_LOW_SNR_DB (-3.0f)
+#define TEST_JOINT_LOW_SNR_NOF_SF 200
+
+/* Returns true if the PUCCH result carries the transmitted UCI */
+static bool test_joint_match(srsran_pucch_cfg_t* cfg, srsran_uci_value_t* uci, srsran_pucch_res_t* res)
+{
+  if (!res->detected) {
+    return false;
+  }
+  for (uint32_t a = 0; a < srsran_pucch_nof_ack_format(cfg->format); a++) {
+    if (!res->uci_data.ack.valid || res->uci_data.ack.ack_value[a] != uci->ack.ack_value[a]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* A single UE at low SNR, with format 1, 1a and 1b in turns. The joint detector shall detect it at least as often as
+ * the per-UE channel estimator and detector, and shall not detect it when it does not transmit. */
+static int test_joint_low_snr(srsran_pucch_t*        pucch_ue,
+                              srsran_pucch_t*        pucch_enb,
+                              srsran_refsignal_ul_t* dmrs,
+                              srsran_chest_ul_t*     chest,
+                              srsran_chest_ul_res_t* chest_res,
+                              srsran_channel_awgn_t* awgn,
+                              cf_t*                  sf_symbols)
+{
+  cf_t     pucch_dmrs[2 * SRSRAN_NRE * 3];
+  uint32_t nof_tx              = 0;
+  uint32_t nof_detected_single = 0;
+  uint32_t nof_detected_joint  = 0;
+  uint32_t nof_false_alarm     = 0;
+
+  if (srsran_channel_awgn_set_n0(awgn, -TEST_JOINT_LOW_SNR_DB) < SRSRAN_SUCCESS) {
+    return SRSRAN_ERROR;
+  }
+
+  for (uint32_t n = 0; n < TEST_JOINT_LOW_SNR_NOF_SF; n++) {
+    srsran_ul_sf_cfg_t ul_sf = {};
+    ul_sf.tti                = n % SRSRAN_NOF_SF_X_FRAME;
+
+    srsran_pucch_cfg_t cfg            = {};
+    cfg.delta_pucch_shift             = 2;
+    cfg.n_pucch                       = n % 12;
+    cfg.format                        = (srsran_pucch_format_t)(n % 3);
+    cfg.rnti                          = 11;
+    cfg.threshold_format1             = SRSRAN_PUCCH_DEFAULT_THRESHOLD_FORMAT1;
+    cfg.threshold_data_valid_format1a = SRSRAN_PUCCH_DEFAULT_THRESHOLD_FORMAT1A;
+    cfg.threshold_dmrs_detection      = SRSRAN_PUCCH_DEFAULT_THRESHOLD_DMRS;
+
+    srsran_uci_data_t uci_data = {};
+    if (cfg.format == SRSRAN_PUCCH_FORMAT_1) {
+      uci_data.value.scheduling_request      = true;
+      uci_data.cfg.is_scheduling_request_tti = true;
+    } else {
+      uci_data.value.ack.ack_value[0] = rand() % 2;
+      uci_data.value.ack.ack_value[1] = rand() % 2;
+      uci_data.cfg.ack[0].nof_acks    = srsran_pucch_nof_ack_format(cfg.format);
+    }
+    cfg.uci_cfg = uci_data.cfg;
+
+    // One in four subframes is empty
+    bool transmit = (n % 4) != 3;
+    srsran_vec_cf_zero(sf_symbols, SRSRAN_NOF_RE(cell));
+    if (transmit) {
+      if (srsran_pucch_encode(pucch_ue, &ul_sf, &cfg, &uci_data.value, sf_symbols) ||
+          srsran_refsignal_dmrs_pucch_gen(dmrs, &ul_sf, &cfg, pucch_dmrs) ||
+          srsran_refsignal_dmrs_pucch_put(dmrs, &cfg, pucch_dmrs, sf_symbols)) {
+        ERROR("Error encoding PUCCH");
+        return SRSRAN_ERROR;
+      }
+      nof_tx++;
+    }
+    srsran_channel_awgn_run_c(awgn, sf_symbols, sf_symbols, SRSRAN_NOF_RE(cell));
+
+    srsran_pucch_res_t res_single = {};
+    if (srsran_chest_ul_estimate_pucch(chest, &ul_sf, &cfg, sf_symbols, chest_res) ||
+        srsran_pucch_decode(pucch_enb, &ul_sf, &cfg, chest_res, sf_symbols, &res_single)) {
+      ERROR("Error decoding PUCCH");
+      return SRSRAN_ERROR;
+    }
+
+    srsran_pucch_res_t  res_joint = {};
+    srsran_pucch_cfg_t* cfg_ptr   = &cfg;
+    srsran_pucch_res_t* res_ptr   = &res_joint;
+    if (srsran_pucch_decode_format1_joint(pucch_enb, dmrs, &ul_sf, &cfg_ptr, sf_symbols, &res_ptr, 1)) {
+      ERROR("Error decoding PUCCH");
+      return SRSRAN_ERROR;
+    }
+
+    if (transmit) {
+      nof_detected_single += test_joint_match(&cfg, &uci_data.value, &res_single) ? 1 : 0;
+      nof_detected_joint += test_joint_match(&cfg, &uci_data.value, &res_joint) ? 1 : 0;
+    } else {
+      nof_false_alarm += res_joint.detected ? 1 : 0;
+    }
+  }
+
+  if (srsran_channel_awgn_set_n0(awgn, -snr_db) < SRSRAN_SUCCESS) {
+    return SRSRAN_ERROR;
+  }
+
+  printf("Joint PUCCH at %+.1f dB: Pd single=%.3f; Pd joint=%.3f; false alarms=%d;\n",
+         TEST_JOINT_LOW_SNR_DB,
+         (float)nof_detected_single / (float)nof_tx,
+         (float)nof_detected_joint / (float)nof_tx,
+         nof_false_alarm);
+
+  if (nof_detected_joint < nof_detected_single || nof_false_alarm > 0) {
+    ERROR("Joint PUCCH detection worse than the per-UE detection");
+    return SRSRAN_ERROR;
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+/* Several UEs share the first PRB pairs with format 1, 1a and 1b, all of them are detected together. Every third SR
+ * UE does not transmit and must not be detected. Then, a single UE is detected at low SNR. */
+static int test_joint(srsran_pucch_t*        pucch_ue,
+                      srsran_pucch_t*        pucch_enb,
+                      srsran_refsignal_ul_t* dmrs,
+                      srsran_chest_ul_t*     chest,
+                      srsran_chest_ul_res_t* chest_res,
+                      srsran_channel_awgn_t* awgn,
+                      cf_t*                  sf_symbols)
+{
+  int                 ret                          = SRSRAN_ERROR;
+  srsran_pucch_cfg_t  cfg[TEST_JOINT_NOF_UE]       = {};
+  srsran_pucch_cfg_t* cfg_ptr[TEST_JOINT_NOF_UE]   = {};
+  srsran_pucch_res_t  res[TEST_JOINT_NOF_UE]       = {};
+  srsran_pucch_res_t* res_ptr[TEST_JOINT_NOF_UE]   = {};
+  srsran_uci_data_t   uci_data[TEST_JOINT_NOF_UE]  = {};
+  bool                transmit[TEST_JOINT_NOF_UE]  = {};
+  cf_t                pucch_dmrs[2 * SRSRAN_NRE * 3];
+  srsran_ul_sf_cfg_t  ul_sf = {};
+  ul_sf.tti                 = subframe;
+
+  cf_t* ue_symbols = srsran_vec_cf_malloc(SRSRAN_NOF_RE(cell));
+  if (!ue_symbols) {
+    return SRSRAN_ERROR;
+  }
+  srsran_vec_cf_zero(sf_symbols, SRSRAN_NOF_RE(cell));
+
+  for (uint32_t i = 0; i < TEST_JOINT_NOF_UE; i++) {
+    cfg[i].delta_pucch_shift             = 2;
+    cfg[i].N_cs                          = 0;
+    cfg[i].n_rb_2                        = 0;
+    cfg[i].n_pucch                       = i;
+    cfg[i].group_hopping_en              = false;
+    cfg[i].format                        = (srsran_pucch_format_t)(i % 3);
+    cfg[i].threshold_format1             = SRSRAN_PUCCH_DEFAULT_THRESHOLD_FORMAT1;
+    cfg[i].threshold_data_valid_format1a = SRSRAN_PUCCH_DEFAULT_THRESHOLD_FORMAT1A;
+    cfg[i].threshold_dmrs_detection      = SRSRAN_PUCCH_DEFAULT_THRESHOLD_DMRS;
+    cfg_ptr[i]                           = &cfg[i];
+    res_ptr[i]                           = &res[i];
+
+    switch (cfg[i].format) {
+      case SRSRAN_PUCCH_FORMAT_1:
+        uci_data[i].value.scheduling_request      = true;
+        uci_data[i].cfg.is_scheduling_request_tti = true;
+        transmit[i]                               = (i % 9) != 0;
+        break;
+      case SRSRAN_PUCCH_FORMAT_1A:
+        uci_data[i].value.ack.ack_value[0] = rand() % 2;
+        uci_data[i].cfg.ack[0].nof_acks    = 1;
+        transmit[i]                        = true;
+        break;
+      default:
+        uci_data[i].value.ack.ack_value[0] = rand() % 2;
+        uci_data[i].value.ack.ack_value[1] = rand() % 2;
+        uci_data[i].cfg.ack[0].nof_acks    = 2;
+        transmit[i]                        = true;
+        break;
+    }
+    cfg[i].uci_cfg = uci_data[i].cfg;
+
+    if (!transmit[i]) {
+      continue;
+    }
+
+    srsran_vec_cf_zero(ue_symbols, SRSRAN_NOF_RE(cell));
+    if (srsran_pucch_encode(pucch_ue, &ul_sf, &cfg[i], &uci_data[i].value, ue_symbols)) {
+      ERROR("Error encoding PUCCH");
+      goto clean_exit;
+    }
+    if (srsran_refsignal_dmrs_pucch_gen(dmrs, &ul_sf, &cfg[i], pucch_dmrs) ||
+        srsran_refsignal_dmrs_pucch_put(dmrs, &cfg[i], pucch_dmrs, ue_symbols)) {
+      ERROR("Error encoding PUCCH DMRS");
+      goto clean_exit;
+    }
+    srsran_vec_sum_ccc(sf_symbols, ue_symbols, sf_symbols, SRSRAN_NOF_RE(cell));
+  }
+
+  srsran_channel_awgn_run_c(awgn, sf_symbols, sf_symbols, SRSRAN_NOF_RE(cell));
+
+  if (srsran_pucch_decode_format1_joint(pucch_enb, dmrs, &ul_sf, cfg_ptr, sf_symbols, res_ptr, TEST_JOINT_NOF_UE)) {
+    ERROR("Error decoding PUCCH");
+    goto clean_exit;
+  }
+
+  for (uint32_t i = 0; i < TEST_JOINT_NOF_UE; i++) {
+    INFO("joint n_pucch=%d format=%s detected=%d corr=%.2f dmrs_corr=%.2f snr=%+.1f",
+         cfg[i].n_pucch,
+         srsran_pucch_format_text(cfg[i].format),
+         res[i].detected,
+         res[i].correlation,
+         res[i].dmrs_correlation,
+         res[i].snr_db);
+    if (res[i].detected != transmit[i]) {
+      ERROR("Joint PUCCH n_pucch=%d detected=%d, expected %d", cfg[i].n_pucch, res[i].detected, transmit[i]);
+      goto clean_exit;
+    }
+    for (uint32_t a = 0; transmit[i] && a < srsran_pucch_nof_ack_format(cfg[i].format); a++) {
+      if (!res[i].uci_data.ack.valid || res[i].uci_data.ack.ack_value[a] != uci_data[i].value.ack.ack_value[a]) {
+        ERROR("Joint PUCCH n_pucch=%d wrong ACK %d", cfg[i].n_pucch, a);
+        goto clean_exit;
+      }
+    }
+  }
+
+  if (test_joint_low_snr(pucch_ue, pucch_enb, dmrs, chest, chest_res, awgn, sf_symbols)) {
+    goto clean_exit;
+  }
+
+  ret = SRSRAN_SUCCESS;
+
+clean_exit:
+  free(ue_symbols);
+  return ret;
+}
+
 int main(int argc, char** argv)
 {
   srsran_pucch_t        pucch_ue   = {};
@@ -317,6 +549,11 @@ int main(int argc, char** argv)
     }
   }
 
+  if (test_joint(&pucch_ue, &pucch_enb, &dmrs, &chest, &chest_res, &awgn, sf_symbols)) {
+    ERROR("Error in joint PUCCH detection");
+    goto quit;
+  }
+
   ret = 0;
 quit:
   srsran_pucch_free(&pucch_ue);
@@ -35,6 +35,7 @@ static srsran_sch_cfg_nr_t pusch_cfg    = {};
 static uint16_t            rnti         = 0x1234;
 static uint32_t            nof_ack_bits = 0;
 static uint32_t            nof_csi_bits = 0;
+static bool                measure_evm  = true;
 
 void usage(char* prog)
 {
@@ -46,13 +47,15 @@ void usage(char* prog)
   printf("\t-L Provide number of layers [Default %d]\n", carrier.max_mimo_layers);
   printf("\t-A Provide a number of HARQ-ACK bits [Default %d]\n", nof_ack_bits);
   printf("\t-C Provide a number of CSI bits [Default %d]\n", nof_csi_bits);
+  printf("\t-E Disable the EVM measurement, the equalizer is then fused with the demodulator [Default %s]\n",
+         measure_evm ? "enabled" : "disabled");
   printf("\t-v [set srsran_verbose to debug, default none]\n");
 }
 
 int parse_args(int argc, char** argv)
 {
   int opt;
-  while ((opt = getopt(argc, argv, "pmTLACv")) != -1) {
+  while ((opt = getopt(argc, argv, "pmTLACEv")) != -1) {
     switch (opt) {
       case 'p':
         n_prb = (uint32_t)strtol(argv[optind], NULL, 10);
@@ -72,6 +75,9 @@ int parse_args(int argc, char** argv)
       case 'C':
         nof_csi_bits = (uint32_t)strtol(argv[optind], NULL, 10);
         break;
+      case 'E':
+        measure_evm = false;
+        break;
       case 'v':
         increase_srsran_verbose_level();
         break;
@@ -105,7 +111,7 @@ int main(int argc, char** argv)
 
   srsran_pusch_nr_args_t pusch_args = {};
   pusch_args.sch.disable_simd       = false;
-  pusch_args.measure_evm            = true;
+  pusch_args.measure_evm            = measure_evm;
 
   if (srsran_pusch_nr_init_ue(&pusch_tx, &pusch_args) < SRSRAN_SUCCESS) {
     ERROR("Error initiating PUSCH for Tx");
@@ -276,9 +282,9 @@ int main(int argc, char** argv)
         goto clean_exit;
       }
 
-      // Check symbols Mean Square Error (MSE)
+      // Check symbols Mean Square Error (MSE), the equalized symbols are only stored when the EVM is measured
       uint32_t nof_re = srsran_ra_dl_nr_slot_nof_re(&pusch_cfg, &pusch_cfg.grant);
-      if (nof_re * pusch_cfg.grant.nof_layers > 0) {
+      if (measure_evm && nof_re * pusch_cfg.grant.nof_layers > 0) {
         float mse     = 0.0f;
         float mse_tmp = 0.0f;
         for (uint32_t i = 0; i < pusch_cfg.grant.nof_layers; i++) {
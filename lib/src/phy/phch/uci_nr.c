@@ -25,6 +25,7 @@
 #include "srsran/phy/phch/csi.h"
 #include "srsran/phy/phch/uci_cfg.h"
 #include "srsran/phy/utils/bit.h"
+#include "srsran/phy/utils/simd_dispatch.h"
 #include "srsran/phy/utils/vector.h"
 
 #define UCI_NR_INFO_TX(...) INFO("UCI-NR Tx: " __VA_ARGS__)
@@ -84,12 +85,14 @@ int srsran_uci_nr_init(srsran_uci_nr_t* q, const srsran_uci_nr_args_t* args)
 
   srsran_polar_encoder_type_t polar_encoder_type = SRSRAN_POLAR_ENCODER_PIPELINED;
   srsran_polar_decoder_type_t polar_decoder_type = SRSRAN_POLAR_DECODER_SSC_C;
-#ifdef LV_HAVE_AVX2
-  if (!args->disable_simd) {
+#ifdef SRSRAN_SIMD_HAVE_AVX2
+  if (!args->disable_simd && srsran_simd_isa_enabled(SRSRAN_SIMD_ISA_AVX2)) {
     polar_encoder_type = SRSRAN_POLAR_ENCODER_AVX2;
-    polar_decoder_type = SRSRAN_POLAR_DECODER_SSC_C_AVX2;
   }
-#endif // LV_HAVE_AVX2
+#endif // SRSRAN_SIMD_HAVE_AVX2
+  if (!args->disable_simd) {
+    polar_decoder_type = SRSRAN_POLAR_DECODER_FSSC_C;
+  }
 
   if (srsran_polar_code_init(&q->code)) {
     ERROR("Initialising polar code");
@@ -809,8 +812,7 @@ static int uci_nr_decode_11_1706_bit(srsran_uci_nr_t*           q,
     srsran_polar_rm_rx_c(&q->rm_rx, &llr[E_r * r], d, E_r, q->code.n, K_r, UCI_NR_POLAR_RM_IBIL);
 
     // Decode bits
-    if (srsran_polar_decoder_decode_c(&q->decoder, d, q->allocated, q->code.n, q->code.F_set, q->code.F_set_size) <
-        SRSRAN_SUCCESS) {
+    if (srsran_polar_decoder_decode_code_c(&q->decoder, d, q->allocated, &q->code) < SRSRAN_SUCCESS) {
       return SRSRAN_ERROR;
     }
 
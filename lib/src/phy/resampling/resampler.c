@@ -25,6 +25,7 @@
 #include <string.h>
 
 #include "srsran/phy/resampling/resampler.h"
+#include "srsran/phy/utils/simd.h"
 #include "srsran/phy/utils/vector.h"
 
 /**
@@ -49,6 +50,22 @@
  */
 #define RESAMPLER_FILTER_SIZE_MIN 64
 
+/**
+ * Number of phases of the polyphase resampler for arbitrary ratios, it shall be a power of two
+ */
+#define RESAMPLER_POLY_ARB_PHASES_POW 8
+
+/**
+ * Kaiser window shape of the polyphase resampler prototype filter. A value of 8 gives about 80 dB of stop-band
+ * attenuation
+ */
+#define RESAMPLER_POLY_KAISER_BETA 8.0
+
+/**
+ * Minimum number of filter taps of each phase of the polyphase resampler
+ */
+#define RESAMPLER_POLY_NOF_TAPS_MIN 4
+
 int srsran_resampler_fft_init(srsran_resampler_fft_t* q, srsran_resampler_mode_t mode, uint32_t ratio)
 {
   if (q == NULL || ratio == 0) {
@@ -337,3 +354,361 @@ uint32_t srsran_resampler_fft_get_delay(srsran_resampler_fft_t* q)
 
   return q->delay;
 }
+
+// Finds the fraction up/down that matches the ratio with up not greater than the maximum number of phases
+static bool resampler_poly_rational(double ratio, uint32_t* up, uint32_t* down)
+{
+  // Continued fraction expansion of the ratio, h1/k1 is the last convergent
+  uint64_t h0 = 0;
+  uint64_t h1 = 1;
+  uint64_t k0 = 1;
+  uint64_t k1 = 0;
+  double   x  = ratio;
+  for (uint32_t i = 0; i < 32; i++) {
+    uint64_t a  = (uint64_t)floor(x);
+    uint64_t h2 = a * h1 + h0;
+    uint64_t k2 = a * k1 + k0;
+    if (h2 > SRSRAN_RESAMPLER_POLY_MAX_PHASES || k2 > UINT32_MAX) {
+      return false;
+    }
+    h0 = h1;
+    h1 = h2;
+    k0 = k1;
+    k1 = k2;
+
+    if (fabs((double)h1 / (double)k1 - ratio) < 1e-9 * ratio) {
+      *up   = (uint32_t)h1;
+      *down = (uint32_t)k1;
+      return true;
+    }
+
+    double r = x - (double)a;
+    if (r < 1e-12) {
+      break;
+    }
+    x = 1.0 / r;
+  }
+
+  return false;
+}
+
+// Zeroth order modified Bessel function of the first kind, used by the Kaiser window
+static double resampler_poly_bessel_i0(double x)
+{
+  double sum  = 1.0;
+  double term = 1.0;
+  for (uint32_t k = 1; k < 64 && term > 1e-12 * sum; k++) {
+    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+// Computes the coefficients of the filter phase for the fractional delay mu, time reversed so they multiply the oldest
+// sample first, normalised for unit DC gain and repeated for the real and imaginary parts
+static void resampler_poly_design_phase(const srsran_resampler_poly_t* q, double mu, double fc, float* h)
+{
+  double sum = 0.0;
+  for (uint32_t m = 0; m < q->nof_taps; m++) {
+    // Time, in input samples, of the sample multiplied by this coefficient relative to the output sample
+    double u = mu + (double)(q->nof_taps - 1 - m) - (double)q->nof_taps / 2.0;
+
+    // Windowed sinc
+    double x = 2.0 * fc * u;
+    double c = isnormal(x) ? sin(M_PI * x) / (M_PI * x) : 1.0;
+    double w = 1.0 - pow(2.0 * u / (double)q->nof_taps, 2.0);
+    c *= resampler_poly_bessel_i0(RESAMPLER_POLY_KAISER_BETA * sqrt(SRSRAN_MAX(w, 0.0))) /
+         resampler_poly_bessel_i0(RESAMPLER_POLY_KAISER_BETA);
+
+    h[2 * m] = (float)c;
+    sum += c;
+  }
+
+  for (uint32_t m = 0; m < q->nof_taps; m++) {
+    h[2 * m]     = (float)(h[2 * m] / sum);
+    h[2 * m + 1] = h[2 * m];
+  }
+}
+
+int srsran_resampler_poly_init(srsran_resampler_poly_t* q, double ratio, uint32_t nof_taps)
+{
+  if (q == NULL || !isnormal(ratio) || ratio < 0.0) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  if (nof_taps == 0) {
+    nof_taps = SRSRAN_RESAMPLER_POLY_DEFAULT_NOF_TAPS;
+  }
+
+  if (nof_taps < RESAMPLER_POLY_NOF_TAPS_MIN) {
+    ERROR("Invalid number of taps (%d), minimum is %d", nof_taps, RESAMPLER_POLY_NOF_TAPS_MIN);
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  // Skip if the configuration is unchanged
+  if (q->ratio == ratio && q->nof_taps == nof_taps) {
+    srsran_resampler_poly_reset_state(q);
+    return SRSRAN_SUCCESS;
+  }
+
+  // Make sure resampler is freed
+  srsran_resampler_poly_free(q);
+
+  q->ratio    = ratio;
+  q->nof_taps = nof_taps;
+
+  // Select the phases and the input step for each output sample
+  uint32_t up   = 0;
+  uint32_t down = 0;
+  q->rational   = resampler_poly_rational(ratio, &up, &down);
+  if (q->rational) {
+    q->nof_phases  = up;
+    q->den         = up;
+    q->step_int    = down / up;
+    q->step_frac   = down % up;
+    q->phase_shift = 0;
+  } else {
+    double step    = 1.0 / ratio;
+    q->nof_phases  = 1U << RESAMPLER_POLY_ARB_PHASES_POW;
+    q->den         = 1ULL << 32U;
+    q->step_int    = (uint32_t)floor(step);
+    q->step_frac   = (uint64_t)round((step - floor(step)) * (double)q->den);
+    q->phase_shift = 32 - RESAMPLER_POLY_ARB_PHASES_POW;
+    if (q->step_frac >= q->den) {
+      q->step_int++;
+      q->step_frac -= q->den;
+    }
+  }
+
+  // Each phase starts aligned to the SIMD register size
+  q->stride = 2 * nof_taps;
+#if SRSRAN_SIMD_F_SIZE
+  q->stride = SRSRAN_CEIL(q->stride, SRSRAN_SIMD_F_SIZE) * SRSRAN_SIMD_F_SIZE;
+#endif /* SRSRAN_SIMD_F_SIZE */
+
+  // Arbitrary ratios have an extra phase, the first phase delayed one sample, for interpolating the last phase
+  uint32_t nof_rows = q->rational ? q->nof_phases : q->nof_phases + 1;
+
+  q->filter = srsran_vec_f_malloc(q->stride * nof_rows);
+  if (q->filter == NULL) {
+    return SRSRAN_ERROR;
+  }
+  srsran_vec_f_zero(q->filter, q->stride * nof_rows);
+
+  q->head = srsran_vec_cf_malloc(2 * nof_taps);
+  if (q->head == NULL) {
+    return SRSRAN_ERROR;
+  }
+
+  // The prototype filter cut-off is the Nyquist frequency of the lowest sampling rate
+  double fc = 0.5 * SRSRAN_MIN(1.0, ratio);
+  for (uint32_t i = 0; i < nof_rows; i++) {
+    resampler_poly_design_phase(q, (double)i / (double)q->nof_phases, fc, &q->filter[q->stride * i]);
+  }
+
+  if (!q->rational) {
+    q->filter_diff = srsran_vec_f_malloc(q->stride * q->nof_phases);
+    if (q->filter_diff == NULL) {
+      return SRSRAN_ERROR;
+    }
+    for (uint32_t i = 0; i < q->nof_phases; i++) {
+      srsran_vec_sub_fff(
+          &q->filter[q->stride * (i + 1)], &q->filter[q->stride * i], &q->filter_diff[q->stride * i], q->stride);
+    }
+  }
+
+  srsran_resampler_poly_reset_state(q);
+
+  return SRSRAN_SUCCESS;
+}
+
+void srsran_resampler_poly_reset_state(srsran_resampler_poly_t* q)
+{
+  if (q == NULL || q->head == NULL) {
+    return;
+  }
+
+  q->idx  = 0;
+  q->frac = 0;
+  srsran_vec_cf_zero(q->head, 2 * q->nof_taps);
+}
+
+double srsran_resampler_poly_get_delay(const srsran_resampler_poly_t* q)
+{
+  if (q == NULL) {
+    return NAN;
+  }
+
+  return (double)q->nof_taps / 2.0;
+}
+
+uint32_t srsran_resampler_poly_get_nof_input(const srsran_resampler_poly_t* q, uint32_t nof_output)
+{
+  if (q == NULL || nof_output == 0 || !isnormal(q->ratio)) {
+    return 0;
+  }
+
+  // The last output sample shall take the last input sample, the previous block may have left it pending
+  uint64_t step = (uint64_t)q->step_int * q->den + q->step_frac;
+  uint64_t last = q->frac + (uint64_t)(nof_output - 1) * step;
+
+  return (uint32_t)((int64_t)q->idx + (int64_t)(last / q->den) + 1);
+}
+
+uint32_t srsran_resampler_poly_get_nof_output(const srsran_resampler_poly_t* q, uint32_t nof_input)
+{
+  if (q == NULL || (int64_t)nof_input <= (int64_t)q->idx || !isnormal(q->ratio)) {
+    return 0;
+  }
+
+  uint64_t step  = (uint64_t)q->step_int * q->den + q->step_frac;
+  uint64_t space = (uint64_t)((int64_t)nof_input - (int64_t)q->idx) * q->den - q->frac;
+
+  return (uint32_t)((space + step - 1) / step);
+}
+
+// Filters nof_taps samples with a phase, if the phase difference is provided the coefficients are interpolated
+static inline cf_t resampler_poly_dot(const cf_t* x, const float* h, const float* d, float mu, uint32_t nof_taps)
+{
+  const float* x_ptr = (const float*)x;
+  uint32_t     n     = 2 * nof_taps;
+  uint32_t     i     = 0;
+  float        re    = 0.0f;
+  float        im    = 0.0f;
+
+#if SRSRAN_SIMD_F_SIZE
+  simd_f_t acc = srsran_simd_f_zero();
+  if (d == NULL) {
+    for (; i + SRSRAN_SIMD_F_SIZE < n + 1; i += SRSRAN_SIMD_F_SIZE) {
+      acc = srsran_simd_f_add(acc, srsran_simd_f_mul(srsran_simd_f_loadu(&x_ptr[i]), srsran_simd_f_load(&h[i])));
+    }
+  } else {
+    simd_f_t simd_mu = srsran_simd_f_set1(mu);
+    for (; i + SRSRAN_SIMD_F_SIZE < n + 1; i += SRSRAN_SIMD_F_SIZE) {
+      simd_f_t c = srsran_simd_f_add(srsran_simd_f_load(&h[i]), srsran_simd_f_mul(srsran_simd_f_load(&d[i]), simd_mu));
+      acc        = srsran_simd_f_add(acc, srsran_simd_f_mul(srsran_simd_f_loadu(&x_ptr[i]), c));
+    }
+  }
+
+  // Even lanes accumulate the real part and odd lanes the imaginary part
+  srsran_simd_aligned float tmp[SRSRAN_SIMD_F_SIZE];
+  srsran_simd_f_store(tmp, acc);
+  for (uint32_t j = 0; j < SRSRAN_SIMD_F_SIZE; j += 2) {
+    re += tmp[j];
+    im += tmp[j + 1];
+  }
+#endif /* SRSRAN_SIMD_F_SIZE */
+
+  for (; i < n; i += 2) {
+    float c = (d == NULL) ? h[i] : h[i] + d[i] * mu;
+    re += x_ptr[i] * c;
+    im += x_ptr[i + 1] * c;
+  }
+
+  return re + I * im;
+}
+
+static uint32_t resampler_poly_run(srsran_resampler_poly_t* q,
+                                   const cf_t*              input,
+                                   cf_t*                    output,
+                                   uint32_t                 nsamples,
+                                   uint32_t                 max_output)
+{
+  // The head holds the last nof_taps samples of the previous block followed by the first of this block, so the filter
+  // can take contiguous samples at the block boundary
+  uint32_t nof_taps = q->nof_taps;
+  srsran_vec_cf_copy(&q->head[nof_taps], input, SRSRAN_MIN(nsamples, nof_taps));
+
+  // Keep the position in local variables, the output could alias the object from the compiler point of view
+  int64_t  idx       = q->idx;
+  uint64_t frac      = q->frac;
+  uint64_t den       = q->den;
+  uint64_t step_frac = q->step_frac;
+  uint32_t step_int  = q->step_int;
+  uint32_t shift     = q->phase_shift;
+  uint64_t mu_mask   = (1ULL << shift) - 1;
+  float    mu_norm   = 1.0f / (float)(1ULL << shift);
+
+  uint32_t count = 0;
+  while (idx < (int64_t)nsamples && count < max_output) {
+    // Oldest input sample of the filter
+    int64_t     oldest = idx - nof_taps + 1;
+    const cf_t* x      = (oldest < 0) ? &q->head[oldest + nof_taps] : &input[oldest];
+
+    cf_t y;
+    if (q->rational) {
+      y = resampler_poly_dot(x, &q->filter[q->stride * frac], NULL, 0.0f, nof_taps);
+    } else {
+      uint32_t phase = (uint32_t)(frac >> shift);
+      float    mu    = (float)(frac & mu_mask) * mu_norm;
+      y = resampler_poly_dot(x, &q->filter[q->stride * phase], &q->filter_diff[q->stride * phase], mu, nof_taps);
+    }
+
+    if (output != NULL) {
+      output[count] = y;
+    }
+    count++;
+
+    // Advance input position
+    idx += step_int;
+    frac += step_frac;
+    if (frac >= den) {
+      frac -= den;
+      idx++;
+    }
+  }
+
+  // Make position relative to the next block, an output limit may leave the next output pending on the last sample
+  q->idx  = (int32_t)(idx - (int64_t)nsamples);
+  q->frac = frac;
+
+  // Save the last input samples for the next block
+  if (nsamples < nof_taps) {
+    memmove(q->head, &q->head[nsamples], sizeof(cf_t) * nof_taps);
+  } else {
+    srsran_vec_cf_copy(q->head, &input[nsamples - nof_taps], nof_taps);
+  }
+
+  return count;
+}
+
+uint32_t srsran_resampler_poly_run(srsran_resampler_poly_t* q, const cf_t* input, cf_t* output, uint32_t nsamples)
+{
+  if (q == NULL || input == NULL || q->head == NULL) {
+    return 0;
+  }
+
+  return resampler_poly_run(q, input, output, nsamples, UINT32_MAX);
+}
+
+uint32_t
+srsran_resampler_poly_run_nof_output(srsran_resampler_poly_t* q, const cf_t* input, cf_t* output, uint32_t nof_output)
+{
+  if (q == NULL || input == NULL || q->head == NULL) {
+    return 0;
+  }
+
+  uint32_t nof_input = srsran_resampler_poly_get_nof_input(q, nof_output);
+  resampler_poly_run(q, input, output, nof_input, nof_output);
+
+  return nof_input;
+}
+
+void srsran_resampler_poly_free(srsran_resampler_poly_t* q)
+{
+  if (q == NULL) {
+    return;
+  }
+
+  if (q->filter) {
+    free(q->filter);
+  }
+  if (q->filter_diff) {
+    free(q->filter_diff);
+  }
+  if (q->head) {
+    free(q->head);
+  }
+
+  memset(q, 0, sizeof(srsran_resampler_poly_t));
+}
@@ -0,0 +1,212 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/phy/resampling/resample_arb.h"
+#include "srsran/phy/resampling/resampler.h"
+#include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/random.h"
+#include "srsran/phy/utils/vector.h"
+#include <complex.h>
+#include <getopt.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#define NOF_TONES 8
+
+static uint32_t buffer_size = 1920;
+static double   ratio       = 20.0 / 23.04;
+static uint32_t nof_taps    = SRSRAN_RESAMPLER_POLY_DEFAULT_NOF_TAPS;
+static uint32_t repetitions = 100;
+static float    min_snr_dB  = 60.0f;
+static float    bandwidth   = 0.7f; // Occupied bandwidth relative to the lowest sampling rate
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [sRtrSbv]\n", prog);
+  printf("\t-s Input buffer size [Default %d]\n", buffer_size);
+  printf("\t-R Output to input sampling rate ratio [Default %.6f]\n", ratio);
+  printf("\t-t Number of filter taps of each phase [Default %d]\n", nof_taps);
+  printf("\t-r Number of buffers [Default %d]\n", repetitions);
+  printf("\t-S Minimum SNR in dB [Default %.1f]\n", min_snr_dB);
+  printf("\t-b Occupied bandwidth relative to the lowest sampling rate [Default %.2f]\n", bandwidth);
+  printf("\t-v [set srsran_verbose to debug, default none]\n");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+
+  while ((opt = getopt(argc, argv, "sRtrSbv")) != -1) {
+    switch (opt) {
+      case 's':
+        buffer_size = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'R':
+        ratio = strtod(argv[optind], NULL);
+        break;
+      case 't':
+        nof_taps = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'r':
+        repetitions = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'S':
+        min_snr_dB = strtof(argv[optind], NULL);
+        break;
+      case 'b':
+        bandwidth = strtof(argv[optind], NULL);
+        break;
+      case 'v':
+        increase_srsran_verbose_level();
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+// Generates the sum of tones at time t, in input samples
+static cf_t gen_signal(const float* freq, const float* phase, double t)
+{
+  cf_t y = 0.0f;
+  for (uint32_t k = 0; k < NOF_TONES; k++) {
+    y += cexpf(I * (float)(2.0 * M_PI * fmod(freq[k] * t, 1.0) + phase[k])) / NOF_TONES;
+  }
+  return y;
+}
+
+int main(int argc, char** argv)
+{
+  int                     ret   = SRSRAN_ERROR;
+  struct timeval          t[3]  = {};
+  srsran_resampler_poly_t poly  = {};
+  srsran_resample_arb_t   arb   = {};
+  srsran_random_t         rand  = srsran_random_init(0x1234);
+  float                   freq[NOF_TONES];
+  float                   phase[NOF_TONES];
+
+  parse_args(argc, argv);
+
+  uint32_t nof_input  = buffer_size * repetitions;
+  uint32_t max_output = (uint32_t)ceil(buffer_size * ratio) + 1;
+  cf_t*    input      = srsran_vec_cf_malloc(nof_input);
+  cf_t*    output     = srsran_vec_cf_malloc(max_output * repetitions);
+  cf_t*    expected   = srsran_vec_cf_malloc(max_output * repetitions);
+  if (input == NULL || output == NULL || expected == NULL) {
+    ERROR("Malloc");
+    goto clean_exit;
+  }
+
+  if (srsran_resampler_poly_init(&poly, ratio, nof_taps) < SRSRAN_SUCCESS) {
+    ERROR("Error initialising resampler");
+    goto clean_exit;
+  }
+
+  // Random tones inside the occupied bandwidth, frequencies are normalised to the input sampling rate
+  for (uint32_t k = 0; k < NOF_TONES; k++) {
+    float bw = bandwidth * (float)SRSRAN_MIN(1.0, ratio) / 2.0f;
+    freq[k]  = srsran_random_uniform_real_dist(rand, -bw, bw);
+    phase[k] = srsran_random_uniform_real_dist(rand, -M_PI, M_PI);
+  }
+  for (uint32_t i = 0; i < nof_input; i++) {
+    input[i] = gen_signal(freq, phase, (double)i);
+  }
+
+  // Resample buffer by buffer, the number of output samples shall match the prediction
+  uint32_t nof_output = 0;
+  gettimeofday(&t[1], NULL);
+  for (uint32_t r = 0; r < repetitions; r++) {
+    uint32_t n = srsran_resampler_poly_get_nof_output(&poly, buffer_size);
+    if (srsran_resampler_poly_run(&poly, &input[buffer_size * r], &output[nof_output], buffer_size) != n) {
+      ERROR("Unexpected number of output samples");
+      goto clean_exit;
+    }
+    nof_output += n;
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+  uint64_t poly_us = (uint64_t)(t[0].tv_sec * 1000000UL + t[0].tv_usec);
+
+  // Resample again requesting a varying number of output samples, the output shall match the previous one
+  srsran_resampler_poly_reset_state(&poly);
+  for (uint32_t count_in = 0, count_out = 0, r = 0; r < repetitions; r++) {
+    uint32_t n = buffer_size / 2 + (r * 7) % buffer_size;
+    if (count_in + srsran_resampler_poly_get_nof_input(&poly, n) > nof_input) {
+      break;
+    }
+    count_in += srsran_resampler_poly_run_nof_output(&poly, &input[count_in], expected, n);
+    if (memcmp(expected, &output[count_out], sizeof(cf_t) * n) != 0) {
+      ERROR("Output mismatch after %d input samples", count_in);
+      goto clean_exit;
+    }
+    count_out += n;
+  }
+
+  // Compare with the ideal signal, skip the filter transient
+  double   delay = srsran_resampler_poly_get_delay(&poly);
+  uint32_t skip  = (uint32_t)ceil((2.0 * delay + 1.0) * ratio);
+  for (uint32_t i = 0; i < nof_output; i++) {
+    expected[i] = gen_signal(freq, phase, (double)i / ratio - delay);
+  }
+  float signal_pwr = srsran_vec_avg_power_cf(&expected[skip], nof_output - skip);
+  srsran_vec_sub_ccc(&output[skip], &expected[skip], expected, nof_output - skip);
+  float error_pwr = srsran_vec_avg_power_cf(expected, nof_output - skip);
+  float snr_dB    = srsran_convert_power_to_dB(signal_pwr / error_pwr);
+
+  // Benchmark the arbitrary rate resampler for reference
+  srsran_resample_arb_init(&arb, (float)ratio, false);
+  gettimeofday(&t[1], NULL);
+  for (uint32_t r = 0; r < repetitions; r++) {
+    srsran_resample_arb_compute(&arb, &input[buffer_size * r], expected, (int)buffer_size);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+  uint64_t arb_us = (uint64_t)(t[0].tv_sec * 1000000UL + t[0].tv_usec);
+
+  printf("Done ratio=%.6f (%s, %d phases); taps=%d; %.1f Msps (resample_arb %.1f Msps); SNR: %.1f dB\n",
+         ratio,
+         poly.rational ? "rational" : "arbitrary",
+         poly.nof_phases,
+         nof_taps,
+         nof_input / (double)poly_us,
+         nof_input / (double)arb_us,
+         snr_dB);
+
+  ret = (snr_dB > min_snr_dB) ? SRSRAN_SUCCESS : SRSRAN_ERROR;
+
+clean_exit:
+  srsran_resampler_poly_free(&poly);
+  srsran_random_free(rand);
+  if (input) {
+    free(input);
+  }
+  if (output) {
+    free(output);
+  }
+  if (expected) {
+    free(expected);
+  }
+
+  return ret;
+}
@@ -0,0 +1,467 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "rf_shm_imp_trx.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <srsran/phy/utils/vector.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * The ring is shared by exactly one transmitter and one receiver, each end only writes its own timestamp. The
+ * transmitter publishes the samples with a release store of write_ts and the receiver frees them with a release store
+ * of read_ts, so no lock is shared between the processes.
+ */
+static inline uint64_t load_ts(const uint64_t* ts)
+{
+  return __atomic_load_n(ts, __ATOMIC_ACQUIRE);
+}
+
+static inline void store_ts(uint64_t* ts, uint64_t value)
+{
+  __atomic_store_n(ts, value, __ATOMIC_RELEASE);
+}
+
+static inline bool is_running(rf_shm_trx_t* q)
+{
+  return __atomic_load_n(&q->running, __ATOMIC_ACQUIRE);
+}
+
+static uint64_t get_time_ms(void)
+{
+  struct timespec ts = {};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000UL + (uint64_t)ts.tv_nsec / 1000000UL;
+}
+
+static void shm_unmap(rf_shm_trx_t* q)
+{
+  if (q->header != NULL) {
+    munmap(q->header, q->size);
+    q->header  = NULL;
+    q->samples = NULL;
+  }
+
+  if (q->fd >= 0) {
+    close(q->fd);
+    q->fd = -1;
+  }
+}
+
+static int shm_map(rf_shm_trx_t* q)
+{
+  q->nof_samples = SHM_RING_NSAMPLES;
+  q->size        = SHM_HEADER_SIZE + (size_t)q->nof_samples * sizeof(cf_t);
+
+  // Either end may create the object, a new object is filled with zeros which is a valid empty ring
+  q->fd = shm_open(q->name, O_RDWR | O_CREAT, 0600);
+  if (q->fd < 0) {
+    fprintf(stderr, "[shm] Error: opening %s: %s\n", q->name, strerror(errno));
+    return SRSRAN_ERROR;
+  }
+
+  struct stat st = {};
+  if (fstat(q->fd, &st) < 0) {
+    fprintf(stderr, "[shm] Error: reading size of %s: %s\n", q->name, strerror(errno));
+    return SRSRAN_ERROR;
+  }
+
+  if (st.st_size == 0) {
+    if (ftruncate(q->fd, (off_t)q->size) < 0) {
+      fprintf(stderr, "[shm] Error: resizing %s: %s\n", q->name, strerror(errno));
+      return SRSRAN_ERROR;
+    }
+  } else if ((size_t)st.st_size != q->size) {
+    fprintf(stderr,
+            "[shm] Error: %s has %ld bytes but %zu were expected. Remove it from /dev/shm and try again.\n",
+            q->name,
+            (long)st.st_size,
+            q->size);
+    return SRSRAN_ERROR;
+  }
+
+  void* ptr = mmap(NULL, q->size, PROT_READ | PROT_WRITE, MAP_SHARED, q->fd, 0);
+  if (ptr == MAP_FAILED) {
+    fprintf(stderr, "[shm] Error: mapping %s: %s\n", q->name, strerror(errno));
+    return SRSRAN_ERROR;
+  }
+  q->header  = (rf_shm_header_t*)ptr;
+  q->samples = (cf_t*)((uint8_t*)ptr + SHM_HEADER_SIZE);
+
+  return SRSRAN_SUCCESS;
+}
+
+static int trx_open(rf_shm_trx_t* q, rf_shm_opts_t opts, const char* name)
+{
+  // Zero object
+  bzero(q, sizeof(rf_shm_trx_t));
+  q->fd = -1;
+
+  // Copy id
+  strncpy(q->id, opts.id, SHM_ID_STRLEN - 1);
+  q->id[SHM_ID_STRLEN - 1] = '\0';
+
+  // POSIX shared memory object names start with a slash
+  snprintf(q->name, RF_PARAM_LEN, "%s%s", (name[0] == '/') ? "" : "/", name);
+
+  q->frequency_mhz      = opts.frequency_mhz;
+  q->fail_on_disconnect = opts.fail_on_disconnect;
+  q->trx_timeout_ms     = opts.trx_timeout_ms ? opts.trx_timeout_ms : SHM_TIMEOUT_MS;
+  q->log_trx_timeout    = opts.log_trx_timeout;
+
+  if (shm_map(q) != SRSRAN_SUCCESS) {
+    shm_unmap(q);
+    return SRSRAN_ERROR;
+  }
+
+  if (pthread_mutex_init(&q->mutex, NULL)) {
+    fprintf(stderr, "Error: creating mutex\n");
+    shm_unmap(q);
+    return SRSRAN_ERROR;
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+static void trx_close(rf_shm_trx_t* q)
+{
+  if (q->header == NULL) {
+    return;
+  }
+
+  // Stop first, so a transmitter waiting for room in the ring gives up
+  __atomic_store_n(&q->running, false, __ATOMIC_RELEASE);
+
+  pthread_mutex_lock(&q->mutex);
+  shm_unmap(q);
+  pthread_mutex_unlock(&q->mutex);
+
+  pthread_mutex_destroy(&q->mutex);
+}
+
+/*
+ * Transmitter functions
+ */
+int rf_shm_tx_open(rf_shm_trx_t* q, rf_shm_opts_t opts, const char* name)
+{
+  int ret = SRSRAN_ERROR;
+
+  if (q && name) {
+    rf_shm_info((char*)opts.id, "Opening transmitter: %s\n", name);
+
+    if (trx_open(q, opts, name) != SRSRAN_SUCCESS) {
+      goto clean_exit;
+    }
+
+    // Reset the ring, a receiver that is already attached starts over when it sees the new generation
+    rf_shm_header_t* h = q->header;
+    h->nof_samples     = q->nof_samples;
+    store_ts(&h->write_ts, 0);
+    store_ts(&h->read_ts, 0);
+    q->generation = __atomic_add_fetch(&h->generation, 1, __ATOMIC_ACQ_REL);
+    __atomic_store_n(&h->magic, SHM_MAGIC, __ATOMIC_RELEASE);
+
+    q->running = true;
+
+    ret = SRSRAN_SUCCESS;
+  }
+
+clean_exit:
+  return ret;
+}
+
+// Waits until the ring has room for nsamples, it keeps waiting while the transmitter runs. The caller holds the mutex
+static int tx_wait(rf_shm_trx_t* q, uint32_t nsamples)
+{
+  uint64_t t0 = get_time_ms();
+
+  while (is_running(q)) {
+    uint64_t w = __atomic_load_n(&q->header->write_ts, __ATOMIC_RELAXED);
+    uint64_t r = load_ts(&q->header->read_ts);
+
+    // A receiver that has not seen the ring reset yet may be ahead, consider the ring empty
+    uint64_t used = (w > r) ? (w - r) : 0;
+    if (used + nsamples <= q->nof_samples) {
+      return SRSRAN_SUCCESS;
+    }
+
+    if (get_time_ms() - t0 >= q->trx_timeout_ms) {
+      if (q->log_trx_timeout) {
+        fprintf(stderr, "[shm] %s waiting for the receiver of %s to read samples\n", q->id, q->name);
+      }
+      t0 = get_time_ms();
+    }
+
+    usleep(SHM_POLL_PERIOD_US);
+  }
+
+  return SRSRAN_ERROR;
+}
+
+// Writes nsamples into the ring and publishes them. The caller holds the mutex and has waited for room
+static void tx_write(rf_shm_trx_t* q, const cf_t* buffer, uint32_t nsamples, uint32_t interp_factor, float gain)
+{
+  uint64_t w    = __atomic_load_n(&q->header->write_ts, __ATOMIC_RELAXED);
+  uint32_t mask = q->nof_samples - 1;
+  uint32_t idx  = (uint32_t)(w & mask);
+  uint32_t n1   = SRSRAN_MIN(nsamples, q->nof_samples - idx);
+
+  if (buffer == NULL) {
+    srsran_vec_cf_zero(&q->samples[idx], n1);
+    srsran_vec_cf_zero(q->samples, nsamples - n1);
+  } else if (interp_factor <= 1) {
+    srsran_vec_sc_prod_cfc(buffer, gain, &q->samples[idx], n1);
+    srsran_vec_sc_prod_cfc(&buffer[n1], gain, q->samples, nsamples - n1);
+  } else {
+    // Zero order hold
+    for (uint32_t i = 0, n = 0; n < nsamples; i++) {
+      cf_t s = buffer[i] * gain;
+      for (uint32_t j = 0; j < interp_factor && n < nsamples; j++, n++) {
+        q->samples[(w + n) & mask] = s;
+      }
+    }
+  }
+
+  store_ts(&q->header->write_ts, w + nsamples);
+}
+
+int rf_shm_tx_align(rf_shm_trx_t* q, uint64_t ts)
+{
+  pthread_mutex_lock(&q->mutex);
+
+  int64_t nsamples = (int64_t)ts - (int64_t)__atomic_load_n(&q->header->write_ts, __ATOMIC_RELAXED);
+
+  // Fill the gap with zeros, in chunks the ring can hold
+  for (int64_t n = nsamples; n > 0;) {
+    uint32_t chunk = (uint32_t)SRSRAN_MIN(n, q->nof_samples / 2);
+    if (tx_wait(q, chunk) != SRSRAN_SUCCESS) {
+      break;
+    }
+    rf_shm_info(q->id, " - Detected Tx gap of %d samples.\n", chunk);
+    tx_write(q, NULL, chunk, 1, 1.0f);
+    n -= chunk;
+  }
+
+  pthread_mutex_unlock(&q->mutex);
+
+  return (int)nsamples;
+}
+
+int rf_shm_tx_baseband(rf_shm_trx_t* q, const cf_t* buffer, uint32_t nsamples_baseband, uint32_t interp_factor, float gain)
+{
+  int ret = SRSRAN_ERROR;
+
+  if (nsamples_baseband > q->nof_samples) {
+    fprintf(stderr, "[shm] Error: trying to transmit %d samples, the ring holds %d\n", nsamples_baseband, q->nof_samples);
+    return SRSRAN_ERROR;
+  }
+
+  pthread_mutex_lock(&q->mutex);
+
+  if (tx_wait(q, nsamples_baseband) == SRSRAN_SUCCESS) {
+    tx_write(q, buffer, nsamples_baseband, interp_factor, gain);
+    ret = (int)nsamples_baseband;
+  }
+
+  pthread_mutex_unlock(&q->mutex);
+
+  return ret;
+}
+
+uint64_t rf_shm_tx_get_nsamples(rf_shm_trx_t* q)
+{
+  return (q->header) ? load_ts(&q->header->write_ts) : 0;
+}
+
+bool rf_shm_tx_match_freq(rf_shm_trx_t* q, uint32_t freq_hz)
+{
+  bool ret = false;
+  if (q) {
+    ret = (q->frequency_mhz == 0 || q->frequency_mhz == freq_hz);
+  }
+  return ret;
+}
+
+void rf_shm_tx_close(rf_shm_trx_t* q)
+{
+  // Remove the name, receivers keep their mapping and look for a new object after a timeout
+  if (q->header != NULL) {
+    shm_unlink(q->name);
+  }
+
+  trx_close(q);
+}
+
+bool rf_shm_tx_is_running(rf_shm_trx_t* q)
+{
+  if (!q) {
+    return false;
+  }
+
+  return is_running(q);
+}
+
+/*
+ * Receiver functions
+ */
+int rf_shm_rx_open(rf_shm_trx_t* q, rf_shm_opts_t opts, const char* name)
+{
+  int ret = SRSRAN_ERROR;
+
+  if (q && name) {
+    rf_shm_info((char*)opts.id, "Opening receiver: %s\n", name);
+
+    if (trx_open(q, opts, name) != SRSRAN_SUCCESS) {
+      goto clean_exit;
+    }
+
+    // Samples already in the ring are kept, the same as a transmitter that starts before the receiver
+    q->generation = __atomic_load_n(&q->header->generation, __ATOMIC_ACQUIRE);
+
+    q->running = true;
+
+    ret = SRSRAN_SUCCESS;
+  }
+
+clean_exit:
+  return ret;
+}
+
+// Maps the object again if the transmitter removed it, a new transmitter creates a new object under the same name
+static void rx_check_unlinked(rf_shm_trx_t* q)
+{
+  struct stat st = {};
+  if (fstat(q->fd, &st) == 0 && st.st_nlink == 0) {
+    rf_shm_info(q->id, "Transmitter of %s is gone, opening it again\n", q->name);
+    shm_unmap(q);
+    if (shm_map(q) != SRSRAN_SUCCESS) {
+      shm_unmap(q);
+      return;
+    }
+    q->generation = __atomic_load_n(&q->header->generation, __ATOMIC_ACQUIRE);
+  }
+}
+
+int rf_shm_rx_wait(rf_shm_trx_t* q, uint32_t nsamples_baseband)
+{
+  if (nsamples_baseband > q->nof_samples) {
+    fprintf(stderr, "[shm] Error: trying to receive %d samples, the ring holds %d\n", nsamples_baseband, q->nof_samples);
+    return SRSRAN_ERROR;
+  }
+
+  uint64_t t0 = get_time_ms();
+  while (is_running(q) && q->header != NULL) {
+    rf_shm_header_t* h = q->header;
+
+    // Start over if the transmitter reset the ring
+    uint64_t generation = __atomic_load_n(&h->generation, __ATOMIC_ACQUIRE);
+    if (generation != q->generation) {
+      rf_shm_info(q->id, "Transmitter of %s reset the ring\n", q->name);
+      store_ts(&h->read_ts, 0);
+      q->generation = generation;
+    }
+
+    if (__atomic_load_n(&h->magic, __ATOMIC_ACQUIRE) == SHM_MAGIC) {
+      if (h->nof_samples != q->nof_samples) {
+        fprintf(stderr, "[shm] Error: %s holds %d samples but %d were expected\n", q->name, h->nof_samples, q->nof_samples);
+        return SRSRAN_ERROR;
+      }
+
+      uint64_t w = load_ts(&h->write_ts);
+      uint64_t r = __atomic_load_n(&h->read_ts, __ATOMIC_RELAXED);
+      if (w >= r + nsamples_baseband) {
+        return SRSRAN_SUCCESS;
+      }
+    }
+
+    if (get_time_ms() - t0 >= q->trx_timeout_ms) {
+      rx_check_unlinked(q);
+      return SRSRAN_ERROR_TIMEOUT;
+    }
+
+    usleep(SHM_POLL_PERIOD_US);
+  }
+
+  return SRSRAN_ERROR;
+}
+
+int rf_shm_rx_baseband(rf_shm_trx_t* q, cf_t* buffer, uint32_t nsamples_baseband, uint32_t decim_factor, float gain)
+{
+  if (q->header == NULL) {
+    return SRSRAN_ERROR;
+  }
+
+  uint64_t r    = __atomic_load_n(&q->header->read_ts, __ATOMIC_RELAXED);
+  uint32_t mask = q->nof_samples - 1;
+
+  if (buffer != NULL) {
+    if (decim_factor <= 1) {
+      // Read straight from the ring into the destination
+      uint32_t idx = (uint32_t)(r & mask);
+      uint32_t n1  = SRSRAN_MIN(nsamples_baseband, q->nof_samples - idx);
+      srsran_vec_sc_prod_cfc(&q->samples[idx], gain, buffer, n1);
+      srsran_vec_sc_prod_cfc(q->samples, gain, &buffer[n1], nsamples_baseband - n1);
+    } else {
+      // Adding decimation, the gain shall include the averaging factor
+      for (uint32_t i = 0, n = 0; n + decim_factor <= nsamples_baseband; i++) {
+        cf_t acc = 0.0f;
+        for (uint32_t j = 0; j < decim_factor; j++, n++) {
+          acc += q->samples[(r + n) & mask];
+        }
+        buffer[i] = acc * gain;
+      }
+    }
+  }
+
+  // Give the samples back to the transmitter
+  store_ts(&q->header->read_ts, r + nsamples_baseband);
+
+  return (int)nsamples_baseband;
+}
+
+bool rf_shm_rx_match_freq(rf_shm_trx_t* q, uint32_t freq_hz)
+{
+  bool ret = false;
+  if (q) {
+    ret = (q->frequency_mhz == 0 || q->frequency_mhz == freq_hz);
+  }
+  return ret;
+}
+
+void rf_shm_rx_close(rf_shm_trx_t* q)
+{
+  trx_close(q);
+}
+
+bool rf_shm_rx_is_running(rf_shm_trx_t* q)
+{
+  if (!q) {
+    return false;
+  }
+
+  return is_running(q);
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSRAN_RF_SHM_IMP_TRX_H
+#define SRSRAN_RF_SHM_IMP_TRX_H
+
+#include "srsran/config.h"
+#include "srsran/phy/rf/rf.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Definitions */
+#define VERBOSE (0)
+#define SHM_MAGIC (0x5352534dU)          // "SRSM"
+#define SHM_RING_NSAMPLES (1U << 19)     // Ring capacity, power of two (about 22 ms at 23.04 MHz)
+#define SHM_HEADER_SIZE (4096)           // Ring header size, it keeps the samples page aligned
+#define SHM_CACHE_LINE (64)              // Keeps the producer and consumer timestamps in different cache lines
+#define SHM_POLL_PERIOD_US (20)          // Sleep between polls while waiting for the other end
+#define SHM_TIMEOUT_MS (2000)
+#define SHM_BASERATE_DEFAULT_HZ (23040000)
+#define SHM_ID_STRLEN 16
+#define SHM_MAX_GAIN_DB (30.0f)
+#define SHM_MIN_GAIN_DB (0.0f)
+
+/*
+ * Ring header at the beginning of the shared memory object, followed by the samples. The transmitter (producer) owns
+ * write_ts and the receiver (consumer) owns read_ts. Both are absolute sample counts at the base rate, the sample with
+ * timestamp t lives at index t % nof_samples. The transmitter (re)initialises the ring on open and increments the
+ * generation, so a receiver that is already attached starts over.
+ */
+typedef struct {
+  uint32_t magic;
+  uint32_t nof_samples;
+  uint64_t generation;
+  uint64_t write_ts __attribute__((aligned(SHM_CACHE_LINE)));
+  uint64_t read_ts __attribute__((aligned(SHM_CACHE_LINE)));
+} rf_shm_header_t;
+
+typedef struct {
+  char             id[SHM_ID_STRLEN];
+  char             name[RF_PARAM_LEN];
+  int              fd;
+  size_t           size;
+  rf_shm_header_t* header;
+  cf_t*            samples;
+  uint32_t         nof_samples;
+  uint64_t         generation;
+  bool             running;
+  pthread_mutex_t  mutex;
+  uint32_t         frequency_mhz;
+  bool             fail_on_disconnect;
+  uint32_t         trx_timeout_ms;
+  bool             log_trx_timeout;
+} rf_shm_trx_t;
+
+typedef struct {
+  const char* id;
+  uint32_t    frequency_mhz;
+  bool        fail_on_disconnect;
+  uint32_t    trx_timeout_ms;
+  bool        log_trx_timeout;
+} rf_shm_opts_t;
+
+/*
+ * Common functions
+ */
+SRSRAN_API void rf_shm_info(char* id, const char* format, ...);
+
+SRSRAN_API void rf_shm_error(char* id, const char* format, ...);
+
+/*
+ * Transmitter functions
+ */
+SRSRAN_API int rf_shm_tx_open(rf_shm_trx_t* q, rf_shm_opts_t opts, const char* name);
+
+SRSRAN_API int rf_shm_tx_align(rf_shm_trx_t* q, uint64_t ts);
+
+/**
+ * @brief Writes nsamples_baseband samples straight into the ring. Every input sample is repeated interp_factor times
+ * and scaled by gain on the way. A NULL buffer transmits zeros.
+ * @return The number of base-band samples written, SRSRAN_ERROR otherwise
+ */
+SRSRAN_API int
+rf_shm_tx_baseband(rf_shm_trx_t* q, const cf_t* buffer, uint32_t nsamples_baseband, uint32_t interp_factor, float gain);
+
+SRSRAN_API uint64_t rf_shm_tx_get_nsamples(rf_shm_trx_t* q);
+
+SRSRAN_API bool rf_shm_tx_match_freq(rf_shm_trx_t* q, uint32_t freq_hz);
+
+SRSRAN_API void rf_shm_tx_close(rf_shm_trx_t* q);
+
+SRSRAN_API bool rf_shm_tx_is_running(rf_shm_trx_t* q);
+
+/*
+ * Receiver functions
+ */
+SRSRAN_API int rf_shm_rx_open(rf_shm_trx_t* q, rf_shm_opts_t opts, const char* name);
+
+/**
+ * @brief Waits until nsamples_baseband samples are available in the ring
+ * @return SRSRAN_SUCCESS, SRSRAN_ERROR_TIMEOUT if the transmitter did not provide them in time or SRSRAN_ERROR
+ */
+SRSRAN_API int rf_shm_rx_wait(rf_shm_trx_t* q, uint32_t nsamples_baseband);
+
+/**
+ * @brief Reads nsamples_baseband samples from the ring straight into buffer, adding every decim_factor samples and
+ * scaling them by gain on the way (the gain shall include the averaging factor). A NULL buffer discards the samples.
+ * Call rf_shm_rx_wait() first.
+ * @return The number of base-band samples read, SRSRAN_ERROR otherwise
+ */
+SRSRAN_API int
+rf_shm_rx_baseband(rf_shm_trx_t* q, cf_t* buffer, uint32_t nsamples_baseband, uint32_t decim_factor, float gain);
+
+SRSRAN_API bool rf_shm_rx_match_freq(rf_shm_trx_t* q, uint32_t freq_hz);
+
+SRSRAN_API void rf_shm_rx_close(rf_shm_trx_t* q);
+
+SRSRAN_API bool rf_shm_rx_is_running(rf_shm_trx_t* q);
+
+#endif // SRSRAN_RF_SHM_IMP_TRX_H
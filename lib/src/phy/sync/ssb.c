@@ -43,6 +43,13 @@
  */
 #define SSB_CORR_SZ(SYMB_SZ) SRSRAN_MIN(1U << (uint32_t)ceil(log2((double)(SYMB_SZ)) + 3.0), 1U << 13U)
 
+/*
+ * Narrow band correlation size in function of the correlation and symbol sizes. It selects a power of two number of
+ * correlation bins that holds the PSS and two guard subcarriers at each side.
+ */
+#define SSB_CORR_NB_SZ(CORR_SZ, SYMB_SZ)                                                                               \
+  (1U << (uint32_t)ceil(log2((double)(CORR_SZ) * (SRSRAN_PSS_NR_LEN + 4) / (double)(SYMB_SZ))))
+
 /*
  * Default NR-PBCH DMRS normalised correlation (RSRP/EPRE) threshold
  */
@@ -169,6 +176,7 @@ void srsran_ssb_free(srsran_ssb_t* q)
   srsran_dft_plan_free(&q->fft);
   srsran_dft_plan_free(&q->fft_corr);
   srsran_dft_plan_free(&q->ifft_corr);
+  srsran_dft_plan_free(&q->ifft_corr_nb);
   srsran_pbch_nr_free(&q->pbch);
 
   SRSRAN_MEM_ZERO(q, srsran_ssb_t, 1);
@@ -348,34 +356,56 @@ static int ssb_setup_corr(srsran_ssb_t* q)
   // Compute new correlation size
   uint32_t corr_sz = SSB_CORR_SZ(q->symbol_sz);
 
-  // Skip if the symbol size is unchanged
-  if (q->corr_sz == corr_sz) {
+  // Skip if the symbol size and the PSS frequency offset are unchanged
+  if (q->corr_sz == corr_sz && q->pss_f_offset == q->f_offset) {
     return SRSRAN_SUCCESS;
   }
-  q->corr_sz = corr_sz;
 
-  // Select correlation window, return error if the correlation window is smaller than a symbol
-  if (corr_sz < 2 * q->symbol_sz) {
-    ERROR("Correlation size (%d) is not sufficient (min. %d)", corr_sz, q->symbol_sz * 2);
-    return SRSRAN_ERROR;
-  }
-  q->corr_window = corr_sz - q->symbol_sz;
+  if (q->corr_sz != corr_sz) {
+    q->corr_sz = corr_sz;
 
-  // Free correlation
-  srsran_dft_plan_free(&q->fft_corr);
-  srsran_dft_plan_free(&q->ifft_corr);
+    // Select correlation window, return error if the correlation window is smaller than a symbol
+    if (corr_sz < 2 * q->symbol_sz) {
+      ERROR("Correlation size (%d) is not sufficient (min. %d)", corr_sz, q->symbol_sz * 2);
+      return SRSRAN_ERROR;
+    }
+    q->corr_window = corr_sz - q->symbol_sz;
 
-  // Prepare correlation FFT
-  if (srsran_dft_plan_guru_c(&q->fft_corr, (int)corr_sz, SRSRAN_DFT_FORWARD, q->tmp_time, q->tmp_freq, 1, 1, 1, 1, 1) <
-      SRSRAN_SUCCESS) {
-    ERROR("Error planning correlation DFT");
-    return SRSRAN_ERROR;
-  }
-  if (srsran_dft_plan_guru_c(
-          &q->ifft_corr, (int)corr_sz, SRSRAN_DFT_BACKWARD, q->tmp_corr, q->tmp_time, 1, 1, 1, 1, 1) < SRSRAN_SUCCESS) {
-    ERROR("Error planning correlation DFT");
-    return SRSRAN_ERROR;
+    // Free correlation
+    srsran_dft_plan_free(&q->fft_corr);
+    srsran_dft_plan_free(&q->ifft_corr);
+    srsran_dft_plan_free(&q->ifft_corr_nb);
+
+    // Prepare correlation FFT
+    if (srsran_dft_plan_guru_c(
+            &q->fft_corr, (int)corr_sz, SRSRAN_DFT_FORWARD, q->tmp_time, q->tmp_freq, 1, 1, 1, 1, 1) < SRSRAN_SUCCESS) {
+      ERROR("Error planning correlation DFT");
+      return SRSRAN_ERROR;
+    }
+    if (srsran_dft_plan_guru_c(
+            &q->ifft_corr, (int)corr_sz, SRSRAN_DFT_BACKWARD, q->tmp_corr, q->tmp_time, 1, 1, 1, 1, 1) <
+        SRSRAN_SUCCESS) {
+      ERROR("Error planning correlation DFT");
+      return SRSRAN_ERROR;
+    }
+
+    // Prepare narrow band correlation IFFT, it only takes the PSS band
+    q->corr_nb_sz = SRSRAN_MIN(SSB_CORR_NB_SZ(corr_sz, q->symbol_sz), corr_sz);
+    if (q->corr_nb_sz < corr_sz && srsran_dft_plan_guru_c(&q->ifft_corr_nb,
+                                                          (int)q->corr_nb_sz,
+                                                          SRSRAN_DFT_BACKWARD,
+                                                          q->tmp_corr,
+                                                          q->tmp_time,
+                                                          1,
+                                                          1,
+                                                          1,
+                                                          1,
+                                                          1) < SRSRAN_SUCCESS) {
+      ERROR("Error planning correlation DFT");
+      return SRSRAN_ERROR;
+    }
   }
+  q->pss_f_offset = q->f_offset;
 
   // Zero the time domain signal last samples
   srsran_vec_cf_zero(&q->tmp_time[q->symbol_sz], q->corr_window);
@@ -850,12 +880,63 @@ static void ssb_vec_prod_conj_circ_shift(const cf_t* a, const cf_t* b, cf_t* c,
   srsran_vec_prod_conj_ccc(a, b, c, n);
 }
 
-static int ssb_pss_search(srsran_ssb_t* q,
-                          const cf_t*   in,
-                          uint32_t      nof_samples,
-                          uint32_t*     found_N_id_2,
-                          uint32_t*     found_delay,
-                          float*        coarse_cfo_hz)
+// Correlates in frequency domain the band of nb bins that starts at bin k of b:
+// c[j] = a[k + j - shift] * conj(b[k + j])
+static void
+ssb_vec_prod_conj_band(const cf_t* a, const cf_t* b, cf_t* c, uint32_t n, uint32_t nb, int32_t k, int32_t shift)
+{
+  uint32_t ka = (uint32_t)(((k - shift) % (int32_t)n + (int32_t)n) % (int32_t)n);
+  uint32_t kb = (uint32_t)((k % (int32_t)n + (int32_t)n) % (int32_t)n);
+
+  // Split the band in segments that do not wrap around neither a nor b
+  for (uint32_t j = 0; j < nb;) {
+    uint32_t len = SRSRAN_MIN(nb - j, SRSRAN_MIN(n - ka, n - kb));
+    srsran_vec_prod_conj_ccc(&a[ka], &b[kb], &c[j], len);
+    j += len;
+    ka = (ka + len) % n;
+    kb = (kb + len) % n;
+  }
+}
+
+// Copies a correlation window of the input and converts it to frequency domain in q->tmp_freq
+static void ssb_corr_fft(srsran_ssb_t* q, const cf_t* in, uint32_t nof_samples, uint32_t t_offset)
+{
+  // Number of samples taken in this iteration
+  uint32_t n = q->corr_sz;
+
+  // Detect if the correlation input exceeds the input length, take the maximum amount of samples
+  if (t_offset + q->corr_sz > nof_samples) {
+    n = nof_samples - t_offset;
+  }
+
+  // Copy the amount of samples
+  srsran_vec_cf_copy(q->tmp_time, &in[t_offset], n);
+
+  // Append zeros if there is space left
+  if (n < q->corr_sz) {
+    srsran_vec_cf_zero(&q->tmp_time[n], q->corr_sz - n);
+  }
+
+  // Convert to frequency domain
+  srsran_dft_run_guru_c(&q->fft_corr);
+}
+
+/*
+ * PSS search state of an SSB center frequency candidate. The candidate is searched by shifting the PSS sequences
+ * shift0 correlation bins.
+ */
+typedef struct {
+  int32_t  shift0;   ///< Frequency domain shift of the PSS sequences for the candidate
+  float    corr;     ///< Best normalised correlation
+  uint32_t t_offset; ///< Correlation window where the best correlation was found
+  uint32_t delay;    ///< Best delay
+  uint32_t N_id_2;   ///< Best N_id_2
+  int32_t  shift;    ///< Best coarse frequency shift, relative to shift0
+  float    cfo_hz;   ///< Coarse frequency offset
+} ssb_pss_cand_t;
+
+static int
+ssb_pss_search_multi(srsran_ssb_t* q, const cf_t* in, uint32_t nof_samples, ssb_pss_cand_t* cand, uint32_t nof_cand)
 {
   // verify it is initialised
   if (q->corr_sz == 0) {
@@ -871,63 +952,64 @@ static int ssb_pss_search(srsran_ssb_t* q,
   // Calculate the coarse shift increment for half of the subcarrier spacing
   int shift_coarse_inc = shift_range / 2;
 
-  // Correlation best sequence
-  float    best_corr   = 0;
-  uint32_t best_delay  = 0;
-  uint32_t best_N_id_2 = 0;
-  int      best_shift  = 0;
+  // The coarse search only takes the PSS band, the delay resolution is decimated by the ratio between sizes
+  uint32_t           corr_nb_sz = q->corr_nb_sz;
+  uint32_t           decim      = q->corr_sz / corr_nb_sz;
+  srsran_dft_plan_t* ifft_nb    = (decim > 1) ? &q->ifft_corr_nb : &q->ifft_corr;
+  uint32_t           nb_window  = SRSRAN_CEIL(q->corr_window, decim);
+
+  // First bin of the PSS band, centered in the PSS sequences
+  int32_t k_nb = (int32_t)round((double)q->pss_f_offset * q->corr_sz / q->symbol_sz) - (int32_t)corr_nb_sz / 2;
+
+  // Reset candidates
+  for (uint32_t c = 0; c < nof_cand; c++) {
+    cand[c].corr     = 0.0f;
+    cand[c].t_offset = 0;
+    cand[c].delay    = 0;
+    cand[c].N_id_2   = 0;
+    cand[c].shift    = 0;
+    cand[c].cfo_hz   = 0.0f;
+  }
 
   // Delay in correlation window
   uint32_t t_offset = 0;
   while ((t_offset + q->symbol_sz) < nof_samples) {
-    // Number of samples taken in this iteration
-    uint32_t n = q->corr_sz;
-
-    // Detect if the correlation input exceeds the input length, take the maximum amount of samples
-    if (t_offset + q->corr_sz > nof_samples) {
-      n = nof_samples - t_offset;
-    }
-
-    // Copy the amount of samples
-    srsran_vec_cf_copy(q->tmp_time, &in[t_offset], n);
-
-    // Append zeros if there is space left
-    if (n < q->corr_sz) {
-      srsran_vec_cf_zero(&q->tmp_time[n], q->corr_sz - n);
-    }
-
-    // Convert to frequency domain
-    srsran_dft_run_guru_c(&q->fft_corr);
-
-    // Try each N_id_2 sequence
-    for (uint32_t N_id_2 = 0; N_id_2 < SRSRAN_NOF_NID_2_NR; N_id_2++) {
-      // Steer coarse frequency offset
-      for (int shift = -shift_range; shift <= shift_range; shift += shift_coarse_inc) {
-        // Actual correlation in frequency domain
-        ssb_vec_prod_conj_circ_shift(q->tmp_freq, q->pss_seq[N_id_2], q->tmp_corr, q->corr_sz, shift);
-
-        // Convert to time domain
-        srsran_dft_run_guru_c(&q->ifft_corr);
-
-        // Find maximum
-        uint32_t peak_idx = srsran_vec_max_abs_ci(q->tmp_time, q->corr_window);
-
-        // Average power, take total power of the frequency domain signal after filtering, skip correlation window if
-        // value is invalid (0.0, nan or inf)
-        float avg_pwr_corr = srsran_vec_avg_power_cf(q->tmp_corr, q->corr_sz);
-        if (!isnormal(avg_pwr_corr)) {
-          continue;
-        }
-
-        // Normalise correlation
-        float corr = SRSRAN_CSQABS(q->tmp_time[peak_idx]) / avg_pwr_corr / sqrtf(SRSRAN_PSS_NR_LEN);
-
-        // Update if the correlation is better than the current best
-        if (best_corr < corr) {
-          best_corr   = corr;
-          best_delay  = peak_idx + t_offset;
-          best_N_id_2 = N_id_2;
-          best_shift  = shift;
+    // Convert to frequency domain once for all the candidates
+    ssb_corr_fft(q, in, nof_samples, t_offset);
+
+    for (uint32_t c = 0; c < nof_cand; c++) {
+      // Try each N_id_2 sequence
+      for (uint32_t N_id_2 = 0; N_id_2 < SRSRAN_NOF_NID_2_NR; N_id_2++) {
+        // Steer coarse frequency offset
+        for (int shift = -shift_range; shift <= shift_range; shift += shift_coarse_inc) {
+          // Actual correlation in frequency domain
+          ssb_vec_prod_conj_band(
+              q->tmp_freq, q->pss_seq[N_id_2], q->tmp_corr, q->corr_sz, corr_nb_sz, k_nb, cand[c].shift0 + shift);
+
+          // Convert to time domain
+          srsran_dft_run_guru_c(ifft_nb);
+
+          // Find maximum
+          uint32_t peak_idx = srsran_vec_max_abs_ci(q->tmp_time, nb_window);
+
+          // Average power, take total power of the frequency domain signal after filtering, skip correlation window
+          // if value is invalid (0.0, nan or inf)
+          float avg_pwr_corr = srsran_vec_avg_power_cf(q->tmp_corr, corr_nb_sz) * corr_nb_sz / q->corr_sz;
+          if (!isnormal(avg_pwr_corr)) {
+            continue;
+          }
+
+          // Normalise correlation
+          float corr = SRSRAN_CSQABS(q->tmp_time[peak_idx]) / avg_pwr_corr / sqrtf(SRSRAN_PSS_NR_LEN);
+
+          // Update if the correlation is better than the current best
+          if (cand[c].corr < corr) {
+            cand[c].corr     = corr;
+            cand[c].t_offset = t_offset;
+            cand[c].delay    = peak_idx * decim + t_offset;
+            cand[c].N_id_2   = N_id_2;
+            cand[c].shift    = shift;
+          }
         }
       }
     }
@@ -936,49 +1018,64 @@ static int ssb_pss_search(srsran_ssb_t* q,
     t_offset += q->corr_window;
   }
 
-  // From the best sequence correlate in frequency domain
-  {
-    // Reset best correlation
-    best_corr = 0.0f;
-
-    // Number of samples taken in this iteration
-    uint32_t n = q->corr_sz;
+  for (uint32_t c = 0; c < nof_cand; c++) {
+    // Refine the delay of the decimated search with the full band correlation
+    if (decim > 1 && cand[c].corr > 0.0f) {
+      ssb_corr_fft(q, in, nof_samples, cand[c].t_offset);
 
-    // Detect if the correlation input exceeds the input length, take the maximum amount of samples
-    if (best_delay + q->corr_sz > nof_samples) {
-      n = nof_samples - best_delay;
-    }
+      ssb_vec_prod_conj_circ_shift(
+          q->tmp_freq, q->pss_seq[cand[c].N_id_2], q->tmp_corr, q->corr_sz, cand[c].shift0 + cand[c].shift);
 
-    // Copy the amount of samples
-    srsran_vec_cf_copy(q->tmp_time, &in[best_delay], n);
+      srsran_dft_run_guru_c(&q->ifft_corr);
 
-    // Append zeros if there is space left
-    if (n < q->corr_sz) {
-      srsran_vec_cf_zero(&q->tmp_time[n], q->corr_sz - n);
+      uint32_t peak     = cand[c].delay - cand[c].t_offset;
+      uint32_t start    = (peak > decim) ? (peak - decim) : 0;
+      uint32_t end      = SRSRAN_MIN(peak + decim + 1, q->corr_window);
+      uint32_t peak_idx = start + srsran_vec_max_abs_ci(&q->tmp_time[start], end - start);
+      cand[c].delay     = cand[c].t_offset + peak_idx;
     }
 
-    // Convert to frequency domain
-    srsran_dft_run_guru_c(&q->fft_corr);
+    // From the best sequence correlate in frequency domain
+    float best_corr = 0.0f;
+    ssb_corr_fft(q, in, nof_samples, cand[c].delay);
 
     for (int shift = -shift_range; shift <= shift_range; shift++) {
       // Actual correlation in frequency domain
-      ssb_vec_prod_conj_circ_shift(q->tmp_freq, q->pss_seq[best_N_id_2], q->tmp_corr, q->corr_sz, shift);
+      ssb_vec_prod_conj_circ_shift(
+          q->tmp_freq, q->pss_seq[cand[c].N_id_2], q->tmp_corr, q->corr_sz, cand[c].shift0 + shift);
 
       // Calculate correlation assuming the peak is in the first sample
       float corr = SRSRAN_CSQABS(srsran_vec_acc_cc(q->tmp_corr, q->corr_sz));
 
       // Update if the correlation is better than the current best
       if (best_corr < corr) {
-        best_corr  = corr;
-        best_shift = shift;
+        best_corr     = corr;
+        cand[c].shift = shift;
       }
     }
+
+    cand[c].cfo_hz = -(float)cand[c].shift * coarse_cfo_ref_hz;
+  }
+
+  return SRSRAN_SUCCESS;
+}
+
+static int ssb_pss_search(srsran_ssb_t* q,
+                          const cf_t*   in,
+                          uint32_t      nof_samples,
+                          uint32_t*     found_N_id_2,
+                          uint32_t*     found_delay,
+                          float*        coarse_cfo_hz)
+{
+  ssb_pss_cand_t cand = {};
+  if (ssb_pss_search_multi(q, in, nof_samples, &cand, 1) < SRSRAN_SUCCESS) {
+    return SRSRAN_ERROR;
   }
 
   // Save findings
-  *found_delay   = best_delay;
-  *found_N_id_2  = best_N_id_2;
-  *coarse_cfo_hz = -(float)best_shift * coarse_cfo_ref_hz;
+  *found_delay   = cand.delay;
+  *found_N_id_2  = cand.N_id_2;
+  *coarse_cfo_hz = cand.cfo_hz;
 
   return SRSRAN_SUCCESS;
 }
@@ -1267,32 +1364,15 @@ int srsran_ssb_decode_pbch(srsran_ssb_t*         q,
   return SRSRAN_SUCCESS;
 }
 
-int srsran_ssb_search(srsran_ssb_t* q, const cf_t* in, uint32_t nof_samples, srsran_ssb_search_res_t* res)
+// Decodes the SSB found by the PSS search, res is only written if the PBCH is decoded
+static int ssb_search_decode(srsran_ssb_t*            q,
+                             const cf_t*              in,
+                             uint32_t                 nof_samples,
+                             uint32_t                 N_id_2,
+                             uint32_t                 t_offset,
+                             float                    coarse_cfo_hz,
+                             srsran_ssb_search_res_t* res)
 {
-  // Verify inputs
-  if (q == NULL || in == NULL || res == NULL || !isnormal(q->scs_hz)) {
-    return SRSRAN_ERROR_INVALID_INPUTS;
-  }
-
-  if (!q->args.enable_search || !q->args.enable_decode) {
-    ERROR("SSB is not configured to search (%c) and decode (%c)",
-          q->args.enable_search ? 'y' : 'n',
-          q->args.enable_decode ? 'y' : 'n');
-    return SRSRAN_ERROR;
-  }
-
-  // Set the SSB search result with default value with PBCH CRC unmatched, meaning no cell is found
-  SRSRAN_MEM_ZERO(res, srsran_ssb_search_res_t, 1);
-
-  // Search for PSS in time domain
-  uint32_t N_id_2        = 0;
-  uint32_t t_offset      = 0;
-  float    coarse_cfo_hz = 0.0f;
-  if (ssb_pss_search(q, in, nof_samples, &N_id_2, &t_offset, &coarse_cfo_hz) < SRSRAN_SUCCESS) {
-    ERROR("Error searching for N_id_2");
-    return SRSRAN_ERROR;
-  }
-
   // Remove CP offset prior demodulation
   if (t_offset >= q->cp_sz) {
     t_offset -= q->cp_sz;
@@ -1366,6 +1446,106 @@ int srsran_ssb_search(srsran_ssb_t* q, const cf_t* in, uint32_t nof_samples, srs
   return SRSRAN_SUCCESS;
 }
 
+int srsran_ssb_search(srsran_ssb_t* q, const cf_t* in, uint32_t nof_samples, srsran_ssb_search_res_t* res)
+{
+  // Verify inputs
+  if (q == NULL || in == NULL || res == NULL || !isnormal(q->scs_hz)) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  if (!q->args.enable_search || !q->args.enable_decode) {
+    ERROR("SSB is not configured to search (%c) and decode (%c)",
+          q->args.enable_search ? 'y' : 'n',
+          q->args.enable_decode ? 'y' : 'n');
+    return SRSRAN_ERROR;
+  }
+
+  // Set the SSB search result with default value with PBCH CRC unmatched, meaning no cell is found
+  SRSRAN_MEM_ZERO(res, srsran_ssb_search_res_t, 1);
+
+  // Search for PSS in time domain
+  uint32_t N_id_2        = 0;
+  uint32_t t_offset      = 0;
+  float    coarse_cfo_hz = 0.0f;
+  if (ssb_pss_search(q, in, nof_samples, &N_id_2, &t_offset, &coarse_cfo_hz) < SRSRAN_SUCCESS) {
+    ERROR("Error searching for N_id_2");
+    return SRSRAN_ERROR;
+  }
+
+  return ssb_search_decode(q, in, nof_samples, N_id_2, t_offset, coarse_cfo_hz, res);
+}
+
+int srsran_ssb_search_wideband(srsran_ssb_t*            q,
+                               const cf_t*              in,
+                               uint32_t                 nof_samples,
+                               const double*            ssb_freq_hz,
+                               uint32_t                 nof_freq,
+                               srsran_ssb_search_res_t* res)
+{
+  // Verify inputs
+  if (q == NULL || in == NULL || ssb_freq_hz == NULL || res == NULL || !isnormal(q->scs_hz) ||
+      nof_freq > SRSRAN_SSB_MAX_NOF_SEARCH_FREQ) {
+    return SRSRAN_ERROR_INVALID_INPUTS;
+  }
+
+  if (!q->args.enable_search || !q->args.enable_decode) {
+    ERROR("SSB is not configured to search (%c) and decode (%c)",
+          q->args.enable_search ? 'y' : 'n',
+          q->args.enable_decode ? 'y' : 'n');
+    return SRSRAN_ERROR;
+  }
+
+  // Set the SSB search results with default value with PBCH CRC unmatched, meaning no cell is found
+  SRSRAN_MEM_ZERO(res, srsran_ssb_search_res_t, nof_freq);
+
+  // Frequency of the PSS sequences and correlation bin width
+  double pss_freq_hz = q->cfg.center_freq_hz + q->pss_f_offset * q->scs_hz;
+  double corr_bin_hz = q->cfg.srate_hz / q->corr_sz;
+
+  // Prepare candidates, each of them shifts the PSS sequences to its center frequency
+  ssb_pss_cand_t cand[SRSRAN_SSB_MAX_NOF_SEARCH_FREQ]     = {};
+  int32_t        f_offset[SRSRAN_SSB_MAX_NOF_SEARCH_FREQ] = {};
+  for (uint32_t c = 0; c < nof_freq; c++) {
+    double freq_offset_hz = ssb_freq_hz[c] - q->cfg.center_freq_hz;
+    f_offset[c]           = (int32_t)round(freq_offset_hz / q->scs_hz);
+
+    // The SSB grid shall be aligned with the subcarriers of the base-band
+    double ssb_offset_error_Hz = ((double)f_offset[c] * q->scs_hz) - freq_offset_hz;
+    if (fabs(ssb_offset_error_Hz) > SSB_FREQ_OFFSET_MAX_ERROR_HZ) {
+      ERROR("SSB Offset (%.1f kHz) error exceeds maximum allowed", freq_offset_hz / 1e3);
+      return SRSRAN_ERROR;
+    }
+
+    // The SSB shall be inside the sampled bandwidth
+    if (abs(f_offset[c]) + SRSRAN_SSB_BW_SUBC / 2 > q->symbol_sz / 2) {
+      ERROR("SSB Offset (%.1f kHz) is outside the sampled bandwidth", freq_offset_hz / 1e3);
+      return SRSRAN_ERROR;
+    }
+
+    cand[c].shift0 = -(int32_t)round((ssb_freq_hz[c] - pss_freq_hz) / corr_bin_hz);
+  }
+
+  // Search for PSS in time domain for all the candidates at once
+  if (ssb_pss_search_multi(q, in, nof_samples, cand, nof_freq) < SRSRAN_SUCCESS) {
+    ERROR("Error searching for N_id_2");
+    return SRSRAN_ERROR;
+  }
+
+  // Decode each candidate with its own frequency offset, the rounding of the correlation shift is compensated as CFO
+  int     ret          = SRSRAN_SUCCESS;
+  int32_t f_offset_cfg = q->f_offset;
+  for (uint32_t c = 0; c < nof_freq && ret == SRSRAN_SUCCESS; c++) {
+    double shift_error_hz = (ssb_freq_hz[c] - pss_freq_hz) + cand[c].shift0 * corr_bin_hz;
+
+    q->f_offset = f_offset[c];
+    ret         = ssb_search_decode(
+        q, in, nof_samples, cand[c].N_id_2, cand[c].delay, cand[c].cfo_hz - (float)shift_error_hz, &res[c]);
+  }
+  q->f_offset = f_offset_cfg;
+
+  return ret;
+}
+
 static int ssb_pss_find(srsran_ssb_t* q, const cf_t* in, uint32_t nof_samples, uint32_t N_id_2, uint32_t* found_delay)
 {
   // verify it is initialised
@@ -0,0 +1,282 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/common/test_common.h"
+#include "srsran/phy/channel/ch_awgn.h"
+#include "srsran/phy/sync/ssb.h"
+#include "srsran/phy/utils/debug.h"
+#include "srsran/phy/utils/vector.h"
+#include <complex.h>
+#include <getopt.h>
+#include <srsran/phy/utils/random.h>
+#include <stdlib.h>
+
+#define SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ 7
+
+// NR parameters
+static uint32_t                    carrier_nof_prb = 106;
+static srsran_subcarrier_spacing_t carrier_scs     = srsran_subcarrier_spacing_15kHz;
+static double                      carrier_freq_hz = 1842.5e6;
+static srsran_subcarrier_spacing_t ssb_scs         = srsran_subcarrier_spacing_15kHz;
+static srsran_ssb_pattern_t        ssb_pattern     = SRSRAN_SSB_PATTERN_A;
+
+// SSB center frequency offsets from the carrier, the SSB are not overlapped and the ones flagged as not transmitted
+// shall not be found
+static const double ssb_offset_hz[SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ] =
+    {-7.2e6, -4.8e6, -2.4e6, 0.0, 2.4e6, 4.8e6, 7.2e6};
+static const bool ssb_transmit[SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ] = {true, false, true, false, true, false, true};
+static uint32_t   nof_freq                                            = SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ;
+
+// Channel parameters
+static int32_t  delay_n  = 7;
+static float    cfo_hz   = 500.0f;
+static float    n0_dB    = -10.0f;
+static uint32_t nof_reps = 10;
+
+// Test context
+static srsran_random_t       random_gen = NULL;
+static srsran_channel_awgn_t awgn       = {};
+static double                srate_hz   = 0.0f; // Base-band sampling rate
+static uint32_t              hf_len     = 0;    // Half-frame length
+static cf_t*                 buffer     = NULL; // Base-band buffer
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [v]\n", prog);
+  printf("\t-F cell/carrier center frequency in Hz [default, %.3f MHz]\n", carrier_freq_hz / 1e6);
+  printf("\t-N number of searched SSB frequencies [default, %d]\n", nof_freq);
+  printf("\t-R number of repetitions [default, %d]\n", nof_reps);
+  printf("\t-v [set srsran_verbose to debug, default none]\n");
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "FNRv")) != -1) {
+    switch (opt) {
+      case 'F':
+        carrier_freq_hz = strtod(argv[optind], NULL);
+        break;
+      case 'N':
+        nof_freq = SRSRAN_MIN((uint32_t)strtol(argv[optind], NULL, 10), SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ);
+        break;
+      case 'R':
+        nof_reps = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'v':
+        increase_srsran_verbose_level();
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+static void run_channel()
+{
+  // Delay
+  for (uint32_t i = 0; i < hf_len; i++) {
+    buffer[i] = buffer[(i + delay_n) % hf_len];
+  }
+
+  // CFO
+  srsran_vec_apply_cfo(buffer, -cfo_hz / srate_hz, buffer, hf_len);
+
+  // AWGN
+  srsran_channel_awgn_run_c(&awgn, buffer, buffer, hf_len);
+}
+
+static void gen_pbch_msg(srsran_pbch_msg_nr_t* pbch_msg, uint32_t ssb_idx)
+{
+  // Default all to zero
+  SRSRAN_MEM_ZERO(pbch_msg, srsran_pbch_msg_nr_t, 1);
+
+  // Generate payload
+  srsran_random_bit_vector(random_gen, pbch_msg->payload, SRSRAN_PBCH_MSG_NR_SZ);
+
+  pbch_msg->ssb_idx = ssb_idx;
+  pbch_msg->crc     = true;
+}
+
+static int set_cfg(srsran_ssb_t* ssb, double ssb_freq_hz)
+{
+  srsran_ssb_cfg_t ssb_cfg = {};
+  ssb_cfg.srate_hz         = srate_hz;
+  ssb_cfg.center_freq_hz   = carrier_freq_hz;
+  ssb_cfg.ssb_freq_hz      = ssb_freq_hz;
+  ssb_cfg.scs              = ssb_scs;
+  ssb_cfg.pattern          = ssb_pattern;
+
+  return srsran_ssb_set_cfg(ssb, &ssb_cfg);
+}
+
+static int assert_res(const srsran_ssb_search_res_t* res, uint32_t pci, const srsran_pbch_msg_nr_t* pbch_msg_tx)
+{
+  TESTASSERT(res->pbch_msg.crc);
+  TESTASSERT(res->N_id == pci);
+  TESTASSERT(memcmp(&res->pbch_msg, pbch_msg_tx, sizeof(srsran_pbch_msg_nr_t)) == 0);
+
+  return SRSRAN_SUCCESS;
+}
+
+static int test_case(srsran_ssb_t* ssb)
+{
+  // For benchmarking purposes
+  uint64_t t_search_usec                                     = 0;
+  uint64_t t_wideband_usec                                   = 0;
+  uint64_t count                                             = 0;
+  double   ssb_freq_hz[SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ] = {};
+  for (uint32_t i = 0; i < nof_freq; i++) {
+    ssb_freq_hz[i] = carrier_freq_hz + ssb_offset_hz[i];
+  }
+
+  for (uint32_t rep = 0; rep < nof_reps; rep++, count++) {
+    struct timeval       t[3]                                            = {};
+    uint32_t             pci[SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ]      = {};
+    srsran_pbch_msg_nr_t pbch_msg[SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ] = {};
+
+    // Initialise baseband
+    srsran_vec_cf_zero(buffer, hf_len);
+
+    // Add an SSB with a different PCI in each of the transmitted frequencies
+    for (uint32_t i = 0; i < nof_freq; i++) {
+      pci[i] = srsran_random_uniform_int_dist(random_gen, 0, SRSRAN_NOF_NID_NR - 1);
+      gen_pbch_msg(&pbch_msg[i], 0);
+      if (!ssb_transmit[i]) {
+        continue;
+      }
+      TESTASSERT(set_cfg(ssb, ssb_freq_hz[i]) == SRSRAN_SUCCESS);
+      TESTASSERT(srsran_ssb_add(ssb, pci[i], &pbch_msg[i], buffer, buffer) == SRSRAN_SUCCESS);
+    }
+
+    // Run channel
+    run_channel();
+
+    // Search every SSB frequency one by one, as a GSCN scan does
+    gettimeofday(&t[1], NULL);
+    srsran_ssb_search_res_t res[SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ] = {};
+    for (uint32_t i = 0; i < nof_freq; i++) {
+      TESTASSERT(set_cfg(ssb, ssb_freq_hz[i]) == SRSRAN_SUCCESS);
+      TESTASSERT(srsran_ssb_search(ssb, buffer, hf_len, &res[i]) == SRSRAN_SUCCESS);
+    }
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+    t_search_usec += t[0].tv_usec + t[0].tv_sec * 1000000UL;
+
+    // Search all SSB frequencies at once
+    srsran_ssb_search_res_t res_wb[SSB_SEARCH_WIDEBAND_TEST_MAX_NOF_FREQ] = {};
+    gettimeofday(&t[1], NULL);
+    TESTASSERT(srsran_ssb_search_wideband(ssb, buffer, hf_len, ssb_freq_hz, nof_freq, res_wb) == SRSRAN_SUCCESS);
+    gettimeofday(&t[2], NULL);
+    get_time_interval(t);
+    t_wideband_usec += t[0].tv_usec + t[0].tv_sec * 1000000UL;
+
+    // Both searches shall find the same cells
+    for (uint32_t i = 0; i < nof_freq; i++) {
+      char str[512] = {};
+      srsran_pbch_msg_info(&res_wb[i].pbch_msg, str, sizeof(str));
+      INFO("test_case - freq=%.3f MHz pci=%d/%d %s crc=%s/%s",
+           ssb_freq_hz[i] / 1e6,
+           res[i].N_id,
+           res_wb[i].N_id,
+           str,
+           res[i].pbch_msg.crc ? "OK" : "KO",
+           res_wb[i].pbch_msg.crc ? "OK" : "KO");
+
+      if (ssb_transmit[i]) {
+        TESTASSERT(assert_res(&res[i], pci[i], &pbch_msg[i]) == SRSRAN_SUCCESS);
+        TESTASSERT(assert_res(&res_wb[i], pci[i], &pbch_msg[i]) == SRSRAN_SUCCESS);
+      } else {
+        TESTASSERT(!res[i].pbch_msg.crc);
+        TESTASSERT(!res_wb[i].pbch_msg.crc);
+      }
+    }
+  }
+
+  if (!count) {
+    ERROR("Error in test case: undefined division");
+    return SRSRAN_ERROR;
+  }
+
+  printf("test_case - %d frequencies; %.1f usec/search; %.1f usec/wideband search;\n",
+         nof_freq,
+         (double)t_search_usec / (double)(count),
+         (double)t_wideband_usec / (double)(count));
+
+  return SRSRAN_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  int ret = SRSRAN_ERROR;
+  parse_args(argc, argv);
+
+  random_gen = srsran_random_init(1234);
+  srate_hz   = (double)SRSRAN_SUBC_SPACING_NR(carrier_scs) * srsran_min_symbol_sz_rb(carrier_nof_prb);
+  hf_len     = (uint32_t)ceil(srate_hz * (5.0 / 1000.0));
+  buffer     = srsran_vec_cf_malloc(hf_len);
+
+  srsran_ssb_t      ssb      = {};
+  srsran_ssb_args_t ssb_args = {};
+  ssb_args.enable_encode     = true;
+  ssb_args.enable_decode     = true;
+  ssb_args.enable_search     = true;
+
+  if (buffer == NULL) {
+    ERROR("Malloc");
+    goto clean_exit;
+  }
+
+  if (srsran_channel_awgn_init(&awgn, 0x0) < SRSRAN_SUCCESS) {
+    ERROR("AWGN");
+    goto clean_exit;
+  }
+
+  if (srsran_channel_awgn_set_n0(&awgn, n0_dB) < SRSRAN_SUCCESS) {
+    ERROR("AWGN");
+    goto clean_exit;
+  }
+
+  if (srsran_ssb_init(&ssb, &ssb_args) < SRSRAN_SUCCESS) {
+    ERROR("Init");
+    goto clean_exit;
+  }
+
+  if (test_case(&ssb) != SRSRAN_SUCCESS) {
+    ERROR("test case failed");
+    goto clean_exit;
+  }
+
+  ret = SRSRAN_SUCCESS;
+
+clean_exit:
+  srsran_random_free(random_gen);
+  srsran_ssb_free(&ssb);
+
+  srsran_channel_awgn_free(&awgn);
+
+  if (buffer) {
+    free(buffer);
+  }
+
+  return ret;
+}
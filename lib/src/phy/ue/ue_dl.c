@@ -423,6 +423,26 @@ static int dci_blind_search(srsran_ue_dl_t*     q,
 {
   uint32_t nof_dci = 0;
   if (rnti) {
+    // Decode all the candidates first, so that the ones with the same payload size are decoded together
+    uint32_t nof_candidates = 0;
+    uint32_t first_candidate[SRSRAN_MAX_CANDIDATES];
+    for (int l = 0; l < search_space->nof_locations; l++) {
+      first_candidate[l] = nof_candidates;
+      if (dci_location_is_allocated(q, search_space->loc[l])) {
+        continue;
+      }
+      for (uint32_t f = 0; f < search_space->nof_formats; f++) {
+        srsran_dci_msg_t* candidate = &q->dci_candidates[nof_candidates++];
+        candidate->location         = search_space->loc[l];
+        candidate->format           = search_space->formats[f];
+        candidate->rnti             = 0;
+      }
+    }
+    if (srsran_pdcch_decode_msg_batch(&q->pdcch, sf, dci_cfg, q->dci_candidates, nof_candidates)) {
+      ERROR("Error decoding DCI msg");
+      return SRSRAN_ERROR;
+    }
+
     for (int l = 0; l < search_space->nof_locations; l++) {
       if (nof_dci >= SRSRAN_MAX_DCI_MSG) {
         ERROR("Can't store more DCIs in buffer");
@@ -440,14 +460,8 @@ static int dci_blind_search(srsran_ue_dl_t*     q,
              l,
              search_space->nof_locations);
 
-        // Try to decode a valid DCI msg
-        dci_msg[nof_dci].location = search_space->loc[l];
-        dci_msg[nof_dci].format   = search_space->formats[f];
-        dci_msg[nof_dci].rnti     = 0;
-        if (srsran_pdcch_decode_msg(&q->pdcch, sf, dci_cfg, &dci_msg[nof_dci])) {
-          ERROR("Error decoding DCI msg");
-          return SRSRAN_ERROR;
-        }
+        // Take the candidate decoded above
+        dci_msg[nof_dci] = q->dci_candidates[first_candidate[l] + f];
 
         // Check if RNTI is matched
         if ((dci_msg[nof_dci].rnti == rnti) && (dci_msg[nof_dci].nof_bits > 0)) {
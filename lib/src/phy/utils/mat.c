@@ -159,6 +159,29 @@ int srsran_mat_2x2_cn(cf_t h00, cf_t h01, cf_t h10, cf_t h11, float* cn)
   return SRSRAN_SUCCESS;
 }
 
+/* Generic in-place Gauss-Jordan inversion of a Hermitian positive definite matrix, the pivots are real and positive */
+void srsran_mat_herm_inv_gen(cf_t a[SRSRAN_MAT_HERM_MAX_N][SRSRAN_MAT_HERM_MAX_N], uint32_t n)
+{
+  for (uint32_t k = 0; k < n; k++) {
+    float p = 1.0f / crealf(a[k][k]);
+
+    a[k][k] = 1.0f;
+    for (uint32_t j = 0; j < n; j++) {
+      a[k][j] *= p;
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+      if (i != k) {
+        cf_t f  = a[i][k];
+        a[i][k] = 0.0f;
+        for (uint32_t j = 0; j < n; j++) {
+          a[i][j] -= f * a[k][j];
+        }
+      }
+    }
+  }
+}
+
 #ifdef LV_HAVE_SSE
 #include <smmintrin.h>
 
@@ -19,6 +19,7 @@
  *
  */
 
+#include "srsran/phy/utils/vector_simd.h"
 #include "srsran/srsran.h"
 #include <srsran/phy/utils/random.h>
 
@@ -1076,7 +1077,7 @@ int main(int argc, char** argv)
     pclose(p);
   }
 
-  printf("\n");
+  printf("\nUsing %s vector kernels\n", srsran_simd_isa_to_str(srsran_vec_simd_isa()));
   printf("%32s |", "Subroutine/MSps");
   if (f)
     fprintf(f, "Subroutine/MSps Vs Vector size\t");
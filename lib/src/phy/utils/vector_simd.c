@@ -29,6 +29,7 @@
 
 #include "srsran/phy/utils/simd.h"
 #include "srsran/phy/utils/vector_simd.h"
+#include "vector_simd_dispatch.h"
 
 void srsran_vec_xor_bbb_simd(const uint8_t* x, const uint8_t* y, uint8_t* z, const int len)
 {
@@ -1848,3 +1849,16 @@ float srsran_vec_estimate_frequency_simd(const cf_t* x, int len)
   // Extract argument and divide by (-2·PI)
   return -cargf(sum) * M_1_PI * 0.5f;
 }
+
+#ifdef SRSRAN_SIMD_DISPATCH_ISA
+#define SRSRAN_VEC_SIMD_KERNEL_INIT_V(F, P, A) .F##_fn = F,
+#define SRSRAN_VEC_SIMD_KERNEL_INIT_R(T, F, P, A) .F##_fn = F,
+
+const srsran_vec_simd_kernels_t SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_simd_kernels) = {
+    SRSRAN_VEC_SIMD_KERNELS(SRSRAN_VEC_SIMD_KERNEL_INIT_V, SRSRAN_VEC_SIMD_KERNEL_INIT_R)
+#ifdef ENABLE_C16
+        .srsran_vec_prod_ccc_c16_simd_fn      = srsran_vec_prod_ccc_c16_simd,
+        .srsran_vec_dot_prod_ccc_c16i_simd_fn = srsran_vec_dot_prod_ccc_c16i_simd,
+#endif /* ENABLE_C16 */
+};
+#endif /* SRSRAN_SIMD_DISPATCH_ISA */
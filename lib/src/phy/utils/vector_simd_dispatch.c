@@ -0,0 +1,217 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsran/phy/utils/vector_simd.h"
+#include "vector_simd_dispatch.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__arm__) && !defined(__aarch64__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
+static const char* simd_isa_names[SRSRAN_SIMD_ISA_COUNT] = {"generic", "sse41", "avx", "avx2", "avx512", "neon"};
+
+const char* srsran_simd_isa_to_str(srsran_simd_isa_t isa)
+{
+  if (isa >= SRSRAN_SIMD_ISA_COUNT) {
+    return "invalid";
+  }
+  return simd_isa_names[isa];
+}
+
+bool srsran_simd_isa_host_supports(srsran_simd_isa_t isa)
+{
+  if (isa == SRSRAN_SIMD_ISA_GENERIC) {
+    return true;
+  }
+
+#if defined(__x86_64__) || defined(__i386__)
+  // It can be called from a constructor, before the CPU model is initialised by the runtime
+  __builtin_cpu_init();
+  switch (isa) {
+    case SRSRAN_SIMD_ISA_SSE41:
+      return __builtin_cpu_supports("sse4.1");
+    case SRSRAN_SIMD_ISA_AVX:
+      return __builtin_cpu_supports("avx");
+    case SRSRAN_SIMD_ISA_AVX2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case SRSRAN_SIMD_ISA_AVX512:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("avx512f") &&
+             __builtin_cpu_supports("avx512cd") && __builtin_cpu_supports("avx512bw") &&
+             __builtin_cpu_supports("avx512dq");
+    default:
+      return false;
+  }
+#elif defined(__aarch64__)
+  // NEON is mandatory in ARMv8-A
+  return isa == SRSRAN_SIMD_ISA_NEON;
+#elif defined(__arm__)
+  return isa == SRSRAN_SIMD_ISA_NEON && (getauxval(AT_HWCAP) & HWCAP_NEON);
+#else
+  return false;
+#endif
+}
+
+#ifdef SRSRAN_SIMD_DISPATCH
+
+// Every variant exports its kernel table from its own build of vector_simd.c
+extern const srsran_vec_simd_kernels_t srsran_vec_simd_kernels_sse41;
+#ifdef SRSRAN_SIMD_DISPATCH_HAVE_AVX2
+extern const srsran_vec_simd_kernels_t srsran_vec_simd_kernels_avx2;
+#endif /* SRSRAN_SIMD_DISPATCH_HAVE_AVX2 */
+#ifdef SRSRAN_SIMD_DISPATCH_HAVE_AVX512
+extern const srsran_vec_simd_kernels_t srsran_vec_simd_kernels_avx512;
+#endif /* SRSRAN_SIMD_DISPATCH_HAVE_AVX512 */
+
+typedef struct {
+  srsran_simd_isa_t                isa;
+  const srsran_vec_simd_kernels_t* kernels;
+} vec_simd_variant_t;
+
+// Variants sorted from the fastest to the baseline
+static const vec_simd_variant_t vec_simd_variants[] = {
+#ifdef SRSRAN_SIMD_DISPATCH_HAVE_AVX512
+    {SRSRAN_SIMD_ISA_AVX512, &srsran_vec_simd_kernels_avx512},
+#endif /* SRSRAN_SIMD_DISPATCH_HAVE_AVX512 */
+#ifdef SRSRAN_SIMD_DISPATCH_HAVE_AVX2
+    {SRSRAN_SIMD_ISA_AVX2, &srsran_vec_simd_kernels_avx2},
+#endif /* SRSRAN_SIMD_DISPATCH_HAVE_AVX2 */
+    {SRSRAN_SIMD_ISA_SSE41, &srsran_vec_simd_kernels_sse41},
+};
+
+#define VEC_SIMD_NOF_VARIANTS (sizeof(vec_simd_variants) / sizeof(vec_simd_variant_t))
+
+// The baseline is used until the selection runs, so kernels called from other constructors are safe
+static const srsran_vec_simd_kernels_t* vec_simd_kernels = &srsran_vec_simd_kernels_sse41;
+static srsran_simd_isa_t                vec_simd_isa     = SRSRAN_SIMD_ISA_SSE41;
+
+// This function is called in the beginning of any executable where it is linked
+__attribute__((constructor)) static void srsran_vec_simd_select()
+{
+  const vec_simd_variant_t* selected = NULL;
+
+  // Fastest variant supported by the host
+  for (uint32_t i = 0; i < VEC_SIMD_NOF_VARIANTS && selected == NULL; i++) {
+    if (srsran_simd_isa_host_supports(vec_simd_variants[i].isa)) {
+      selected = &vec_simd_variants[i];
+    }
+  }
+
+  // Variant requested from the environment, mostly for testing and benchmarking
+  const char* isa = getenv("SRSRAN_SIMD_ISA");
+  if (isa != NULL && strlen(isa) > 0) {
+    const vec_simd_variant_t* requested = NULL;
+    for (uint32_t i = 0; i < VEC_SIMD_NOF_VARIANTS && requested == NULL; i++) {
+      if (strcmp(isa, srsran_simd_isa_to_str(vec_simd_variants[i].isa)) == 0 &&
+          srsran_simd_isa_host_supports(vec_simd_variants[i].isa)) {
+        requested = &vec_simd_variants[i];
+      }
+    }
+    if (requested != NULL) {
+      selected = requested;
+    } else {
+      fprintf(stderr,
+              "Warning: SIMD variant '%s' is not available, using %s\n",
+              isa,
+              srsran_simd_isa_to_str(selected != NULL ? selected->isa : vec_simd_isa));
+    }
+  }
+
+  if (selected != NULL) {
+    vec_simd_kernels = selected->kernels;
+    vec_simd_isa     = selected->isa;
+  }
+}
+
+srsran_simd_isa_t srsran_vec_simd_isa()
+{
+  return vec_simd_isa;
+}
+
+#define VEC_SIMD_KERNEL_CALL_V(F, P, A)                                                                                \
+  void F P                                                                                                             \
+  {                                                                                                                    \
+    vec_simd_kernels->F##_fn A;                                                                                        \
+  }
+#define VEC_SIMD_KERNEL_CALL_R(T, F, P, A)                                                                             \
+  T F P                                                                                                                \
+  {                                                                                                                    \
+    return vec_simd_kernels->F##_fn A;                                                                                 \
+  }
+
+SRSRAN_VEC_SIMD_KERNELS(VEC_SIMD_KERNEL_CALL_V, VEC_SIMD_KERNEL_CALL_R)
+
+#ifdef ENABLE_C16
+void srsran_vec_prod_ccc_c16_simd(const int16_t* a_re,
+                                  const int16_t* a_im,
+                                  const int16_t* b_re,
+                                  const int16_t* b_im,
+                                  int16_t*       r_re,
+                                  int16_t*       r_im,
+                                  const int      len)
+{
+  vec_simd_kernels->srsran_vec_prod_ccc_c16_simd_fn(a_re, a_im, b_re, b_im, r_re, r_im, len);
+}
+
+c16_t srsran_vec_dot_prod_ccc_c16i_simd(const c16_t* x, const c16_t* y, const int len)
+{
+  return vec_simd_kernels->srsran_vec_dot_prod_ccc_c16i_simd_fn(x, y, len);
+}
+#endif /* ENABLE_C16 */
+
+#else /* SRSRAN_SIMD_DISPATCH */
+
+srsran_simd_isa_t srsran_vec_simd_isa()
+{
+#if defined(LV_HAVE_AVX512)
+  return SRSRAN_SIMD_ISA_AVX512;
+#elif defined(LV_HAVE_AVX2)
+  return SRSRAN_SIMD_ISA_AVX2;
+#elif defined(LV_HAVE_AVX)
+  return SRSRAN_SIMD_ISA_AVX;
+#elif defined(LV_HAVE_SSE)
+  return SRSRAN_SIMD_ISA_SSE41;
+#elif defined(HAVE_NEON)
+  return SRSRAN_SIMD_ISA_NEON;
+#else
+  return SRSRAN_SIMD_ISA_GENERIC;
+#endif
+}
+
+#endif /* SRSRAN_SIMD_DISPATCH */
+
+bool srsran_simd_isa_enabled(srsran_simd_isa_t isa)
+{
+  srsran_simd_isa_t selected = srsran_vec_simd_isa();
+
+  if (isa == SRSRAN_SIMD_ISA_GENERIC || isa == selected) {
+    return true;
+  }
+
+  // NEON does not include any x86 instruction set and the other way around
+  if (isa == SRSRAN_SIMD_ISA_NEON || selected == SRSRAN_SIMD_ISA_NEON) {
+    return false;
+  }
+
+  return isa < selected;
+}
@@ -0,0 +1,167 @@
+/**
+ * Copyright 2013-2023 Software Radio Systems Limited
+ *
+ * This file is part of srsRAN.
+ *
+ * srsRAN is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsRAN is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         vector_simd_dispatch.h
+ *
+ *  Description:  SIMD vector kernels selected at runtime. When
+ *                SRSRAN_SIMD_DISPATCH is defined, vector_simd.c is built once
+ *                per ISA with SRSRAN_SIMD_DISPATCH_ISA set to the variant
+ *                name. Every variant suffixes its kernels with that name and
+ *                exports them in a srsran_vec_simd_kernels_t table. The
+ *                unsuffixed kernels call the table selected at startup.
+ *
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef SRSRAN_VECTOR_SIMD_DISPATCH_H
+#define SRSRAN_VECTOR_SIMD_DISPATCH_H
+
+#include "srsran/config.h"
+#include "srsran/phy/utils/simd_dispatch.h"
+#include <stdint.h>
+
+#ifdef SRSRAN_SIMD_DISPATCH_ISA
+#define srsran_vec_xor_bbb_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_xor_bbb_simd)
+#define srsran_vec_sum_sss_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sum_sss_simd)
+#define srsran_vec_sub_sss_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sub_sss_simd)
+#define srsran_vec_sub_bbb_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sub_bbb_simd)
+#define srsran_vec_acc_ff_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_acc_ff_simd)
+#define srsran_vec_acc_cc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_acc_cc_simd)
+#define srsran_vec_add_fff_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_add_fff_simd)
+#define srsran_vec_sub_fff_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sub_fff_simd)
+#define srsran_vec_sc_sum_fff_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sc_sum_fff_simd)
+#define srsran_vec_sc_prod_cfc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sc_prod_cfc_simd)
+#define srsran_vec_sc_prod_fcc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sc_prod_fcc_simd)
+#define srsran_vec_sc_prod_fff_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sc_prod_fff_simd)
+#define srsran_vec_sc_prod_ccc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sc_prod_ccc_simd)
+#define srsran_vec_sc_prod_ccc_simd2 SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_sc_prod_ccc_simd2)
+#define srsran_vec_prod_ccc_split_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_prod_ccc_split_simd)
+#define srsran_vec_prod_sss_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_prod_sss_simd)
+#define srsran_vec_neg_sss_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_neg_sss_simd)
+#define srsran_vec_neg_bbb_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_neg_bbb_simd)
+#define srsran_vec_prod_cfc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_prod_cfc_simd)
+#define srsran_vec_prod_fff_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_prod_fff_simd)
+#define srsran_vec_prod_ccc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_prod_ccc_simd)
+#define srsran_vec_prod_conj_ccc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_prod_conj_ccc_simd)
+#define srsran_vec_div_ccc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_div_ccc_simd)
+#define srsran_vec_div_cfc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_div_cfc_simd)
+#define srsran_vec_div_fff_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_div_fff_simd)
+#define srsran_vec_dot_prod_conj_ccc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_dot_prod_conj_ccc_simd)
+#define srsran_vec_dot_prod_ccc_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_dot_prod_ccc_simd)
+#define srsran_vec_dot_prod_sss_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_dot_prod_sss_simd)
+#define srsran_vec_abs_cf_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_abs_cf_simd)
+#define srsran_vec_abs_square_cf_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_abs_square_cf_simd)
+#define srsran_vec_lut_sss_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_lut_sss_simd)
+#define srsran_vec_lut_bbb_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_lut_bbb_simd)
+#define srsran_vec_convert_if_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_convert_if_simd)
+#define srsran_vec_convert_fi_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_convert_fi_simd)
+#define srsran_vec_convert_conj_cs_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_convert_conj_cs_simd)
+#define srsran_vec_convert_bf_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_convert_bf_simd)
+#define srsran_vec_convert_fb_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_convert_fb_simd)
+#define srsran_vec_interleave_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_interleave_simd)
+#define srsran_vec_interleave_add_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_interleave_add_simd)
+#define srsran_vec_gen_sine_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_gen_sine_simd)
+#define srsran_vec_apply_cfo_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_apply_cfo_simd)
+#define srsran_vec_estimate_frequency_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_estimate_frequency_simd)
+#define srsran_vec_max_fi_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_max_fi_simd)
+#define srsran_vec_max_abs_fi_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_max_abs_fi_simd)
+#define srsran_vec_max_ci_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_max_ci_simd)
+#ifdef ENABLE_C16
+#define srsran_vec_prod_ccc_c16_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_prod_ccc_c16_simd)
+#define srsran_vec_dot_prod_ccc_c16i_simd SRSRAN_SIMD_DISPATCH_NAME(srsran_vec_dot_prod_ccc_c16i_simd)
+#endif /* ENABLE_C16 */
+#endif /* SRSRAN_SIMD_DISPATCH_ISA */
+
+/*
+ * Kernel list, V(name, parameters, arguments) for the kernels that return void and R(type, name, parameters,
+ * arguments) for the rest
+ */
+#define SRSRAN_VEC_SIMD_KERNELS(V, R)                                                                                  \
+  V(srsran_vec_xor_bbb_simd, (const uint8_t* x, const uint8_t* y, uint8_t* z, int len), (x, y, z, len))                \
+  V(srsran_vec_sum_sss_simd, (const int16_t* x, const int16_t* y, int16_t* z, int len), (x, y, z, len))                \
+  V(srsran_vec_sub_sss_simd, (const int16_t* x, const int16_t* y, int16_t* z, int len), (x, y, z, len))                \
+  V(srsran_vec_sub_bbb_simd, (const int8_t* x, const int8_t* y, int8_t* z, int len), (x, y, z, len))                   \
+  R(float, srsran_vec_acc_ff_simd, (const float* x, int len), (x, len))                                                \
+  R(cf_t, srsran_vec_acc_cc_simd, (const cf_t* x, int len), (x, len))                                                  \
+  V(srsran_vec_add_fff_simd, (const float* x, const float* y, float* z, int len), (x, y, z, len))                      \
+  V(srsran_vec_sub_fff_simd, (const float* x, const float* y, float* z, int len), (x, y, z, len))                      \
+  V(srsran_vec_sc_sum_fff_simd, (const float* x, float h, float* z, int len), (x, h, z, len))                          \
+  V(srsran_vec_sc_prod_cfc_simd, (const cf_t* x, const float h, cf_t* y, const int len), (x, h, y, len))               \
+  V(srsran_vec_sc_prod_fcc_simd, (const float* x, const cf_t h, cf_t* y, const int len), (x, h, y, len))               \
+  V(srsran_vec_sc_prod_fff_simd, (const float* x, const float h, float* z, const int len), (x, h, z, len))             \
+  V(srsran_vec_sc_prod_ccc_simd, (const cf_t* x, const cf_t h, cf_t* z, const int len), (x, h, z, len))                \
+  R(int, srsran_vec_sc_prod_ccc_simd2, (const cf_t* x, const cf_t h, cf_t* z, const int len), (x, h, z, len))          \
+  V(srsran_vec_prod_ccc_split_simd,                                                                                    \
+    (const float* a_re, const float* a_im, const float* b_re, const float* b_im,                                       \
+     float* r_re, float* r_im, const int len),                                                                         \
+    (a_re, a_im, b_re, b_im, r_re, r_im, len))                                                                         \
+  V(srsran_vec_prod_sss_simd, (const int16_t* x, const int16_t* y, int16_t* z, const int len), (x, y, z, len))         \
+  V(srsran_vec_neg_sss_simd, (const int16_t* x, const int16_t* y, int16_t* z, const int len), (x, y, z, len))          \
+  V(srsran_vec_neg_bbb_simd, (const int8_t* x, const int8_t* y, int8_t* z, const int len), (x, y, z, len))             \
+  V(srsran_vec_prod_cfc_simd, (const cf_t* x, const float* y, cf_t* z, const int len), (x, y, z, len))                 \
+  V(srsran_vec_prod_fff_simd, (const float* x, const float* y, float* z, const int len), (x, y, z, len))               \
+  V(srsran_vec_prod_ccc_simd, (const cf_t* x, const cf_t* y, cf_t* z, const int len), (x, y, z, len))                  \
+  V(srsran_vec_prod_conj_ccc_simd, (const cf_t* x, const cf_t* y, cf_t* z, const int len), (x, y, z, len))             \
+  V(srsran_vec_div_ccc_simd, (const cf_t* x, const cf_t* y, cf_t* z, const int len), (x, y, z, len))                   \
+  V(srsran_vec_div_cfc_simd, (const cf_t* x, const float* y, cf_t* z, const int len), (x, y, z, len))                  \
+  V(srsran_vec_div_fff_simd, (const float* x, const float* y, float* z, const int len), (x, y, z, len))                \
+  R(cf_t, srsran_vec_dot_prod_conj_ccc_simd, (const cf_t* x, const cf_t* y, const int len), (x, y, len))               \
+  R(cf_t, srsran_vec_dot_prod_ccc_simd, (const cf_t* x, const cf_t* y, const int len), (x, y, len))                    \
+  R(int, srsran_vec_dot_prod_sss_simd, (const int16_t* x, const int16_t* y, const int len), (x, y, len))               \
+  V(srsran_vec_abs_cf_simd, (const cf_t* x, float* z, const int len), (x, z, len))                                     \
+  V(srsran_vec_abs_square_cf_simd, (const cf_t* x, float* z, const int len), (x, z, len))                              \
+  V(srsran_vec_lut_sss_simd, (const short* x, const unsigned short* lut, short* y, const int len), (x, lut, y, len))   \
+  V(srsran_vec_lut_bbb_simd, (const int8_t* x, const unsigned short* lut, int8_t* y, const int len), (x, lut, y, len)) \
+  V(srsran_vec_convert_if_simd, (const int16_t* x, float* z, const float scale, const int len), (x, z, scale, len))    \
+  V(srsran_vec_convert_fi_simd, (const float* x, int16_t* z, const float scale, const int len), (x, z, scale, len))    \
+  V(srsran_vec_convert_conj_cs_simd,                                                                                   \
+    (const cf_t* x, int16_t* z, const float scale, const int len),                                                     \
+    (x, z, scale, len))                                                                                                \
+  V(srsran_vec_convert_bf_simd, (const int8_t* x, float* z, const float scale, const int len), (x, z, scale, len))     \
+  V(srsran_vec_convert_fb_simd, (const float* x, int8_t* z, const float scale, const int len), (x, z, scale, len))     \
+  V(srsran_vec_interleave_simd, (const cf_t* x, const cf_t* y, cf_t* z, const int len), (x, y, z, len))                \
+  V(srsran_vec_interleave_add_simd, (const cf_t* x, const cf_t* y, cf_t* z, const int len), (x, y, z, len))            \
+  R(cf_t, srsran_vec_gen_sine_simd, (cf_t amplitude, float freq, cf_t* z, int len), (amplitude, freq, z, len))         \
+  V(srsran_vec_apply_cfo_simd, (const cf_t* x, float cfo, cf_t* z, int len), (x, cfo, z, len))                         \
+  R(float, srsran_vec_estimate_frequency_simd, (const cf_t* x, int len), (x, len))                                     \
+  R(uint32_t, srsran_vec_max_fi_simd, (const float* x, const int len), (x, len))                                       \
+  R(uint32_t, srsran_vec_max_abs_fi_simd, (const float* x, const int len), (x, len))                                   \
+  R(uint32_t, srsran_vec_max_ci_simd, (const cf_t* x, const int len), (x, len))
+
+#define SRSRAN_VEC_SIMD_KERNEL_FIELD_V(F, P, A) void(*F##_fn) P;
+#define SRSRAN_VEC_SIMD_KERNEL_FIELD_R(T, F, P, A) T(*F##_fn) P;
+
+typedef struct {
+  SRSRAN_VEC_SIMD_KERNELS(SRSRAN_VEC_SIMD_KERNEL_FIELD_V, SRSRAN_VEC_SIMD_KERNEL_FIELD_R)
+#ifdef ENABLE_C16
+  void (*srsran_vec_prod_ccc_c16_simd_fn)(const int16_t* a_re,
+                                          const int16_t* a_im,
+                                          const int16_t* b_re,
+                                          const int16_t* b_im,
+                                          int16_t*       r_re,
+                                          int16_t*       r_im,
+                                          const int      len);
+  c16_t (*srsran_vec_dot_prod_ccc_c16i_simd_fn)(const c16_t* x, const c16_t* y, const int len);
+#endif /* ENABLE_C16 */
+} srsran_vec_simd_kernels_t;
+
+#endif // SRSRAN_VECTOR_SIMD_DISPATCH_H
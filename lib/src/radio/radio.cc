@@ -47,6 +47,14 @@ radio::~radio()
   for (srsran_resampler_fft_t& q : decimators) {
     srsran_resampler_fft_free(&q);
   }
+
+  for (srsran_resampler_poly_t& q : tx_poly_resamplers) {
+    srsran_resampler_poly_free(&q);
+  }
+
+  for (srsran_resampler_poly_t& q : rx_poly_resamplers) {
+    srsran_resampler_poly_free(&q);
+  }
 }
 
 int radio::init(const rf_args_t& args, phy_interface_radio* phy_)
@@ -295,25 +303,31 @@ bool radio::rx_now(rf_buffer_interface& buffer, rf_timestamp_interface& rxd_time
 
   // Extract decimation ratio. As the decimation may take some time to set a new ratio, deactivate the decimation and
   // keep receiving samples to avoid stalling the RX stream
-  uint32_t ratio = 1; // No decimation by default
+  uint32_t ratio    = 1; // No decimation by default
+  bool     resample = false;
   if (decimator_busy) {
     lock.unlock();
   } else if (decimators[0].ratio > 1) {
     ratio = decimators[0].ratio;
+  } else if (std::isnormal(rx_poly_resamplers[0].ratio)) {
+    resample = true;
   }
 
-  // Calculate number of samples, considering the decimation ratio
+  // Calculate number of samples, considering the decimation ratio or the resampler state
   uint32_t nof_samples = buffer.get_nof_samples() * ratio;
+  if (resample) {
+    nof_samples = srsran_resampler_poly_get_nof_input(&rx_poly_resamplers[0], buffer.get_nof_samples());
+  }
 
   // Check decimation buffer protection
-  if (ratio > 1 && nof_samples > rx_buffer[0].size()) {
+  if ((ratio > 1 || resample) && nof_samples > rx_buffer[0].size()) {
     // This is a corner case that could happen during sample rate change transitions, as it does not have a negative
     // impact, log it as info.
     fmt::memory_buffer buff;
     fmt::format_to(buff,
                    "Rx number of samples ({}/{}) exceeds buffer size ({})",
                    buffer.get_nof_samples(),
-                   buffer.get_nof_samples() * ratio,
+                   nof_samples,
                    rx_buffer[0].size());
     logger.info("%s", to_c_str(buff));
 
@@ -327,7 +341,7 @@ bool radio::rx_now(rf_buffer_interface& buffer, rf_timestamp_interface& rxd_time
   // If the interpolator have been set, interpolate
   for (uint32_t ch = 0; ch < nof_channels; ch++) {
     // Use rx buffer if decimator is required
-    buffer_rx.set(ch, ratio > 1 ? rx_buffer[ch].data() : buffer.get(ch));
+    buffer_rx.set(ch, (ratio > 1 || resample) ? rx_buffer[ch].data() : buffer.get(ch));
   }
 
   if (not radio_is_streaming) {
@@ -357,6 +371,16 @@ bool radio::rx_now(rf_buffer_interface& buffer, rf_timestamp_interface& rxd_time
     }
   }
 
+  // Perform non-integer ratio resampling, every channel runs to keep the same resampler state
+  if (resample) {
+    uint32_t nof_output =
+        SRSRAN_MIN(buffer.get_nof_samples(),
+                   srsran_resampler_poly_get_nof_output(&rx_poly_resamplers[0], buffer_rx.get_nof_samples()));
+    for (uint32_t ch = 0; ch < nof_channels; ch++) {
+      srsran_resampler_poly_run_nof_output(&rx_poly_resamplers[ch], buffer_rx.get(ch), buffer.get(ch), nof_output);
+    }
+  }
+
   return ret;
 }
 
@@ -421,11 +445,22 @@ bool radio::tx(rf_buffer_interface& buffer, const rf_timestamp_interface& tx_tim
 {
   bool                         ret = true;
   std::unique_lock<std::mutex> lock(tx_mutex);
-  uint32_t                     ratio = interpolators[0].ratio;
+  uint32_t                     ratio    = interpolators[0].ratio;
+  bool                         resample = std::isnormal(tx_poly_resamplers[0].ratio);
 
   // Get number of samples at the low rate
   uint32_t nof_samples = buffer.get_nof_samples();
 
+  // Check that number of the resampled samples does not exceed the buffer size
+  if (resample && srsran_resampler_poly_get_nof_output(&tx_poly_resamplers[0], nof_samples) > tx_buffer[0].size()) {
+    logger.info("Tx number of samples (%d) exceeds buffer size (%d) after resampling",
+                nof_samples,
+                (uint32_t)tx_buffer[0].size());
+
+    // Limit number of samples to transmit
+    nof_samples = srsran_resampler_poly_get_nof_input(&tx_poly_resamplers[0], (uint32_t)tx_buffer[0].size()) - 1;
+  }
+
   // Check that number of the interpolated samples does not exceed the buffer size
   if (ratio > 1 && (size_t)nof_samples * (size_t)ratio > tx_buffer[0].size()) {
     // This is a corner case that could happen during sample rate change transitions, as it does not have a negative
@@ -456,6 +491,17 @@ bool radio::tx(rf_buffer_interface& buffer, const rf_timestamp_interface& tx_tim
     buffer.set_nof_samples(nof_samples * ratio);
   }
 
+  // If the non-integer ratio resampler have been set, resample. Channels without buffer transmit zeros
+  if (resample) {
+    uint32_t nof_resampled = 0;
+    for (uint32_t ch = 0; ch < nof_channels; ch++) {
+      const cf_t* input = (buffer.get(ch) != nullptr) ? buffer.get(ch) : zeros.data();
+      nof_resampled = srsran_resampler_poly_run(&tx_poly_resamplers[ch], input, tx_buffer[ch].data(), nof_samples);
+      buffer.set(ch, tx_buffer[ch].data());
+    }
+    buffer.set_nof_samples(nof_resampled);
+  }
+
   for (uint32_t device_idx = 0; device_idx < (uint32_t)rf_devices.size(); device_idx++) {
     ret &= tx_dev(device_idx, buffer, tx_time.get(device_idx));
   }
@@ -746,17 +792,19 @@ void radio::set_rx_srate(const double& srate)
       }
     }
 
-    // Assert ratio is integer
-    srsran_assert(((uint32_t)cur_rx_srate % (uint32_t)srate) == 0,
-                  "The sampling rate ratio is not integer (%.2f MHz / %.2f MHz = %.3f)",
-                  cur_rx_srate / 1e6,
-                  srate / 1e6,
-                  cur_rx_srate / srate);
-
-    // Update decimators
-    uint32_t ratio = (uint32_t)ceil(cur_rx_srate / srate);
-    for (uint32_t ch = 0; ch < nof_channels; ch++) {
-      srsran_resampler_fft_init(&decimators[ch], SRSRAN_RESAMPLER_MODE_DECIMATE, ratio);
+    // Update decimators if the ratio is integer, otherwise use the polyphase resampler
+    if (((uint32_t)cur_rx_srate % (uint32_t)srate) == 0) {
+      uint32_t ratio = (uint32_t)ceil(cur_rx_srate / srate);
+      for (uint32_t ch = 0; ch < nof_channels; ch++) {
+        srsran_resampler_fft_init(&decimators[ch], SRSRAN_RESAMPLER_MODE_DECIMATE, ratio);
+        srsran_resampler_poly_free(&rx_poly_resamplers[ch]);
+      }
+    } else {
+      logger.info("Resampling Rx from %.2f MHz to %.2f MHz", cur_rx_srate / 1e6, srate / 1e6);
+      for (uint32_t ch = 0; ch < nof_channels; ch++) {
+        srsran_resampler_fft_init(&decimators[ch], SRSRAN_RESAMPLER_MODE_DECIMATE, 1);
+        srsran_resampler_poly_init(&rx_poly_resamplers[ch], srate / cur_rx_srate, 0);
+      }
     }
 
     decimator_busy = false;
@@ -974,7 +1022,7 @@ double radio::get_dev_cal_tx_adv_sec(const std::string& device_name)
             cur_tx_srate);
         nsamples = blade_default_tx_adv_samples + (int)(blade_default_tx_adv_offset_sec * cur_tx_srate);
       }
-    } else if (device_name == "zmq") {
+    } else if (device_name == "zmq" || device_name == "shm") {
       nsamples = 0;
     }
   } else {
@@ -1002,17 +1050,19 @@ void radio::set_tx_srate(const double& srate)
       }
     }
 
-    // Assert ratio is integer
-    srsran_assert(((uint32_t)cur_tx_srate % (uint32_t)srate) == 0,
-                  "The sampling rate ratio is not integer (%.2f MHz / %.2f MHz = %.3f)",
-                  cur_rx_srate / 1e6,
-                  srate / 1e6,
-                  cur_rx_srate / srate);
-
-    // Update interpolators
-    uint32_t ratio = (uint32_t)ceil(cur_tx_srate / srate);
-    for (uint32_t ch = 0; ch < nof_channels; ch++) {
-      srsran_resampler_fft_init(&interpolators[ch], SRSRAN_RESAMPLER_MODE_INTERPOLATE, ratio);
+    // Update interpolators if the ratio is integer, otherwise use the polyphase resampler
+    if (((uint32_t)cur_tx_srate % (uint32_t)srate) == 0) {
+      uint32_t ratio = (uint32_t)ceil(cur_tx_srate / srate);
+      for (uint32_t ch = 0; ch < nof_channels; ch++) {
+        srsran_resampler_fft_init(&interpolators[ch], SRSRAN_RESAMPLER_MODE_INTERPOLATE, ratio);
+        srsran_resampler_poly_free(&tx_poly_resamplers[ch]);
+      }
+    } else {
+      logger.info("Resampling Tx from %.2f MHz to %.2f MHz", srate / 1e6, cur_tx_srate / 1e6);
+      for (uint32_t ch = 0; ch < nof_channels; ch++) {
+        srsran_resampler_fft_init(&interpolators[ch], SRSRAN_RESAMPLER_MODE_INTERPOLATE, 1);
+        srsran_resampler_poly_init(&tx_poly_resamplers[ch], cur_tx_srate / srate, 0);
+      }
     }
   } else {
     for (srsran_rf_t& rf_device : rf_devices) {
@@ -62,6 +62,7 @@ static int test_pucch_ca(srsran_ack_nack_feedback_mode_t ack_nack_feedback_mode,
   pucch_cfg.N_cs                   = 1;                      // 0, 1, ..., 7
   pucch_cfg.N_pucch_1              = 1;                      // 0, 1, ..., 2047
   pucch_cfg.ack_nack_feedback_mode = ack_nack_feedback_mode; // Normal, CS, PUCCH3
+  pucch_cfg.meas_ta_en             = true;                   // Measure the time alignment
 
   // Set Channel Selection resources
   for (uint32_t i = 0, k = 6; i < SRSRAN_PUCCH_SIZE_AN_CS; i++) {
@@ -111,11 +112,24 @@ static int test_pucch_ca(srsran_ack_nack_feedback_mode_t ack_nack_feedback_mode,
     // Process UL signal
     srsran_enb_ul_fft(&enb_ul);
 
+    srsran_pucch_cfg_t  batch_cfg     = pucch_cfg;
+    srsran_pucch_res_t  batch_res     = {};
+    srsran_pucch_cfg_t* batch_cfg_ptr = &batch_cfg;
+    srsran_pucch_res_t* batch_res_ptr = &batch_res;
+
     TESTASSERT(!srsran_enb_ul_get_pucch(&enb_ul, &ul_sf, &pucch_cfg, &pucch_res));
 
     TESTASSERT(pucch_res.detected);
     TESTASSERT(pucch_res.uci_data.ack.valid);
 
+    // The batch decoder shall give the same result
+    TESTASSERT(!srsran_enb_ul_get_pucch_batch(&enb_ul, &ul_sf, &batch_cfg_ptr, &batch_res_ptr, 1));
+
+    TESTASSERT(batch_res.detected);
+    TESTASSERT(batch_res.uci_data.ack.valid);
+    TESTASSERT(batch_res.ta_valid == pucch_res.ta_valid);
+    TESTASSERT(fabsf(batch_res.ta_us - pucch_res.ta_us) < 1e-3f);
+
     // Check results
     for (int i = 0, k = 0; i < nof_carriers; i++) {
       for (int j = 0; j < nof_tb[i]; j++, k++) {
@@ -125,6 +139,7 @@ static int test_pucch_ca(srsran_ack_nack_feedback_mode_t ack_nack_feedback_mode,
              pusch_data.uci.ack.ack_value[k],
              pucch_res.uci_data.ack.ack_value[k]);
         TESTASSERT(pusch_data.uci.ack.ack_value[k] == pucch_res.uci_data.ack.ack_value[k]);
+        TESTASSERT(pusch_data.uci.ack.ack_value[k] == batch_res.uci_data.ack.ack_value[k]);
       }
     }
   }
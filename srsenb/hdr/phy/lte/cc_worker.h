@@ -23,6 +23,7 @@
 #define SRSENB_CC_WORKER_H
 
 #include <string.h>
+#include <vector>
 
 #include "../phy_common.h"
 #include "srsran/srslog/srslog.h"
@@ -69,8 +70,13 @@ private:
 
   int  encode_pdsch(stack_interface_phy_lte::dl_sched_grant_t* grants, uint32_t nof_grants);
   int  encode_pmch(stack_interface_phy_lte::dl_sched_grant_t* grant, srsran_mbsfn_cfg_t* mbsfn_cfg);
+  bool get_pusch_cfg_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_grant,
+                          srsran_ul_cfg_t&                           ul_cfg,
+                          bool&                                      uci_required);
   bool decode_pusch_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_grant,
                          srsran_ul_cfg_t&                           ul_cfg,
+                         bool                                       uci_required,
+                         srsran_chest_ul_res_t&                     chest_res,
                          srsran_pusch_res_t&                        pusch_res);
   void decode_pusch(stack_interface_phy_lte::ul_sched_grant_t* grants, uint32_t nof_pusch);
   int  encode_phich(stack_interface_phy_lte::ul_sched_ack_t* acks, uint32_t nof_acks);
@@ -78,6 +84,8 @@ private:
   int  encode_pdcch_ul(stack_interface_phy_lte::ul_sched_grant_t* grants, uint32_t nof_grants);
   int  decode_pucch();
 
+  cf_t* get_plot_ce();
+
   /* Common objects */
   srslog::basic_logger& logger;
   phy_common*           phy       = nullptr;
@@ -117,6 +125,29 @@ private:
     phy_metrics_t metrics = {};
   };
 
+  // PUSCH grants of the current subframe, kept until their pending transport blocks are decoded
+  struct pusch_decode_t {
+    srsran_ul_cfg_t    ul_cfg       = {};
+    srsran_pusch_res_t pusch_res    = {};
+    bool               uci_required = false;
+  };
+  std::vector<pusch_decode_t> pusch_decode_list;
+
+  // PUSCH channel estimates of the current subframe, one for each grant. They are estimated in a single batch
+  std::vector<srsran_chest_ul_res_t>  pusch_chest_res;
+  std::vector<srsran_pusch_cfg_t*>    pusch_cfg_list;
+  std::vector<srsran_chest_ul_res_t*> pusch_chest_list;
+
+  // PUCCH receptions of the current subframe, they are detected in a single call with joint PUCCH detection
+  struct pucch_decode_t {
+    uint16_t           rnti      = 0;
+    srsran_ul_cfg_t    ul_cfg    = {};
+    srsran_pucch_res_t pucch_res = {};
+  };
+  std::vector<pucch_decode_t>      pucch_decode_list;
+  std::vector<srsran_pucch_cfg_t*> pucch_cfg_list;
+  std::vector<srsran_pucch_res_t*> pucch_res_list;
+
   // Component carrier index
   uint32_t cc_idx = 0;
 
@@ -59,22 +59,24 @@ struct phy_args_t {
   std::string            type;
   srsran::phy_log_args_t log;
 
-  float                   rx_gain_offset      = 62;
-  float                   max_prach_offset_us = 10;
-  uint32_t                pusch_max_its       = 10;
-  uint32_t                nr_pusch_max_its    = 10;
-  bool                    pusch_8bit_decoder  = false;
-  float                   tx_amplitude        = 1.0f;
-  uint32_t                nof_phy_threads     = 1;
-  std::string             equalizer_mode      = "mmse";
-  float                   estimator_fil_w     = 1.0f;
-  bool                    pusch_meas_epre     = true;
-  bool                    pusch_meas_evm      = false;
-  bool                    pusch_meas_ta       = true;
-  bool                    pucch_meas_ta       = true;
-  bool                    use_cedron_alg      = false;
-  uint32_t                nof_prach_threads   = 1;
-  bool                    extended_cp         = false;
+  float                   rx_gain_offset        = 62;
+  float                   max_prach_offset_us   = 10;
+  uint32_t                pusch_max_its         = 10;
+  uint32_t                nr_pusch_max_its      = 10;
+  bool                    pusch_8bit_decoder    = false;
+  bool                    pusch_batch_decoder   = false;
+  bool                    pucch_joint_detection = false;
+  float                   tx_amplitude          = 1.0f;
+  uint32_t                nof_phy_threads       = 1;
+  std::string             equalizer_mode        = "mmse";
+  float                   estimator_fil_w       = 1.0f;
+  bool                    pusch_meas_epre       = true;
+  bool                    pusch_meas_evm        = false;
+  bool                    pusch_meas_ta         = true;
+  bool                    pucch_meas_ta         = true;
+  bool                    use_cedron_alg        = false;
+  uint32_t                nof_prach_threads     = 1;
+  bool                    extended_cp           = false;
   srsran::channel::args_t dl_channel_args;
   srsran::channel::args_t ul_channel_args;
   cfr_args_t              cfr_args;
@@ -205,6 +205,9 @@ private:
 
   // Softbuffer pool
   std::unique_ptr<srsran::obj_pool_itf<ue_cc_softbuffers> > softbuffer_pool;
+
+  // UL code block softbuffers shared by all UEs, it must outlive softbuffer_pool
+  srsran_softbuffer_pool_t ul_softbuffer_pool = {};
 };
 
 } // namespace srsenb
@@ -57,7 +57,11 @@ struct ue_cc_softbuffers {
   cc_softbuffer_tx_list_t softbuffer_tx_list;
   cc_softbuffer_rx_list_t softbuffer_rx_list;
 
-  ue_cc_softbuffers(uint32_t nof_prb, uint32_t nof_tx_harq_proc_, uint32_t nof_rx_harq_proc_);
+  ue_cc_softbuffers(uint32_t                  nof_prb,
+                    uint32_t                  nof_tx_harq_proc_,
+                    uint32_t                  nof_rx_harq_proc_,
+                    srsran_softbuffer_pool_t* rx_pool    = nullptr,
+                    bool                      rx_is_8bit = false);
   ue_cc_softbuffers(ue_cc_softbuffers&&) noexcept = default;
   ~ue_cc_softbuffers();
   void clear();
@@ -2092,6 +2092,9 @@ int set_derived_args(all_args_t* args_, rrc_cfg_t* rrc_cfg_, phy_cfg_t* phy_cfg_
   // MAC needs to know the cell bandwidth to dimension softbuffers
   args_->stack.mac.nof_prb = args_->enb.n_prb;
 
+  // UL softbuffers store the LLR with the width used by the PUSCH decoder
+  args_->stack.mac.ul_softbuffer_8bit = args_->phy.pusch_8bit_decoder;
+
   // RRC needs eNB id for SIB1 packing
   rrc_cfg_->enb_id = args_->stack.s1ap.enb_id;
 
@@ -2100,9 +2103,10 @@ int set_derived_args(all_args_t* args_, rrc_cfg_t* rrc_cfg_, phy_cfg_t* phy_cfg_
   rrc_cfg_->max_mac_ul_kos       = args_->general.max_mac_ul_kos;
   rrc_cfg_->rlf_release_timer_ms = args_->general.rlf_release_timer_ms;
 
-  // Set sync queue capacity to 1 for ZMQ
-  if (args_->rf.device_name == "zmq") {
-    srslog::fetch_basic_logger("ENB").info("Using sync queue size of one for ZMQ based radio.");
+  // Set sync queue capacity to 1 for ZMQ and shared memory
+  if (args_->rf.device_name == "zmq" || args_->rf.device_name == "shm") {
+    srslog::fetch_basic_logger("ENB").info("Using sync queue size of one for %s based radio.",
+                                           args_->rf.device_name.c_str());
     args_->stack.sync_queue_size = 1;
   } else {
     // use default size
@@ -67,6 +67,10 @@ cc_worker::~cc_worker()
   srsran_enb_dl_free(&enb_dl);
   srsran_enb_ul_free(&enb_ul);
 
+  for (srsran_chest_ul_res_t& chest_res : pusch_chest_res) {
+    srsran_chest_ul_res_free(&chest_res);
+  }
+
   for (int p = 0; p < SRSRAN_MAX_PORTS; p++) {
     if (signal_buffer_rx[p]) {
       free(signal_buffer_rx[p]);
@@ -156,6 +160,12 @@ void cc_worker::init(phy_common* phy_, uint32_t cc_idx_)
     enb_ul.pusch.llr_is_8bit        = true;
     enb_ul.pusch.ul_sch.llr_is_8bit = true;
   }
+  if (phy->params.pusch_batch_decoder) {
+    if (srsran_enb_ul_set_pusch_batch_decoding(&enb_ul, true) < SRSRAN_SUCCESS) {
+      ERROR("Error enabling PUSCH batch decoding");
+      return;
+    }
+  }
   initiated = true;
 
 #ifdef DEBUG_WRITE_FILE
@@ -283,9 +293,9 @@ void cc_worker::work_dl(const srsran_dl_sf_cfg_t&            dl_sf_cfg,
   }
 }
 
-bool cc_worker::decode_pusch_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_grant,
-                                  srsran_ul_cfg_t&                           ul_cfg,
-                                  srsran_pusch_res_t&                        pusch_res)
+bool cc_worker::get_pusch_cfg_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_grant,
+                                   srsran_ul_cfg_t&                           ul_cfg,
+                                   bool&                                      uci_required)
 {
   uint16_t rnti = ul_grant.dci.rnti;
 
@@ -307,8 +317,7 @@ bool cc_worker::decode_pusch_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_
   }
 
   // Fill UCI configuration
-  bool uci_required =
-      phy->ue_db.fill_uci_cfg(tti_rx, cc_idx, rnti, ul_grant.dci.cqi_request, true, ul_cfg.pusch.uci_cfg);
+  uci_required = phy->ue_db.fill_uci_cfg(tti_rx, cc_idx, rnti, ul_grant.dci.cqi_request, true, ul_cfg.pusch.uci_cfg);
 
   // Compute UL grant
   srsran_pusch_grant_t& grant = ul_cfg.pusch.grant;
@@ -338,75 +347,144 @@ bool cc_worker::decode_pusch_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_
     Error("Error setting last UL TB for RNTI %x, CC %d, PID %d", rnti, cc_idx, ul_grant.pid);
   }
 
-  // Run PUSCH decoder
   ul_cfg.pusch.softbuffers.rx = ul_grant.softbuffer_rx;
-  pusch_res.data              = ul_grant.data;
+
+  return true;
+}
+
+bool cc_worker::decode_pusch_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_grant,
+                                  srsran_ul_cfg_t&                           ul_cfg,
+                                  bool                                       uci_required,
+                                  srsran_chest_ul_res_t&                     chest_res,
+                                  srsran_pusch_res_t&                        pusch_res)
+{
+  uint16_t rnti = ul_grant.dci.rnti;
+
+  // Run PUSCH decoder
+  pusch_res.data = ul_grant.data;
   if (pusch_res.data) {
-    if (srsran_enb_ul_get_pusch(&enb_ul, &ul_sf, &ul_cfg.pusch, &pusch_res)) {
+    if (srsran_enb_ul_decode_pusch(&enb_ul, &ul_sf, &ul_cfg.pusch, &chest_res, &pusch_res)) {
       Error("Decoding PUSCH for RNTI %x", rnti);
       return false;
     }
-  }
-  // Save PHICH scheduling for this user. Each user can have just 1 PUSCH dci per TTI
-  ue_db[rnti]->phich_grant.n_prb_lowest = grant.n_prb_tilde[0];
-  ue_db[rnti]->phich_grant.n_dmrs       = ul_grant.dci.n_dmrs;
 
-  float snr_db = enb_ul.chest_res.snr_db;
+    // Notify MAC of RL status
+    float snr_db = chest_res.snr_db;
+    if (snr_db >= PUSCH_RL_SNR_DB_TH) {
+      // Notify MAC UL channel quality
+      phy->stack->snr_info(ul_sf.tti, rnti, cc_idx, snr_db, mac_interface_phy_lte::PUSCH);
 
-  // Notify MAC of RL status
-  if (snr_db >= PUSCH_RL_SNR_DB_TH) {
-    // Notify MAC UL channel quality
-    phy->stack->snr_info(ul_sf.tti, rnti, cc_idx, snr_db, mac_interface_phy_lte::PUSCH);
-
-    // Notify MAC of Time Alignment only if it enabled and valid measurement, ignore value otherwise
-    if (ul_cfg.pusch.meas_ta_en and not std::isnan(enb_ul.chest_res.ta_us) and not std::isinf(enb_ul.chest_res.ta_us)) {
-      phy->stack->ta_info(ul_sf.tti, rnti, enb_ul.chest_res.ta_us);
+      // Notify MAC of Time Alignment only if it enabled and valid measurement, ignore value otherwise
+      if (ul_cfg.pusch.meas_ta_en and not std::isnan(chest_res.ta_us) and not std::isinf(chest_res.ta_us)) {
+        phy->stack->ta_info(ul_sf.tti, rnti, chest_res.ta_us);
+      }
     }
   }
+  // Save PHICH scheduling for this user. Each user can have just 1 PUSCH dci per TTI
+  ue_db[rnti]->phich_grant.n_prb_lowest = ul_cfg.pusch.grant.n_prb_tilde[0];
+  ue_db[rnti]->phich_grant.n_dmrs       = ul_grant.dci.n_dmrs;
 
   // Send UCI data to MAC
   if (uci_required) {
     phy->ue_db.send_uci_data(tti_rx, rnti, cc_idx, ul_cfg.pusch.uci_cfg, pusch_res.uci);
   }
 
-  // Save statistics only if data was provided
-  if (ul_grant.data != nullptr) {
-    // Save metrics stats
-    ue_db[rnti]->metrics_ul(ul_grant.dci.tb.mcs_idx,
-                            enb_ul.chest_res.epre_dBfs - phy->params.rx_gain_offset,
-                            enb_ul.chest_res.snr_db,
-                            pusch_res.avg_iterations_block);
-  }
   return true;
 }
 
 void cc_worker::decode_pusch(stack_interface_phy_lte::ul_sched_grant_t* grants, uint32_t nof_pusch)
 {
-  // Iterate over all the grants, all the grants need to report MAC the CRC status
-  for (uint32_t i = 0; i < nof_pusch; i++) {
-    // Get grant itself and RNTI
-    stack_interface_phy_lte::ul_sched_grant_t& ul_grant = grants[i];
-    uint16_t                                   rnti     = ul_grant.dci.rnti;
+  // The results are written by the batched turbo decoder, they must not move until it has run
+  pusch_decode_list.resize(nof_pusch);
 
-    srsran_pusch_res_t pusch_res = {};
-    srsran_ul_cfg_t    ul_cfg    = {};
+  // Get the configuration of all the grants first
+  uint32_t nof_valid = 0;
+  for (; nof_valid < nof_pusch; nof_valid++) {
+    pusch_decode_t& pusch = pusch_decode_list[nof_valid];
+    pusch                 = {};
 
-    // Decodes PUSCH for the given grant
-    if (!decode_pusch_rnti(ul_grant, ul_cfg, pusch_res)) {
+    if (!get_pusch_cfg_rnti(grants[nof_valid], pusch.ul_cfg, pusch.uci_required)) {
+      break;
+    }
+  }
+
+  // Each grant needs its own channel estimate, the storage only grows
+  while (pusch_chest_res.size() < nof_valid) {
+    srsran_chest_ul_res_t chest_res = {};
+    if (srsran_chest_ul_res_init(&chest_res, phy->get_nof_prb(cc_idx)) < SRSRAN_SUCCESS) {
+      Error("Allocating PUSCH channel estimates");
+      return;
+    }
+    pusch_chest_res.push_back(chest_res);
+  }
+
+  // Estimate the channel of all the grants with data in a single batch
+  pusch_cfg_list.clear();
+  pusch_chest_list.clear();
+  for (uint32_t i = 0; i < nof_valid; i++) {
+    if (grants[i].data != nullptr) {
+      pusch_cfg_list.push_back(&pusch_decode_list[i].ul_cfg.pusch);
+      pusch_chest_list.push_back(&pusch_chest_res[i]);
+    }
+  }
+  if (not pusch_cfg_list.empty()) {
+    uint32_t nof_estimates = (uint32_t)pusch_cfg_list.size();
+    if (srsran_enb_ul_estimate_pusch_batch(
+            &enb_ul, &ul_sf, pusch_cfg_list.data(), pusch_chest_list.data(), nof_estimates) < SRSRAN_SUCCESS) {
+      Error("Estimating PUSCH channel");
       return;
     }
+  }
+
+  // Demodulate all the grants, short transport blocks are left pending for a single batched decode
+  uint32_t nof_decoded = 0;
+  for (; nof_decoded < nof_valid; nof_decoded++) {
+    pusch_decode_t& pusch = pusch_decode_list[nof_decoded];
+
+    // Decodes PUSCH for the given grant
+    if (!decode_pusch_rnti(grants[nof_decoded],
+                           pusch.ul_cfg,
+                           pusch.uci_required,
+                           pusch_chest_res[nof_decoded],
+                           pusch.pusch_res)) {
+      break;
+    }
+  }
+
+  // Turbo decode all the pending transport blocks of this subframe
+  if (srsran_enb_ul_decode_pusch_pending(&enb_ul) < SRSRAN_SUCCESS) {
+    Error("Decoding pending PUSCH transport blocks");
+  }
+
+  // Iterate over all the grants, all the grants need to report MAC the CRC status
+  for (uint32_t i = 0; i < nof_decoded; i++) {
+    // Get grant itself and RNTI
+    stack_interface_phy_lte::ul_sched_grant_t& ul_grant  = grants[i];
+    uint16_t                                   rnti      = ul_grant.dci.rnti;
+    pusch_decode_t&                            pusch     = pusch_decode_list[i];
+    srsran_chest_ul_res_t&                     chest_res = pusch_chest_res[i];
 
     // Notify MAC new received data and HARQ Indication value
     if (ul_grant.data != nullptr) {
+      // Save metrics stats
+      ue_db[rnti]->metrics_ul(ul_grant.dci.tb.mcs_idx,
+                              chest_res.epre_dBfs - phy->params.rx_gain_offset,
+                              chest_res.snr_db,
+                              pusch.pusch_res.avg_iterations_block);
+
       // Inform MAC about the CRC result
-      phy->stack->crc_info(tti_rx, rnti, cc_idx, ul_cfg.pusch.grant.tb.tbs / 8, pusch_res.crc);
+      phy->stack->crc_info(tti_rx, rnti, cc_idx, pusch.ul_cfg.pusch.grant.tb.tbs / 8, pusch.pusch_res.crc);
       // Push PDU buffer
-      phy->stack->push_pdu(
-          tti_rx, rnti, cc_idx, ul_cfg.pusch.grant.tb.tbs / 8, pusch_res.crc, ul_cfg.pusch.grant.L_prb);
+      phy->stack->push_pdu(tti_rx,
+                           rnti,
+                           cc_idx,
+                           pusch.ul_cfg.pusch.grant.tb.tbs / 8,
+                           pusch.pusch_res.crc,
+                           pusch.ul_cfg.pusch.grant.L_prb);
       // Logging
       if (logger.info.enabled()) {
         char str[512];
-        srsran_pusch_rx_info(&ul_cfg.pusch, &pusch_res, &enb_ul.chest_res, str, sizeof(str));
+        srsran_pusch_rx_info(&pusch.ul_cfg.pusch, &pusch.pusch_res, &chest_res, str, sizeof(str));
         logger.info("PUSCH: cc=%d, %s", cc_idx, str);
       }
     }
@@ -415,7 +493,7 @@ void cc_worker::decode_pusch(stack_interface_phy_lte::ul_sched_grant_t* grants,
 
 int cc_worker::decode_pucch()
 {
-  srsran_pucch_res_t pucch_res = {};
+  pucch_decode_list.clear();
 
   for (auto& iter : ue_db) {
     uint16_t rnti = iter.first;
@@ -438,37 +516,68 @@ int cc_worker::decode_pucch()
 
       // If ret is more than success, UCI is present
       if (ret > SRSRAN_SUCCESS) {
-        // Decode PUCCH
-        if (srsran_enb_ul_get_pucch(&enb_ul, &ul_sf, &ul_cfg.pucch, &pucch_res)) {
-          Error("Error getting PUCCH");
-          continue;
-        }
+        pucch_decode_t pucch = {};
+        pucch.rnti           = rnti;
+        pucch.ul_cfg         = ul_cfg;
+        pucch_decode_list.push_back(pucch);
+      }
+    }
+  }
 
-        // Send UCI data to MAC
-        if (phy->ue_db.send_uci_data(tti_rx, rnti, cc_idx, ul_cfg.pucch.uci_cfg, pucch_res.uci_data) < SRSRAN_SUCCESS) {
-          Error("Error sending UCI data for RNTI %x, CC %d", rnti, cc_idx);
-          continue;
-        }
+  if (pucch_decode_list.empty()) {
+    return 0;
+  }
 
-        if (pucch_res.detected and pucch_res.ta_valid) {
-          phy->stack->ta_info(tti_rx, rnti, pucch_res.ta_us);
-          phy->stack->snr_info(tti_rx, rnti, cc_idx, pucch_res.snr_db, mac_interface_phy_lte::PUCCH);
-        }
+  if (phy->params.pucch_joint_detection) {
+    // Decode the PUCCH of all the users at once, the resources sharing PRB are detected jointly
+    pucch_cfg_list.clear();
+    pucch_res_list.clear();
+    for (pucch_decode_t& pucch : pucch_decode_list) {
+      pucch_cfg_list.push_back(&pucch.ul_cfg.pucch);
+      pucch_res_list.push_back(&pucch.pucch_res);
+    }
+    if (srsran_enb_ul_get_pucch_batch(
+            &enb_ul, &ul_sf, pucch_cfg_list.data(), pucch_res_list.data(), (uint32_t)pucch_decode_list.size())) {
+      Error("Error getting PUCCH");
+      return 0;
+    }
+  }
 
-        // Logging
-        if (logger.info.enabled()) {
-          char str[512];
-          srsran_pucch_rx_info(&ul_cfg.pucch, &pucch_res, str, sizeof(str));
-          logger.info("PUCCH: cc=%d; %s", cc_idx, str);
-        }
+  for (pucch_decode_t& pucch : pucch_decode_list) {
+    uint16_t            rnti      = pucch.rnti;
+    srsran_pucch_res_t& pucch_res = pucch.pucch_res;
 
-        // Save metrics
-        if (pucch_res.detected) {
-          ue_db[rnti]->metrics_ul_pucch(pucch_res.rssi_dbFs - phy->params.rx_gain_offset,
-                                        pucch_res.ni_dbFs - -phy->params.rx_gain_offset,
-                                        pucch_res.snr_db);
-        }
-      }
+    // Decode PUCCH
+    if (not phy->params.pucch_joint_detection and
+        srsran_enb_ul_get_pucch(&enb_ul, &ul_sf, &pucch.ul_cfg.pucch, &pucch_res)) {
+      Error("Error getting PUCCH");
+      continue;
+    }
+
+    // Send UCI data to MAC
+    if (phy->ue_db.send_uci_data(tti_rx, rnti, cc_idx, pucch.ul_cfg.pucch.uci_cfg, pucch_res.uci_data) <
+        SRSRAN_SUCCESS) {
+      Error("Error sending UCI data for RNTI %x, CC %d", rnti, cc_idx);
+      continue;
+    }
+
+    if (pucch_res.detected and pucch_res.ta_valid) {
+      phy->stack->ta_info(tti_rx, rnti, pucch_res.ta_us);
+      phy->stack->snr_info(tti_rx, rnti, cc_idx, pucch_res.snr_db, mac_interface_phy_lte::PUCCH);
+    }
+
+    // Logging
+    if (logger.info.enabled()) {
+      char str[512];
+      srsran_pucch_rx_info(&pucch.ul_cfg.pucch, &pucch_res, str, sizeof(str));
+      logger.info("PUCCH: cc=%d; %s", cc_idx, str);
+    }
+
+    // Save metrics
+    if (pucch_res.detected) {
+      ue_db[rnti]->metrics_ul_pucch(pucch_res.rssi_dbFs - phy->params.rx_gain_offset,
+                                    pucch_res.ni_dbFs - -phy->params.rx_gain_offset,
+                                    pucch_res.snr_db);
     }
   }
   return 0;
@@ -703,12 +812,18 @@ void cc_worker::ue::metrics_ul_pucch(float rssi, float ni, float sinr)
   metrics.ul.n_samples_pucch++;
 }
 
+// The plots show the PUSCH channel estimate of the first grant, the PUSCH estimates are not kept in enb_ul
+cf_t* cc_worker::get_plot_ce()
+{
+  return pusch_chest_res.empty() ? enb_ul.chest_res.ce : pusch_chest_res[0].ce;
+}
+
 int cc_worker::read_ce_abs(float* ce_abs)
 {
   int sz = srsran_symbol_sz(phy->get_nof_prb(cc_idx));
   srsran_vec_f_zero(ce_abs, sz);
   int g = (sz - SRSRAN_NRE * phy->get_nof_prb(cc_idx)) / 2;
-  srsran_vec_abs_dB_cf(enb_ul.chest_res.ce, -80.0f, &ce_abs[g], SRSRAN_NRE * phy->get_nof_prb(cc_idx));
+  srsran_vec_abs_dB_cf(get_plot_ce(), -80.0f, &ce_abs[g], SRSRAN_NRE * phy->get_nof_prb(cc_idx));
   return sz;
 }
 
@@ -717,7 +832,7 @@ int cc_worker::read_ce_arg(float* ce_arg)
   int sz = srsran_symbol_sz(phy->get_nof_prb(cc_idx));
   srsran_vec_f_zero(ce_arg, sz);
   int g = (sz - SRSRAN_NRE * phy->get_nof_prb(cc_idx)) / 2;
-  srsran_vec_arg_deg_cf(enb_ul.chest_res.ce, -80.0f, &ce_arg[g], SRSRAN_NRE * phy->get_nof_prb(cc_idx));
+  srsran_vec_arg_deg_cf(get_plot_ce(), -80.0f, &ce_arg[g], SRSRAN_NRE * phy->get_nof_prb(cc_idx));
   return sz;
 }
 
@@ -53,6 +53,20 @@ bool worker_pool::init(const args_t& args, const phy_cell_cfg_list_nr_t& cell_li
   srslog::basic_levels log_level = srslog::str_to_basic_level(args.log.phy_level);
   logger.set_level(log_level);
 
+  // Plan the OFDM DFTs of the carriers once, at the sampling rate and at the carrier bandwidth, the workers get them
+  // from the DFT plan cache
+  std::vector<int> dft_sizes;
+  for (const phy_cell_cfg_nr_t& cell : cell_list) {
+    int symbol_sz = srsran_symbol_sz_from_srate(srate_hz, cell.carrier.scs);
+    if (symbol_sz > 0) {
+      dft_sizes.push_back(symbol_sz);
+    }
+    dft_sizes.push_back((int)srsran_min_symbol_sz_rb(cell.carrier.nof_prb));
+  }
+  if (srsran_dft_plan_prewarm(dft_sizes.data(), dft_sizes.size()) < SRSRAN_SUCCESS) {
+    logger.warning("Error pre-warming the DFT plans");
+  }
+
   // Add workers to workers pool and start threads
   for (uint32_t i = 0; i < args.nof_phy_threads; i++) {
     auto& log = srslog::fetch_basic_logger(fmt::format("{}PHY{}-NR", args.log.id_preamble, i), log_sink);
@@ -180,6 +180,20 @@ int phy::init_lte(const phy_args_t&            args,
 
   parse_common_config(cfg);
 
+  // Plan the OFDM and transform precoding DFTs of all the carriers once, the workers get them from the DFT plan cache
+  std::vector<int> dft_sizes;
+  for (const phy_cell_cfg_t& cell_cfg : cfg.phy_cell_cfg) {
+    dft_sizes.push_back(srsran_symbol_sz(cell_cfg.cell.nof_prb));
+  }
+  if (srsran_dft_plan_prewarm(dft_sizes.data(), dft_sizes.size()) < SRSRAN_SUCCESS) {
+    phy_log.warning("Error pre-warming the DFT plans");
+  }
+  for (const phy_cell_cfg_t& cell_cfg : cfg.phy_cell_cfg) {
+    if (srsran_dft_precoding_prewarm(cell_cfg.cell.nof_prb) < SRSRAN_SUCCESS) {
+      phy_log.warning("Error pre-warming the transform precoding DFT plans");
+    }
+  }
+
   // Add workers to workers pool and start threads
   if (not cfg.phy_cell_cfg.empty()) {
     lte_workers.init(args, &workers_common, log_sink, WORKERS_THREAD_PRIO);
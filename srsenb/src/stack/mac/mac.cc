@@ -47,6 +47,8 @@ mac::mac(srsran::ext_task_sched_handle task_sched_, srslog::basic_logger& logger
 mac::~mac()
 {
   stop();
+  softbuffer_pool.reset();
+  srsran_softbuffer_pool_free(&ul_softbuffer_pool);
   pthread_rwlock_destroy(&rwlock);
 }
 
@@ -79,10 +81,22 @@ bool mac::init(const mac_args_t&        args_,
     srsran_softbuffer_tx_init(&cc.rar_softbuffer_tx, args.nof_prb);
   }
 
+  // Initiate the UL code block softbuffers shared by all UEs
+  srsran_softbuffer_pool_t* ul_pool = nullptr;
+  if (args.ul_softbuffer_pool_cbs > 0) {
+    if (srsran_softbuffer_pool_init(
+            &ul_softbuffer_pool, args.ul_softbuffer_pool_cbs, SOFTBUFFER_SIZE, args.ul_softbuffer_8bit)) {
+      logger.error("Error initiating pool of %d UL softbuffers", args.ul_softbuffer_pool_cbs);
+      return false;
+    }
+    ul_pool = &ul_softbuffer_pool;
+  }
+
   // Initiate common pool of softbuffers
   uint32_t nof_prb          = args.nof_prb;
-  auto     init_softbuffers = [nof_prb](void* ptr) {
-    new (ptr) ue_cc_softbuffers(nof_prb, SRSRAN_FDD_NOF_HARQ, SRSRAN_FDD_NOF_HARQ);
+  bool     ul_8bit          = args.ul_softbuffer_8bit;
+  auto     init_softbuffers = [nof_prb, ul_pool, ul_8bit](void* ptr) {
+    new (ptr) ue_cc_softbuffers(nof_prb, SRSRAN_FDD_NOF_HARQ, SRSRAN_FDD_NOF_HARQ, ul_pool, ul_8bit);
   };
   auto recycle_softbuffers = [](ue_cc_softbuffers& softbuffers) { softbuffers.clear(); };
   softbuffer_pool.reset(new srsran::background_obj_pool<ue_cc_softbuffers>(
@@ -32,13 +32,23 @@
 
 namespace srsenb {
 
-ue_cc_softbuffers::ue_cc_softbuffers(uint32_t nof_prb, uint32_t nof_tx_harq_proc_, uint32_t nof_rx_harq_proc_) :
+ue_cc_softbuffers::ue_cc_softbuffers(uint32_t                  nof_prb,
+                                     uint32_t                  nof_tx_harq_proc_,
+                                     uint32_t                  nof_rx_harq_proc_,
+                                     srsran_softbuffer_pool_t* rx_pool,
+                                     bool                      rx_is_8bit) :
   nof_tx_harq_proc(nof_tx_harq_proc_), nof_rx_harq_proc(nof_rx_harq_proc_)
 {
-  // Create and init Rx buffers
+  // Create and init Rx buffers. Pooled buffers only hold code blocks while their HARQ process is pending
   softbuffer_rx_list.resize(nof_rx_harq_proc);
   for (srsran_softbuffer_rx_t& buffer : softbuffer_rx_list) {
-    srsran_softbuffer_rx_init(&buffer, nof_prb);
+    if (rx_pool != nullptr) {
+      srsran_softbuffer_rx_init_pool(&buffer, nof_prb, rx_pool);
+    } else if (rx_is_8bit) {
+      srsran_softbuffer_rx_init_8bit(&buffer, nof_prb);
+    } else {
+      srsran_softbuffer_rx_init(&buffer, nof_prb);
+    }
   }
 
   // Create and init Tx buffers
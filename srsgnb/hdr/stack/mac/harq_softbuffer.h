@@ -81,8 +81,8 @@ public:
   rx_harq_softbuffer() { bzero(&buffer, sizeof(buffer)); }
   explicit rx_harq_softbuffer(uint32_t nof_prb_)
   {
-    // Note: for now we use same size regardless of nof_prb_
-    srsran_softbuffer_rx_init_guru(&buffer, SRSRAN_SCH_NR_MAX_NOF_CB_LDPC, SRSRAN_LDPC_MAX_LEN_ENCODED_CB);
+    // Note: for now we use same size regardless of nof_prb_. The LDPC decoder works with 8-bit LLR
+    srsran_softbuffer_rx_init_guru_8bit(&buffer, SRSRAN_SCH_NR_MAX_NOF_CB_LDPC, SRSRAN_LDPC_MAX_LEN_ENCODED_CB);
   }
   rx_harq_softbuffer(const rx_harq_softbuffer&) = delete;
   rx_harq_softbuffer(rx_harq_softbuffer&& other) noexcept
@@ -59,7 +59,8 @@ public:
   bool work_ul(srsran_uci_data_t* uci_data);
 
   int read_ce_abs(float* ce_abs, uint32_t tx_antenna, uint32_t rx_antenna);
-  int read_pdsch_d(cf_t* pdsch_d);
+  int  read_pdsch_d(cf_t* pdsch_d);
+  void set_store_pdsch_symbols(bool enable);
 
   void update_measurements(std::vector<phy_meas_t>& serving_cells, cf_t* rssi_power_buffer = nullptr);
 
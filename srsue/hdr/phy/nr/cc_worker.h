@@ -44,7 +44,8 @@ public:
   bool work_dl();
   bool work_ul();
 
-  int read_pdsch_d(cf_t* pdsch_d);
+  int  read_pdsch_d(cf_t* pdsch_d);
+  void set_store_pdsch_symbols(bool enable);
 
 private:
   // PHY lib temporal logger types
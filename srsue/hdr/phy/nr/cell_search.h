@@ -25,6 +25,7 @@
 #include "srsran/interfaces/radio_interfaces.h"
 #include "srsran/interfaces/ue_nr_interfaces.h"
 #include "srsran/srsran.h"
+#include <vector>
 
 namespace srsue {
 namespace nr {
@@ -40,6 +41,7 @@ public:
     double                      srate_hz;
     double                      center_freq_hz;
     double                      ssb_freq_hz;
+    std::vector<double>         extra_ssb_freq_hz; ///< Other SSB center frequencies inside the sampled bandwidth
     srsran_subcarrier_spacing_t ssb_scs;
     srsran_ssb_pattern_t        ssb_pattern;
     srsran_duplex_mode_t        duplex_mode;
@@ -48,6 +50,7 @@ public:
   struct ret_t {
     enum { CELL_FOUND = 1, CELL_NOT_FOUND = 0, ERROR = -1 } result;
     srsran_ssb_search_res_t ssb_res;
+    double                  ssb_freq_hz; ///< SSB center frequency the result belongs to
   };
 
   cell_search(srslog::basic_logger& logger);
@@ -59,8 +62,10 @@ public:
   ret_t run_slot(const cf_t* buffer, uint32_t slot_sz);
 
 private:
-  srslog::basic_logger&        logger;
-  srsran_ssb_t                 ssb    = {};
+  srslog::basic_logger&                logger;
+  srsran_ssb_t                         ssb         = {};
+  std::vector<double>                  ssb_freq_hz = {}; ///< Searched SSB center frequencies, the configured first
+  std::vector<srsran_ssb_search_res_t> ssb_res     = {}; ///< Search result of each SSB center frequency
 };
 } // namespace nr
 } // namespace srsue
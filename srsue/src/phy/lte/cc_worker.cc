@@ -931,6 +931,11 @@ int cc_worker::read_pdsch_d(cf_t* pdsch_d)
   return ue_dl_cfg.cfg.pdsch.grant.nof_re;
 }
 
+void cc_worker::set_store_pdsch_symbols(bool enable)
+{
+  ue_dl_cfg.cfg.pdsch.store_symbols = enable;
+}
+
 void cc_worker::new_mch_dl(mac_interface_phy_lte::tb_action_dl_t* action)
 {
   action->generate_ack        = false;
@@ -164,6 +164,11 @@ void sf_worker::work_imp()
     return;
   }
 
+#ifdef ENABLE_GUI
+  // The plot reads the equalized PDSCH symbols of the primary cell, which are not kept by default
+  cc_workers[0]->set_store_pdsch_symbols((int)get_id() == plot_worker_id);
+#endif
+
   bool     rx_signal_ok    = false;
   bool     tx_signal_ready = false;
   uint32_t nof_samples     = SRSRAN_SF_LEN_PRB(cell.nof_prb);
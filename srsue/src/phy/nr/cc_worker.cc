@@ -713,5 +713,10 @@ int cc_worker::read_pdsch_d(cf_t* pdsch_d)
   return nof_re;
 }
 
+void cc_worker::set_store_pdsch_symbols(bool enable)
+{
+  ue_dl.pdsch.store_symbols = enable;
+}
+
 } // namespace nr
 } // namespace srsue
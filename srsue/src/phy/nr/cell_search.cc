@@ -75,18 +75,58 @@ bool cell_search::start(const cfg_t& cfg)
     logger.error("Cell search: Error setting SSB configuration");
     return false;
   }
+
+  // The configured SSB center frequency goes first, so it is selected if it is found together with others
+  ssb_freq_hz.clear();
+  ssb_freq_hz.push_back(cfg.ssb_freq_hz);
+  for (double freq_hz : cfg.extra_ssb_freq_hz) {
+    if (ssb_freq_hz.size() == SRSRAN_SSB_MAX_NOF_SEARCH_FREQ) {
+      logger.warning("Cell search: Only the first %d SSB center frequencies are searched",
+                     SRSRAN_SSB_MAX_NOF_SEARCH_FREQ);
+      break;
+    }
+    if (freq_hz != cfg.ssb_freq_hz) {
+      ssb_freq_hz.push_back(freq_hz);
+    }
+  }
+  ssb_res.resize(ssb_freq_hz.size());
+
   return true;
 }
 
 cell_search::ret_t cell_search::run_slot(const cf_t* buffer, uint32_t slot_sz)
 {
   cell_search::ret_t ret = {};
+  ret.ssb_freq_hz        = ssb.cfg.ssb_freq_hz;
 
-  // Search for SSB
-  if (srsran_ssb_search(&ssb, buffer, slot_sz + ssb.ssb_sz, &ret.ssb_res) < SRSRAN_SUCCESS) {
+  // Search for SSB, several SSB center frequencies share a single pass over the slot
+  int err;
+  if (ssb_freq_hz.size() > 1) {
+    err = srsran_ssb_search_wideband(
+        &ssb, buffer, slot_sz + ssb.ssb_sz, ssb_freq_hz.data(), (uint32_t)ssb_freq_hz.size(), ssb_res.data());
+  } else {
+    err = srsran_ssb_search(&ssb, buffer, slot_sz + ssb.ssb_sz, &ret.ssb_res);
+  }
+  if (err < SRSRAN_SUCCESS) {
     logger.error("Error occurred searching SSB");
     ret.result = ret_t::ERROR;
-  } else if (ret.ssb_res.measurements.snr_dB >= -10.0f and ret.ssb_res.pbch_msg.crc) {
+    return ret;
+  }
+
+  // Select the first SSB center frequency that decoded, the configured one has priority
+  if (ssb_freq_hz.size() > 1) {
+    uint32_t idx = 0;
+    for (uint32_t i = 0; i < ssb_res.size(); i++) {
+      if (ssb_res[i].measurements.snr_dB >= -10.0f and ssb_res[i].pbch_msg.crc) {
+        idx = i;
+        break;
+      }
+    }
+    ret.ssb_res     = ssb_res[idx];
+    ret.ssb_freq_hz = ssb_freq_hz[idx];
+  }
+
+  if (ret.ssb_res.measurements.snr_dB >= -10.0f and ret.ssb_res.pbch_msg.crc) {
     // Consider the SSB is found and decoded if the PBCH CRC matched
     ret.result = ret_t::CELL_FOUND;
   } else {
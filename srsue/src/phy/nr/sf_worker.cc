@@ -85,6 +85,11 @@ void sf_worker::work_imp()
 {
   srsran::rf_buffer_t tx_buffer = {};
 
+#ifdef ENABLE_GUI
+  // The plot reads the equalized PDSCH symbols of the first carrier, which are not kept by default
+  cc_workers[0]->set_store_pdsch_symbols((int)get_id() == plot_worker_id);
+#endif
+
   // Perform DL processing
   for (auto& w : cc_workers) {
     w->work_dl();
@@ -20,6 +20,7 @@
  */
 #include "srsue/hdr/phy/nr/worker_pool.h"
 #include "srsran/common/band_helper.h"
+#include <algorithm>
 
 namespace srsue {
 namespace nr {
@@ -54,6 +55,19 @@ bool worker_pool::init(const phy_args_nr_t& args, srsran::phy_common_interface&
     return true;
   }
 
+  // The carrier bandwidth is not known until it is configured, plan the OFDM DFTs of every symbol size up to the maximum
+  // number of PRB so that the workers get them from the DFT plan cache
+  std::vector<int> dft_sizes;
+  for (uint32_t nof_prb = 1; nof_prb <= args.max_nof_prb; nof_prb++) {
+    int symbol_sz = (int)srsran_min_symbol_sz_rb(nof_prb);
+    if (symbol_sz > 0 and std::find(dft_sizes.begin(), dft_sizes.end(), symbol_sz) == dft_sizes.end()) {
+      dft_sizes.push_back(symbol_sz);
+    }
+  }
+  if (srsran_dft_plan_prewarm(dft_sizes.data(), dft_sizes.size()) < SRSRAN_SUCCESS) {
+    logger.warning("Error pre-warming the DFT plans");
+  }
+
   // Add workers to workers pool and start threads
   for (uint32_t i = 0; i < args.nof_phy_threads; i++) {
     auto& log = srslog::fetch_basic_logger(fmt::format("{}PHY{}-NR", args.log.id_preamble, i));
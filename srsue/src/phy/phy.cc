@@ -141,6 +141,22 @@ void phy::run_thread()
   prach_buffer.init(SRSRAN_MAX_PRB);
   common.init(&args, radio, stack, &sfsync);
 
+  // The cell is not known yet, plan the OFDM DFTs of every LTE bandwidth so that a cell change gets them from the DFT
+  // plan cache
+  std::vector<int> dft_sizes;
+  for (uint32_t nof_prb : {6, 15, 25, 50, 75, 100}) {
+    dft_sizes.push_back(srsran_symbol_sz(nof_prb));
+  }
+  if (srsran_dft_plan_prewarm(dft_sizes.data(), dft_sizes.size()) < SRSRAN_SUCCESS) {
+    logger_phy.warning("Error pre-warming the DFT plans");
+  }
+
+  // The PUSCH transform precoding plans are shared, create them before the cell is known rather than on the first
+  // transmission
+  if (srsran_dft_precoding_prewarm(SRSRAN_MAX_PRB) < SRSRAN_SUCCESS) {
+    logger_phy.warning("Error pre-warming the transform precoding DFT plans");
+  }
+
   // Initialise workers
   lte_workers.init(&common, WORKERS_THREAD_PRIO);
 
@@ -261,25 +261,34 @@ static cell_search_result_t cell_search(const args_t& args, dummy_ue& ue)
   srsran::srsran_band_helper::sync_raster_t ss = bands.get_sync_raster(band, args.ssb_scs);
   srsran_assert(ss.valid(), "Invalid synchronization raster");
 
-  // Iterate every possible frequency in the synchronization raster
+  // Collect every possible frequency in the synchronization raster within the baseband range
+  std::vector<double> ssb_freq_hz;
   while (not ss.end()) {
     // Get SSB center frequency
-    cs_args.ssb_freq_hz = ss.get_frequency();
+    double freq_hz = ss.get_frequency();
 
     // Advance SSB frequency raster
     ss.next();
 
     // Calculate frequency offset between the base-band center frequency and the SSB absolute frequency
-    uint32_t offset_hz = (uint32_t)std::abs(std::round(cs_args.ssb_freq_hz - args.base_carrier.dl_center_frequency_hz));
+    uint32_t offset_hz = (uint32_t)std::abs(std::round(freq_hz - args.base_carrier.dl_center_frequency_hz));
 
     // The SSB absolute frequency is invalid if it is outside the range and the offset is NOT multiple of the subcarrier
     // spacing
-    if ((cs_args.ssb_freq_hz < ssb_center_freq_min_hz) or (cs_args.ssb_freq_hz > ssb_center_freq_max_hz) or
-        (offset_hz % ssb_scs_hz != 0)) {
+    if ((freq_hz < ssb_center_freq_min_hz) or (freq_hz > ssb_center_freq_max_hz) or (offset_hz % ssb_scs_hz != 0)) {
       // Skip this frequency
       continue;
     }
 
+    ssb_freq_hz.push_back(freq_hz);
+  }
+
+  // Search all the SSB frequencies at once, a single pass covers the whole baseband
+  for (uint32_t i = 0; i < ssb_freq_hz.size(); i += SRSRAN_SSB_MAX_NOF_SEARCH_FREQ) {
+    uint32_t nof_freq = std::min((uint32_t)ssb_freq_hz.size() - i, (uint32_t)SRSRAN_SSB_MAX_NOF_SEARCH_FREQ);
+    cs_args.ssb_freq_hz = ssb_freq_hz[i];
+    cs_args.extra_ssb_freq_hz.assign(ssb_freq_hz.begin() + i + 1, ssb_freq_hz.begin() + i + nof_freq);
+
     // Transition PHY to cell search
     srsran_assert(ue.start_cell_search(cs_args), "Failed cell search start");
 
@@ -296,8 +305,9 @@ static cell_search_result_t cell_search(const args_t& args, dummy_ue& ue)
     }
 
     // Print found cells
-    printf("Cells found at SSB center frequency %.2f MHz:\n", cs_args.ssb_freq_hz / 1e6);
-    printf("| %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s |\n",
+    printf("Cells found:\n");
+    printf("| %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s | %10s |\n",
+           "SSB MHz",
            "PCI",
            "SSB",
            "Count",
@@ -315,9 +325,12 @@ static cell_search_result_t cell_search(const args_t& args, dummy_ue& ue)
     for (auto& pci : metrics.cell_search) {
       // For each found beam...
       for (auto& ssb : pci.second) {
+        double found_ssb_freq_hz = bands.nr_arfcn_to_freq(ssb.second.last_result.ssb_arfcn);
+
         // Print stats
-        printf("| %10d | %10d | %10d | %+10.1f | %+10.1f | %+10.1f | %+10.1f | %+10.1f | %+10.1f | %+10.1f | %+10.1f | "
-               "%+10.1f |\n",
+        printf("| %10.2f | %10d | %10d | %10d | %+10.1f | %+10.1f | %+10.1f | %+10.1f | %+10.1f | %+10.1f | %+10.1f | "
+               "%+10.1f | %+10.1f |\n",
+               found_ssb_freq_hz / 1e6,
                pci.first,
                ssb.first,
                (uint32_t)ssb.second.count,
@@ -334,7 +347,7 @@ static cell_search_result_t cell_search(const args_t& args, dummy_ue& ue)
         // If this is the first found cell, then set return value
         if (not ret.found) {
           ret.found           = true;
-          ret.ssb_abs_freq_hz = cs_args.ssb_freq_hz;
+          ret.ssb_abs_freq_hz = found_ssb_freq_hz;
           ret.ssb_scs         = cs_args.ssb_scs;
           ret.ssb_pattern     = cs_args.ssb_pattern;
           ret.duplex_mode     = cs_args.duplex_mode;